@@ -1120,6 +1120,13 @@ macro(process_options)
     endif()
   endif()
 
+  # The objects shared by the partitions of the MultithreadedSimulatorImpl
+  # (e.g., the reference counts and the free lists of the packets) are made
+  # thread-safe
+  if(${NS3_MTP})
+    add_definitions(-DNS3_MTP)
+  endif()
+
   mark_as_advanced(Boost_INCLUDE_DIR)
   find_package(Boost)
   if(${Boost_FOUND})
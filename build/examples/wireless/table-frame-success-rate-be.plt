@@ -0,0 +1,8436 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "table-frame-success-rate-be.eps"
+set xlabel "SNR(dB)"
+set ylabel "Frame Success Rate"
+set xrange [-5:55]
+set yrange [0:1]
+set style line 1 linewidth 5 linecolor rgb "green" 
+set style line 2 linewidth 5 linecolor rgb "blue" 
+set style line 3 linewidth 5 linecolor rgb "red" 
+set style line 4 linewidth 5 linecolor rgb "black" 
+set style line 5 linewidth 5 linecolor rgb "orange" 
+set style line 6 linewidth 5 linecolor rgb "purple" 
+set style line 7 linewidth 5 linecolor rgb "yellow" 
+set style line 8 linewidth 5 linecolor rgb "pink" 
+set style line 9 linewidth 5 linecolor rgb "grey" 
+set style line 10 linewidth 5 linecolor rgb "magenta" 
+set style line 11 linewidth 5 linecolor rgb "brown" 
+set style line 12 linewidth 5 linecolor rgb "turquoise" 
+set style line 13 linewidth 5 linecolor rgb "olive" 
+set style line 14 linewidth 5 linecolor rgb "beige" 
+set style increment user
+plot "-"  title "EhtMcs0" with lines, "-"  title "EhtMcs1" with lines, "-"  title "EhtMcs2" with lines, "-"  title "EhtMcs3" with lines, "-"  title "EhtMcs4" with lines, "-"  title "EhtMcs5" with lines, "-"  title "EhtMcs6" with lines, "-"  title "EhtMcs7" with lines, "-"  title "EhtMcs8" with lines, "-"  title "EhtMcs9" with lines, "-"  title "EhtMcs10" with lines, "-"  title "EhtMcs11" with lines, "-"  title "EhtMcs12" with lines, "-"  title "EhtMcs13" with lines
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0.00098865
+-0.8 0.00201718
+-0.7 0.00306131
+-0.6 0.00411572
+-0.5 0.00517783
+-0.4 0.0374896
+-0.3 0.0707535
+-0.2 0.104479
+-0.1 0.138517
+-1.02696e-15 0.172793
+0.1 0.276903
+0.2 0.382147
+0.3 0.48822
+0.4 0.594946
+0.5 0.702215
+0.6 0.747994
+0.7 0.793852
+0.8 0.839784
+0.9 0.885787
+1 0.931857
+1.1 0.943174
+1.2 0.954494
+1.3 0.965819
+1.4 0.977147
+1.5 0.988479
+1.6 0.990475
+1.7 0.99247
+1.8 0.994465
+1.9 0.996461
+2 0.998457
+2.1 0.998735
+2.2 0.999012
+2.3 0.99929
+2.4 0.999568
+2.5 0.999846
+2.6 0.999874
+2.7 0.999903
+2.8 0.999932
+2.9 0.999961
+3 0.99999
+3.1 1
+3.2 1
+3.3 1
+3.4 1
+3.5 1
+3.6 1
+3.7 1
+3.8 1
+3.9 1
+4 1
+4.1 1
+4.2 1
+4.3 1
+4.4 1
+4.5 1
+4.6 1
+4.7 1
+4.8 1
+4.9 1
+5 1
+5.1 1
+5.2 1
+5.3 1
+5.4 1
+5.5 1
+5.6 1
+5.7 1
+5.8 1
+5.9 1
+6 1
+6.1 1
+6.2 1
+6.3 1
+6.4 1
+6.5 1
+6.6 1
+6.7 1
+6.8 1
+6.9 1
+7 1
+7.1 1
+7.2 1
+7.3 1
+7.4 1
+7.5 1
+7.6 1
+7.7 1
+7.8 1
+7.9 1
+8 1
+8.1 1
+8.2 1
+8.3 1
+8.4 1
+8.5 1
+8.6 1
+8.7 1
+8.8 1
+8.9 1
+9 1
+9.1 1
+9.2 1
+9.3 1
+9.4 1
+9.5 1
+9.6 1
+9.7 1
+9.8 1
+9.9 1
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0.000484552
+2.2 0.00098865
+2.3 0.0015004
+2.4 0.00201718
+2.5 0.00253773
+2.6 0.0397625
+2.7 0.0782536
+2.8 0.117306
+2.9 0.156732
+3 0.196442
+3.1 0.294067
+3.2 0.392626
+3.3 0.49189
+3.4 0.591722
+3.5 0.69203
+3.6 0.738505
+3.7 0.785063
+3.8 0.831697
+3.9 0.878405
+4 0.925183
+4.1 0.937669
+4.2 0.950159
+4.3 0.962654
+4.4 0.975153
+4.5 0.987656
+4.6 0.989816
+4.7 0.991976
+4.8 0.994136
+4.9 0.996296
+5 0.998457
+5.1 0.998718
+5.2 0.998979
+5.3 0.999241
+5.4 0.999502
+5.5 0.999763
+5.6 0.999811
+5.7 0.999858
+5.8 0.999905
+5.9 0.999953
+6 1
+6.1 1
+6.2 1
+6.3 1
+6.4 1
+6.5 1
+6.6 1
+6.7 1
+6.8 1
+6.9 1
+7 1
+7.1 1
+7.2 1
+7.3 1
+7.4 1
+7.5 1
+7.6 1
+7.7 1
+7.8 1
+7.9 1
+8 1
+8.1 1
+8.2 1
+8.3 1
+8.4 1
+8.5 1
+8.6 1
+8.7 1
+8.8 1
+8.9 1
+9 1
+9.1 1
+9.2 1
+9.3 1
+9.4 1
+9.5 1
+9.6 1
+9.7 1
+9.8 1
+9.9 1
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0.000319284
+4.7 0.000651446
+4.8 0.00098865
+4.9 0.00132917
+5 0.00167218
+5.1 0.0459038
+5.2 0.0917342
+5.3 0.138244
+5.4 0.185206
+5.5 0.232506
+5.6 0.323175
+5.7 0.414572
+5.8 0.506541
+5.9 0.598982
+6 0.691826
+6.1 0.739403
+6.2 0.787065
+6.3 0.834809
+6.4 0.882629
+6.5 0.930522
+6.6 0.9419
+6.7 0.953282
+6.8 0.964668
+6.9 0.976057
+7 0.987451
+7.1 0.989487
+7.2 0.991524
+7.3 0.99356
+7.4 0.995597
+7.5 0.997634
+7.6 0.998035
+7.7 0.998436
+7.8 0.998837
+7.9 0.999239
+8 0.99964
+8.1 0.999704
+8.2 0.999767
+8.3 0.999831
+8.4 0.999895
+8.5 0.999959
+8.6 0.999967
+8.7 0.999975
+8.8 0.999984
+8.9 1
+9 1
+9.1 1
+9.2 1
+9.3 1
+9.4 1
+9.5 1
+9.6 1
+9.7 1
+9.8 1
+9.9 1
+10 1
+10.1 1
+10.2 1
+10.3 1
+10.4 1
+10.5 1
+10.6 1
+10.7 1
+10.8 1
+10.9 1
+11 1
+11.1 1
+11.2 1
+11.3 1
+11.4 1
+11.5 1
+11.6 1
+11.7 1
+11.8 1
+11.9 1
+12 1
+12.1 1
+12.2 1
+12.3 1
+12.4 1
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0.00098865
+7.7 0.00201718
+7.8 0.00306131
+7.9 0.00411572
+8 0.00517783
+8.1 0.0333671
+8.2 0.0623616
+8.3 0.0917535
+8.4 0.121416
+8.5 0.151285
+8.6 0.231104
+8.7 0.311718
+8.8 0.392927
+8.9 0.474612
+9 0.556695
+9.1 0.615925
+9.2 0.675316
+9.3 0.734853
+9.4 0.794527
+9.5 0.854325
+9.6 0.87574
+9.7 0.89717
+9.8 0.918614
+9.9 0.940072
+10 0.961544
+10.1 0.967464
+10.2 0.973384
+10.3 0.979306
+10.4 0.985229
+10.5 0.991153
+10.6 0.992532
+10.7 0.99391
+10.8 0.995288
+10.9 0.996667
+11 0.998045
+11.1 0.998362
+11.2 0.998679
+11.3 0.998996
+11.4 0.999313
+11.5 0.99963
+11.6 0.999693
+11.7 0.999757
+11.8 0.999821
+11.9 0.999885
+12 0.999949
+12.1 0.999959
+12.2 0.999969
+12.3 0.999979
+12.4 0.99999
+12.5 1
+12.6 1
+12.7 1
+12.8 1
+12.9 1
+13 1
+13.1 1
+13.2 1
+13.3 1
+13.4 1
+13.5 1
+13.6 1
+13.7 1
+13.8 1
+13.9 1
+14 1
+14.1 1
+14.2 1
+14.3 1
+14.4 1
+14.5 1
+14.6 1
+14.7 1
+14.8 1
+14.9 1
+15 1
+15.1 1
+15.2 1
+15.3 1
+15.4 1
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0.0129445
+11.2 0.0264112
+11.3 0.0400822
+11.4 0.0538876
+11.5 0.0677939
+11.6 0.147578
+11.7 0.228655
+11.8 0.310563
+11.9 0.393088
+12 0.476103
+12.1 0.542996
+12.2 0.61012
+12.3 0.677453
+12.4 0.744974
+12.5 0.812666
+12.6 0.840521
+12.7 0.868402
+12.8 0.896308
+12.9 0.924239
+13 0.952193
+13.1 0.959488
+13.2 0.966785
+13.3 0.974084
+13.4 0.981383
+13.5 0.988685
+13.6 0.990413
+13.7 0.992141
+13.8 0.993869
+13.9 0.995597
+14 0.997325
+14.1 0.997776
+14.2 0.998226
+14.3 0.998677
+14.4 0.999128
+14.5 0.999578
+14.6 0.999642
+14.7 0.999706
+14.8 0.99977
+14.9 0.999833
+15 0.999897
+15.1 0.999918
+15.2 0.999938
+15.3 0.999959
+15.4 0.999979
+15.5 1
+15.6 1
+15.7 1
+15.8 1
+15.9 1
+16 1
+16.1 1
+16.2 1
+16.3 1
+16.4 1
+16.5 1
+16.6 1
+16.7 1
+16.8 1
+16.9 1
+17 1
+17.1 1
+17.2 1
+17.3 1
+17.4 1
+17.5 1
+17.6 1
+17.7 1
+17.8 1
+17.9 1
+18 1
+18.1 1
+18.2 1
+18.3 1
+18.4 1
+18.5 1
+18.6 1
+18.7 1
+18.8 1
+18.9 1
+19 1
+19.1 1
+19.2 1
+19.3 1
+19.4 1
+19.5 1
+19.6 1
+19.7 1
+19.8 1
+19.9 1
+20 1
+20.1 1
+20.2 1
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0.000156486
+14.7 0.000319284
+14.8 0.000484552
+14.9 0.000651446
+15 0.000819559
+15.1 0.0098587
+15.2 0.0191935
+15.3 0.0286626
+15.4 0.0382218
+15.5 0.0478491
+15.6 0.102432
+15.7 0.157885
+15.8 0.213901
+15.9 0.270335
+16 0.327103
+16.1 0.400045
+16.2 0.473363
+16.3 0.547001
+16.4 0.620919
+16.5 0.695085
+16.6 0.734221
+16.7 0.773416
+16.8 0.812666
+16.9 0.85197
+17 0.891324
+17.1 0.906177
+17.2 0.921036
+17.3 0.935902
+17.4 0.950775
+17.5 0.965655
+17.6 0.97065
+17.7 0.975646
+17.8 0.980643
+17.9 0.985641
+18 0.990639
+18.1 0.992038
+18.2 0.993437
+18.3 0.994836
+18.4 0.996235
+18.5 0.997634
+18.6 0.997975
+18.7 0.998317
+18.8 0.998658
+18.9 0.999
+19 0.999342
+19.1 0.999438
+19.2 0.999535
+19.3 0.999632
+19.4 0.999728
+19.5 0.999825
+19.6 0.999856
+19.7 0.999887
+19.8 0.999918
+19.9 0.999949
+20 0.999979
+20.1 0.999984
+20.2 0.999988
+20.3 1
+20.4 1
+20.5 1
+20.6 1
+20.7 1
+20.8 1
+20.9 1
+21 1
+21.1 1
+21.2 1
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0.000819559
+16.2 0.00167218
+16.3 0.00253773
+16.4 0.0034118
+16.5 0.00429225
+16.6 0.0253338
+16.7 0.0469612
+16.8 0.0688819
+16.9 0.091003
+17 0.113277
+17.1 0.184597
+17.2 0.256717
+17.3 0.329417
+17.4 0.402572
+17.5 0.476103
+17.6 0.537636
+17.7 0.599368
+17.8 0.661278
+17.9 0.723351
+18 0.785573
+18.1 0.815264
+18.2 0.844985
+18.3 0.874736
+18.4 0.904515
+18.5 0.934321
+18.6 0.943626
+18.7 0.952933
+18.8 0.962242
+18.9 0.971555
+19 0.980869
+19.1 0.983749
+19.2 0.986628
+19.3 0.989508
+19.4 0.992388
+19.5 0.995268
+19.6 0.995947
+19.7 0.996626
+19.8 0.997305
+19.9 0.997984
+20 0.998663
+20.1 0.998883
+20.2 0.999103
+20.3 0.999323
+20.4 0.999543
+20.5 0.999763
+20.6 0.999807
+20.7 0.99985
+20.8 0.999893
+20.9 0.999936
+21 0.999979
+21.1 0.999984
+21.2 0.999988
+21.3 1
+21.4 1
+21.5 1
+21.6 1
+21.7 1
+21.8 1
+21.9 1
+22 1
+22.1 1
+22.2 1
+22.3 1
+22.4 1
+22.5 1
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0.00367533
+17.7 0.00749891
+17.8 0.0113805
+17.9 0.0153003
+18 0.0192487
+18.1 0.0642091
+18.2 0.110162
+18.3 0.156674
+18.4 0.203582
+18.5 0.250797
+18.6 0.330654
+18.7 0.411059
+18.8 0.491911
+18.9 0.573137
+19 0.654689
+19.1 0.698263
+19.2 0.741913
+19.3 0.785635
+19.4 0.829425
+19.5 0.873281
+19.6 0.891304
+19.7 0.909337
+19.8 0.92738
+19.9 0.945433
+20 0.963496
+20.1 0.968738
+20.2 0.973981
+20.3 0.979224
+20.4 0.984468
+20.5 0.989713
+20.6 0.991215
+20.7 0.992717
+20.8 0.994219
+20.9 0.99572
+21 0.997222
+21.1 0.997675
+21.2 0.998128
+21.3 0.99858
+21.4 0.999033
+21.5 0.999486
+21.6 0.99957
+21.7 0.999654
+21.8 0.999739
+21.9 0.999823
+22 0.999907
+22.1 0.999924
+22.2 0.99994
+22.3 0.999957
+22.4 0.999973
+22.5 0.99999
+22.6 1
+22.7 1
+22.8 1
+22.9 1
+23 1
+23.1 1
+23.2 1
+23.3 1
+23.4 1
+23.5 1
+23.6 1
+23.7 1
+23.8 1
+23.9 1
+24 1
+24.1 1
+24.2 1
+24.3 1
+24.4 1
+24.5 1
+24.6 1
+24.7 1
+24.8 1
+24.9 1
+25 1
+25.1 1
+25.2 1
+25.3 1
+25.4 1
+25.5 1
+25.6 1
+25.7 1
+25.8 1
+25.9 1
+26 1
+26.1 1
+26.2 1
+26.3 1
+26.4 1
+26.5 1
+26.6 1
+26.7 1
+26.8 1
+26.9 1
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0.000319284
+21.2 0.000651446
+21.3 0.00098865
+21.4 0.00132917
+21.5 0.00167218
+21.6 0.0120345
+21.7 0.0227017
+21.8 0.0335168
+21.9 0.0444322
+22 0.055424
+22.1 0.106991
+22.2 0.159292
+22.3 0.212088
+22.4 0.265258
+22.5 0.318731
+22.6 0.382347
+22.7 0.446263
+22.8 0.510438
+22.9 0.574839
+23 0.639444
+23.1 0.683152
+23.2 0.72694
+23.3 0.770801
+23.4 0.814732
+23.5 0.85873
+23.6 0.877196
+23.7 0.895673
+23.8 0.91416
+23.9 0.932658
+24 0.951166
+24.1 0.957762
+24.2 0.96436
+24.3 0.970958
+24.4 0.977559
+24.5 0.98416
+24.6 0.986258
+24.7 0.988356
+24.8 0.990454
+24.9 0.992552
+25 0.994651
+25.1 0.995412
+25.2 0.996173
+25.3 0.996934
+25.4 0.997696
+25.5 0.998457
+25.6 0.998691
+25.7 0.998926
+25.8 0.999161
+25.9 0.999395
+26 0.99963
+26.1 0.999689
+26.2 0.999749
+26.3 0.999809
+26.4 0.999868
+26.5 0.999928
+26.6 0.999942
+26.7 0.999957
+26.8 0.999971
+26.9 0.999986
+27 1
+27.1 1
+27.2 1
+27.3 1
+27.4 1
+27.5 1
+27.6 1
+27.7 1
+27.8 1
+27.9 1
+28 1
+28.1 1
+28.2 1
+28.3 1
+28.4 1
+28.5 1
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0
+21.2 0
+21.3 0
+21.4 0
+21.5 0
+21.6 0
+21.7 0
+21.8 0
+21.9 0
+22 0
+22.1 0
+22.2 0
+22.3 0
+22.4 0
+22.5 0
+22.6 0.000156486
+22.7 0.000319284
+22.8 0.000484552
+22.9 0.000651446
+23 0.000819559
+23.1 0.0093709
+23.2 0.0181995
+23.3 0.0271549
+23.4 0.0361952
+23.5 0.0452999
+23.6 0.0960671
+23.7 0.147636
+23.8 0.199726
+23.9 0.252202
+24 0.304989
+24.1 0.37658
+24.2 0.448557
+24.3 0.52086
+24.4 0.593446
+24.5 0.666282
+24.6 0.707268
+24.7 0.748321
+24.8 0.789436
+24.9 0.830612
+25 0.871846
+25.1 0.889048
+25.2 0.906259
+25.3 0.923479
+25.4 0.940709
+25.5 0.957947
+25.6 0.963681
+25.7 0.969417
+25.8 0.975153
+25.9 0.98089
+26 0.986628
+26.1 0.988562
+26.2 0.990495
+26.3 0.992429
+26.4 0.994363
+26.5 0.996296
+26.6 0.996868
+26.7 0.99744
+26.8 0.998012
+26.9 0.998584
+27 0.999156
+27.1 0.999305
+27.2 0.999453
+27.3 0.999601
+27.4 0.999749
+27.5 0.999897
+27.6 0.999914
+27.7 0.99993
+27.8 0.999947
+27.9 0.999963
+28 0.999979
+28.1 0.999981
+28.2 0.999984
+28.3 0.999986
+28.4 0.999988
+28.5 0.99999
+28.6 1
+28.7 1
+28.8 1
+28.9 1
+29 1
+29.1 1
+29.2 1
+29.3 1
+29.4 1
+29.5 1
+29.6 1
+29.7 1
+29.8 1
+29.9 1
+30 1
+30.1 1
+30.2 1
+30.3 1
+30.4 1
+30.5 1
+30.6 1
+30.7 1
+30.8 1
+30.9 1
+31 1
+31.1 1
+31.2 1
+31.3 1
+31.4 1
+31.5 1
+31.6 1
+31.7 1
+31.8 1
+31.9 1
+32 1
+32.1 1
+32.2 1
+32.3 1
+32.4 1
+32.5 1
+32.6 1
+32.7 1
+32.8 1
+32.9 1
+33 1
+33.1 1
+33.2 1
+33.3 1
+33.4 1
+33.5 1
+33.6 1
+33.7 1
+33.8 1
+33.9 1
+34 1
+34.1 1
+34.2 1
+34.3 1
+34.4 1
+34.5 1
+34.6 1
+34.7 1
+34.8 1
+34.9 1
+35 1
+35.1 1
+35.2 1
+35.3 1
+35.4 1
+35.5 1
+35.6 1
+35.7 1
+35.8 1
+35.9 1
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0
+21.2 0
+21.3 0
+21.4 0
+21.5 0
+21.6 0
+21.7 0
+21.8 0
+21.9 0
+22 0
+22.1 0
+22.2 0
+22.3 0
+22.4 0
+22.5 0
+22.6 0
+22.7 0
+22.8 0
+22.9 0
+23 0
+23.1 0
+23.2 0
+23.3 0
+23.4 0
+23.5 0
+23.6 0
+23.7 0
+23.8 0
+23.9 0
+24 0
+24.1 0
+24.2 0
+24.3 1.85644e-317
+24.4 5.48773e-305
+24.5 9.39425e-293
+24.6 9.18977e-281
+24.7 5.07263e-269
+24.8 1.56125e-257
+24.9 2.64958e-246
+25 2.45385e-235
+25.1 1.22842e-224
+25.2 3.2954e-214
+25.3 4.70067e-204
+25.4 3.54102e-194
+25.5 1.40042e-184
+25.6 2.8934e-175
+25.7 3.1109e-166
+25.8 1.73551e-157
+25.9 5.0145e-149
+26 7.49773e-141
+26.1 5.80282e-133
+26.2 2.32766e-125
+26.3 4.85063e-118
+26.4 5.26938e-111
+26.5 2.99742e-104
+26.6 8.97757e-98
+26.7 1.42506e-91
+26.8 1.20795e-85
+26.9 5.51458e-80
+27 1.36881e-74
+27.1 1.86662e-69
+27.2 1.41435e-64
+27.3 6.02715e-60
+27.4 1.46332e-55
+27.5 2.052e-51
+27.6 1.68603e-47
+27.7 8.24e-44
+27.8 2.43295e-40
+27.9 4.41043e-37
+28 4.99076e-34
+28.1 3.58554e-31
+28.2 1.664e-28
+28.3 5.07663e-26
+28.4 1.03639e-23
+28.5 1.44125e-21
+28.6 1.38995e-19
+28.7 9.46374e-18
+28.8 4.63082e-16
+28.9 1.65747e-14
+29 4.41571e-13
+29.1 8.90785e-12
+29.2 1.38382e-10
+29.3 1.68294e-09
+29.4 1.62821e-08
+29.5 1.27281e-07
+29.6 8.16155e-07
+29.7 4.35555e-06
+29.8 1.9617e-05
+29.9 7.55682e-05
+30 0.000252169
+30.1 0.000737807
+30.2 0.00191456
+30.3 0.0044541
+30.4 0.00938486
+30.5 0.0180801
+30.6 0.0321313
+30.7 0.0531115
+30.8 0.0822801
+30.9 0.120309
+31 0.167111
+31.1 0.221807
+31.2 0.282843
+31.3 0.348205
+31.4 0.415675
+31.5 0.483086
+31.6 0.548513
+31.7 0.610399
+31.8 0.667612
+31.9 0.719441
+32 0.76555
+32.1 0.805912
+32.2 0.840736
+32.3 0.870393
+32.4 0.895353
+32.5 0.916137
+32.6 0.933273
+32.7 0.947274
+32.8 0.958616
+32.9 0.967731
+33 0.975
+33.1 0.980755
+33.2 0.985279
+33.3 0.988811
+33.4 0.99155
+33.5 0.993659
+33.6 0.995272
+33.7 0.996498
+33.8 0.997424
+33.9 0.998117
+34 0.998634
+34.1 0.999015
+34.2 0.999295
+34.3 0.999499
+34.4 0.999647
+34.5 0.999753
+34.6 0.999829
+34.7 0.999882
+34.8 0.999919
+34.9 0.999945
+35 0.999963
+35.1 0.999976
+35.2 0.999984
+35.3 0.999989
+35.4 0.999993
+35.5 0.999996
+35.6 0.999997
+35.7 0.999998
+35.8 0.999999
+35.9 0.999999
+36 1
+36.1 1
+36.2 1
+36.3 1
+36.4 1
+36.5 1
+36.6 1
+36.7 1
+36.8 1
+36.9 1
+37 1
+37.1 1
+37.2 1
+37.3 1
+37.4 1
+37.5 1
+37.6 1
+37.7 1
+37.8 1
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0
+21.2 0
+21.3 0
+21.4 0
+21.5 0
+21.6 0
+21.7 0
+21.8 0
+21.9 0
+22 0
+22.1 0
+22.2 0
+22.3 0
+22.4 0
+22.5 0
+22.6 0
+22.7 0
+22.8 0
+22.9 0
+23 0
+23.1 0
+23.2 0
+23.3 0
+23.4 0
+23.5 0
+23.6 0
+23.7 0
+23.8 0
+23.9 0
+24 0
+24.1 0
+24.2 0
+24.3 0
+24.4 0
+24.5 0
+24.6 0
+24.7 0
+24.8 0
+24.9 0
+25 0
+25.1 0
+25.2 0
+25.3 0
+25.4 0
+25.5 0
+25.6 0
+25.7 0
+25.8 0
+25.9 0
+26 0
+26.1 0
+26.2 0
+26.3 0
+26.4 0
+26.5 0
+26.6 0
+26.7 0
+26.8 0
+26.9 0
+27 0
+27.1 0
+27.2 0
+27.3 2.96439e-323
+27.4 4.72707e-304
+27.5 1.16193e-285
+27.6 4.4181e-268
+27.7 2.70123e-251
+27.8 2.76418e-235
+27.9 4.93428e-220
+28 1.60342e-205
+28.1 9.90927e-192
+28.2 1.21802e-178
+28.3 3.11707e-166
+28.4 1.7399e-154
+28.5 2.2208e-143
+28.6 6.79949e-133
+28.7 5.24096e-123
+28.8 1.0677e-113
+28.9 6.03711e-105
+29 9.95042e-97
+29.1 5.02077e-89
+29.2 8.14413e-82
+29.3 4.45849e-75
+29.4 8.64502e-69
+29.5 6.22783e-63
+29.6 1.74745e-57
+29.7 2.00068e-52
+29.8 9.78395e-48
+29.9 2.13745e-43
+30 2.17962e-39
+30.1 1.08284e-35
+30.2 2.7325e-32
+30.3 3.64714e-29
+30.4 2.67785e-26
+30.5 1.12341e-23
+30.6 2.79311e-21
+30.7 4.26306e-19
+30.8 4.13144e-17
+30.9 2.62581e-15
+31 1.12879e-13
+31.1 3.37996e-12
+31.2 7.24925e-11
+31.3 1.14354e-09
+31.4 1.36037e-08
+31.5 1.24955e-07
+31.6 9.061e-07
+31.7 5.29624e-06
+31.8 2.54439e-05
+31.9 0.000102309
+32 0.000350186
+32.1 0.00103646
+32.2 0.00269139
+32.3 0.00621427
+32.4 0.0129164
+32.5 0.0244422
+32.6 0.0425476
+32.7 0.0687764
+32.8 0.104124
+32.9 0.148794
+33 0.202106
+33.1 0.262589
+33.2 0.328195
+33.3 0.396589
+33.4 0.465436
+33.5 0.532628
+33.6 0.596441
+33.7 0.655602
+33.8 0.709296
+33.9 0.757119
+34 0.799007
+34.1 0.835154
+34.2 0.865932
+34.3 0.891827
+34.4 0.913377
+34.5 0.931132
+34.6 0.945628
+34.7 0.957361
+34.8 0.966783
+34.9 0.97429
+35 0.980227
+35.1 0.984891
+35.2 0.988528
+35.3 0.991346
+35.4 0.993513
+35.5 0.99517
+35.6 0.996427
+35.7 0.997375
+35.8 0.998084
+35.9 0.998612
+36 0.999001
+36.1 0.999287
+36.2 0.999494
+36.3 0.999644
+36.4 0.999752
+36.5 0.999828
+36.6 0.999882
+36.7 0.999919
+36.8 0.999946
+36.9 0.999964
+37 0.999976
+37.1 0.999984
+37.2 0.99999
+37.3 0.999993
+37.4 0.999996
+37.5 0.999997
+37.6 0.999998
+37.7 0.999999
+37.8 0.999999
+37.9 1
+38 1
+38.1 1
+38.2 1
+38.3 1
+38.4 1
+38.5 1
+38.6 1
+38.7 1
+38.8 1
+38.9 1
+39 1
+39.1 1
+39.2 1
+39.3 1
+39.4 1
+39.5 1
+39.6 1
+39.7 1
+39.8 1
+39.9 1
+40 1
+40.1 1
+40.2 1
+40.3 1
+40.4 1
+40.5 1
+40.6 1
+40.7 1
+40.8 1
+40.9 1
+41 1
+41.1 1
+41.2 1
+41.3 1
+41.4 1
+41.5 1
+41.6 1
+41.7 1
+41.8 1
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0
+21.2 0
+21.3 0
+21.4 0
+21.5 0
+21.6 0
+21.7 0
+21.8 0
+21.9 0
+22 0
+22.1 0
+22.2 0
+22.3 0
+22.4 0
+22.5 0
+22.6 0
+22.7 0
+22.8 0
+22.9 0
+23 0
+23.1 0
+23.2 0
+23.3 0
+23.4 0
+23.5 0
+23.6 0
+23.7 0
+23.8 0
+23.9 0
+24 0
+24.1 0
+24.2 0
+24.3 0
+24.4 0
+24.5 0
+24.6 0
+24.7 0
+24.8 0
+24.9 0
+25 0
+25.1 0
+25.2 0
+25.3 0
+25.4 0
+25.5 0
+25.6 0
+25.7 0
+25.8 0
+25.9 0
+26 0
+26.1 0
+26.2 0
+26.3 0
+26.4 0
+26.5 0
+26.6 0
+26.7 0
+26.8 0
+26.9 0
+27 0
+27.1 0
+27.2 0
+27.3 0
+27.4 0
+27.5 0
+27.6 0
+27.7 0
+27.8 0
+27.9 0
+28 0
+28.1 0
+28.2 0
+28.3 0
+28.4 0
+28.5 0
+28.6 0
+28.7 0
+28.8 6.16472e-318
+28.9 4.81821e-309
+29 3.2717e-300
+29.1 1.90749e-291
+29.2 9.43705e-283
+29.3 3.91553e-274
+29.4 1.3466e-265
+29.5 3.79431e-257
+29.6 8.65879e-249
+29.7 1.58218e-240
+29.8 2.28894e-232
+29.9 2.59285e-224
+30 2.27486e-216
+30.1 1.52945e-208
+30.2 7.79836e-201
+30.3 2.98513e-193
+30.4 8.4949e-186
+30.5 1.78024e-178
+30.6 2.72253e-171
+30.7 3.01207e-164
+30.8 2.3909e-157
+30.9 1.35103e-150
+31 5.39483e-144
+31.1 1.51192e-137
+31.2 2.95508e-131
+31.3 4.00485e-125
+31.4 3.74384e-119
+31.5 2.40299e-113
+31.6 1.05474e-107
+31.7 3.15511e-102
+31.8 6.41453e-97
+31.9 8.84454e-92
+32 8.25873e-87
+32.1 5.21839e-82
+32.2 2.23096e-77
+32.3 6.45689e-73
+32.4 1.26668e-68
+32.5 1.68751e-64
+32.6 1.53067e-60
+32.7 9.48374e-57
+32.8 4.02924e-53
+32.9 1.17916e-49
+33 2.38926e-46
+33.1 3.37117e-43
+33.2 3.33324e-40
+33.3 2.32542e-37
+33.4 1.15316e-34
+33.5 4.0969e-32
+33.6 1.05152e-29
+33.7 1.9669e-27
+33.8 2.70599e-25
+33.9 2.76424e-23
+34 2.11736e-21
+34.1 1.22846e-19
+34.2 5.45446e-18
+34.3 1.87296e-16
+34.4 5.02702e-15
+34.5 1.06601e-13
+34.6 1.80536e-12
+34.7 2.46839e-11
+34.8 2.75416e-10
+34.9 2.53477e-09
+35 1.94474e-08
+35.1 1.25689e-07
+35.2 6.91362e-07
+35.3 3.26925e-06
+35.4 1.3421e-05
+35.5 4.82895e-05
+35.6 0.000153696
+35.7 0.000436594
+35.8 0.0011164
+35.9 0.00259093
+36 0.00550026
+36.1 0.0107606
+36.2 0.0195384
+36.3 0.0331458
+36.4 0.0528666
+36.5 0.0797443
+36.6 0.114384
+36.7 0.156818
+36.8 0.206463
+36.9 0.262179
+37 0.322409
+37.1 0.385353
+37.2 0.449168
+37.3 0.512123
+37.4 0.572727
+37.5 0.6298
+37.6 0.682497
+37.7 0.730298
+37.8 0.772972
+37.9 0.810525
+38 0.843143
+38.1 0.871141
+38.2 0.894915
+38.3 0.914902
+38.4 0.931552
+38.5 0.945304
+38.6 0.956571
+38.7 0.965732
+38.8 0.973127
+38.9 0.979055
+39 0.983773
+39.1 0.987505
+39.2 0.990437
+39.3 0.992726
+39.4 0.994501
+39.5 0.995869
+39.6 0.996917
+39.7 0.997713
+39.8 0.998315
+39.9 0.998767
+40 0.999104
+40.1 0.999353
+40.2 0.999536
+40.3 0.99967
+40.4 0.999767
+40.5 0.999837
+40.6 0.999886
+40.7 0.999922
+40.8 0.999946
+40.9 0.999964
+41 0.999975
+41.1 0.999984
+41.2 0.999989
+41.3 0.999993
+41.4 0.999995
+41.5 0.999997
+41.6 0.999998
+41.7 0.999999
+41.8 0.999999
+41.9 1
+42 1
+42.1 1
+42.2 1
+42.3 1
+42.4 1
+42.5 1
+42.6 1
+42.7 1
+42.8 1
+42.9 1
+43 1
+43.1 1
+43.2 1
+43.3 1
+43.4 1
+43.5 1
+43.6 1
+43.7 1
+43.8 1
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
+-5 0
+-4.9 0
+-4.8 0
+-4.7 0
+-4.6 0
+-4.5 0
+-4.4 0
+-4.3 0
+-4.2 0
+-4.1 0
+-4 0
+-3.9 0
+-3.8 0
+-3.7 0
+-3.6 0
+-3.5 0
+-3.4 0
+-3.3 0
+-3.2 0
+-3.1 0
+-3 0
+-2.9 0
+-2.8 0
+-2.7 0
+-2.6 0
+-2.5 0
+-2.4 0
+-2.3 0
+-2.2 0
+-2.1 0
+-2 0
+-1.9 0
+-1.8 0
+-1.7 0
+-1.6 0
+-1.5 0
+-1.4 0
+-1.3 0
+-1.2 0
+-1.1 0
+-1 0
+-0.9 0
+-0.8 0
+-0.7 0
+-0.6 0
+-0.5 0
+-0.4 0
+-0.3 0
+-0.2 0
+-0.1 0
+-1.02696e-15 0
+0.1 0
+0.2 0
+0.3 0
+0.4 0
+0.5 0
+0.6 0
+0.7 0
+0.8 0
+0.9 0
+1 0
+1.1 0
+1.2 0
+1.3 0
+1.4 0
+1.5 0
+1.6 0
+1.7 0
+1.8 0
+1.9 0
+2 0
+2.1 0
+2.2 0
+2.3 0
+2.4 0
+2.5 0
+2.6 0
+2.7 0
+2.8 0
+2.9 0
+3 0
+3.1 0
+3.2 0
+3.3 0
+3.4 0
+3.5 0
+3.6 0
+3.7 0
+3.8 0
+3.9 0
+4 0
+4.1 0
+4.2 0
+4.3 0
+4.4 0
+4.5 0
+4.6 0
+4.7 0
+4.8 0
+4.9 0
+5 0
+5.1 0
+5.2 0
+5.3 0
+5.4 0
+5.5 0
+5.6 0
+5.7 0
+5.8 0
+5.9 0
+6 0
+6.1 0
+6.2 0
+6.3 0
+6.4 0
+6.5 0
+6.6 0
+6.7 0
+6.8 0
+6.9 0
+7 0
+7.1 0
+7.2 0
+7.3 0
+7.4 0
+7.5 0
+7.6 0
+7.7 0
+7.8 0
+7.9 0
+8 0
+8.1 0
+8.2 0
+8.3 0
+8.4 0
+8.5 0
+8.6 0
+8.7 0
+8.8 0
+8.9 0
+9 0
+9.1 0
+9.2 0
+9.3 0
+9.4 0
+9.5 0
+9.6 0
+9.7 0
+9.8 0
+9.9 0
+10 0
+10.1 0
+10.2 0
+10.3 0
+10.4 0
+10.5 0
+10.6 0
+10.7 0
+10.8 0
+10.9 0
+11 0
+11.1 0
+11.2 0
+11.3 0
+11.4 0
+11.5 0
+11.6 0
+11.7 0
+11.8 0
+11.9 0
+12 0
+12.1 0
+12.2 0
+12.3 0
+12.4 0
+12.5 0
+12.6 0
+12.7 0
+12.8 0
+12.9 0
+13 0
+13.1 0
+13.2 0
+13.3 0
+13.4 0
+13.5 0
+13.6 0
+13.7 0
+13.8 0
+13.9 0
+14 0
+14.1 0
+14.2 0
+14.3 0
+14.4 0
+14.5 0
+14.6 0
+14.7 0
+14.8 0
+14.9 0
+15 0
+15.1 0
+15.2 0
+15.3 0
+15.4 0
+15.5 0
+15.6 0
+15.7 0
+15.8 0
+15.9 0
+16 0
+16.1 0
+16.2 0
+16.3 0
+16.4 0
+16.5 0
+16.6 0
+16.7 0
+16.8 0
+16.9 0
+17 0
+17.1 0
+17.2 0
+17.3 0
+17.4 0
+17.5 0
+17.6 0
+17.7 0
+17.8 0
+17.9 0
+18 0
+18.1 0
+18.2 0
+18.3 0
+18.4 0
+18.5 0
+18.6 0
+18.7 0
+18.8 0
+18.9 0
+19 0
+19.1 0
+19.2 0
+19.3 0
+19.4 0
+19.5 0
+19.6 0
+19.7 0
+19.8 0
+19.9 0
+20 0
+20.1 0
+20.2 0
+20.3 0
+20.4 0
+20.5 0
+20.6 0
+20.7 0
+20.8 0
+20.9 0
+21 0
+21.1 0
+21.2 0
+21.3 0
+21.4 0
+21.5 0
+21.6 0
+21.7 0
+21.8 0
+21.9 0
+22 0
+22.1 0
+22.2 0
+22.3 0
+22.4 0
+22.5 0
+22.6 0
+22.7 0
+22.8 0
+22.9 0
+23 0
+23.1 0
+23.2 0
+23.3 0
+23.4 0
+23.5 0
+23.6 0
+23.7 0
+23.8 0
+23.9 0
+24 0
+24.1 0
+24.2 0
+24.3 0
+24.4 0
+24.5 0
+24.6 0
+24.7 0
+24.8 0
+24.9 0
+25 0
+25.1 0
+25.2 0
+25.3 0
+25.4 0
+25.5 0
+25.6 0
+25.7 0
+25.8 0
+25.9 0
+26 0
+26.1 0
+26.2 0
+26.3 0
+26.4 0
+26.5 0
+26.6 0
+26.7 0
+26.8 0
+26.9 0
+27 0
+27.1 0
+27.2 0
+27.3 0
+27.4 0
+27.5 0
+27.6 0
+27.7 0
+27.8 0
+27.9 0
+28 0
+28.1 0
+28.2 0
+28.3 0
+28.4 0
+28.5 0
+28.6 0
+28.7 0
+28.8 0
+28.9 0
+29 0
+29.1 0
+29.2 0
+29.3 0
+29.4 0
+29.5 0
+29.6 0
+29.7 0
+29.8 0
+29.9 0
+30 0
+30.1 0
+30.2 0
+30.3 0
+30.4 0
+30.5 0
+30.6 0
+30.7 0
+30.8 0
+30.9 0
+31 0
+31.1 0
+31.2 0
+31.3 0
+31.4 0
+31.5 0
+31.6 0
+31.7 0
+31.8 0
+31.9 0
+32 0
+32.1 0
+32.2 0
+32.3 0
+32.4 0
+32.5 0
+32.6 0
+32.7 2.7836e-309
+32.8 2.93613e-293
+32.9 8.67724e-278
+33 7.24978e-263
+33.1 1.73048e-248
+33.2 1.19436e-234
+33.3 2.41598e-221
+33.4 1.45393e-208
+33.5 2.64606e-196
+33.6 1.48243e-184
+33.7 2.60582e-173
+33.8 1.46672e-162
+33.9 2.70111e-152
+34 1.66488e-142
+34.1 3.51719e-133
+34.2 2.61061e-124
+34.3 6.98534e-116
+34.4 6.91947e-108
+34.5 2.60778e-100
+34.6 3.84552e-93
+34.7 2.28329e-86
+34.8 5.62019e-80
+34.9 5.90701e-74
+35 2.73153e-68
+35.1 5.72755e-63
+35.2 5.61338e-58
+35.3 2.6508e-53
+35.4 6.2176e-49
+35.5 7.46643e-45
+35.6 4.73065e-41
+35.7 1.62932e-37
+35.8 3.14179e-34
+35.9 3.49195e-31
+36 2.30197e-28
+36.1 9.25669e-26
+36.2 2.33375e-23
+36.3 3.78902e-21
+36.4 4.06624e-19
+36.5 2.95829e-17
+36.6 1.49524e-15
+36.7 5.37627e-14
+36.8 1.40687e-12
+36.9 2.73866e-11
+37 4.05002e-10
+37.1 4.64223e-09
+37.2 4.20396e-08
+37.3 3.06308e-07
+37.4 1.82693e-06
+37.5 9.06664e-06
+37.6 3.80209e-05
+37.7 0.000136694
+37.8 0.000427106
+37.9 0.00117466
+38 0.0028777
+38.1 0.00634941
+38.2 0.0127478
+38.3 0.0235113
+38.4 0.0401847
+38.5 0.0641633
+38.6 0.096419
+38.7 0.137284
+38.8 0.186351
+38.9 0.242506
+39 0.304082
+39.1 0.369074
+39.2 0.435384
+39.3 0.50103
+39.4 0.564299
+39.5 0.623842
+39.6 0.678704
+39.7 0.728309
+39.8 0.772411
+39.9 0.811036
+40 0.844409
+40.1 0.872893
+40.2 0.896938
+40.3 0.917029
+40.4 0.933662
+40.5 0.947312
+40.6 0.958424
+40.7 0.967401
+40.8 0.974599
+40.9 0.98033
+41 0.984862
+41.1 0.988423
+41.2 0.991201
+41.3 0.993354
+41.4 0.995012
+41.5 0.996281
+41.6 0.997245
+41.7 0.997973
+41.8 0.998518
+41.9 0.998925
+42 0.999225
+42.1 0.999446
+42.2 0.999606
+42.3 0.999722
+42.4 0.999806
+42.5 0.999865
+42.6 0.999907
+42.7 0.999937
+42.8 0.999957
+42.9 0.999971
+43 0.999981
+43.1 0.999987
+43.2 0.999992
+43.3 0.999995
+43.4 0.999997
+43.5 0.999998
+43.6 0.999999
+43.7 0.999999
+43.8 0.999999
+43.9 1
+44 1
+44.1 1
+44.2 1
+44.3 1
+44.4 1
+44.5 1
+44.6 1
+44.7 1
+44.8 1
+44.9 1
+45 1
+45.1 1
+45.2 1
+45.3 1
+45.4 1
+45.5 1
+45.6 1
+45.7 1
+45.8 1
+45.9 1
+46 1
+46.1 1
+46.2 1
+46.3 1
+46.4 1
+46.5 1
+46.6 1
+46.7 1
+46.8 1
+46.9 1
+47 1
+47.1 1
+47.2 1
+47.3 1
+47.4 1
+47.5 1
+47.6 1
+47.7 1
+47.8 1
+47.9 1
+48 1
+48.1 1
+48.2 1
+48.3 1
+48.4 1
+48.5 1
+48.6 1
+48.7 1
+48.8 1
+48.9 1
+49 1
+49.1 1
+49.2 1
+49.3 1
+49.4 1
+49.5 1
+49.6 1
+49.7 1
+49.8 1
+49.9 1
+50 1
+50.1 1
+50.2 1
+50.3 1
+50.4 1
+50.5 1
+50.6 1
+50.7 1
+50.8 1
+50.9 1
+51 1
+51.1 1
+51.2 1
+51.3 1
+51.4 1
+51.5 1
+51.6 1
+51.7 1
+51.8 1
+51.9 1
+52 1
+52.1 1
+52.2 1
+52.3 1
+52.4 1
+52.5 1
+52.6 1
+52.7 1
+52.8 1
+52.9 1
+53 1
+53.1 1
+53.2 1
+53.3 1
+53.4 1
+53.5 1
+53.6 1
+53.7 1
+53.8 1
+53.9 1
+54 1
+54.1 1
+54.2 1
+54.3 1
+54.4 1
+54.5 1
+54.6 1
+54.7 1
+54.8 1
+54.9 1
+e
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/cf-parameter-set.h"
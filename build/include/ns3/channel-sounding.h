@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/he/channel-sounding.h"
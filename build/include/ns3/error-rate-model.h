@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/error-rate-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/infrastructure-wifi-mac.h"
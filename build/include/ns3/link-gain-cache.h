@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/link-gain-cache.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/network/utils/mac64-address.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/probabilistic-v2v-channel-condition-model.h"
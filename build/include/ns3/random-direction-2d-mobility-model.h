@@ -0,0 +1 @@
+#include "/root/repo/src/mobility/model/random-direction-2d-mobility-model.h"
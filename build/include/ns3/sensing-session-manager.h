@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/he/sensing-session-manager.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/helper/sensing-stats-helper.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/propagation/model/spatial-index.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/stats/model/uinteger-16-probe.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/waveform-generator.h"
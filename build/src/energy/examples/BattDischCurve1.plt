@@ -0,0 +1,332 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "BattDisch1.eps"
+set xlabel " Time (minutes)"
+set ylabel "Voltage (V)"
+set xrange[0:70]
+                               set yrange [0.8:1.8]
+                               set xtics 10
+                               set ytics 0.1
+                               set grid
+                               set style line 1 linewidth 5
+                               set style line 2 linewidth 5
+                               set style line 3 linewidth 5
+                               set style line 4 linewidth 5
+                               set style line 5 linewidth 5
+                               set style line 6 linewidth 5
+                               set style line 7 linewidth 5
+                               set style line 8 linewidth 5
+                               set style increment user
+                               set key reverse Left
+plot "-"  title "Panasonic NiMH HHR650D 6.5 A (1C)" with lines, "-"  title "Panasonic NiMH HHR650D 13 A (2C)" with lines, "-"  title "Panasonic NiMH HHR650D 32.5 A (5C)" with lines
+0 1.36608
+0.333333 1.35326
+0.666667 1.34261
+1 1.33376
+1.33333 1.32612
+1.66667 1.31933
+2 1.31322
+2.33333 1.30765
+2.66667 1.30256
+3 1.29789
+3.33333 1.29359
+3.66667 1.28963
+4 1.28598
+4.33333 1.28262
+4.66667 1.27952
+5 1.27666
+5.33333 1.27401
+5.66667 1.27157
+6 1.26932
+6.33333 1.26723
+6.66667 1.2653
+7 1.26352
+7.33333 1.26187
+7.66667 1.26034
+8 1.25892
+8.33333 1.2576
+8.66667 1.25638
+9 1.25524
+9.33333 1.25418
+9.66667 1.2532
+10 1.25228
+10.3333 1.25142
+10.6667 1.25062
+11 1.24987
+11.3333 1.24917
+11.6667 1.24851
+12 1.24789
+12.3333 1.24731
+12.6667 1.24676
+13 1.24623
+13.3333 1.24574
+13.6667 1.24527
+14 1.24483
+14.3333 1.2444
+14.6667 1.244
+15 1.24361
+15.3333 1.24324
+15.6667 1.24288
+16 1.24253
+16.3333 1.2422
+16.6667 1.24187
+17 1.24156
+17.3333 1.24125
+17.6667 1.24095
+18 1.24066
+18.3333 1.24037
+18.6667 1.24009
+19 1.23981
+19.3333 1.23954
+19.6667 1.23927
+20 1.239
+20.3333 1.23873
+20.6667 1.23847
+21 1.2382
+21.3333 1.23794
+21.6667 1.23768
+22 1.23741
+22.3333 1.23715
+22.6667 1.23688
+23 1.23662
+23.3333 1.23635
+23.6667 1.23608
+24 1.23581
+24.3333 1.23554
+24.6667 1.23526
+25 1.23498
+25.3333 1.2347
+25.6667 1.23442
+26 1.23413
+26.3333 1.23384
+26.6667 1.23354
+27 1.23324
+27.3333 1.23294
+27.6667 1.23263
+28 1.23232
+28.3333 1.232
+28.6667 1.23168
+29 1.23135
+29.3333 1.23101
+29.6667 1.23067
+30 1.23033
+30.3333 1.22998
+30.6667 1.22962
+31 1.22925
+31.3333 1.22888
+31.6667 1.2285
+32 1.22811
+32.3333 1.22772
+32.6667 1.22732
+33 1.22691
+33.3333 1.22649
+33.6667 1.22606
+34 1.22562
+34.3333 1.22518
+34.6667 1.22472
+35 1.22425
+35.3333 1.22378
+35.6667 1.22329
+36 1.22279
+36.3333 1.22228
+36.6667 1.22176
+37 1.22122
+37.3333 1.22068
+37.6667 1.22012
+38 1.21954
+38.3333 1.21895
+38.6667 1.21835
+39 1.21772
+39.3333 1.21709
+39.6667 1.21643
+40 1.21576
+40.3333 1.21507
+40.6667 1.21436
+41 1.21364
+41.3333 1.21289
+41.6667 1.21211
+42 1.21132
+42.3333 1.2105
+42.6667 1.20966
+43 1.20879
+43.3333 1.20789
+43.6667 1.20697
+44 1.20602
+44.3333 1.20503
+44.6667 1.20401
+45 1.20296
+45.3333 1.20187
+45.6667 1.20074
+46 1.19958
+46.3333 1.19837
+46.6667 1.19711
+47 1.19581
+47.3333 1.19445
+47.6667 1.19305
+48 1.19159
+48.3333 1.19006
+48.6667 1.18848
+49 1.18682
+49.3333 1.1851
+49.6667 1.1833
+50 1.18141
+50.3333 1.17944
+50.6667 1.17737
+51 1.17521
+51.3333 1.17293
+51.6667 1.17054
+52 1.16802
+52.3333 1.16536
+52.6667 1.16256
+53 1.15959
+53.3333 1.15645
+53.6667 1.15312
+54 1.14958
+54.3333 1.14581
+54.6667 1.14179
+55 1.13749
+55.3333 1.13289
+55.6667 1.12794
+56 1.12261
+56.3333 1.11685
+56.6667 1.1106
+57 1.10382
+57.3333 1.09641
+57.6667 1.08829
+58 1.07936
+58.3333 1.06948
+58.6667 1.0585
+59 1.04622
+59.3333 1.03239
+59.6667 1.01671
+e
+0 1.33618
+0.333333 1.31105
+0.666667 1.29144
+1 1.27636
+1.33333 1.26438
+1.66667 1.25463
+2 1.24654
+2.33333 1.23977
+2.66667 1.23405
+3 1.22918
+3.33333 1.22503
+3.66667 1.22146
+4 1.21838
+4.33333 1.21572
+4.66667 1.2134
+5 1.21138
+5.33333 1.20959
+5.66667 1.20801
+6 1.2066
+6.33333 1.20532
+6.66667 1.20417
+7 1.20311
+7.33333 1.20213
+7.66667 1.20121
+8 1.20035
+8.33333 1.19952
+8.66667 1.19873
+9 1.19796
+9.33333 1.19721
+9.66667 1.19647
+10 1.19574
+10.3333 1.19501
+10.6667 1.19428
+11 1.19354
+11.3333 1.19279
+11.6667 1.19203
+12 1.19125
+12.3333 1.19046
+12.6667 1.18965
+13 1.18882
+13.3333 1.18796
+13.6667 1.18708
+14 1.18617
+14.3333 1.18522
+14.6667 1.18425
+15 1.18324
+15.3333 1.18219
+15.6667 1.18111
+16 1.17998
+16.3333 1.1788
+16.6667 1.17757
+17 1.1763
+17.3333 1.17496
+17.6667 1.17357
+18 1.17211
+18.3333 1.17058
+18.6667 1.16898
+19 1.1673
+19.3333 1.16554
+19.6667 1.16368
+20 1.16172
+20.3333 1.15965
+20.6667 1.15746
+21 1.15514
+21.3333 1.15269
+21.6667 1.15008
+22 1.1473
+22.3333 1.14434
+22.6667 1.14117
+23 1.13777
+23.3333 1.13413
+23.6667 1.1302
+24 1.12596
+24.3333 1.12137
+24.6667 1.11637
+25 1.11092
+25.3333 1.10495
+25.6667 1.09838
+26 1.09112
+26.3333 1.08306
+26.6667 1.07404
+27 1.06389
+27.3333 1.05239
+27.6667 1.03924
+28 1.02407
+28.3333 1.00636
+28.6667 0.985419
+29 0.960282
+29.3333 0.929542
+29.6667 0.891091
+30 0.841612
+30.3333 0.775565
+30.6667 0.682957
+e
+0 1.24648
+0.333333 1.18717
+0.666667 1.14818
+1 1.12365
+1.33333 1.1078
+1.66667 1.09718
+2 1.08973
+2.33333 1.08419
+2.66667 1.07978
+3 1.07603
+3.33333 1.07261
+3.66667 1.06933
+4 1.06605
+4.33333 1.06267
+4.66667 1.05913
+5 1.05536
+5.33333 1.05129
+5.66667 1.04689
+6 1.04208
+6.33333 1.03679
+6.66667 1.03096
+7 1.02447
+7.33333 1.01721
+7.66667 1.00904
+8 0.99977
+8.33333 0.989157
+8.66667 0.976888
+9 0.962544
+9.33333 0.945549
+9.66667 0.925093
+10 0.899997
+10.3333 0.868483
+10.6667 0.827726
+11 0.772961
+11.3333 0.695469
+11.6667 0.577397
+e
@@ -0,0 +1,3 @@
+#!/bin/sh
+
+gnuplot gnuplot-aggregator.plt
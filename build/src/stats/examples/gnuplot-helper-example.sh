@@ -0,0 +1,3 @@
+#!/bin/sh
+
+gnuplot gnuplot-helper-example.plt
@@ -0,0 +1,145 @@
+set terminal png
+set output "plot-3d.png"
+set title "3-D Plot"
+
+set view 30, 120, 1.0, 1.0
+set ticslevel 0
+set xlabel "X Values"
+set ylabel "Y Values"
+set zlabel "Z Values"
+set xrange [-5:+5]
+set yrange [-5:+5]
+splot "-"  with lines title "3-D Data"
+-5 -5 625
+-5 -4 400
+-5 -3 225
+-5 -2 100
+-5 -1 25
+-5 0 0
+-5 1 25
+-5 2 100
+-5 3 225
+-5 4 400
+-5 5 625
+
+-4 -5 400
+-4 -4 256
+-4 -3 144
+-4 -2 64
+-4 -1 16
+-4 0 0
+-4 1 16
+-4 2 64
+-4 3 144
+-4 4 256
+-4 5 400
+
+-3 -5 225
+-3 -4 144
+-3 -3 81
+-3 -2 36
+-3 -1 9
+-3 0 0
+-3 1 9
+-3 2 36
+-3 3 81
+-3 4 144
+-3 5 225
+
+-2 -5 100
+-2 -4 64
+-2 -3 36
+-2 -2 16
+-2 -1 4
+-2 0 0
+-2 1 4
+-2 2 16
+-2 3 36
+-2 4 64
+-2 5 100
+
+-1 -5 25
+-1 -4 16
+-1 -3 9
+-1 -2 4
+-1 -1 1
+-1 0 0
+-1 1 1
+-1 2 4
+-1 3 9
+-1 4 16
+-1 5 25
+
+0 -5 0
+0 -4 0
+0 -3 0
+0 -2 0
+0 -1 0
+0 0 0
+0 1 0
+0 2 0
+0 3 0
+0 4 0
+0 5 0
+
+1 -5 25
+1 -4 16
+1 -3 9
+1 -2 4
+1 -1 1
+1 0 0
+1 1 1
+1 2 4
+1 3 9
+1 4 16
+1 5 25
+
+2 -5 100
+2 -4 64
+2 -3 36
+2 -2 16
+2 -1 4
+2 0 0
+2 1 4
+2 2 16
+2 3 36
+2 4 64
+2 5 100
+
+3 -5 225
+3 -4 144
+3 -3 81
+3 -2 36
+3 -1 9
+3 0 0
+3 1 9
+3 2 36
+3 3 81
+3 4 144
+3 5 225
+
+4 -5 400
+4 -4 256
+4 -3 144
+4 -2 64
+4 -1 16
+4 0 0
+4 1 16
+4 2 64
+4 3 144
+4 4 256
+4 5 400
+
+5 -5 625
+5 -4 400
+5 -3 225
+5 -2 100
+5 -1 25
+5 0 0
+5 1 25
+5 2 100
+5 3 225
+5 4 400
+5 5 625
+
+e
@@ -0,0 +1,61 @@
+set terminal postscript eps color enh "Times-BoldItalic"
+set output "wifi-manager-example-Ideal-802.11a.eps"
+set title "Results for 802.11a with Ideal\n"
+set xlabel "SNR (dB)"
+set ylabel "Rate (Mb/s)"
+set xrange [0:30]
+set yrange [0:60]
+set key top left
+plot "-"  title "802.11a-rate selected" with lines, "-"  title "802.11a-observed" with lines
+27 54
+26 54
+25 54
+24 54
+23 54
+22 54
+21 54
+20 54
+19 54
+18 54
+17 54
+16 54
+15 54
+14 54
+13 54
+12 54
+11 54
+10 54
+9 54
+8 54
+7 54
+6 54
+5 54
+4 54
+3 54
+e
+27 25.1003
+26 25.2068
+25 25.1494
+24 25.1494
+23 25.1412
+22 25.1412
+21 25.2396
+20 25.1904
+19 25.2723
+18 25.174
+17 25.1331
+16 25.215
+15 25.1576
+14 25.1822
+13 25.1658
+12 25.2314
+11 25.1658
+10 25.2314
+9 25.2314
+8 25.1167
+7 25.1494
+6 25.2314
+5 25.2314
+4 25.1412
+3 25.1658
+e
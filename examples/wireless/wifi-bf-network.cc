@@ -33,10 +33,12 @@
 #include "ns3/mac48-address.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/node-list.h"
 #include "ns3/on-off-helper.h"
 #include "ns3/packet-sink-helper.h"
 #include "ns3/packet-sink.h"
 #include "ns3/propagation-loss-model.h"
+#include "ns3/sensing-stats-helper.h"
 #include "ns3/spectrum-wifi-helper.h"
 #include "ns3/ssid.h"
 #include "ns3/string.h"
@@ -123,33 +125,13 @@ using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("bf-wifi-network");
 
-uint64_t m_countBeacon;
-uint64_t m_countCfPoll;
-uint64_t m_countCfEnd;
-uint64_t m_countCfEndAck;
-uint64_t m_countDataNullAnnouncement;
-uint64_t m_countDataNull;
-uint64_t m_countData;
-uint64_t m_countCTS;
-uint64_t m_countCTStoSelf;
-uint64_t m_csiBeamformingReport;
 uint32_t nStations;
 uint32_t nStations_net2;
-Time m_sumDelay;
-Time m_avgDelay;
-Time m_sumTrueLatency;
-Time m_avgTrueLatency;
-Time m_sumTrueLatency_net2;
-Time m_avgTrueLatency_net2;
 bool enableCTStoSelf = true;
-bool firstSensingPhase = true;
-bool stillSensing = false;
 bool multipleBss;
 double nBss;
 int nBfBss;
 int nAxBss;
-double m_innerCounter;
-double m_collisionCounter;
 double radius;
 double numerator;
 double denominator;
@@ -174,18 +156,6 @@ typedef struct Bss
     Ipv4InterfaceContainer ApInterface, ApInterface_net2, StaInterface, StaInterface_net2;
 } Bss;
 
-typedef struct Calculation
-{
-    Time m_sumTrueLatency;
-    Time m_avgTrueLatency;
-    double m_innerCounter;
-    double m_collisionCounter;
-    bool stillSensing;
-} Calculation;
-
-std::map<Mac48Address, Calculation> allCalculation;
-std::map<Mac48Address, Calculation> allCalculation_net2;
-
 void
 MonitorSniffRx(Ptr<const Packet> packet,
                uint16_t channelFreqMhz,
@@ -200,157 +170,6 @@ MonitorSniffRx(Ptr<const Packet> packet,
     g_noiseDbmAvg += ((signalNoise.noise - g_noiseDbmAvg) / g_samples);
 }
 
-void
-MonitorChannelAccess(Mac48Address addr, ns3::Time currentTime, bool AccessGranted)
-{
-    if (!AccessGranted)
-    {
-        if (allCalculation.find(addr) != allCalculation.end())
-        {
-            allCalculation.find(addr)->second.m_sumTrueLatency = currentTime;
-            if (allCalculation.find(addr)->second.stillSensing)
-            {
-                m_collisionCounter++;
-                allCalculation.find(addr)->second.m_collisionCounter++;
-            }
-            else
-            {
-                allCalculation.find(addr)->second.stillSensing = true;
-                stillSensing = true;
-            }
-        }
-        else if (allCalculation_net2.find(addr) != allCalculation_net2.end())
-        {
-            if (allCalculation_net2.find(addr)->second.stillSensing)
-            {
-                m_collisionCounter++;
-                allCalculation_net2.find(addr)->second.m_collisionCounter++;
-            }
-            else
-            {
-                allCalculation_net2.find(addr)->second.m_sumTrueLatency = currentTime;
-                allCalculation_net2.find(addr)->second.stillSensing = true;
-            }
-        }
-    }
-    else
-    {
-        if (allCalculation.find(addr) != allCalculation.end())
-        {
-            if (allCalculation.find(addr)->second.stillSensing)
-            {
-                allCalculation.find(addr)->second.m_avgTrueLatency =
-                    allCalculation.find(addr)->second.m_avgTrueLatency +
-                    (currentTime - allCalculation.find(addr)->second.m_sumTrueLatency);
-                allCalculation.find(addr)->second.m_innerCounter++;
-                allCalculation.find(addr)->second.stillSensing = false;
-            }
-        }
-        else if (allCalculation_net2.find(addr) != allCalculation_net2.end())
-        {
-            if (allCalculation_net2.find(addr)->second.stillSensing)
-            {
-                allCalculation_net2.find(addr)->second.m_avgTrueLatency +=
-                    (currentTime - allCalculation_net2.find(addr)->second.m_sumTrueLatency);
-                allCalculation_net2.find(addr)->second.m_innerCounter++;
-                allCalculation_net2.find(addr)->second.stillSensing = false;
-            }
-        }
-    }
-}
-
-void
-TxCallback(std::string context, Ptr<const Packet> p, double txPowerW)
-{
-    WifiMacHeader hdr;
-    p->PeekHeader(hdr);
-    hdr.GetAddr1();
-    if (hdr.IsBeacon())
-    {
-        m_countBeacon++;
-    }
-    else if (hdr.IsCfPoll())
-    {
-        m_countCfPoll++;
-    }
-    else if (hdr.IsCfEnd())
-    {
-        if (hdr.IsCfAck())
-        {
-            m_countCfEndAck++;
-        }
-        else
-        {
-            m_countCfEnd++;
-        }
-    }
-    else if (hdr.IsNdpa())
-    {
-        m_countDataNullAnnouncement++;
-    }
-    else if (hdr.IsActionNoAck())
-    {
-        m_csiBeamformingReport++;
-    }
-    else if (hdr.IsData())
-    {
-        if (!hdr.HasData())
-        {
-            m_countDataNull++;
-        }
-        else
-        {
-            m_countData++;
-        }
-    }
-    else if (hdr.IsCts())
-    {
-        if (enableCTStoSelf)
-        {
-            m_countCTStoSelf++;
-        }
-        else
-        {
-            m_countCTS++;
-        }
-    }
-}
-
-void
-RxEndCallback(Ptr<const Packet> packet)
-{
-    WifiMacHeader hdr;
-    packet->PeekHeader(hdr);
-    if (hdr.IsActionNoAck() && Simulator::Now() > Seconds(1))
-    {
-        m_csiBeamformingReport++;
-        // if (multipleBss)
-        // {
-        //     // if (m_csiBeamformingReport % (nBfBss * nStations) == 0 && m_innerCounter < 1)
-        //     // {
-        //     //     m_avgTrueLatency = m_avgTrueLatency + (Simulator::Now() - m_sumTrueLatency);
-        //     //     m_innerCounter++;
-        //     //     // std::cout << "All reporting obtained in " << Simulator::Now() << std::endl;
-        //     // }
-        //     if (m_csiBeamformingReport % nStations == 0 && m_innerCounter < 1)
-        //     {
-        //         // std::cout << "All reporting obtained in " << Simulator::Now() << std::endl;
-        //         m_avgTrueLatency = m_avgTrueLatency + (Simulator::Now() - m_sumTrueLatency);
-        //         m_innerCounter++;
-        //     }
-        // }
-        // else
-        // {
-        //     if (m_csiBeamformingReport % nStations == 0 && m_innerCounter < 1)
-        //     {
-        //         // std::cout << "All reporting obtained in " << Simulator::Now() << std::endl;
-        //         m_avgTrueLatency = m_avgTrueLatency + (Simulator::Now() - m_sumTrueLatency);
-        //         m_innerCounter++;
-        //     }
-        // }
-    }
-}
-
 // Function to split a string by a delimiter and return a vector of substrings
 std::vector<std::string>
 split(const std::string& s, char delimiter)
@@ -614,43 +433,6 @@ setNumberDevice(int scenario)
         default_Bss.nStations_no_sensing = nStations_net2;
         std::vector<Bss> allBss(nBss, default_Bss);
 
-        for (int i = 0; i < nBfBss; i++)
-        {
-            char address_tempconst[18];
-            std::snprintf(address_tempconst,
-                          sizeof(address_tempconst),
-                          "00:00:00:00:00:%02x",
-                          i + 1);
-            Mac48Address address = Mac48Address(address_tempconst);
-            Calculation calc;
-            calc.m_avgTrueLatency = Seconds(0);
-            calc.m_sumTrueLatency = Seconds(0);
-            calc.m_innerCounter = 0;
-            calc.m_collisionCounter = 0;
-            calc.stillSensing = false;
-            allCalculation.insert({address, calc});
-        }
-
-        int j = 0;
-        for (int i = nBfBss; i < nBss; i++)
-        // for (int i = nBfBss; i < nBfBss+1; i++)
-        {
-            char address_tempconst[18];
-            j = i + nStations * nBfBss;
-            std::snprintf(address_tempconst,
-                          sizeof(address_tempconst),
-                          "00:00:00:00:00:%02x",
-                          j + 1);
-            Mac48Address address = Mac48Address(address_tempconst);
-            Calculation calc;
-            calc.m_avgTrueLatency = Seconds(0);
-            calc.m_sumTrueLatency = Seconds(0);
-            calc.m_innerCounter = 0;
-            calc.m_collisionCounter = 0;
-            calc.stillSensing = false;
-            allCalculation_net2.insert({address, calc});
-        }
-
         for (int i = 0; i < nBfBss; i++)
         {
             NodeContainer wifiStaNode, wifiApNode;
@@ -683,40 +465,6 @@ setNumberDevice(int scenario)
         default_Bss.nStations_sensing = 1;
         default_Bss.nStations_no_sensing = 1;
         std::vector<Bss> allBss_sce2(nBss, default_Bss);
-        for (int i = 0; i < nBfBss; i++)
-        {
-            char address_tempconst[18];
-            std::snprintf(address_tempconst,
-                          sizeof(address_tempconst),
-                          "00:00:00:00:00:%02x",
-                          i + 1);
-            Mac48Address address = Mac48Address(address_tempconst);
-            Calculation calc;
-            calc.m_avgTrueLatency = Seconds(0);
-            calc.m_sumTrueLatency = Seconds(0);
-            calc.m_innerCounter = 0;
-            calc.m_collisionCounter = 0;
-            calc.stillSensing = false;
-            allCalculation.insert({address, calc});
-        }
-
-        for (int i = nBfBss; i < nBss; i++)
-        {
-            char address_tempconst[18];
-            std::snprintf(address_tempconst,
-                          sizeof(address_tempconst),
-                          "00:00:00:00:00:%02x",
-                          i + 1 + (i * nStations_net2));
-            Mac48Address address = Mac48Address(address_tempconst);
-            Calculation calc;
-            calc.m_avgTrueLatency = Seconds(0);
-            calc.m_sumTrueLatency = Seconds(0);
-            calc.m_innerCounter = 0;
-            calc.m_collisionCounter = 0;
-            calc.stillSensing = false;
-            allCalculation_net2.insert({address, calc});
-        }
-
         for (int i = 0; i < nBfBss; i++)
         {
             NodeContainer wifiStaNode, wifiApNode;
@@ -727,24 +475,6 @@ setNumberDevice(int scenario)
             allBss_sce2[i].wifiStaNode = wifiStaNode;
             allBss_sce2[i].wifiApNode = wifiApNode;
         }
-        int j = 0;
-        for (int i = nBfBss; i < nBss; i++)
-        {
-            char address_tempconst[18];
-            j = i + nStations * nBfBss;
-            std::snprintf(address_tempconst,
-                          sizeof(address_tempconst),
-                          "00:00:00:00:00:%02x",
-                          j + 1);
-            Mac48Address address = Mac48Address(address_tempconst);
-            Calculation calc;
-            calc.m_avgTrueLatency = Seconds(0);
-            calc.m_sumTrueLatency = Seconds(0);
-            calc.m_innerCounter = 0;
-            calc.m_collisionCounter = 0;
-            calc.stillSensing = false;
-            allCalculation_net2.insert({address, calc});
-        }
         return allBss_sce2;
     }
     else if (scenario == 2)
@@ -773,26 +503,6 @@ setNumberDevice(int scenario)
         default_Bss.nStations_no_sensing = nStations;
         std::vector<Bss> allBss(nBss, default_Bss);
 
-        for (int i = 0; i < nBss; i++)
-        {
-            if (indoorOfficeApOrder_vec[i] == 1)
-            {
-                char address_tempconst[18];
-                std::snprintf(address_tempconst,
-                              sizeof(address_tempconst),
-                              "00:00:00:00:00:%02x",
-                              i + 1 + (i * nStations));
-                Mac48Address address = Mac48Address(address_tempconst);
-                Calculation calc;
-                calc.m_avgTrueLatency = Seconds(0);
-                calc.m_sumTrueLatency = Seconds(0);
-                calc.m_innerCounter = 0;
-                calc.m_collisionCounter = 0;
-                calc.stillSensing = false;
-                allCalculation.insert({address, calc});
-            }
-        }
-
         for (int i = 0; i < nBss; i++)
         {
             if (indoorOfficeApOrder_vec[i] == 1)
@@ -865,6 +575,8 @@ main(int argc, char* argv[])
     std::string codebookSizeMu = "(9,7)"; // Codebook size for MU channel sounding
     uint8_t nc = 2;           // Number of colums in the compressed beamforming feedback matrix
     uint8_t SoundingType = 0; // Sounding type (0: SU, 1: SU+MU, 2: MU)
+    bool physicalCsi = false; // Derive the reported channel information from the received NDPs
+    uint32_t sbpRequesters = 0; // Number of STAs per BSS requesting sensing by proxy
 
     /*******************************************/
     // MU-OFDMA Setup in Physical Layer        //
@@ -923,6 +635,13 @@ main(int argc, char* argv[])
     cmd.AddValue("seed", "Seed for random number generator", iseed);
     cmd.AddValue("radius", "Radius of the circle for the model distance", radius);
     cmd.AddValue("soundingtype", "Sounding type (0: SU, 1: SU+MU, 2: MU)", SoundingType);
+    cmd.AddValue("physicalCsi",
+                 "Derive the channel information reported by the stations from the received "
+                 "NDPs instead of drawing it at random",
+                 physicalCsi);
+    cmd.AddValue("sbpRequesters",
+                 "Number of STAs per 802.11bf BSS requesting sensing by proxy",
+                 sbpRequesters);
     cmd.AddValue("frequency", "Frequency (2.4, 5, 6 GHz)", frequency);
     cmd.AddValue("nBss", "Number of BSS", nBss);
     cmd.AddValue("nAxBss", "Number of BSS for ax", nAxBss);
@@ -948,21 +667,6 @@ main(int argc, char* argv[])
     RngSeedManager::SetSeed(iseed);
     RngSeedManager::SetRun(10);
 
-    m_countBeacon = 0;
-    m_countCfEnd = 0;
-    m_countCfEndAck = 0;
-    m_countCfPoll = 0;
-    m_countDataNullAnnouncement = 0;
-    m_countDataNull = 0;
-    m_countData = 0;
-    m_countCTS = 0;
-    m_countCTStoSelf = 0;
-    m_innerCounter = 0;
-    m_sumDelay = Seconds(0);
-    m_avgDelay = Seconds(0);
-    m_sumTrueLatency = Seconds(0);
-    m_avgTrueLatency = Seconds(0);
-
     std::vector<Bss> allBss = setNumberDevice(scenario);
 
     WifiHelper wifi;
@@ -1302,6 +1006,66 @@ main(int argc, char* argv[])
         }
     }
 
+    // Assign fixed streams to the random variables of all the Wi-Fi devices (including the CSI
+    // generators of the sensing beamformees), so that runs with the same seed are identical
+    NetDeviceContainer allDevices;
+    for (auto node = NodeList::Begin(); node != NodeList::End(); ++node)
+    {
+        for (uint32_t j = 0; j < (*node)->GetNDevices(); j++)
+        {
+            allDevices.Add((*node)->GetDevice(j));
+        }
+    }
+    wifi.AssignStreams(allDevices, 100);
+
+    if (physicalCsi)
+    {
+        for (uint32_t i = 0; i < allDevices.GetN(); i++)
+        {
+            auto device = DynamicCast<WifiNetDevice>(allDevices.Get(i));
+            if (!device || !DynamicCast<StaWifiMac>(device->GetMac()))
+            {
+                continue;
+            }
+            for (uint8_t linkId = 0; linkId < device->GetNPhys(); linkId++)
+            {
+                auto heFem = DynamicCast<HeFrameExchangeManager>(
+                    device->GetMac()->GetFrameExchangeManager(linkId));
+                NS_ABORT_MSG_IF(!heFem, "The CSI generator requires an HE Frame Exchange Manager");
+                auto csiGenerator = CreateObject<SpectrumCsiGenerator>();
+                csiGenerator->SetWifiPhy(device->GetPhy(linkId));
+                heFem->GetCsBeamformee()->SetCsiGenerator(csiGenerator);
+            }
+        }
+    }
+
+    // Sensing KPIs of the 802.11bf APs and channel access latency of the 802.11ax APs
+    SensingStatsHelper sensingStats;
+    SensingStatsHelper sensingStats_net2;
+    for (const auto& bss : allBss)
+    {
+        sensingStats.Install(bss.apDevice);
+        sensingStats_net2.Install(bss.apDevice_net2);
+    }
+    sensingStats.EnableFrameCounters(allDevices);
+
+    // STAs requesting the same measurement setup by proxy are served by a single setup
+    for (int i = 0; i < nBfBss; i++)
+    {
+        const auto& staDevices = allBss[i].staDevices;
+        for (uint32_t j = 0; j < std::min(sbpRequesters, staDevices.GetN()); j++)
+        {
+            auto staMac = DynamicCast<StaWifiMac>(
+                DynamicCast<WifiNetDevice>(staDevices.Get(j))->GetMac());
+            SensingMeasurementSetup setup;
+            setup.interval = MilliSeconds(sensingInterval);
+            setup.priority = sensingPriority;
+            Simulator::Schedule(Seconds(1.0), [staMac, setup]() {
+                staMac->RequestSensingByProxy(setup);
+            });
+        }
+    }
+
     MobilityHelper mobility;
     Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
 
@@ -1661,17 +1425,6 @@ main(int argc, char* argv[])
             }
         }
 
-        Config::Connect("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/$ns3::WifiPhy/PhyTxBegin",
-                        MakeCallback(&TxCallback));
-
-        // Config::ConnectWithoutContext(
-        //     "/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/$ns3::WifiPhy/PhyRxEnd",
-        //     MakeCallback(&RxEndCallback));
-
-        Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/"
-                                      "$ns3::WifiPhy/MonitorChannelAccess",
-                                      MakeCallback(&MonitorChannelAccess));
-
         Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/"
                                       "$ns3::WifiPhy/MonitorSnifferRx",
                                       MakeCallback(&MonitorSniffRx));
@@ -1756,43 +1509,54 @@ main(int argc, char* argv[])
             std::cout << "# SNR (db): " << "N/A" << std::endl;
         }
 
-        m_avgTrueLatency = Seconds(0);
-        m_innerCounter = 0;
-        for (auto it = allCalculation.begin(); it != allCalculation.end(); ++it)
+        Time avgLatency = Seconds(0);
+        for (std::size_t ap = 0; ap < sensingStats.GetNAps(); ap++)
         {
-            if (it->second.m_avgTrueLatency > Seconds(0) && it->second.m_innerCounter > 0)
-            {
-                m_avgTrueLatency += it->second.m_avgTrueLatency / it->second.m_innerCounter;
-            }
-            m_innerCounter += it->second.m_innerCounter;
-            m_collisionCounter += it->second.m_collisionCounter;
+            avgLatency += sensingStats.GetApStats(ap).GetAverageAttemptLatency();
         }
+        const auto successfulSensing = static_cast<int>(sensingStats.GetNCompleted());
 
-        std::cout << "# tx beacons: " << m_countBeacon << std::endl;
-        std::cout << "# tx CF-END: " << m_countCfEnd << std::endl;
-        std::cout << "# tx CF-END-ACK: " << m_countCfEndAck << std::endl;
-        std::cout << "# tx CF-POLL: " << m_countCfPoll << std::endl;
-        std::cout << "# tx DATA-NULL-ANNOUNCEMENT: " << m_countDataNullAnnouncement << std::endl;
-        std::cout << "# tx DATA-NULL: " << m_countDataNull << std::endl;
-        std::cout << "# tx CSI-BEAMFORMING-REPORT: " << m_csiBeamformingReport << std::endl;
-        std::cout << "# tx DATA: " << m_countData << std::endl;
-        std::cout << "# tx CTS: " << m_countCTS << std::endl;
-        std::cout << "# tx CTS-to-self: " << m_countCTStoSelf << std::endl;
+        std::cout << "# tx beacons: " << sensingStats.GetFrameCount(SensingStatsHelper::BEACON)
+                  << std::endl;
+        std::cout << "# tx CF-END: " << sensingStats.GetFrameCount(SensingStatsHelper::CF_END)
+                  << std::endl;
+        std::cout << "# tx CF-END-ACK: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::CF_END_ACK) << std::endl;
+        std::cout << "# tx CF-POLL: " << sensingStats.GetFrameCount(SensingStatsHelper::CF_POLL)
+                  << std::endl;
+        std::cout << "# tx DATA-NULL-ANNOUNCEMENT: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::NDPA) << std::endl;
+        std::cout << "# tx DATA-NULL: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::DATA_NULL) << std::endl;
+        std::cout << "# tx CSI-BEAMFORMING-REPORT: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::BF_REPORT) << std::endl;
+        std::cout << "# tx DATA: " << sensingStats.GetFrameCount(SensingStatsHelper::DATA)
+                  << std::endl;
+        std::cout << "# tx CTS: " << sensingStats.GetFrameCount(SensingStatsHelper::CTS)
+                  << std::endl;
+        std::cout << "# tx CTS-to-self: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::CTS_TO_SELF) << std::endl;
+        std::cout << "# rx CSI reports: " << sensingStats.GetNCsiReports() << std::endl;
+        std::cout << "# sensing collisions: " << sensingStats.GetNCollisions() << std::endl;
         if (nBfBss > 0)
         {
-            if (m_avgTrueLatency.GetSeconds() > 0.0)
+            if (avgLatency.IsStrictlyPositive())
             {
-                std::cout << "# average latency: " << m_avgTrueLatency.GetSeconds() / nBfBss
+                std::cout << "# average latency: " << avgLatency.GetSeconds() / nBfBss
                           << std::endl;
             }
             else
             {
                 std::cout << "# average latency: -nan " << std::endl;
             }
+            std::cout << "# p50 latency: " << sensingStats.GetMedianLatency().GetSeconds()
+                      << std::endl;
+            std::cout << "# p99 latency: " << sensingStats.GetP99Latency().GetSeconds()
+                      << std::endl;
         }
-        std::cout << "# successful sensing: " << m_innerCounter << std::endl;
+        std::cout << "# successful sensing: " << successfulSensing << std::endl;
         int unsuccessfulSensing =
-            simulationTime * (1000 / sensingInterval) * nBfBss - m_innerCounter;
+            simulationTime * (1000 / sensingInterval) * nBfBss - successfulSensing;
         if (unsuccessfulSensing < 0)
             unsuccessfulSensing = 0;
         std::cout << "# unsuccessfull sensing: " << unsuccessfulSensing << std::endl;
@@ -1974,17 +1738,6 @@ main(int argc, char* argv[])
             }
         }
 
-        Config::Connect("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/$ns3::WifiPhy/PhyTxBegin",
-                        MakeCallback(&TxCallback));
-
-        // Config::ConnectWithoutContext(
-        //     "/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/$ns3::WifiPhy/PhyRxEnd",
-        //     MakeCallback(&RxEndCallback));
-
-        Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/"
-                                      "$ns3::WifiPhy/MonitorChannelAccess",
-                                      MakeCallback(&MonitorChannelAccess));
-
         Config::ConnectWithoutContext("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/"
                                       "$ns3::WifiPhy/MonitorSnifferRx",
                                       MakeCallback(&MonitorSniffRx));
@@ -2095,59 +1848,63 @@ main(int argc, char* argv[])
             }
         }
 
-        m_avgTrueLatency = Seconds(0);
-        m_innerCounter = 0;
-        for (auto it = allCalculation.begin(); it != allCalculation.end(); ++it)
+        Time avgLatency = Seconds(0);
+        for (std::size_t ap = 0; ap < sensingStats.GetNAps(); ap++)
         {
-            if (it->second.m_avgTrueLatency > Seconds(0) && it->second.m_innerCounter > 0)
-            {
-                m_avgTrueLatency += it->second.m_avgTrueLatency / it->second.m_innerCounter;
-            }
-            m_innerCounter += it->second.m_innerCounter;
-            m_collisionCounter += it->second.m_collisionCounter;
+            avgLatency += sensingStats.GetApStats(ap).GetAverageAttemptLatency();
         }
+        const auto successfulSensing = static_cast<int>(sensingStats.GetNCompleted());
 
-        std::cout << "# tx beacons: " << m_countBeacon << std::endl;
-        std::cout << "# tx CF-END: " << m_countCfEnd << std::endl;
-        std::cout << "# tx CF-END-ACK: " << m_countCfEndAck << std::endl;
-        std::cout << "# tx CF-POLL: " << m_countCfPoll << std::endl;
-        std::cout << "# tx DATA-NULL-ANNOUNCEMENT: " << m_countDataNullAnnouncement << std::endl;
-        std::cout << "# tx DATA-NULL: " << m_countDataNull << std::endl;
-        std::cout << "# tx CSI-BEAMFORMING-REPORT: " << m_csiBeamformingReport << std::endl;
-        std::cout << "# tx DATA: " << m_countData << std::endl;
-        std::cout << "# tx CTS: " << m_countCTS << std::endl;
-        std::cout << "# tx CTS-to-self: " << m_countCTStoSelf << std::endl;
+        std::cout << "# tx beacons: " << sensingStats.GetFrameCount(SensingStatsHelper::BEACON)
+                  << std::endl;
+        std::cout << "# tx CF-END: " << sensingStats.GetFrameCount(SensingStatsHelper::CF_END)
+                  << std::endl;
+        std::cout << "# tx CF-END-ACK: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::CF_END_ACK) << std::endl;
+        std::cout << "# tx CF-POLL: " << sensingStats.GetFrameCount(SensingStatsHelper::CF_POLL)
+                  << std::endl;
+        std::cout << "# tx DATA-NULL-ANNOUNCEMENT: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::NDPA) << std::endl;
+        std::cout << "# tx DATA-NULL: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::DATA_NULL) << std::endl;
+        std::cout << "# tx CSI-BEAMFORMING-REPORT: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::BF_REPORT) << std::endl;
+        std::cout << "# tx DATA: " << sensingStats.GetFrameCount(SensingStatsHelper::DATA)
+                  << std::endl;
+        std::cout << "# tx CTS: " << sensingStats.GetFrameCount(SensingStatsHelper::CTS)
+                  << std::endl;
+        std::cout << "# tx CTS-to-self: "
+                  << sensingStats.GetFrameCount(SensingStatsHelper::CTS_TO_SELF) << std::endl;
+        std::cout << "# rx CSI reports: " << sensingStats.GetNCsiReports() << std::endl;
+        std::cout << "# sensing collisions: " << sensingStats.GetNCollisions() << std::endl;
         if (nBfBss > 0)
         {
-            if (m_avgTrueLatency.GetSeconds() > 0.0)
+            if (avgLatency.IsStrictlyPositive())
             {
-                std::cout << "# average latency (bf): " << m_avgTrueLatency.GetSeconds() / nBfBss
+                std::cout << "# average latency (bf): " << avgLatency.GetSeconds() / nBfBss
                           << std::endl;
             }
             else
             {
                 std::cout << "# average latency (bf): -nan " << std::endl;
             }
+            std::cout << "# p50 latency (bf): " << sensingStats.GetMedianLatency().GetSeconds()
+                      << std::endl;
+            std::cout << "# p99 latency (bf): " << sensingStats.GetP99Latency().GetSeconds()
+                      << std::endl;
         }
 
-        m_avgTrueLatency_net2 = Seconds(0);
-        for (auto it = allCalculation_net2.begin(); it != allCalculation_net2.end(); ++it)
+        Time totalLatency_net2 = Seconds(0);
+        for (std::size_t ap = 0; ap < sensingStats_net2.GetNAps(); ap++)
         {
-            if (it->second.m_avgTrueLatency > Seconds(0) && it->second.m_innerCounter > 0)
-            {
-                // m_avgTrueLatency_net2 += it->second.m_avgTrueLatency /
-                // (it->second.m_innerCounter);
-                m_avgTrueLatency_net2 += it->second.m_avgTrueLatency;
-            }
-            // std::cout << it->first << " average latency: " << it->second.stillSensing <<
-            // std::endl;
+            totalLatency_net2 += sensingStats_net2.GetApStats(ap).totalLatency;
         }
         if (nAxBss > 0)
         {
-            if (m_avgTrueLatency_net2.GetSeconds() > 0.0)
+            if (totalLatency_net2.IsStrictlyPositive())
             {
-                std::cout << "# average latency (ax): "
-                          << m_avgTrueLatency_net2.GetSeconds() / nAxBss << std::endl;
+                std::cout << "# average latency (ax): " << totalLatency_net2.GetSeconds() / nAxBss
+                          << std::endl;
             }
             else
             {
@@ -2155,9 +1912,9 @@ main(int argc, char* argv[])
             }
         }
 
-        std::cout << "# successful sensing: " << m_innerCounter << std::endl;
+        std::cout << "# successful sensing: " << successfulSensing << std::endl;
         int unsuccessfulSensing =
-            simulationTime * (1000 / sensingInterval) * nBfBss - m_innerCounter;
+            simulationTime * (1000 / sensingInterval) * nBfBss - successfulSensing;
         if (unsuccessfulSensing < 0)
             unsuccessfulSensing = 0;
         std::cout << "# unsuccessfull sensing: " << unsuccessfulSensing << std::endl;
@@ -22,8 +22,8 @@
 
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
-#include <mutex>
 #include <thread>
 
 /**
@@ -95,19 +95,17 @@ class DefaultSimulatorImpl : public SimulatorImpl
         uint64_t timestamp;
         /** The event implementation. */
         EventImpl* event;
+        /** The next event in the list. */
+        EventWithContext* next;
     };
 
-    /** Container type for the events from a different context. */
-    typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * The events from a different context, as a lock-free linked list
+     * starting from the last event scheduled.  The other threads push their
+     * events with a compare-and-swap, and the main thread takes the whole
+     * list at once with an exchange.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
-    std::mutex m_eventsWithContextMutex;
+    std::atomic<EventWithContext*> m_eventsWithContext;
 
     /** Container type for the events to run at Simulator::Destroy() */
     typedef std::list<EventId> DestroyEvents;
@@ -32,6 +32,125 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("EventImpl");
 
+namespace
+{
+
+/** The granularity of the sizes of the events recycled. */
+constexpr std::size_t EVENT_POOL_GRANULARITY = 16;
+/** The number of size classes: the events up to 128 bytes are recycled. */
+constexpr std::size_t EVENT_POOL_CLASSES = 8;
+/** The maximum number of free blocks kept per size class and thread. */
+constexpr std::size_t EVENT_POOL_MAX_FREE = 4096;
+
+/**
+ * \ingroup events
+ * The free lists of the memory blocks of the events released by a thread.
+ *
+ * Each block is allocated on its own from the heap, hence it can be
+ * released by any thread, whichever thread allocated it.
+ */
+struct EventPool
+{
+    /** A free memory block, linked to the next free block of its size class. */
+    struct FreeBlock
+    {
+        FreeBlock* next; //!< The next free block.
+    };
+
+    /** Destructor: return the free blocks to the heap. */
+    ~EventPool();
+
+    FreeBlock* m_free[EVENT_POOL_CLASSES]{};    //!< The free lists, per size class.
+    std::size_t m_nFree[EVENT_POOL_CLASSES]{}; //!< The length of the free lists.
+};
+
+/**
+ * Whether the pool of the current thread has been destroyed: the events
+ * released afterwards (e.g., by static objects) go back to the heap.
+ */
+thread_local bool t_eventPoolDestroyed = false;
+
+EventPool::~EventPool()
+{
+    for (auto block : m_free)
+    {
+        while (block)
+        {
+            FreeBlock* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+    }
+    t_eventPoolDestroyed = true;
+}
+
+/**
+ * \ingroup events
+ * Get the event pool of the current thread.
+ *
+ * \returns The event pool.
+ */
+EventPool&
+GetEventPool()
+{
+    thread_local EventPool pool;
+    return pool;
+}
+
+/**
+ * \ingroup events
+ * Get the size class of an event.
+ *
+ * \param [in] size The size of the event object.
+ * \returns The size class, EVENT_POOL_CLASSES or more if the event is not recycled.
+ */
+std::size_t
+GetSizeClass(std::size_t size)
+{
+    return (size - 1) / EVENT_POOL_GRANULARITY;
+}
+
+} // unnamed namespace
+
+void*
+EventImpl::operator new(std::size_t size)
+{
+    std::size_t sizeClass = GetSizeClass(size);
+    if (sizeClass >= EVENT_POOL_CLASSES || t_eventPoolDestroyed)
+    {
+        return ::operator new(size);
+    }
+    EventPool& pool = GetEventPool();
+    EventPool::FreeBlock* block = pool.m_free[sizeClass];
+    if (!block)
+    {
+        // allocate the whole size class, so that the block can be reused by any event of the class
+        return ::operator new((sizeClass + 1) * EVENT_POOL_GRANULARITY);
+    }
+    pool.m_free[sizeClass] = block->next;
+    pool.m_nFree[sizeClass]--;
+    return block;
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    std::size_t sizeClass = GetSizeClass(size);
+    if (sizeClass < EVENT_POOL_CLASSES && !t_eventPoolDestroyed)
+    {
+        EventPool& pool = GetEventPool();
+        if (pool.m_nFree[sizeClass] < EVENT_POOL_MAX_FREE)
+        {
+            auto block = static_cast<EventPool::FreeBlock*>(p);
+            block->next = pool.m_free[sizeClass];
+            pool.m_free[sizeClass] = block;
+            pool.m_nFree[sizeClass]++;
+            return;
+        }
+    }
+    ::operator delete(p);
+}
+
 EventImpl::~EventImpl()
 {
     NS_LOG_FUNCTION(this);
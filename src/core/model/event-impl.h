@@ -21,6 +21,7 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
 #include <stdint.h>
 
 /**
@@ -67,6 +68,26 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /**
+     * Allocate the memory of an event.
+     *
+     * Events are small, short lived objects created at a very high rate,
+     * hence the memory of the small events is recycled through per-thread
+     * free lists (one per size class) rather than returned to the heap.
+     *
+     * \param [in] size The size of the event object.
+     * \returns The memory allocated.
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Release the memory of an event, to the free list of the calling
+     * thread if it is small enough.
+     *
+     * \param [in] p The memory to release.
+     * \param [in] size The size of the event object.
+     */
+    static void operator delete(void* p, std::size_t size);
+
   protected:
     /**
      * Implementation for Invoke().
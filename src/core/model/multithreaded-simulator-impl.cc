@@ -0,0 +1,669 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "global-value.h"
+#include "log.h"
+#include "scheduler.h"
+#include "simulator.h"
+#include "string.h"
+#include "uinteger.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <tuple>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+thread_local MultithreadedSimulatorImpl::Partition*
+    MultithreadedSimulatorImpl::g_currentPartition = nullptr;
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("Partitions",
+                          "The number of partitions, each run by its own thread",
+                          TypeId::ATTR_CONSTRUCT | TypeId::ATTR_GET,
+                          UintegerValue(2),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::SetPartitions,
+                                               &MultithreadedSimulatorImpl::GetPartitions),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("Lookahead",
+                          "The minimum delay of the events scheduled for another partition. "
+                          "If zero, the lookahead is the minimum of the delays returned by the "
+                          "lookahead sources, e.g., the channels shared by the partitions.",
+                          TimeValue(Time(0)),
+                          MakeTimeAccessor(&MultithreadedSimulatorImpl::SetLookahead,
+                                           &MultithreadedSimulatorImpl::GetLookahead),
+                          MakeTimeChecker(Time(0)));
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+    m_lookahead = std::numeric_limits<int64_t>::max();
+    m_stop = false;
+    m_running = false;
+    m_barrierCount = 0;
+    m_barrierGeneration = 0;
+    SetPartitions(1);
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& partition : m_partitions)
+    {
+        ProcessRemoteEvents(*partition);
+        while (!partition->events->IsEmpty())
+        {
+            Scheduler::Event next = partition->events->RemoveNext();
+            next.impl->Unref();
+        }
+        partition->events = nullptr;
+    }
+    m_lookaheadSources.clear();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+    // the sources may hold references to the objects holding this simulator
+    m_lookaheadSources.clear();
+}
+
+void
+MultithreadedSimulatorImpl::SetPartitions(uint32_t nPartitions)
+{
+    NS_LOG_FUNCTION(this << nPartitions);
+    NS_ASSERT(nPartitions > 0);
+    NS_ASSERT_MSG(m_partitions.empty() || !m_partitions.front()->events,
+                  "The partitions cannot be changed once the scheduler is set");
+    m_partitions.clear();
+    for (uint32_t id = 0; id < nPartitions; id++)
+    {
+        auto partition = std::make_unique<Partition>();
+        partition->id = id;
+        partition->remoteEvents = nullptr;
+        partition->sent = 0;
+        partition->uid = EventId::UID::VALID;
+        partition->currentUid = EventId::UID::INVALID;
+        partition->currentTs = 0;
+        partition->currentContext = Simulator::NO_CONTEXT;
+        partition->eventCount = 0;
+        partition->nextTs = 0;
+        partition->unscheduledEvents = 0;
+        partition->requestedStopTs = std::numeric_limits<uint64_t>::max();
+        partition->stopTs = std::numeric_limits<uint64_t>::max();
+        m_partitions.push_back(std::move(partition));
+    }
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartitions() const
+{
+    return m_partitions.size();
+}
+
+void
+MultithreadedSimulatorImpl::SetLookahead(Time lookahead)
+{
+    NS_LOG_FUNCTION(this << lookahead);
+    NS_ASSERT_MSG(!m_running, "The lookahead cannot be changed while the simulation runs");
+    m_lookaheadAttribute = lookahead;
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookahead() const
+{
+    return m_lookaheadAttribute;
+}
+
+void
+MultithreadedSimulatorImpl::AddLookaheadSource(Callback<Time> source)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_running, "The lookahead sources cannot be added while the simulation runs");
+    m_lookaheadSources.push_back(source);
+}
+
+void
+MultithreadedSimulatorImpl::UpdateLookahead()
+{
+    NS_LOG_FUNCTION(this);
+    Time lookahead = m_lookaheadAttribute;
+    if (lookahead.IsZero())
+    {
+        // without source, no event is expected to be scheduled for another partition
+        lookahead = Time::Max();
+        for (const auto& source : m_lookaheadSources)
+        {
+            lookahead = std::min(lookahead, source());
+        }
+        NS_ABORT_MSG_IF(!lookahead.IsStrictlyPositive(),
+                        "Null lookahead: nodes of different partitions may receive each other "
+                        "without propagation delay (set the Lookahead attribute or change the "
+                        "number of partitions)");
+    }
+    m_lookahead = lookahead.GetTimeStep();
+    NS_LOG_LOGIC("Lookahead " << lookahead);
+}
+
+Ptr<MultithreadedSimulatorImpl>
+MultithreadedSimulatorImpl::GetInstance()
+{
+    StringValue type;
+    GlobalValue::GetValueByName("SimulatorImplementationType", type);
+    if (type.Get() != GetTypeId().GetName())
+    {
+        return nullptr;
+    }
+    return DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    NS_ASSERT_MSG(!m_running, "The scheduler cannot be changed while the simulation runs");
+
+    for (auto& partition : m_partitions)
+    {
+        Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+        if (partition->events)
+        {
+            while (!partition->events->IsEmpty())
+            {
+                Scheduler::Event next = partition->events->RemoveNext();
+                scheduler->Insert(next);
+            }
+        }
+        partition->events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+MultithreadedSimulatorImpl::Partition&
+MultithreadedSimulatorImpl::GetPartition(uint32_t context) const
+{
+    if (context == Simulator::NO_CONTEXT)
+    {
+        return *m_partitions.front();
+    }
+    return *m_partitions[context % m_partitions.size()];
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartitionId(uint32_t context) const
+{
+    return GetPartition(context).id;
+}
+
+MultithreadedSimulatorImpl::Partition&
+MultithreadedSimulatorImpl::GetCurrentPartition() const
+{
+    if (g_currentPartition)
+    {
+        return *g_currentPartition;
+    }
+    NS_ASSERT_MSG(!m_running, "Thread-unsafe invocation from outside the partition threads!");
+    return *m_partitions.front();
+}
+
+EventId
+MultithreadedSimulatorImpl::Insert(Partition& partition,
+                                   uint64_t ts,
+                                   uint32_t context,
+                                   EventImpl* event)
+{
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = partition.uid;
+    partition.uid++;
+    partition.unscheduledEvents++;
+    partition.events->Insert(ev);
+    return EventId(event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ProcessRemoteEvents(Partition& partition)
+{
+    if (partition.remoteEvents.load(std::memory_order_relaxed) == nullptr)
+    {
+        return;
+    }
+
+    std::vector<RemoteEvent*> events;
+    for (RemoteEvent* ev = partition.remoteEvents.exchange(nullptr, std::memory_order_acquire); ev;
+         ev = ev->next)
+    {
+        events.push_back(ev);
+    }
+    // the order of insertion, hence the uid, must not depend on the timing of the threads
+    std::sort(events.begin(), events.end(), [](const RemoteEvent* a, const RemoteEvent* b) {
+        return std::tie(a->timestamp, a->source, a->sequence) <
+               std::tie(b->timestamp, b->source, b->sequence);
+    });
+    for (auto ev : events)
+    {
+        NS_ASSERT(ev->timestamp >= partition.currentTs);
+        Insert(partition, ev->timestamp, ev->context, ev->event);
+        delete ev;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent(Partition& partition)
+{
+    Scheduler::Event next = partition.events->RemoveNext();
+
+    PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+    NS_ASSERT(next.key.m_ts >= partition.currentTs);
+    partition.unscheduledEvents--;
+    partition.eventCount++;
+
+    partition.currentTs = next.key.m_ts;
+    partition.currentContext = next.key.m_context;
+    partition.currentUid = next.key.m_uid;
+    next.impl->Invoke();
+    next.impl->Unref();
+}
+
+void
+MultithreadedSimulatorImpl::Wait()
+{
+    std::unique_lock lock{m_barrierMutex};
+    uint64_t generation = m_barrierGeneration;
+    if (++m_barrierCount == m_partitions.size())
+    {
+        m_barrierCount = 0;
+        m_barrierGeneration++;
+        m_barrierCondition.notify_all();
+        return;
+    }
+    m_barrierCondition.wait(lock, [this, generation]() {
+        return m_barrierGeneration != generation;
+    });
+}
+
+void
+MultithreadedSimulatorImpl::RunPartition(Partition& partition)
+{
+    g_currentPartition = &partition;
+
+    while (true)
+    {
+        // all the partitions see the same state here, hence agree on the window
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        uint64_t stop = std::numeric_limits<uint64_t>::max();
+        for (const auto& p : m_partitions)
+        {
+            next = std::min(next, p->nextTs);
+            stop = std::min(stop, p->stopTs);
+        }
+        if (next >= stop)
+        {
+            break;
+        }
+        uint64_t end = next + std::min(m_lookahead, std::numeric_limits<uint64_t>::max() - next);
+        end = std::min(end, stop);
+
+        // the partition stops at once when its own events request it
+        while (!partition.events->IsEmpty() &&
+               partition.events->PeekNext().key.m_ts < std::min(end, partition.requestedStopTs))
+        {
+            ProcessOneEvent(partition);
+        }
+        Wait();
+
+        ProcessRemoteEvents(partition);
+        partition.nextTs = partition.events->IsEmpty()
+                               ? std::numeric_limits<uint64_t>::max()
+                               : partition.events->PeekNext().key.m_ts;
+        partition.stopTs = partition.requestedStopTs;
+        Wait();
+    }
+
+    g_currentPartition = nullptr;
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    return std::all_of(m_partitions.begin(), m_partitions.end(), [](const auto& partition) {
+        return partition->events->IsEmpty() && !partition->remoteEvents.load();
+    });
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    m_stop = false;
+    UpdateLookahead();
+    for (auto& partition : m_partitions)
+    {
+        ProcessRemoteEvents(*partition);
+        partition->nextTs = partition->events->IsEmpty() ? std::numeric_limits<uint64_t>::max()
+                                                         : partition->events->PeekNext().key.m_ts;
+        partition->stopTs = partition->requestedStopTs;
+    }
+
+    m_running = true;
+    std::vector<std::thread> threads;
+    for (auto it = std::next(m_partitions.begin()); it != m_partitions.end(); it++)
+    {
+        threads.emplace_back(&MultithreadedSimulatorImpl::RunPartition, this, std::ref(**it));
+    }
+    RunPartition(*m_partitions.front());
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    m_running = false;
+
+    // the stop requests which took effect are consumed, so that the simulation can be resumed
+    uint64_t stop = std::numeric_limits<uint64_t>::max();
+    for (const auto& partition : m_partitions)
+    {
+        stop = std::min(stop, partition->stopTs);
+    }
+    for (auto& partition : m_partitions)
+    {
+        if (partition->requestedStopTs == stop)
+        {
+            partition->requestedStopTs = std::numeric_limits<uint64_t>::max();
+            m_stop = true;
+        }
+    }
+
+    // If the simulator stopped naturally by lack of events, make a
+    // consistency test to check that we didn't lose any events along the way.
+    for (const auto& partition [[maybe_unused]] : m_partitions)
+    {
+        NS_ASSERT(!partition->events->IsEmpty() || partition->unscheduledEvents == 0);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::RequestStop(uint64_t ts)
+{
+    Partition& partition = GetCurrentPartition();
+    partition.requestedStopTs = std::min(partition.requestedStopTs, ts);
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    // as with the other implementations, stopping before running has no effect
+    if (m_running)
+    {
+        RequestStop(GetCurrentPartition().currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Stop(): Negative delay");
+    RequestStop(GetCurrentPartition().currentTs + delay.GetTimeStep());
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    Partition& partition = GetCurrentPartition();
+    return Insert(partition,
+                  partition.currentTs + delay.GetTimeStep(),
+                  partition.currentContext,
+                  event);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(),
+                  "MultithreadedSimulatorImpl::ScheduleWithContext(): Negative delay");
+    Partition& source = GetCurrentPartition();
+    Partition& target = GetPartition(context);
+    uint64_t ts = source.currentTs + delay.GetTimeStep();
+
+    if (!m_running || &source == &target)
+    {
+        Insert(target, ts, context, event);
+        return;
+    }
+
+    NS_ABORT_MSG_IF(static_cast<uint64_t>(delay.GetTimeStep()) < m_lookahead,
+                    "Event scheduled for context " << context << " after " << delay
+                                                   << ", less than the lookahead "
+                                                   << TimeStep(m_lookahead)
+                                                   << " (see the Lookahead attribute)");
+    auto ev = new RemoteEvent;
+    ev->timestamp = ts;
+    ev->context = context;
+    ev->source = source.id;
+    ev->sequence = source.sent++;
+    ev->event = event;
+    ev->next = target.remoteEvents.load(std::memory_order_relaxed);
+    while (!target.remoteEvents.compare_exchange_weak(ev->next,
+                                                      ev,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed))
+    {
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    NS_ASSERT_MSG(!m_running, "Simulator::ScheduleDestroy Thread-unsafe invocation!");
+
+    EventId id(Ptr<EventImpl>(event, false), Now().GetTimeStep(), 0xffffffff, 2);
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    return TimeStep(GetCurrentPartition().currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    else
+    {
+        return TimeStep(id.GetTs() - GetCurrentPartition().currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        NS_ASSERT_MSG(!m_running, "Simulator::Remove Thread-unsafe invocation!");
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                m_destroyEvents.erase(i);
+                break;
+            }
+        }
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    Partition& partition = GetPartition(id.GetContext());
+    NS_ASSERT_MSG(!m_running || &partition == g_currentPartition,
+                  "Simulator::Remove of an event of another partition!");
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    partition.events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+
+    partition.unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        // destroy events.
+        for (auto i = m_destroyEvents.begin(); i != m_destroyEvents.end(); i++)
+        {
+            if (*i == id)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (id.PeekEventImpl() == nullptr)
+    {
+        return true;
+    }
+    // the events are only accessed by the partition they belong to
+    const Partition& partition = GetPartition(id.GetContext());
+    return id.GetTs() < partition.currentTs ||
+           (id.GetTs() == partition.currentTs && id.GetUid() <= partition.currentUid) ||
+           id.PeekEventImpl()->IsCancelled();
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    return GetCurrentPartition().currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t eventCount = 0;
+    for (const auto& partition : m_partitions)
+    {
+        eventCount += partition->eventCount;
+    }
+    return eventCount;
+}
+
+} // namespace ns3
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "callback.h"
+#include "nstime.h"
+#include "object-factory.h"
+#include "simulator-impl.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+// Forward
+class Scheduler;
+
+/**
+ * \ingroup simulator
+ *
+ * \brief A conservative parallel simulator implementation running on the
+ * threads of a single process.
+ *
+ * The execution contexts (i.e., the nodes) are divided among a number of
+ * partitions (the Partitions attribute): the context \c c belongs to the
+ * partition <tt>c % Partitions</tt>, and the events without context to the
+ * first partition.  Each partition has its own event list and is run by
+ * its own thread, the first partition being run by the thread calling
+ * Simulator::Run().
+ *
+ * The partitions are synchronized by time windows.  All the partitions
+ * run the events earlier than the end of the window, i.e., the time of the
+ * earliest pending event plus the lookahead, then wait for each other
+ * before the next window starts.  An event scheduled for another partition
+ * must therefore be scheduled, with Simulator::ScheduleWithContext(), at
+ * least the lookahead ahead; a shorter delay aborts the simulation.  These
+ * events are queued without lock and added to the event list of their
+ * partition between two windows, in an order which does not depend on the
+ * timing of the threads, so that the results of a simulation only depend
+ * on the number of partitions.
+ *
+ * The lookahead is the minimum propagation delay between nodes of
+ * different partitions.  Unless it is set with the Lookahead attribute, it
+ * is derived, at the start of Run(), from the lookahead sources added by
+ * the channels shared by the partitions (see AddLookaheadSource()), e.g.,
+ * the YansWifiChannel and the MultiModelSpectrumChannel, which get the
+ * minimum delay between their nodes from their PropagationDelayModel.
+ * The larger the lookahead, the more events are run in each window and
+ * the less time is spent synchronizing the threads.
+ *
+ * Simulator::Stop() stops the partition calling it at once, while the
+ * other partitions stop at the end of the current window: they may
+ * therefore run the events they have until then, i.e., up to the lookahead
+ * after the stop time.  Simulator::Stop(delay) is exact as long as the
+ * delay is at least the lookahead, since all the partitions then stop
+ * before the stop time; the events at the stop time itself are not run,
+ * whatever the order in which they were scheduled.
+ *
+ * \warning All the objects which are shared by partitions must be safe to
+ * use concurrently.  The reference counts of SimpleRefCount and the global
+ * state of Packet are only thread-safe when ns-3 is built with NS3_MTP,
+ * and the channels shared by partitions copy the packets they deliver to
+ * the other partitions.  This implementation cannot be used with the
+ * events scheduled by threads other than the partition threads.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    void Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Get the simulator implementation if it is a MultithreadedSimulatorImpl.
+     *
+     * Unlike Simulator::GetImplementation(), the simulator implementation
+     * is not created unless the SimulatorImplementationType global value
+     * selects this implementation, so that the objects shared by the
+     * partitions (e.g., the channels) can check whether they are.
+     *
+     * \returns The simulator implementation, or null if it is not a
+     * MultithreadedSimulatorImpl.
+     */
+    static Ptr<MultithreadedSimulatorImpl> GetInstance();
+
+    /**
+     * Add a lookahead source, i.e., a callback returning the minimum delay
+     * of the events that an object (e.g., a channel) schedules for another
+     * partition.  The sources are invoked at the start of Run(), before the
+     * partitions start, and the lookahead is the minimum of the delays they
+     * return, unless the Lookahead attribute is set.
+     *
+     * \param [in] source The lookahead source.
+     */
+    void AddLookaheadSource(Callback<Time> source);
+
+    /**
+     * Get the index of the partition which runs the events of a context.
+     *
+     * \param [in] context The context.
+     * \returns The index of the partition.
+     */
+    uint32_t GetPartitionId(uint32_t context) const;
+
+  private:
+    void DoDispose() override;
+
+    /** An event scheduled for another partition. */
+    struct RemoteEvent
+    {
+        /** Event timestamp. */
+        uint64_t timestamp;
+        /** The event context. */
+        uint32_t context;
+        /** The partition which scheduled the event. */
+        uint32_t source;
+        /** The number of events scheduled for other partitions by the source before. */
+        uint64_t sequence;
+        /** The event implementation. */
+        EventImpl* event;
+        /** The next event in the list. */
+        RemoteEvent* next;
+    };
+
+    /** A partition: a set of contexts run by the same thread. */
+    struct Partition
+    {
+        /** The partition index. */
+        uint32_t id;
+        /** The event priority queue. */
+        Ptr<Scheduler> events;
+        /**
+         * The events scheduled by other partitions, as a lock-free linked
+         * list starting from the last event scheduled.
+         */
+        std::atomic<RemoteEvent*> remoteEvents;
+        /** Number of events scheduled for other partitions. */
+        uint64_t sent;
+        /** Next event unique id. */
+        uint32_t uid;
+        /** Unique id of the current event. */
+        uint32_t currentUid;
+        /** Timestamp of the current event. */
+        uint64_t currentTs;
+        /** Execution context of the current event. */
+        uint32_t currentContext;
+        /** The event count. */
+        uint64_t eventCount;
+        /** Timestamp of the next event, at the start of a window. */
+        uint64_t nextTs;
+        /** Number of events that have been inserted but not yet scheduled. */
+        int unscheduledEvents;
+        /** Earliest stop time requested by the events of the partition. */
+        uint64_t requestedStopTs;
+        /** Earliest stop time requested by the partition, at the start of a window. */
+        uint64_t stopTs;
+    };
+
+    /**
+     * Set the number of partitions.
+     *
+     * This can only be used at construction, as invoked by the
+     * Attribute Partitions.
+     *
+     * \param [in] nPartitions The number of partitions.
+     */
+    void SetPartitions(uint32_t nPartitions);
+    /**
+     * Get the number of partitions.
+     *
+     * \returns The number of partitions.
+     */
+    uint32_t GetPartitions() const;
+    /**
+     * Set the lookahead.
+     *
+     * \param [in] lookahead The lookahead, or zero to derive it from the lookahead sources.
+     */
+    void SetLookahead(Time lookahead);
+    /**
+     * Get the lookahead.
+     *
+     * \returns The lookahead, or zero if it is derived from the lookahead sources.
+     */
+    Time GetLookahead() const;
+    /**
+     * Compute the lookahead of the next run, from the Lookahead attribute or
+     * the lookahead sources.
+     */
+    void UpdateLookahead();
+    /**
+     * Get the partition of a context.
+     *
+     * \param [in] context The context.
+     * \returns The partition.
+     */
+    Partition& GetPartition(uint32_t context) const;
+    /**
+     * Get the partition run by the calling thread, or the first partition
+     * if the simulation is not running.
+     *
+     * \returns The partition.
+     */
+    Partition& GetCurrentPartition() const;
+    /**
+     * Insert an event in the event list of a partition.
+     *
+     * \param [in] partition The partition.
+     * \param [in] ts The event timestamp.
+     * \param [in] context The event context.
+     * \param [in] event The event implementation.
+     * \returns The event id.
+     */
+    EventId Insert(Partition& partition, uint64_t ts, uint32_t context, EventImpl* event);
+    /**
+     * Request the partition run by the calling thread to stop at the given time.
+     *
+     * \param [in] ts The stop time.
+     */
+    void RequestStop(uint64_t ts);
+    /**
+     * Move the events scheduled by other partitions into the event list.
+     *
+     * \param [in] partition The partition.
+     */
+    void ProcessRemoteEvents(Partition& partition);
+    /**
+     * Process the next event of a partition.
+     *
+     * \param [in] partition The partition.
+     */
+    void ProcessOneEvent(Partition& partition);
+    /**
+     * Run the windows of a partition until the end of the simulation.
+     *
+     * \param [in] partition The partition.
+     */
+    void RunPartition(Partition& partition);
+    /** Wait until all the partitions have called this method. */
+    void Wait();
+
+    /** The partition run by the calling thread, if any. */
+    static thread_local Partition* g_currentPartition;
+
+    /** The partitions. */
+    std::vector<std::unique_ptr<Partition>> m_partitions;
+    /** The lookahead set with the Lookahead attribute, zero if derived from the sources. */
+    Time m_lookaheadAttribute;
+    /** The sources of the lookahead. */
+    std::vector<Callback<Time>> m_lookaheadSources;
+    /** The lookahead of the current run, in dimensionless time units. */
+    uint64_t m_lookahead;
+    /** Whether the last run ended because of Simulator::Stop(). */
+    bool m_stop;
+    /** Whether the simulation is running. */
+    bool m_running;
+
+    /** Container type for the events to run at Simulator::Destroy() */
+    typedef std::list<EventId> DestroyEvents;
+    /** The container of events to run at Destroy. */
+    DestroyEvents m_destroyEvents;
+
+    /** Mutex of the barrier between the partitions. */
+    std::mutex m_barrierMutex;
+    /** Condition variable the partitions wait on at the barrier. */
+    std::condition_variable m_barrierCondition;
+    /** Number of partitions waiting at the barrier. */
+    uint32_t m_barrierCount;
+    /** Number of times all the partitions have passed the barrier. */
+    uint64_t m_barrierGeneration;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "recording-scheduler.h"
+
+#include "abort.h"
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "map-scheduler.h"
+#include "object-factory.h"
+#include "string.h"
+#include "type-id.h"
+
+#include <cstring>
+#include <limits>
+#include <typeinfo>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::RecordingScheduler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("RecordingScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(RecordingScheduler);
+
+namespace
+{
+
+/** The magic string at the start of the trace files. */
+const char TRACE_MAGIC[] = "ns3evtrc";
+/** The size of the magic string, without the terminating null character. */
+const std::size_t TRACE_MAGIC_SIZE = sizeof(TRACE_MAGIC) - 1;
+/** The version of the format of the trace files. */
+const uint32_t TRACE_VERSION = 2;
+
+/**
+ * \ingroup scheduler
+ * Write a value to a stream, in host byte order.
+ *
+ * \tparam T \deduced The type of the value.
+ * \param [in] os The stream.
+ * \param [in] value The value.
+ */
+template <typename T>
+void
+WriteValue(std::ostream& os, T value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * \ingroup scheduler
+ * Read a value from a stream, in host byte order.
+ *
+ * \tparam T \deduced The type of the value.
+ * \param [in] is The stream.
+ * \param [out] value The value.
+ * \returns \c true if the value could be read.
+ */
+template <typename T>
+bool
+ReadValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // unnamed namespace
+
+TypeId
+RecordingScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::RecordingScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<RecordingScheduler>()
+            .AddAttribute("Scheduler",
+                          "The type of the scheduler the operations are forwarded to",
+                          TypeId::ATTR_CONSTRUCT,
+                          TypeIdValue(MapScheduler::GetTypeId()),
+                          MakeTypeIdAccessor(&RecordingScheduler::SetScheduler),
+                          MakeTypeIdChecker())
+            .AddAttribute("FileName",
+                          "The name of the file the operations are recorded to "
+                          "(nothing is recorded if empty)",
+                          TypeId::ATTR_CONSTRUCT,
+                          StringValue("scheduler.evtrace"),
+                          MakeStringAccessor(&RecordingScheduler::SetFileName),
+                          MakeStringChecker());
+    return tid;
+}
+
+RecordingScheduler::RecordingScheduler()
+    : m_lastTs(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+RecordingScheduler::~RecordingScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+RecordingScheduler::SetScheduler(TypeId tid)
+{
+    NS_LOG_FUNCTION(this << tid);
+    NS_ASSERT_MSG(!m_scheduler || m_scheduler->IsEmpty(),
+                  "Cannot change the scheduler of a non empty RecordingScheduler");
+    NS_ABORT_MSG_IF(tid == GetTypeId(), "Cannot forward to another RecordingScheduler");
+    ObjectFactory factory;
+    factory.SetTypeId(tid);
+    m_scheduler = factory.Create<Scheduler>();
+}
+
+void
+RecordingScheduler::SetFileName(std::string filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+    m_kinds.clear();
+    if (filename.empty())
+    {
+        return;
+    }
+    m_file.open(filename, std::ios::binary | std::ios::trunc);
+    NS_ABORT_MSG_IF(!m_file.is_open(), "Cannot open the scheduler trace file " << filename);
+    m_file.write(TRACE_MAGIC, TRACE_MAGIC_SIZE);
+    WriteValue(m_file, TRACE_VERSION);
+}
+
+void
+RecordingScheduler::Append(Operation operation, const Scheduler::Event& ev)
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+    NS_ASSERT(ev.impl);
+    auto [kind, defined] = m_kinds.emplace(typeid(*ev.impl), m_kinds.size());
+    if (defined)
+    {
+        NS_ABORT_MSG_IF(m_kinds.size() > std::numeric_limits<uint16_t>::max() + 1u,
+                        "Too many event kinds to record");
+        std::string name = kind->first.name();
+        WriteValue<uint8_t>(m_file, KIND);
+        WriteValue<uint32_t>(m_file, name.size());
+        m_file.write(name.data(), name.size());
+    }
+    bool cancelled = (operation == REMOVE_NEXT && ev.impl->IsCancelled());
+    WriteValue<uint8_t>(m_file, operation);
+    WriteValue<uint8_t>(m_file, cancelled);
+    WriteValue(m_file, kind->second);
+    WriteValue(m_file, ev.key.m_context);
+    WriteValue(m_file, ev.key.m_uid);
+    WriteValue(m_file, ev.key.m_ts);
+    WriteValue<uint64_t>(m_file, ev.key.m_ts - m_lastTs);
+}
+
+std::vector<RecordingScheduler::Record>
+RecordingScheduler::ReadTrace(const std::string& filename, std::vector<std::string>* kinds)
+{
+    NS_LOG_FUNCTION(filename << kinds);
+    std::ifstream file(filename, std::ios::binary);
+    NS_ABORT_MSG_IF(!file.is_open(), "Cannot open the scheduler trace file " << filename);
+
+    char magic[TRACE_MAGIC_SIZE];
+    uint32_t version = 0;
+    NS_ABORT_MSG_IF(!file.read(magic, TRACE_MAGIC_SIZE) ||
+                        std::memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_SIZE) != 0 ||
+                        !ReadValue(file, version),
+                    filename << " is not a scheduler trace file");
+    NS_ABORT_MSG_IF(version != TRACE_VERSION,
+                    "Unsupported version " << version << " of scheduler trace file " << filename);
+
+    std::vector<Record> records;
+    std::size_t nKinds = 0;
+    uint8_t operation;
+    uint8_t cancelled;
+    Record record;
+    while (ReadValue(file, operation))
+    {
+        if (operation == KIND)
+        {
+            uint32_t size = 0;
+            if (!ReadValue(file, size))
+            {
+                break;
+            }
+            std::string name(size, '\0');
+            if (!file.read(name.data(), size))
+            {
+                break;
+            }
+            if (kinds)
+            {
+                kinds->push_back(name);
+            }
+            nKinds++;
+            continue;
+        }
+        if (!ReadValue(file, cancelled) || !ReadValue(file, record.kind) ||
+            !ReadValue(file, record.context) || !ReadValue(file, record.uid) ||
+            !ReadValue(file, record.ts) || !ReadValue(file, record.delay))
+        {
+            break;
+        }
+        NS_ABORT_MSG_IF(operation > REMOVE, "Invalid operation in scheduler trace " << filename);
+        NS_ABORT_MSG_IF(record.kind >= nKinds,
+                        "Undefined event kind in scheduler trace " << filename);
+        record.operation = static_cast<Operation>(operation);
+        record.cancelled = (cancelled != 0);
+        records.push_back(record);
+    }
+    return records;
+}
+
+void
+RecordingScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    m_scheduler->Insert(ev);
+    Append(INSERT, ev);
+}
+
+bool
+RecordingScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_scheduler->IsEmpty();
+}
+
+Scheduler::Event
+RecordingScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_scheduler->PeekNext();
+}
+
+Scheduler::Event
+RecordingScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    Scheduler::Event ev = m_scheduler->RemoveNext();
+    Append(REMOVE_NEXT, ev);
+    m_lastTs = ev.key.m_ts;
+    return ev;
+}
+
+void
+RecordingScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    m_scheduler->Remove(ev);
+    Append(REMOVE, ev);
+}
+
+} // namespace ns3
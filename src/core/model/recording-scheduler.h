@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef RECORDING_SCHEDULER_H
+#define RECORDING_SCHEDULER_H
+
+#include "ptr.h"
+#include "scheduler.h"
+#include "type-id.h"
+
+#include <fstream>
+#include <stdint.h>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::RecordingScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a scheduler recording the operations performed on another scheduler
+ *
+ * This scheduler forwards all the operations to a scheduler of the type
+ * given by the Scheduler attribute, and appends a record for each of them
+ * to the binary file given by the FileName attribute.  The recorded trace
+ * of a real simulation can then be replayed on any Scheduler, e.g., by
+ * `utils/bench-scheduler-replay.cc`, to compare the schedulers on the
+ * actual event distribution of a model.
+ *
+ * To record the trace of a simulation, select this scheduler and the file,
+ * e.g., from the command line:
+ *
+ * \code
+ *   --SchedulerType=ns3::RecordingScheduler
+ *   --ns3::RecordingScheduler::FileName=events.trace
+ * \endcode
+ *
+ * The file starts with the 8 characters `ns3evtrc` followed by the
+ * version of the format as a 32-bit integer.  Each record then stores,
+ * in host byte order and without padding:
+ *
+ * Field     | Size    | Content
+ * :-------- | :------ | :------
+ * operation | 1 byte  | RecordingScheduler::Operation
+ * cancelled | 1 byte  | whether the event had been cancelled (RemoveNext only)
+ * kind      | 2 bytes | the kind of the event
+ * context   | 4 bytes | the context of the event
+ * uid       | 4 bytes | the unique id of the event
+ * ts        | 8 bytes | the timestamp of the event
+ * delay     | 8 bytes | the timestamp minus the timestamp of the last event removed
+ *
+ * The kind of an event is the dynamic type of its EventImpl, which
+ * identifies the function or the method the event invokes (up to its
+ * signature) or the lambda it runs.  The kinds are numbered in the order
+ * they first appear in the trace and each of them is defined, before the
+ * first record of an event of this kind, by a definition made of the
+ * operation RecordingScheduler::KIND (1 byte), the length of the name
+ * (4 bytes) and the name of the type as returned by std::type_info::name().
+ *
+ * The delay of the events inserted is relative to the simulation time
+ * at which they were scheduled, since the simulator sets its time to the
+ * timestamp of the events it removes.
+ */
+class RecordingScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Operations performed on the scheduler. */
+    enum Operation : uint8_t
+    {
+        INSERT = 0,      //!< Insert()
+        REMOVE_NEXT = 1, //!< RemoveNext()
+        REMOVE = 2,      //!< Remove()
+        KIND = 3,        //!< definition of an event kind (not returned by ReadTrace())
+    };
+
+    /** A record of the trace. */
+    struct Record
+    {
+        Operation operation; //!< the operation
+        bool cancelled;      //!< whether the event had been cancelled
+        uint16_t kind;       //!< the kind of the event
+        uint32_t context;    //!< the context of the event
+        uint32_t uid;        //!< the unique id of the event
+        uint64_t ts;         //!< the timestamp of the event
+        uint64_t delay;      //!< the timestamp minus the timestamp of the last event removed
+    };
+
+    /**
+     * Read a trace recorded by this scheduler.
+     *
+     * \param [in] filename The name of the trace file.
+     * \param [out] kinds If not null, the names of the event kinds, indexed
+     *        by Record::kind.
+     * \returns The records of the trace.
+     */
+    static std::vector<Record> ReadTrace(const std::string& filename,
+                                         std::vector<std::string>* kinds = nullptr);
+
+    /** Constructor. */
+    RecordingScheduler();
+    /** Destructor. */
+    ~RecordingScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /**
+     * Set the type of the scheduler the operations are forwarded to.
+     *
+     * This can only be used at construction, as invoked by the
+     * Attribute Scheduler.
+     *
+     * \param [in] tid The TypeId of the scheduler.
+     */
+    void SetScheduler(TypeId tid);
+    /**
+     * Open the trace file and write its header.
+     *
+     * This can only be used at construction, as invoked by the
+     * Attribute FileName.
+     *
+     * \param [in] filename The name of the trace file.
+     */
+    void SetFileName(std::string filename);
+    /**
+     * Append a record to the trace file.
+     *
+     * \param [in] operation The operation.
+     * \param [in] ev The event.
+     */
+    void Append(Operation operation, const Scheduler::Event& ev);
+
+    Ptr<Scheduler> m_scheduler; //!< The scheduler the operations are forwarded to.
+    std::ofstream m_file;       //!< The trace file.
+    uint64_t m_lastTs;          //!< The timestamp of the last event removed.
+    /** The event kinds defined in the trace file so far, and their index. */
+    std::unordered_map<std::type_index, uint16_t> m_kinds;
+};
+
+} // namespace ns3
+
+#endif /* RECORDING_SCHEDULER_H */
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "timing-wheel-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "type-id.h"
+#include "uinteger.h"
+
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::TimingWheelScheduler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimingWheelScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(TimingWheelScheduler);
+
+namespace
+{
+
+/**
+ * \ingroup scheduler
+ * Compare two events in reverse chronological order.
+ *
+ * \param [in] a The first event.
+ * \param [in] b The second event.
+ * \returns \c true if \p a is later than \p b.
+ */
+bool
+IsLater(const Scheduler::Event& a, const Scheduler::Event& b)
+{
+    return b.key < a.key;
+}
+
+} // unnamed namespace
+
+TypeId
+TimingWheelScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TimingWheelScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<TimingWheelScheduler>()
+            .AddAttribute("Buckets",
+                          "The number of buckets of the wheel",
+                          TypeId::ATTR_CONSTRUCT,
+                          UintegerValue(4096),
+                          MakeUintegerAccessor(&TimingWheelScheduler::SetBuckets),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("BucketWidth",
+                          "The time span covered by each bucket of the wheel",
+                          TypeId::ATTR_CONSTRUCT,
+                          TimeValue(MicroSeconds(5)),
+                          MakeTimeAccessor(&TimingWheelScheduler::SetBucketWidth,
+                                           &TimingWheelScheduler::GetBucketWidth),
+                          MakeTimeChecker(TimeStep(1)));
+    return tid;
+}
+
+TimingWheelScheduler::TimingWheelScheduler()
+    : m_nBuckets(1),
+      m_width(1),
+      m_qSize(0),
+      m_currentBucket(0),
+      m_wheel(1),
+      m_wheelSize(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TimingWheelScheduler::~TimingWheelScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TimingWheelScheduler::SetBuckets(uint32_t nBuckets)
+{
+    NS_LOG_FUNCTION(this << nBuckets);
+    NS_ASSERT_MSG(m_qSize == 0, "Cannot resize the wheel of a non empty scheduler");
+    NS_ASSERT(nBuckets > 0);
+    m_nBuckets = nBuckets;
+    m_wheel.assign(m_nBuckets, Bucket());
+}
+
+void
+TimingWheelScheduler::SetBucketWidth(Time width)
+{
+    NS_LOG_FUNCTION(this << width);
+    NS_ASSERT_MSG(m_qSize == 0, "Cannot change the bucket width of a non empty scheduler");
+    m_width = std::max<int64_t>(width.GetTimeStep(), 1);
+}
+
+Time
+TimingWheelScheduler::GetBucketWidth() const
+{
+    return TimeStep(m_width);
+}
+
+uint64_t
+TimingWheelScheduler::GetBucket(uint64_t ts) const
+{
+    return ts / m_width;
+}
+
+void
+TimingWheelScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+
+    uint64_t bucket = GetBucket(ev.key.m_ts);
+    if (bucket <= m_currentBucket)
+    {
+        m_current.insert(std::lower_bound(m_current.begin(), m_current.end(), ev, IsLater), ev);
+    }
+    else if (bucket - m_currentBucket < m_nBuckets)
+    {
+        m_wheel[bucket % m_nBuckets].push_back(ev);
+        m_wheelSize++;
+    }
+    else
+    {
+        bool inserted [[maybe_unused]] = m_far.emplace(ev.key, ev.impl).second;
+        NS_ASSERT(inserted);
+    }
+    m_qSize++;
+}
+
+bool
+TimingWheelScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_qSize == 0;
+}
+
+Scheduler::Event
+TimingWheelScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+
+    Advance();
+    return m_current.back();
+}
+
+Scheduler::Event
+TimingWheelScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+
+    Advance();
+    Scheduler::Event ev = m_current.back();
+    m_current.pop_back();
+    m_qSize--;
+    NS_LOG_DEBUG("remove " << ev.key.m_ts << ", " << ev.key.m_uid << ", " << ev.impl);
+    return ev;
+}
+
+void
+TimingWheelScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+    NS_ASSERT(!IsEmpty());
+
+    uint64_t bucket = GetBucket(ev.key.m_ts);
+    if (bucket <= m_currentBucket)
+    {
+        auto it = std::lower_bound(m_current.begin(), m_current.end(), ev, IsLater);
+        NS_ASSERT(it != m_current.end() && it->key == ev.key);
+        NS_ASSERT(it->impl == ev.impl);
+        m_current.erase(it);
+    }
+    else if (bucket - m_currentBucket < m_nBuckets)
+    {
+        Bucket& events = m_wheel[bucket % m_nBuckets];
+        auto it = std::find_if(events.begin(), events.end(), [&ev](const Scheduler::Event& e) {
+            return e.key == ev.key;
+        });
+        NS_ASSERT(it != events.end());
+        NS_ASSERT(it->impl == ev.impl);
+        // events are not sorted within the buckets of the wheel
+        *it = events.back();
+        events.pop_back();
+        m_wheelSize--;
+    }
+    else
+    {
+        auto it = m_far.find(ev.key);
+        NS_ASSERT(it != m_far.end());
+        NS_ASSERT(it->second == ev.impl);
+        m_far.erase(it);
+    }
+    m_qSize--;
+}
+
+void
+TimingWheelScheduler::PullFarEvents() const
+{
+    NS_LOG_FUNCTION(this);
+
+    while (!m_far.empty())
+    {
+        auto it = m_far.begin();
+        uint64_t bucket = GetBucket(it->first.m_ts);
+        NS_ASSERT(bucket >= m_currentBucket);
+        if (bucket - m_currentBucket >= m_nBuckets)
+        {
+            break;
+        }
+        m_wheel[bucket % m_nBuckets].push_back({it->second, it->first});
+        m_wheelSize++;
+        m_far.erase(it);
+    }
+}
+
+void
+TimingWheelScheduler::Advance() const
+{
+    if (!m_current.empty() || m_qSize == 0)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        if (m_wheelSize == 0)
+        {
+            // jump to the bucket of the earliest far event
+            NS_ASSERT(!m_far.empty());
+            m_currentBucket = GetBucket(m_far.begin()->first.m_ts);
+        }
+        else
+        {
+            m_currentBucket++;
+        }
+        PullFarEvents();
+
+        Bucket& events = m_wheel[m_currentBucket % m_nBuckets];
+        if (!events.empty())
+        {
+            m_wheelSize -= events.size();
+            // m_current is empty: swapping keeps the memory of both vectors for reuse
+            m_current.swap(events);
+            std::sort(m_current.begin(), m_current.end(), IsLater);
+            NS_LOG_DEBUG("advanced to bucket " << m_currentBucket << " holding "
+                                               << m_current.size() << " events");
+            return;
+        }
+    }
+}
+
+} // namespace ns3
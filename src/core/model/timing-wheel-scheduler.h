@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TIMING_WHEEL_SCHEDULER_H
+#define TIMING_WHEEL_SCHEDULER_H
+
+#include "nstime.h"
+#include "scheduler.h"
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::TimingWheelScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup scheduler
+ * \brief a two-level timing wheel event scheduler
+ *
+ * This event scheduler is tuned for event distributions where most of
+ * the events are scheduled a short time ahead (e.g., the interframe spaces,
+ * slots and PPDU receptions of wireless models) and a few events are
+ * scheduled far in the future (e.g., periodic timers).
+ *
+ * Time is divided in buckets of uniform width (the BucketWidth attribute).
+ * The events falling in the near future, i.e., in the buckets following
+ * the current one up to the number of buckets of the wheel (the Buckets
+ * attribute), are appended to the unsorted vector of their bucket.
+ * The events beyond the wheel horizon are stored in a `std::map`, and are
+ * moved to the wheel as the wheel advances.  When the current bucket has
+ * been emptied, the wheel advances to the next non empty bucket (or jumps
+ * to the earliest far event, if the wheel is empty) and the events of that
+ * bucket are sorted once; the events of the current bucket are kept in a
+ * vector sorted in reverse chronological order, so that the next event
+ * is removed from its back.
+ *
+ * Events are only sorted when their bucket becomes the current one,
+ * hence inserting an event in the wheel has constant cost, while the cost
+ * of sorting is shared by the (usually few) events of a bucket.
+ * Removing an arbitrary event only searches its bucket, or the map for
+ * far events.
+ *
+ * \par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | ~Constant       | `std::vector::push_back()` in the wheel; logarithmic beyond
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | ~Constant       | Search next non empty bucket, sort it
+ * Remove()     | ~Constant       | Search within bucket; logarithmic beyond the wheel
+ * RemoveNext() | ~Constant       | Search next non empty bucket, sort it
+ *
+ * \par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 3 x `sizeof (*)` per bucket      | `std::vector`
+ * Per Event | 16 bytes in the wheel, 48 bytes beyond | `std::vector`, red-black tree
+ */
+class TimingWheelScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  \return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    TimingWheelScheduler();
+    /** Destructor. */
+    ~TimingWheelScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /**
+     * Set the number of buckets of the wheel.
+     *
+     * This can only be used at construction, as invoked by the
+     * Attribute Buckets.
+     *
+     * \param [in] nBuckets The number of buckets.
+     */
+    void SetBuckets(uint32_t nBuckets);
+    /**
+     * Set the width of the buckets.
+     *
+     * This can only be used at construction, as invoked by the
+     * Attribute BucketWidth.
+     *
+     * \param [in] width The width of the buckets.
+     */
+    void SetBucketWidth(Time width);
+    /**
+     * Get the width of the buckets.
+     *
+     * \returns The width of the buckets.
+     */
+    Time GetBucketWidth() const;
+    /**
+     * Get the (absolute) bucket number of a dimensionless time.
+     *
+     * \param [in] ts The dimensionless time.
+     * \returns The bucket number.
+     */
+    inline uint64_t GetBucket(uint64_t ts) const;
+    /**
+     * Move the far events falling within the wheel horizon to the wheel.
+     */
+    void PullFarEvents() const;
+    /**
+     * If the current bucket is empty, advance the wheel to the next
+     * non empty bucket and sort its events.
+     *
+     * This method does not change the set of events stored by this
+     * scheduler, hence it is const.
+     */
+    void Advance() const;
+
+    /** Bucket type: a vector of Events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+    /** Far events type: a Map from EventKey to EventImpl. */
+    typedef std::map<Scheduler::EventKey, EventImpl*> EventMap;
+
+    uint32_t m_nBuckets; //!< Number of buckets of the wheel.
+    uint64_t m_width;    //!< Width of a bucket, in dimensionless time units.
+    uint32_t m_qSize;    //!< Number of events in queue.
+
+    /*
+     * The members below are mutable because PeekNext may need to advance
+     * the wheel to find the next event.
+     */
+
+    /** Current bucket number; all the events in earlier buckets are in m_current. */
+    mutable uint64_t m_currentBucket;
+    /** Events up to the current bucket, in reverse chronological order. */
+    mutable Bucket m_current;
+    /** The buckets following the current one, indexed by bucket number modulo m_nBuckets. */
+    mutable std::vector<Bucket> m_wheel;
+    /** Number of events in the buckets of the wheel. */
+    mutable uint32_t m_wheelSize;
+    /** Events beyond the wheel horizon. */
+    mutable EventMap m_far;
+};
+
+} // namespace ns3
+
+#endif /* TIMING_WHEEL_SCHEDULER_H */
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/config.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \file
+ * \ingroup multithreaded-simulator-tests
+ * Multithreaded simulator test suite
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup multithreaded-simulator-tests Multithreaded simulator tests
+ */
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * \brief Check that the MultithreadedSimulatorImpl runs the same events at
+ * the same times as the DefaultSimulatorImpl.
+ *
+ * Each context runs chains of events, which are scheduled either in the
+ * same context or in another context (possibly of another partition),
+ * and rearm a timer which only expires at the end of the chains.  The
+ * simulation is optionally stopped, more than the lookahead after the
+ * start, with Simulator::Stop(delay).  The lookahead is either set with the
+ * Lookahead attribute or derived from lookahead sources.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * \param partitions The number of partitions.
+     * \param stop The time at which the simulation is stopped, if strictly positive.
+     * \param lookaheadSources Whether the lookahead is derived from lookahead sources.
+     */
+    MultithreadedSimulatorTestCase(uint32_t partitions,
+                                   Time stop = Time(),
+                                   bool lookaheadSources = false);
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+
+    /// Number of contexts.
+    static constexpr uint32_t N_CONTEXTS = 8;
+
+    /** The results of a simulation. */
+    struct Results
+    {
+        std::array<std::vector<int64_t>, N_CONTEXTS> times; //!< Times of the events, per context
+        std::array<uint32_t, N_CONTEXTS> timeouts{};        //!< Timers expired, per context
+        std::array<EventId, N_CONTEXTS> timers;             //!< Timer, per context
+        std::array<uint32_t, N_CONTEXTS> badContexts{};     //!< Events run in another context
+        uint64_t eventCount{0};                             //!< Events run by the simulator
+    };
+
+    /**
+     * Run a simulation.
+     *
+     * \param [in] simulatorType The simulator implementation type.
+     * \returns The results of the simulation.
+     */
+    Results RunSimulation(const std::string& simulatorType);
+    /**
+     * Event of a chain.
+     *
+     * \param [in] results The results of the simulation.
+     * \param [in] context The context the event is scheduled for.
+     * \param [in] hops The number of events before this one in the chain.
+     */
+    static void Hop(Results* results, uint32_t context, uint32_t hops);
+    /**
+     * Timer expiration.
+     *
+     * \param [in] results The results of the simulation.
+     * \param [in] context The context of the timer.
+     */
+    static void Timeout(Results* results, uint32_t context);
+
+    uint32_t m_partitions;   //!< The number of partitions.
+    Time m_stop;             //!< The time at which the simulation is stopped.
+    bool m_lookaheadSources; //!< Whether the lookahead is derived from lookahead sources.
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase(uint32_t partitions,
+                                                               Time stop,
+                                                               bool lookaheadSources)
+    : TestCase("Check the MultithreadedSimulatorImpl with " + std::to_string(partitions) +
+               " partitions" + (stop.IsStrictlyPositive() ? " and Simulator::Stop()" : "") +
+               (lookaheadSources ? " and lookahead sources" : "")),
+      m_partitions(partitions),
+      m_stop(stop),
+      m_lookaheadSources(lookaheadSources)
+{
+}
+
+void
+MultithreadedSimulatorTestCase::Hop(Results* results, uint32_t context, uint32_t hops)
+{
+    // each context is only accessed by the thread of its partition
+    if (Simulator::GetContext() != context)
+    {
+        results->badContexts[context]++;
+    }
+    results->times[context].push_back(Simulator::Now().GetTimeStep());
+    results->timers[context].Cancel();
+    results->timers[context] = Simulator::Schedule(MicroSeconds(100),
+                                                   &MultithreadedSimulatorTestCase::Timeout,
+                                                   results,
+                                                   context);
+
+    if (Simulator::Now() >= MilliSeconds(1))
+    {
+        return;
+    }
+    if (hops % 3 == 2)
+    {
+        uint32_t next = (context + 1 + hops % 5) % N_CONTEXTS;
+        Simulator::ScheduleWithContext(next,
+                                       MicroSeconds(1) + NanoSeconds((hops * 7) % 300),
+                                       &MultithreadedSimulatorTestCase::Hop,
+                                       results,
+                                       next,
+                                       hops + 1);
+    }
+    else
+    {
+        Simulator::Schedule(NanoSeconds((context * 37 + hops * 13) % 500),
+                            &MultithreadedSimulatorTestCase::Hop,
+                            results,
+                            context,
+                            hops + 1);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Timeout(Results* results, uint32_t context)
+{
+    results->timeouts[context]++;
+}
+
+MultithreadedSimulatorTestCase::Results
+MultithreadedSimulatorTestCase::RunSimulation(const std::string& simulatorType)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    if (auto simulator = MultithreadedSimulatorImpl::GetInstance(); simulator && m_lookaheadSources)
+    {
+        // the lookahead is the minimum delay returned by the sources
+        simulator->AddLookaheadSource(Callback<Time>([]() { return MicroSeconds(2); }));
+        simulator->AddLookaheadSource(Callback<Time>([]() { return MicroSeconds(1); }));
+        simulator->AddLookaheadSource(Callback<Time>([]() { return Time::Max(); }));
+    }
+
+    Results results;
+    for (uint32_t context = 0; context < N_CONTEXTS; context++)
+    {
+        for (uint32_t chain = 0; chain < 2; chain++)
+        {
+            Simulator::ScheduleWithContext(context,
+                                           NanoSeconds(context * 10 + chain),
+                                           &MultithreadedSimulatorTestCase::Hop,
+                                           &results,
+                                           context,
+                                           chain);
+        }
+    }
+    if (m_stop.IsStrictlyPositive())
+    {
+        Simulator::Stop(m_stop);
+    }
+    Simulator::Run();
+    results.eventCount = Simulator::GetEventCount();
+    Simulator::Destroy();
+    return results;
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun()
+{
+    Results expected = RunSimulation("ns3::DefaultSimulatorImpl");
+
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::Partitions", UintegerValue(m_partitions));
+    if (!m_lookaheadSources)
+    {
+        Config::SetDefault("ns3::MultithreadedSimulatorImpl::Lookahead",
+                           TimeValue(MicroSeconds(1)));
+    }
+    Results results = RunSimulation("ns3::MultithreadedSimulatorImpl");
+
+    // the DefaultSimulatorImpl runs an event to stop the simulation
+    NS_TEST_EXPECT_MSG_EQ(results.eventCount + (m_stop.IsStrictlyPositive() ? 1 : 0),
+                          expected.eventCount,
+                          "Unexpected number of events");
+    for (uint32_t context = 0; context < N_CONTEXTS; context++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(results.badContexts[context],
+                              0,
+                              "Event run in another context than " << context);
+        NS_TEST_EXPECT_MSG_EQ(results.timeouts[context],
+                              expected.timeouts[context],
+                              "Unexpected number of timeouts in context " << context);
+        NS_TEST_EXPECT_MSG_EQ((results.times[context] == expected.times[context]),
+                              true,
+                              "Unexpected events in context " << context);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+    Config::Reset();
+}
+
+/**
+ * \ingroup multithreaded-simulator-tests
+ *
+ * \brief The multithreaded simulator Test Suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite()
+        : TestSuite("multithreaded-simulator")
+    {
+        for (uint32_t partitions : {1, 3, 4})
+        {
+            AddTestCase(new MultithreadedSimulatorTestCase(partitions), TestCase::QUICK);
+        }
+        AddTestCase(new MultithreadedSimulatorTestCase(3, MicroSeconds(500) + NanoSeconds(3)),
+                    TestCase::QUICK);
+        AddTestCase(new MultithreadedSimulatorTestCase(4, Time(), true), TestCase::QUICK);
+    }
+};
+
+/// Static variable for test initialization.
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite;
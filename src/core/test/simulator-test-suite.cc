@@ -21,8 +21,12 @@
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/recording-scheduler.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
+#include "ns3/timing-wheel-scheduler.h"
+#include "ns3/uinteger.h"
 
 using namespace ns3;
 
@@ -707,6 +711,79 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the RecordingScheduler records the operations performed on the scheduler.
+ */
+class RecordingSchedulerTestCase : public TestCase
+{
+  public:
+    RecordingSchedulerTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+RecordingSchedulerTestCase::RecordingSchedulerTestCase()
+    : TestCase("Check that the scheduler operations are recorded by the RecordingScheduler")
+{
+}
+
+void
+RecordingSchedulerTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("scheduler.evtrace");
+    ObjectFactory factory;
+    factory.SetTypeId(RecordingScheduler::GetTypeId());
+    factory.Set("Scheduler", TypeIdValue(HeapScheduler::GetTypeId()));
+    factory.Set("FileName", StringValue(filename));
+    Simulator::SetScheduler(factory);
+
+    // a and b are of the same kind, c is of another kind
+    auto nothing = []() {};
+    EventId a = Simulator::Schedule(MicroSeconds(10), nothing);
+    EventId b = Simulator::Schedule(MicroSeconds(20), nothing);
+    EventId c = Simulator::Schedule(MicroSeconds(30), []() {});
+    Simulator::Cancel(a);
+    Simulator::Remove(c);
+    Simulator::Run();
+    // the trace file is closed when the scheduler is destroyed
+    Simulator::Destroy();
+
+    const std::vector<std::pair<RecordingScheduler::Operation, EventId>> expected{
+        {RecordingScheduler::INSERT, a},
+        {RecordingScheduler::INSERT, b},
+        {RecordingScheduler::INSERT, c},
+        {RecordingScheduler::REMOVE, c},
+        {RecordingScheduler::REMOVE_NEXT, a},
+        {RecordingScheduler::REMOVE_NEXT, b},
+    };
+    std::vector<std::string> kinds;
+    auto records = RecordingScheduler::ReadTrace(filename, &kinds);
+    NS_TEST_ASSERT_MSG_EQ(records.size(), expected.size(), "Unexpected number of records");
+    NS_TEST_ASSERT_MSG_EQ(kinds.size(), 2, "Unexpected number of event kinds");
+    NS_TEST_EXPECT_MSG_NE(kinds[0], kinds[1], "The event kinds should have different names");
+
+    uint64_t lastTs = 0;
+    for (std::size_t i = 0; i < records.size(); i++)
+    {
+        const auto& [operation, id] = expected[i];
+        NS_TEST_EXPECT_MSG_EQ(records[i].operation, operation, "Unexpected operation #" << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].uid, id.GetUid(), "Unexpected event #" << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].kind, (id == c ? 1 : 0), "Unexpected kind #" << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].ts, id.GetTs(), "Unexpected timestamp #" << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].delay, id.GetTs() - lastTs, "Unexpected delay #" << i);
+        NS_TEST_EXPECT_MSG_EQ(records[i].cancelled,
+                              (id == a && operation == RecordingScheduler::REMOVE_NEXT),
+                              "Unexpected cancelled flag #" << i);
+        if (operation == RecordingScheduler::REMOVE_NEXT)
+        {
+            lastTs = id.GetTs();
+        }
+    }
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -730,6 +807,13 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        factory.SetTypeId(TimingWheelScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        // a wheel much shorter than the event times, so that most events are far events
+        factory.Set("Buckets", UintegerValue(4));
+        factory.Set("BucketWidth", TimeValue(NanoSeconds(1)));
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        AddTestCase(new RecordingSchedulerTestCase, TestCase::QUICK);
     }
 };
 
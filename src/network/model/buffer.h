@@ -25,7 +25,10 @@
 #include <stdint.h>
 #include <vector>
 
+// the partitions of the MultithreadedSimulatorImpl do not share a free list
+#ifndef NS3_MTP
 #define BUFFER_FREE_LIST 1
+#endif
 
 namespace ns3
 {
@@ -769,7 +772,11 @@ class Buffer
      * writing data. i.e., m_start should be initialized to this
      * value.
      */
+#ifdef NS3_MTP
+    static thread_local uint32_t g_recommendedStart;
+#else
     static uint32_t g_recommendedStart;
+#endif
 
     /**
      * offset to the start of the virtual zero area from the start
@@ -684,10 +684,21 @@ class PacketMetadata
      * m_enable is false; used to detect enabling of metadata in the
      * middle of a simulation, which isn't allowed.
      */
+#ifdef NS3_MTP
+    static thread_local bool m_metadataSkipped;
+#else
     static bool m_metadataSkipped;
-
+#endif
+
+#ifdef NS3_MTP
+    // the partitions of the MultithreadedSimulatorImpl have their own counters and do not
+    // use the free list
+    static thread_local uint32_t m_maxSize;  //!< maximum metadata size
+    static thread_local uint16_t m_chunkUid; //!< Chunk Uid
+#else
     static uint32_t m_maxSize;  //!< maximum metadata size
     static uint16_t m_chunkUid; //!< Chunk Uid
+#endif
 
     Data* m_data; //!< Metadata storage
     /*
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "link-gain-cache.h"
+
+#include "ns3/log.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LinkGainCache");
+
+LinkGainCache::LinkGainCache()
+    : m_lossVersion(0),
+      m_delayVersion(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LinkGainCache::~LinkGainCache()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+const LinkGainCache::Link*
+LinkGainCache::Find(Ptr<const MobilityModel> tx, Ptr<const MobilityModel> rx) const
+{
+    auto it = m_links.find({PeekPointer(tx), PeekPointer(rx)});
+    return (it != m_links.end()) ? &it->second : nullptr;
+}
+
+void
+LinkGainCache::Add(Ptr<MobilityModel> tx, Ptr<MobilityModel> rx, const Link& link)
+{
+    NS_LOG_FUNCTION(this << tx << rx << link.txPowerDbm << link.rxPowerDbm << link.delay);
+    const Vector zero;
+    if (tx->GetVelocity() != zero || rx->GetVelocity() != zero)
+    {
+        NS_LOG_DEBUG("Not caching the link since a node is moving");
+        return;
+    }
+    Subscribe(tx);
+    Subscribe(rx);
+    m_links[{PeekPointer(tx), PeekPointer(rx)}] = link;
+}
+
+std::size_t
+LinkGainCache::GetSize() const
+{
+    return m_links.size();
+}
+
+void
+LinkGainCache::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (const auto& [ptr, mobility] : m_subscribed)
+    {
+        mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&LinkGainCache::NotifyCourseChange, this));
+    }
+    m_subscribed.clear();
+    m_links.clear();
+}
+
+void
+LinkGainCache::CheckVersions(uint64_t lossVersion, uint64_t delayVersion)
+{
+    if (lossVersion != m_lossVersion || delayVersion != m_delayVersion)
+    {
+        NS_LOG_DEBUG("The parameters of the propagation models changed");
+        Clear();
+        m_lossVersion = lossVersion;
+        m_delayVersion = delayVersion;
+    }
+}
+
+void
+LinkGainCache::NotifyCourseChange(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    const auto ptr = PeekPointer(mobility);
+    for (auto it = m_links.begin(); it != m_links.end();)
+    {
+        if (it->first.first == ptr || it->first.second == ptr)
+        {
+            it = m_links.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void
+LinkGainCache::Subscribe(Ptr<MobilityModel> mobility)
+{
+    if (m_subscribed.emplace(PeekPointer(mobility), mobility).second)
+    {
+        mobility->TraceConnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&LinkGainCache::NotifyCourseChange, this));
+    }
+}
+
+} // namespace ns3
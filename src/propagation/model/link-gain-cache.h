@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LINK_GAIN_CACHE_H
+#define LINK_GAIN_CACHE_H
+
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+
+#include <map>
+#include <utility>
+
+namespace ns3
+{
+
+/**
+ * \ingroup propagation
+ *
+ * \brief Cache of the propagation results (received power and delay) of the links
+ * between static nodes, used by the channels to avoid calling the propagation loss
+ * and delay models for every transmission.
+ *
+ * A link is identified by the mobility models of the transmitter and of the receiver
+ * (in this order). Only links between nodes whose velocity is null are cached. The
+ * cache registers to the CourseChange trace source of the mobility models of the
+ * cached links and drops all the links of a node as soon as its course changes.
+ *
+ * It is up to the channel to only use the cache if the propagation models are
+ * cacheable (see PropagationLossModel::IsCacheable) and to drop the cached links when
+ * the parameters of the propagation models change (see CheckVersions).
+ */
+class LinkGainCache
+{
+  public:
+    /// Propagation results of a link
+    struct Link
+    {
+        double txPowerDbm; //!< the transmit power used to compute the received power
+        double rxPowerDbm; //!< the received power
+        Time delay;        //!< the propagation delay
+    };
+
+    LinkGainCache();
+    ~LinkGainCache();
+
+    // Delete copy constructor and assignment operator, since the mobility models
+    // hold callbacks to this object
+    LinkGainCache(const LinkGainCache&) = delete;
+    LinkGainCache& operator=(const LinkGainCache&) = delete;
+
+    /**
+     * \param tx the mobility model of the transmitter
+     * \param rx the mobility model of the receiver
+     * \return a pointer to the cached link, or a null pointer if the link is not cached
+     */
+    const Link* Find(Ptr<const MobilityModel> tx, Ptr<const MobilityModel> rx) const;
+
+    /**
+     * Cache a link. Nothing is done if either node is moving.
+     *
+     * \param tx the mobility model of the transmitter
+     * \param rx the mobility model of the receiver
+     * \param link the propagation results of the link
+     */
+    void Add(Ptr<MobilityModel> tx, Ptr<MobilityModel> rx, const Link& link);
+
+    /**
+     * \return the number of cached links
+     */
+    std::size_t GetSize() const;
+
+    /**
+     * Drop all the cached links and disconnect from the mobility models.
+     */
+    void Clear();
+
+    /**
+     * Drop all the cached links if the parameters of the propagation models changed
+     * since the links were cached.
+     *
+     * \param lossVersion the version of the parameters of the propagation loss model(s)
+     *                    (see PropagationLossModel::GetParametersVersion)
+     * \param delayVersion the version of the parameters of the propagation delay model
+     *                     (see PropagationDelayModel::GetParametersVersion)
+     */
+    void CheckVersions(uint64_t lossVersion, uint64_t delayVersion);
+
+  private:
+    /**
+     * Drop all the cached links of the node whose course changed.
+     *
+     * \param mobility the mobility model of the node
+     */
+    void NotifyCourseChange(Ptr<const MobilityModel> mobility);
+
+    /**
+     * Register to the CourseChange trace source of the given mobility model, if not done yet.
+     *
+     * \param mobility the mobility model
+     */
+    void Subscribe(Ptr<MobilityModel> mobility);
+
+    /// Link identifier: mobility models of the transmitter and of the receiver
+    using LinkId = std::pair<const MobilityModel*, const MobilityModel*>;
+
+    std::map<LinkId, Link> m_links; //!< cached links
+    std::map<const MobilityModel*, Ptr<MobilityModel>>
+        m_subscribed;        //!< mobility models whose CourseChange trace source is connected
+    uint64_t m_lossVersion;  //!< version of the loss model parameters of the cached links
+    uint64_t m_delayVersion; //!< version of the delay model parameters of the cached links
+};
+
+} // namespace ns3
+
+#endif /* LINK_GAIN_CACHE_H */
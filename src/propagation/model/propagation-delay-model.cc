@@ -23,9 +23,17 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <atomic>
+
 namespace ns3
 {
 
+namespace
+{
+/// Last version given to the parameters of a delay model
+std::atomic<uint64_t> g_lastParametersVersion{0};
+} // namespace
+
 NS_OBJECT_ENSURE_REGISTERED(PropagationDelayModel);
 
 TypeId
@@ -46,6 +54,30 @@ PropagationDelayModel::AssignStreams(int64_t stream)
     return DoAssignStreams(stream);
 }
 
+Time
+PropagationDelayModel::GetMinDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
+    return Time(0);
+}
+
+bool
+PropagationDelayModel::IsCacheable() const
+{
+    return false;
+}
+
+uint64_t
+PropagationDelayModel::GetParametersVersion() const
+{
+    return m_parametersVersion;
+}
+
+void
+PropagationDelayModel::NotifyParametersChanged()
+{
+    m_parametersVersion = ++g_lastParametersVersion;
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(RandomPropagationDelayModel);
@@ -101,7 +133,8 @@ ConstantSpeedPropagationDelayModel::GetTypeId()
                           "The propagation speed (m/s) in the propagation medium being considered. "
                           "The default value is the propagation speed of light in the vacuum.",
                           DoubleValue(299792458),
-                          MakeDoubleAccessor(&ConstantSpeedPropagationDelayModel::m_speed),
+                          MakeDoubleAccessor(&ConstantSpeedPropagationDelayModel::SetSpeed,
+                                             &ConstantSpeedPropagationDelayModel::GetSpeed),
                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -118,10 +151,24 @@ ConstantSpeedPropagationDelayModel::GetDelay(Ptr<MobilityModel> a, Ptr<MobilityM
     return Seconds(seconds);
 }
 
+Time
+ConstantSpeedPropagationDelayModel::GetMinDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
+    // the nodes which do not move are assumed to stay where they are, while the moving
+    // nodes may get as close as they can
+    const Vector zero;
+    if (a->GetVelocity() != zero || b->GetVelocity() != zero)
+    {
+        return Time(0);
+    }
+    return GetDelay(a, b);
+}
+
 void
 ConstantSpeedPropagationDelayModel::SetSpeed(double speed)
 {
     m_speed = speed;
+    NotifyParametersChanged();
 }
 
 double
@@ -136,4 +183,10 @@ ConstantSpeedPropagationDelayModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+ConstantSpeedPropagationDelayModel::IsCacheable() const
+{
+    return true;
+}
+
 } // namespace ns3
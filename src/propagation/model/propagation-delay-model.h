@@ -52,6 +52,18 @@ class PropagationDelayModel : public Object
      * source and destination.
      */
     virtual Time GetDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const = 0;
+
+    /**
+     * \param a the source
+     * \param b the destination
+     * \returns a lower bound of the propagation delay between the specified source
+     * and destination until the end of the simulation
+     *
+     * This is used by the channels shared by the partitions of the
+     * MultithreadedSimulatorImpl to compute the lookahead.  The default is zero,
+     * i.e., no lower bound is known.
+     */
+    virtual Time GetMinDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
     /**
      * If this delay model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -62,6 +74,16 @@ class PropagationDelayModel : public Object
      * \return the number of stream indices assigned by this model
      */
     int64_t AssignStreams(int64_t stream);
+    /**
+     * \returns true if the delay between two nodes stays the same as long as the nodes
+     * do not move, in which case the channels may cache it. The default is false.
+     */
+    virtual bool IsCacheable() const;
+    /**
+     * \returns a number that changes whenever a parameter affecting the delay computed by
+     * this model changes, so that the channels know when the cached delays become stale
+     */
+    uint64_t GetParametersVersion() const;
 
   protected:
     /**
@@ -74,6 +96,15 @@ class PropagationDelayModel : public Object
      * \return the number of stream indices assigned by this model
      */
     virtual int64_t DoAssignStreams(int64_t stream) = 0;
+
+    /**
+     * Subclasses that can be cached (see IsCacheable) must call this method whenever
+     * a parameter affecting the computed delay changes.
+     */
+    void NotifyParametersChanged();
+
+  private:
+    uint64_t m_parametersVersion{0}; //!< Version of the parameters of this model
 };
 
 /**
@@ -121,6 +152,8 @@ class ConstantSpeedPropagationDelayModel : public PropagationDelayModel
      */
     ConstantSpeedPropagationDelayModel();
     Time GetDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const override;
+    Time GetMinDelay(Ptr<MobilityModel> a, Ptr<MobilityModel> b) const override;
+    bool IsCacheable() const override;
     /**
      * \param speed the new speed (m/s)
      */
@@ -29,13 +29,23 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
 
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("PropagationLossModel");
 
+namespace
+{
+/// Last version given to the parameters of a loss model; a single counter is shared by all
+/// the models so that the version of a chain increases whenever any model of the chain changes
+std::atomic<uint64_t> g_lastParametersVersion{0};
+} // namespace
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(PropagationLossModel);
@@ -49,7 +59,8 @@ PropagationLossModel::GetTypeId()
 }
 
 PropagationLossModel::PropagationLossModel()
-    : m_next(nullptr)
+    : m_next(nullptr),
+      m_parametersVersion(0)
 {
 }
 
@@ -61,6 +72,7 @@ void
 PropagationLossModel::SetNext(Ptr<PropagationLossModel> next)
 {
     m_next = next;
+    NotifyParametersChanged();
 }
 
 Ptr<PropagationLossModel>
@@ -94,6 +106,48 @@ PropagationLossModel::AssignStreams(int64_t stream)
     return (currentStream - stream);
 }
 
+bool
+PropagationLossModel::IsCacheable() const
+{
+    return DoIsCacheable() && (!m_next || m_next->IsCacheable());
+}
+
+bool
+PropagationLossModel::DoIsCacheable() const
+{
+    return false;
+}
+
+uint64_t
+PropagationLossModel::GetParametersVersion() const
+{
+    return m_next ? std::max(m_parametersVersion, m_next->GetParametersVersion())
+                  : m_parametersVersion;
+}
+
+void
+PropagationLossModel::NotifyParametersChanged()
+{
+    m_parametersVersion = ++g_lastParametersVersion;
+}
+
+double
+PropagationLossModel::GetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    if (m_next)
+    {
+        // the chained models may increase the reception power
+        return std::numeric_limits<double>::infinity();
+    }
+    return DoGetMaxRange(txPowerDbm, rxPowerDbm);
+}
+
+double
+PropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    return std::numeric_limits<double>::infinity();
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(RandomPropagationLossModel);
@@ -163,7 +217,8 @@ FriisPropagationLossModel::GetTypeId()
             .AddAttribute("SystemLoss",
                           "The system loss",
                           DoubleValue(1.0),
-                          MakeDoubleAccessor(&FriisPropagationLossModel::m_systemLoss),
+                          MakeDoubleAccessor(&FriisPropagationLossModel::SetSystemLoss,
+                                             &FriisPropagationLossModel::GetSystemLoss),
                           MakeDoubleChecker<double>())
             .AddAttribute("MinLoss",
                           "The minimum value (dB) of the total loss, used at short ranges.",
@@ -182,6 +237,7 @@ void
 FriisPropagationLossModel::SetSystemLoss(double systemLoss)
 {
     m_systemLoss = systemLoss;
+    NotifyParametersChanged();
 }
 
 double
@@ -194,6 +250,7 @@ void
 FriisPropagationLossModel::SetMinLoss(double minLoss)
 {
     m_minLoss = minLoss;
+    NotifyParametersChanged();
 }
 
 double
@@ -208,6 +265,7 @@ FriisPropagationLossModel::SetFrequency(double frequency)
     m_frequency = frequency;
     static const double C = 299792458.0; // speed of light in vacuum
     m_lambda = C / frequency;
+    NotifyParametersChanged();
 }
 
 double
@@ -287,6 +345,26 @@ FriisPropagationLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+FriisPropagationLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
+double
+FriisPropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    double maxLossDb = txPowerDbm - rxPowerDbm;
+    if (m_minLoss > maxLossDb)
+    {
+        return 0;
+    }
+    // invert the Friis equation; the small margin accounts for rounding errors
+    double distance =
+        m_lambda / (4 * M_PI) * std::sqrt(std::pow(10, maxLossDb / 10) / m_systemLoss);
+    return distance * (1 + 1e-9);
+}
+
 // ------------------------------------------------------------------------- //
 // -- Two-Ray Ground Model ported from NS-2 -- tomhewer@mac.com -- Nov09 //
 
@@ -310,7 +388,8 @@ TwoRayGroundPropagationLossModel::GetTypeId()
             .AddAttribute("SystemLoss",
                           "The system loss",
                           DoubleValue(1.0),
-                          MakeDoubleAccessor(&TwoRayGroundPropagationLossModel::m_systemLoss),
+                          MakeDoubleAccessor(&TwoRayGroundPropagationLossModel::SetSystemLoss,
+                                             &TwoRayGroundPropagationLossModel::GetSystemLoss),
                           MakeDoubleChecker<double>())
             .AddAttribute(
                 "MinDistance",
@@ -322,7 +401,8 @@ TwoRayGroundPropagationLossModel::GetTypeId()
             .AddAttribute("HeightAboveZ",
                           "The height of the antenna (m) above the node's Z coordinate",
                           DoubleValue(0),
-                          MakeDoubleAccessor(&TwoRayGroundPropagationLossModel::m_heightAboveZ),
+                          MakeDoubleAccessor(&TwoRayGroundPropagationLossModel::SetHeightAboveZ,
+                                             &TwoRayGroundPropagationLossModel::GetHeightAboveZ),
                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -335,6 +415,7 @@ void
 TwoRayGroundPropagationLossModel::SetSystemLoss(double systemLoss)
 {
     m_systemLoss = systemLoss;
+    NotifyParametersChanged();
 }
 
 double
@@ -347,6 +428,7 @@ void
 TwoRayGroundPropagationLossModel::SetMinDistance(double minDistance)
 {
     m_minDistance = minDistance;
+    NotifyParametersChanged();
 }
 
 double
@@ -359,6 +441,13 @@ void
 TwoRayGroundPropagationLossModel::SetHeightAboveZ(double heightAboveZ)
 {
     m_heightAboveZ = heightAboveZ;
+    NotifyParametersChanged();
+}
+
+double
+TwoRayGroundPropagationLossModel::GetHeightAboveZ() const
+{
+    return m_heightAboveZ;
 }
 
 void
@@ -367,6 +456,7 @@ TwoRayGroundPropagationLossModel::SetFrequency(double frequency)
     m_frequency = frequency;
     static const double C = 299792458.0; // speed of light in vacuum
     m_lambda = C / frequency;
+    NotifyParametersChanged();
 }
 
 double
@@ -468,6 +558,12 @@ TwoRayGroundPropagationLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+TwoRayGroundPropagationLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(LogDistancePropagationLossModel);
@@ -483,18 +579,22 @@ LogDistancePropagationLossModel::GetTypeId()
             .AddAttribute("Exponent",
                           "The exponent of the Path Loss propagation model",
                           DoubleValue(3.0),
-                          MakeDoubleAccessor(&LogDistancePropagationLossModel::m_exponent),
+                          MakeDoubleAccessor(&LogDistancePropagationLossModel::SetPathLossExponent,
+                                             &LogDistancePropagationLossModel::GetPathLossExponent),
                           MakeDoubleChecker<double>())
             .AddAttribute("ReferenceDistance",
                           "The distance at which the reference loss is calculated (m)",
                           DoubleValue(1.0),
-                          MakeDoubleAccessor(&LogDistancePropagationLossModel::m_referenceDistance),
+                          MakeDoubleAccessor(
+                              &LogDistancePropagationLossModel::SetReferenceDistance,
+                              &LogDistancePropagationLossModel::GetReferenceDistance),
                           MakeDoubleChecker<double>())
             .AddAttribute("ReferenceLoss",
                           "The reference loss at reference distance (dB). (Default is Friis at 1m "
                           "with 5.15 GHz)",
                           DoubleValue(46.6777),
-                          MakeDoubleAccessor(&LogDistancePropagationLossModel::m_referenceLoss),
+                          MakeDoubleAccessor(&LogDistancePropagationLossModel::SetReferenceLoss,
+                                             &LogDistancePropagationLossModel::GetReferenceLoss),
                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -507,6 +607,7 @@ void
 LogDistancePropagationLossModel::SetPathLossExponent(double n)
 {
     m_exponent = n;
+    NotifyParametersChanged();
 }
 
 void
@@ -514,6 +615,31 @@ LogDistancePropagationLossModel::SetReference(double referenceDistance, double r
 {
     m_referenceDistance = referenceDistance;
     m_referenceLoss = referenceLoss;
+    NotifyParametersChanged();
+}
+
+void
+LogDistancePropagationLossModel::SetReferenceDistance(double referenceDistance)
+{
+    SetReference(referenceDistance, m_referenceLoss);
+}
+
+double
+LogDistancePropagationLossModel::GetReferenceDistance() const
+{
+    return m_referenceDistance;
+}
+
+void
+LogDistancePropagationLossModel::SetReferenceLoss(double referenceLoss)
+{
+    SetReference(m_referenceDistance, referenceLoss);
+}
+
+double
+LogDistancePropagationLossModel::GetReferenceLoss() const
+{
+    return m_referenceLoss;
 }
 
 double
@@ -560,6 +686,26 @@ LogDistancePropagationLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+LogDistancePropagationLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
+double
+LogDistancePropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    double maxLossDb = txPowerDbm - rxPowerDbm;
+    if (m_referenceLoss > maxLossDb)
+    {
+        return 0;
+    }
+    // invert the log distance equation; the small margin accounts for rounding errors
+    double distance =
+        m_referenceDistance * std::pow(10, (maxLossDb - m_referenceLoss) / (10 * m_exponent));
+    return distance * (1 + 1e-9);
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(ThreeLogDistancePropagationLossModel);
@@ -790,7 +936,8 @@ FixedRssLossModel::GetTypeId()
                             .AddAttribute("Rss",
                                           "The fixed receiver Rss.",
                                           DoubleValue(-150.0),
-                                          MakeDoubleAccessor(&FixedRssLossModel::m_rss),
+                                          MakeDoubleAccessor(&FixedRssLossModel::SetRss,
+                                                             &FixedRssLossModel::GetRss),
                                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -808,6 +955,13 @@ void
 FixedRssLossModel::SetRss(double rss)
 {
     m_rss = rss;
+    NotifyParametersChanged();
+}
+
+double
+FixedRssLossModel::GetRss() const
+{
+    return m_rss;
 }
 
 double
@@ -824,6 +978,12 @@ FixedRssLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+FixedRssLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(MatrixPropagationLossModel);
@@ -839,7 +999,8 @@ MatrixPropagationLossModel::GetTypeId()
             .AddAttribute("DefaultLoss",
                           "The default value for propagation loss, dB.",
                           DoubleValue(std::numeric_limits<double>::max()),
-                          MakeDoubleAccessor(&MatrixPropagationLossModel::m_default),
+                          MakeDoubleAccessor(&MatrixPropagationLossModel::SetDefaultLoss,
+                                             &MatrixPropagationLossModel::GetDefaultLoss),
                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -858,6 +1019,13 @@ void
 MatrixPropagationLossModel::SetDefaultLoss(double loss)
 {
     m_default = loss;
+    NotifyParametersChanged();
+}
+
+double
+MatrixPropagationLossModel::GetDefaultLoss() const
+{
+    return m_default;
 }
 
 void
@@ -884,6 +1052,7 @@ MatrixPropagationLossModel::SetLoss(Ptr<MobilityModel> ma,
     {
         SetLoss(mb, ma, loss, false);
     }
+    NotifyParametersChanged();
 }
 
 double
@@ -909,6 +1078,12 @@ MatrixPropagationLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+MatrixPropagationLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
 // ------------------------------------------------------------------------- //
 
 NS_OBJECT_ENSURE_REGISTERED(RangePropagationLossModel);
@@ -923,7 +1098,8 @@ RangePropagationLossModel::GetTypeId()
                             .AddAttribute("MaxRange",
                                           "Maximum Transmission Range (meters)",
                                           DoubleValue(250),
-                                          MakeDoubleAccessor(&RangePropagationLossModel::m_range),
+                                          MakeDoubleAccessor(&RangePropagationLossModel::SetRange,
+                                                             &RangePropagationLossModel::GetRange),
                                           MakeDoubleChecker<double>());
     return tid;
 }
@@ -932,6 +1108,19 @@ RangePropagationLossModel::RangePropagationLossModel()
 {
 }
 
+void
+RangePropagationLossModel::SetRange(double range)
+{
+    m_range = range;
+    NotifyParametersChanged();
+}
+
+double
+RangePropagationLossModel::GetRange() const
+{
+    return m_range;
+}
+
 double
 RangePropagationLossModel::DoCalcRxPower(double txPowerDbm,
                                          Ptr<MobilityModel> a,
@@ -954,6 +1143,23 @@ RangePropagationLossModel::DoAssignStreams(int64_t stream)
     return 0;
 }
 
+bool
+RangePropagationLossModel::DoIsCacheable() const
+{
+    return true;
+}
+
+double
+RangePropagationLossModel::DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const
+{
+    if (rxPowerDbm <= -1000)
+    {
+        // the power received out of range is not lower than the threshold
+        return std::numeric_limits<double>::infinity();
+    }
+    return m_range;
+}
+
 // ------------------------------------------------------------------------- //
 
 } // namespace ns3
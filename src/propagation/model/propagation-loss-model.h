@@ -114,7 +114,46 @@ class PropagationLossModel : public Object
      */
     int64_t AssignStreams(int64_t stream);
 
+    /**
+     * Returns whether the loss computed by this PropagationLossModel and all the
+     * PropagationLossModel(s) chained to it between two nodes stays the same as long as
+     * the nodes do not move, in which case the channels may cache it.
+     *
+     * \returns true if the loss between two static nodes can be cached
+     */
+    bool IsCacheable() const;
+
+    /**
+     * Returns a distance beyond which the reception power computed by this
+     * PropagationLossModel is guaranteed to be lower than the given threshold, so that
+     * the channels can skip the receivers that are farther away without computing the
+     * loss. An infinite distance is returned if no such distance is known, which is
+     * always the case when other PropagationLossModel(s) are chained to this one.
+     *
+     * \param txPowerDbm the transmission power (in dBm)
+     * \param rxPowerDbm the reception power threshold (in dBm)
+     * \returns the maximum distance (in meters) at which the reception power may be
+     *          greater than or equal to the threshold
+     */
+    double GetMaxRange(double txPowerDbm, double rxPowerDbm) const;
+
+    /**
+     * Returns a number that changes whenever a parameter affecting the loss computed by
+     * this PropagationLossModel or by the PropagationLossModel(s) chained to it changes
+     * (including the chain itself), so that the channels know when the cached losses
+     * become stale.
+     *
+     * \returns the version of the parameters of the chain of loss models
+     */
+    uint64_t GetParametersVersion() const;
+
   protected:
+    /**
+     * Subclasses that can be cached (see DoIsCacheable) must call this method whenever
+     * a parameter affecting the computed loss changes.
+     */
+    void NotifyParametersChanged();
+
     /**
      * Assign a fixed random variable stream number to the random variables used by this model.
      *
@@ -139,7 +178,30 @@ class PropagationLossModel : public Object
                                  Ptr<MobilityModel> a,
                                  Ptr<MobilityModel> b) const = 0;
 
+    /**
+     * Subclasses whose loss between two nodes only depends on the position of the
+     * nodes (e.g., that do not draw a new random value for each call) can override
+     * this method to return true. The default is false, so that the loss is never
+     * cached.
+     *
+     * \returns true if the loss computed by this model between two static nodes can be cached
+     */
+    virtual bool DoIsCacheable() const;
+
+    /**
+     * Subclasses whose loss increases with the distance can override this method to
+     * return the distance beyond which the reception power is lower than the given
+     * threshold. The default is an infinite distance.
+     *
+     * \param txPowerDbm the transmission power (in dBm)
+     * \param rxPowerDbm the reception power threshold (in dBm)
+     * \returns the maximum distance (in meters) at which the reception power may be
+     *          greater than or equal to the threshold
+     */
+    virtual double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const;
+
     Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
+    uint64_t m_parametersVersion;     //!< Version of the parameters of this model
 };
 
 /**
@@ -304,6 +366,8 @@ class FriisPropagationLossModel : public PropagationLossModel
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
 
     /**
      * Transforms a Dbm value to Watt
@@ -408,12 +472,17 @@ class TwoRayGroundPropagationLossModel : public PropagationLossModel
      * Set the model antenna height above the node's Z coordinate
      */
     void SetHeightAboveZ(double heightAboveZ);
+    /**
+     * \returns the model antenna height above the node's Z coordinate
+     */
+    double GetHeightAboveZ() const;
 
   private:
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
 
     /**
      * Transforms a Dbm value to Watt
@@ -488,11 +557,30 @@ class LogDistancePropagationLossModel : public PropagationLossModel
     void SetReference(double referenceDistance, double referenceLoss);
 
   private:
+    /**
+     * \param referenceDistance the reference distance
+     */
+    void SetReferenceDistance(double referenceDistance);
+    /**
+     * \returns the reference distance
+     */
+    double GetReferenceDistance() const;
+    /**
+     * \param referenceLoss the reference path loss
+     */
+    void SetReferenceLoss(double referenceLoss);
+    /**
+     * \returns the reference path loss
+     */
+    double GetReferenceLoss() const;
+
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
 
     /**
      *  Creates a default reference loss model
@@ -679,6 +767,10 @@ class FixedRssLossModel : public PropagationLossModel
      * Set the received signal strength (RSS) in dBm.
      */
     void SetRss(double rss);
+    /**
+     * \returns the received signal strength (dBm)
+     */
+    double GetRss() const;
 
   private:
     double DoCalcRxPower(double txPowerDbm,
@@ -686,6 +778,7 @@ class FixedRssLossModel : public PropagationLossModel
                          Ptr<MobilityModel> b) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
 
     double m_rss; //!< the received signal strength
 };
@@ -731,6 +824,10 @@ class MatrixPropagationLossModel : public PropagationLossModel
      * \param defaultLoss the default proagation loss
      */
     void SetDefaultLoss(double defaultLoss);
+    /**
+     * \returns the default propagation loss (in dB, positive)
+     */
+    double GetDefaultLoss() const;
 
   private:
     double DoCalcRxPower(double txPowerDbm,
@@ -738,6 +835,7 @@ class MatrixPropagationLossModel : public PropagationLossModel
                          Ptr<MobilityModel> b) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
 
     double m_default; //!< default loss
 
@@ -772,12 +870,23 @@ class RangePropagationLossModel : public PropagationLossModel
     RangePropagationLossModel(const RangePropagationLossModel&) = delete;
     RangePropagationLossModel& operator=(const RangePropagationLossModel&) = delete;
 
+    /**
+     * \param range the maximum transmission range (meters)
+     */
+    void SetRange(double range);
+    /**
+     * \returns the maximum transmission range (meters)
+     */
+    double GetRange() const;
+
   private:
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
+    bool DoIsCacheable() const override;
+    double DoGetMaxRange(double txPowerDbm, double rxPowerDbm) const override;
 
     double m_range; //!< Maximum Transmission Range (meters)
 };
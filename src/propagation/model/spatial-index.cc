@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spatial-index.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpatialIndex");
+
+SpatialIndex::SpatialIndex()
+    : m_cellSize(100),
+      m_cellSizeSet(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SpatialIndex::~SpatialIndex()
+{
+    NS_LOG_FUNCTION(this);
+    Clear();
+}
+
+void
+SpatialIndex::SetCellSize(double cellSize)
+{
+    NS_LOG_FUNCTION(this << cellSize);
+    NS_ASSERT_MSG(cellSize > 0 && std::isfinite(cellSize), "Invalid cell size " << cellSize);
+    m_cellSize = cellSize;
+    m_cellSizeSet = true;
+    m_cells.clear();
+    m_unbinned.clear();
+    for (std::size_t index = 0; index < m_items.size(); ++index)
+    {
+        Bin(index);
+    }
+}
+
+double
+SpatialIndex::GetCellSize() const
+{
+    return m_cellSize;
+}
+
+bool
+SpatialIndex::IsCellSizeSet() const
+{
+    return m_cellSizeSet;
+}
+
+void
+SpatialIndex::Add(Ptr<MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    if (mobility)
+    {
+        const auto ptr = PeekPointer(mobility);
+        if (m_byMobility.find(ptr) == m_byMobility.end())
+        {
+            mobility->TraceConnectWithoutContext(
+                "CourseChange",
+                MakeCallback(&SpatialIndex::NotifyCourseChange, this));
+        }
+        m_byMobility.emplace(ptr, m_items.size());
+    }
+    m_items.push_back({mobility, false, {}});
+    Bin(m_items.size() - 1);
+}
+
+std::size_t
+SpatialIndex::GetSize() const
+{
+    return m_items.size();
+}
+
+void
+SpatialIndex::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto it = m_byMobility.begin(); it != m_byMobility.end();
+         it = m_byMobility.upper_bound(it->first))
+    {
+        m_items[it->second].mobility->TraceDisconnectWithoutContext(
+            "CourseChange",
+            MakeCallback(&SpatialIndex::NotifyCourseChange, this));
+    }
+    m_byMobility.clear();
+    m_items.clear();
+    m_cells.clear();
+    m_unbinned.clear();
+}
+
+void
+SpatialIndex::GetCandidates(const Vector& position,
+                            double range,
+                            std::vector<std::size_t>& indices) const
+{
+    NS_LOG_FUNCTION(this << position << range);
+    indices.clear();
+
+    if (!std::isfinite(range))
+    {
+        indices.resize(m_items.size());
+        for (std::size_t index = 0; index < m_items.size(); ++index)
+        {
+            indices[index] = index;
+        }
+        return;
+    }
+
+    indices = m_unbinned;
+    auto addIfInRange = [&](const std::vector<std::size_t>& cellItems) {
+        for (const auto index : cellItems)
+        {
+            if (CalculateDistance(m_items[index].mobility->GetPosition(), position) <= range)
+            {
+                indices.push_back(index);
+            }
+        }
+    };
+
+    const auto [xMin, yMin] = GetCell(Vector(position.x - range, position.y - range, 0));
+    const auto [xMax, yMax] = GetCell(Vector(position.x + range, position.y + range, 0));
+    if (static_cast<double>(xMax - xMin + 1) * static_cast<double>(yMax - yMin + 1) >
+        m_cells.size())
+    {
+        // cheaper to go through the non-empty cells
+        for (const auto& [cell, cellItems] : m_cells)
+        {
+            if (cell.first >= xMin && cell.first <= xMax && cell.second >= yMin &&
+                cell.second <= yMax)
+            {
+                addIfInRange(cellItems);
+            }
+        }
+    }
+    else
+    {
+        for (auto x = xMin; x <= xMax; ++x)
+        {
+            for (auto it = m_cells.lower_bound({x, yMin});
+                 it != m_cells.end() && it->first <= Cell{x, yMax};
+                 ++it)
+            {
+                addIfInRange(it->second);
+            }
+        }
+    }
+
+    std::sort(indices.begin(), indices.end());
+    NS_LOG_DEBUG(indices.size() << " candidates out of " << m_items.size() << " items");
+}
+
+SpatialIndex::Cell
+SpatialIndex::GetCell(const Vector& position) const
+{
+    auto coord = [this](double value) {
+        // clamp the coordinate to avoid overflows with very large ranges
+        const double maxCoord = 1e12;
+        return static_cast<int64_t>(
+            std::clamp(std::floor(value / m_cellSize), -maxCoord, maxCoord));
+    };
+    return {coord(position.x), coord(position.y)};
+}
+
+void
+SpatialIndex::Bin(std::size_t index)
+{
+    auto& item = m_items.at(index);
+    if (!item.mobility || item.mobility->GetVelocity() != Vector())
+    {
+        item.binned = false;
+        m_unbinned.push_back(index);
+        return;
+    }
+    item.binned = true;
+    item.cell = GetCell(item.mobility->GetPosition());
+    m_cells[item.cell].push_back(index);
+}
+
+void
+SpatialIndex::Unbin(std::size_t index)
+{
+    auto& item = m_items.at(index);
+    if (!item.binned)
+    {
+        m_unbinned.erase(std::find(m_unbinned.begin(), m_unbinned.end(), index));
+        return;
+    }
+    auto cellIt = m_cells.find(item.cell);
+    NS_ASSERT(cellIt != m_cells.end());
+    cellIt->second.erase(std::find(cellIt->second.begin(), cellIt->second.end(), index));
+    if (cellIt->second.empty())
+    {
+        m_cells.erase(cellIt);
+    }
+}
+
+void
+SpatialIndex::NotifyCourseChange(Ptr<const MobilityModel> mobility)
+{
+    NS_LOG_FUNCTION(this << mobility);
+    auto [first, last] = m_byMobility.equal_range(PeekPointer(mobility));
+    for (auto it = first; it != last; ++it)
+    {
+        Unbin(it->second);
+        Bin(it->second);
+    }
+}
+
+} // namespace ns3
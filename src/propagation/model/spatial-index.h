@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include "ns3/mobility-model.h"
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup propagation
+ *
+ * \brief Uniform grid over the positions of the receivers attached to a channel, used by
+ * the channels to skip the receivers that are out of the range of a transmitter (see
+ * PropagationLossModel::GetMaxRange).
+ *
+ * Each item is identified by its index in the container of receivers of the channel and
+ * items must be added in increasing order of index. Static items are binned in square
+ * cells of the XY plane according to their position; the index registers to the
+ * CourseChange trace source of their mobility model to move them to another cell when
+ * their course changes. Moving items are not binned and are always returned as
+ * candidates, since their position changes without notification. The same holds for
+ * the items without a mobility model.
+ */
+class SpatialIndex
+{
+  public:
+    SpatialIndex();
+    ~SpatialIndex();
+
+    // Delete copy constructor and assignment operator, since the mobility models
+    // hold callbacks to this object
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+    /**
+     * Set the size of the side of the cells, which is 100 meters until set. All the items
+     * are binned again.
+     *
+     * \param cellSize the size of the side of the cells (in meters)
+     */
+    void SetCellSize(double cellSize);
+
+    /**
+     * \return the size of the side of the cells (in meters)
+     */
+    double GetCellSize() const;
+
+    /**
+     * \return whether the size of the side of the cells has been set
+     */
+    bool IsCellSizeSet() const;
+
+    /**
+     * Add an item, whose index is the current number of items.
+     *
+     * \param mobility the mobility model of the item (possibly null)
+     */
+    void Add(Ptr<MobilityModel> mobility);
+
+    /**
+     * \return the number of items
+     */
+    std::size_t GetSize() const;
+
+    /**
+     * Remove all the items and disconnect from the mobility models.
+     */
+    void Clear();
+
+    /**
+     * Get the indices, in increasing order, of the items that may be within the given
+     * distance from the given position. All the static items within that distance and
+     * all the other items are returned.
+     *
+     * \param position the position
+     * \param range the distance (in meters)
+     * \param indices the vector to fill with the indices of the candidate items
+     */
+    void GetCandidates(const Vector& position,
+                       double range,
+                       std::vector<std::size_t>& indices) const;
+
+  private:
+    /// Coordinates of a cell
+    using Cell = std::pair<int64_t, int64_t>;
+
+    /// An item of the index
+    struct Item
+    {
+        Ptr<MobilityModel> mobility; //!< the mobility model of the item
+        bool binned;                 //!< whether the item is stored in a cell
+        Cell cell;                   //!< the cell storing the item, if binned
+    };
+
+    /**
+     * \param position a position
+     * \return the coordinates of the cell containing the given position
+     */
+    Cell GetCell(const Vector& position) const;
+
+    /**
+     * Store the given item in the cell containing its position, if it is static, or in
+     * the list of unbinned items, otherwise.
+     *
+     * \param index the index of the item
+     */
+    void Bin(std::size_t index);
+
+    /**
+     * Remove the given item from the cell or from the list of unbinned items.
+     *
+     * \param index the index of the item
+     */
+    void Unbin(std::size_t index);
+
+    /**
+     * Bin again the items of the node whose course changed.
+     *
+     * \param mobility the mobility model of the node
+     */
+    void NotifyCourseChange(Ptr<const MobilityModel> mobility);
+
+    double m_cellSize;                                //!< size of the side of the cells
+    bool m_cellSizeSet;                               //!< whether the cell size has been set
+    std::vector<Item> m_items;                        //!< items sorted by index
+    std::map<Cell, std::vector<std::size_t>> m_cells; //!< indices of the static items per cell
+    std::vector<std::size_t> m_unbinned;              //!< indices of the other items
+    std::multimap<const MobilityModel*, std::size_t>
+        m_byMobility; //!< indices of the items per mobility model
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_INDEX_H */
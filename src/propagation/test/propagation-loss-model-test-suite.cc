@@ -18,12 +18,20 @@
 #include "ns3/abort.h"
 #include "ns3/config.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/double.h"
+#include "ns3/link-gain-cache.h"
 #include "ns3/log.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
+#include "ns3/spatial-index.h"
 #include "ns3/test.h"
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("PropagationLossModelsTest");
@@ -489,6 +497,240 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief LinkGainCache Test
+ *
+ * Check which propagation models can be cached, that only links between static
+ * nodes are cached, that the links of a node are dropped when its course changes and
+ * that all the links are dropped when the parameters of the propagation models change.
+ */
+class LinkGainCacheTestCase : public TestCase
+{
+  public:
+    LinkGainCacheTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LinkGainCacheTestCase::LinkGainCacheTestCase()
+    : TestCase("Test LinkGainCache")
+{
+}
+
+void
+LinkGainCacheTestCase::DoRun()
+{
+    Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel>();
+    NS_TEST_EXPECT_MSG_EQ(friis->IsCacheable(), true, "Friis loss should be cacheable");
+    NS_TEST_EXPECT_MSG_EQ(CreateObject<NakagamiPropagationLossModel>()->IsCacheable(),
+                          false,
+                          "Nakagami loss should not be cacheable");
+    friis->SetNext(CreateObject<RandomPropagationLossModel>());
+    NS_TEST_EXPECT_MSG_EQ(friis->IsCacheable(),
+                          false,
+                          "A chain including a random loss should not be cacheable");
+    NS_TEST_EXPECT_MSG_EQ(CreateObject<ConstantSpeedPropagationDelayModel>()->IsCacheable(),
+                          true,
+                          "Constant speed delay should be cacheable");
+    NS_TEST_EXPECT_MSG_EQ(CreateObject<RandomPropagationDelayModel>()->IsCacheable(),
+                          false,
+                          "Random delay should not be cacheable");
+
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    a->SetPosition(Vector(0, 0, 0));
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+    b->SetPosition(Vector(10, 0, 0));
+    Ptr<ConstantVelocityMobilityModel> c = CreateObject<ConstantVelocityMobilityModel>();
+    c->SetPosition(Vector(20, 0, 0));
+    c->SetVelocity(Vector(1, 0, 0));
+
+    LinkGainCache cache;
+    cache.Add(a, b, {10.0, -50.0, NanoSeconds(33)});
+    cache.Add(b, a, {10.0, -51.0, NanoSeconds(33)});
+    cache.Add(a, c, {10.0, -60.0, NanoSeconds(66)});
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 2, "The link with a moving node should not be cached");
+    NS_TEST_ASSERT_MSG_NE(cache.Find(a, b), nullptr, "Link a -> b should be cached");
+    NS_TEST_EXPECT_MSG_EQ(cache.Find(a, b)->rxPowerDbm, -50.0, "Unexpected cached RX power");
+    NS_TEST_ASSERT_MSG_NE(cache.Find(b, a), nullptr, "Link b -> a should be cached");
+    NS_TEST_EXPECT_MSG_EQ(cache.Find(b, a)->rxPowerDbm, -51.0, "Unexpected cached RX power");
+    NS_TEST_EXPECT_MSG_EQ(cache.Find(a, c), nullptr, "Link a -> c should not be cached");
+
+    // the minimum delay is the delay between the nodes which do not move, and the lower
+    // bound of the delay otherwise
+    Ptr<ConstantSpeedPropagationDelayModel> speed =
+        CreateObject<ConstantSpeedPropagationDelayModel>();
+    NS_TEST_EXPECT_MSG_EQ(speed->GetMinDelay(a, b),
+                          speed->GetDelay(a, b),
+                          "Unexpected minimum delay between nodes which do not move");
+    NS_TEST_EXPECT_MSG_EQ(speed->GetMinDelay(a, c),
+                          Time(0),
+                          "Unexpected minimum delay to a moving node");
+    NS_TEST_EXPECT_MSG_EQ(CreateObject<RandomPropagationDelayModel>()->GetMinDelay(a, b),
+                          Time(0),
+                          "Unexpected minimum random delay");
+
+    c->SetVelocity(Vector(0, 0, 0));
+    cache.Add(a, c, {10.0, -60.0, NanoSeconds(66)});
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 3, "The link with a stopped node should be cached");
+
+    // moving b drops the links of b only
+    b->SetPosition(Vector(15, 0, 0));
+    NS_TEST_EXPECT_MSG_EQ(cache.Find(a, b), nullptr, "Link a -> b should have been dropped");
+    NS_TEST_EXPECT_MSG_EQ(cache.Find(b, a), nullptr, "Link b -> a should have been dropped");
+    NS_TEST_EXPECT_MSG_NE(cache.Find(a, c), nullptr, "Link a -> c should still be cached");
+
+    cache.Clear();
+    NS_TEST_EXPECT_MSG_EQ(cache.GetSize(), 0, "The cache should be empty");
+    // course changes after the cache was cleared must not affect it
+    c->SetPosition(Vector(30, 0, 0));
+
+    // the links are dropped when the parameters of the propagation models change,
+    // be it through a setter, an attribute or the chain of models
+    Ptr<MatrixPropagationLossModel> matrix = CreateObject<MatrixPropagationLossModel>();
+    Ptr<ConstantSpeedPropagationDelayModel> delay =
+        CreateObject<ConstantSpeedPropagationDelayModel>();
+    auto getCacheSize = [&]() {
+        cache.CheckVersions(matrix->GetParametersVersion(), delay->GetParametersVersion());
+        return cache.GetSize();
+    };
+    auto cacheLink = [&]() {
+        NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "The cache should be empty");
+        cache.Add(a, b, {10.0, -50.0, NanoSeconds(33)});
+        NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 1, "The link should be cached");
+    };
+    cacheLink();
+    matrix->SetLoss(a, b, 60);
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "SetLoss should drop the links");
+    cacheLink();
+    matrix->SetDefaultLoss(70);
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "SetDefaultLoss should drop the links");
+    cacheLink();
+    matrix->SetAttribute("DefaultLoss", DoubleValue(80));
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "The DefaultLoss attribute should drop the links");
+    cacheLink();
+    Ptr<FixedRssLossModel> fixedRss = CreateObject<FixedRssLossModel>();
+    matrix->SetNext(fixedRss);
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "SetNext should drop the links");
+    cacheLink();
+    fixedRss->SetAttribute("Rss", DoubleValue(-80));
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(),
+                          0,
+                          "The Rss attribute of a chained model should drop the links");
+    cacheLink();
+    delay->SetAttribute("Speed", DoubleValue(2e8));
+    NS_TEST_EXPECT_MSG_EQ(getCacheSize(), 0, "The Speed attribute should drop the links");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief Receiver culling Test
+ *
+ * Check the distances returned by PropagationLossModel::GetMaxRange and that the
+ * SpatialIndex returns, in increasing order, all the static items within range and all
+ * the moving items, also after a course change.
+ */
+class ReceiverCullingTestCase : public TestCase
+{
+  public:
+    ReceiverCullingTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+ReceiverCullingTestCase::ReceiverCullingTestCase()
+    : TestCase("Test PropagationLossModel::GetMaxRange and SpatialIndex")
+{
+}
+
+void
+ReceiverCullingTestCase::DoRun()
+{
+    Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel>();
+    a->SetPosition(Vector(0, 0, 0));
+    Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel>();
+
+    // the reception power at the returned distance is the threshold
+    Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel>();
+    double range = friis->GetMaxRange(20, -82);
+    b->SetPosition(Vector(range, 0, 0));
+    NS_TEST_EXPECT_MSG_EQ_TOL(friis->CalcRxPower(20, a, b), -82, 1e-6, "Wrong Friis range");
+    NS_TEST_EXPECT_MSG_EQ(friis->GetMaxRange(20, 30), 0, "Wrong Friis range above min loss");
+
+    Ptr<LogDistancePropagationLossModel> logDistance =
+        CreateObject<LogDistancePropagationLossModel>();
+    range = logDistance->GetMaxRange(16, -95);
+    b->SetPosition(Vector(range, 0, 0));
+    NS_TEST_EXPECT_MSG_EQ_TOL(logDistance->CalcRxPower(16, a, b),
+                              -95,
+                              1e-6,
+                              "Wrong log distance range");
+
+    Ptr<RangePropagationLossModel> rangeLoss = CreateObject<RangePropagationLossModel>();
+    rangeLoss->SetAttribute("MaxRange", DoubleValue(127));
+    NS_TEST_EXPECT_MSG_EQ(rangeLoss->GetMaxRange(16, -95), 127, "Wrong range");
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(rangeLoss->GetMaxRange(16, -2000)),
+                          true,
+                          "The out of range power is above the threshold");
+
+    logDistance->SetNext(CreateObject<NakagamiPropagationLossModel>());
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(logDistance->GetMaxRange(16, -95)),
+                          true,
+                          "The range of a chain of models should be unknown");
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(CreateObject<TwoRayGroundPropagationLossModel>()
+                                         ->GetMaxRange(16, -95)),
+                          true,
+                          "The range of the two-ray ground model should be unknown");
+
+    // static items on a line, every 10 meters, a moving item and an item without mobility
+    SpatialIndex index;
+    std::vector<Ptr<MobilityModel>> mobilities;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        mobilities.push_back(CreateObject<ConstantPositionMobilityModel>());
+        mobilities.back()->SetPosition(Vector(10.0 * i, 5, 0));
+        index.Add(mobilities.back());
+    }
+    Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel>();
+    moving->SetPosition(Vector(1000, 0, 0));
+    moving->SetVelocity(Vector(1, 0, 0));
+    index.Add(moving);
+    index.Add(nullptr);
+    index.SetCellSize(25);
+    NS_TEST_EXPECT_MSG_EQ(index.GetSize(), 12, "Unexpected number of items");
+
+    std::vector<std::size_t> candidates;
+    index.GetCandidates(Vector(30, 0, 0), 15, candidates);
+    std::vector<std::size_t> expected{2, 3, 4, 10, 11};
+    NS_TEST_EXPECT_MSG_EQ((candidates == expected), true, "Unexpected candidates");
+
+    // a large range is served by going through the non-empty cells
+    index.GetCandidates(Vector(30, 0, 0), 1e6, candidates);
+    NS_TEST_EXPECT_MSG_EQ(candidates.size(), 12, "All the items should be candidates");
+    index.GetCandidates(Vector(30, 0, 0), std::numeric_limits<double>::infinity(), candidates);
+    NS_TEST_EXPECT_MSG_EQ(candidates.size(), 12, "All the items should be candidates");
+
+    // item 9 moves close to the position, the moving item stops far away
+    mobilities[9]->SetPosition(Vector(31, 0, 0));
+    moving->SetVelocity(Vector(0, 0, 0));
+    index.GetCandidates(Vector(30, 0, 0), 15, candidates);
+    expected = {2, 3, 4, 9, 11};
+    NS_TEST_EXPECT_MSG_EQ((candidates == expected), true, "Unexpected candidates after move");
+
+    index.Clear();
+    NS_TEST_EXPECT_MSG_EQ(index.GetSize(), 0, "The index should be empty");
+    // course changes after the index was cleared must not affect it
+    mobilities[0]->SetPosition(Vector(30, 0, 0));
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -500,6 +742,8 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - LinkGainCache
+ *   - SpatialIndex
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -515,6 +759,8 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::QUICK);
+    AddTestCase(new LinkGainCacheTestCase, TestCase::QUICK);
+    AddTestCase(new ReceiverCullingTestCase, TestCase::QUICK);
 }
 
 /// Static variable for test initialization
@@ -26,9 +26,11 @@
 
 #include <ns3/angles.h>
 #include <ns3/antenna-model.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/log.h>
 #include <ns3/mobility-model.h>
+#include <ns3/multithreaded-simulator-impl.h>
 #include <ns3/net-device.h>
 #include <ns3/node.h>
 #include <ns3/object.h>
@@ -39,7 +41,9 @@
 #include <ns3/simulator.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <utility>
 
 namespace ns3
@@ -81,7 +85,10 @@ RxSpectrumModelInfo::RxSpectrumModelInfo(Ptr<const SpectrumModel> rxSpectrumMode
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel()
-    : m_numDevices{0}
+    : m_numDevices{0},
+      m_receiverCulling{false},
+      m_maxAntennaGainDb{0},
+      m_shared{false}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -92,18 +99,36 @@ MultiModelSpectrumChannel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_txSpectrumModelInfoMap.clear();
     m_rxSpectrumModelInfoMap.clear();
+    m_receiverIndices.clear();
+    m_simulator = nullptr;
     SpectrumChannel::DoDispose();
 }
 
 TypeId
 MultiModelSpectrumChannel::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::MultiModelSpectrumChannel")
-                            .SetParent<SpectrumChannel>()
-                            .SetGroupName("Spectrum")
-                            .AddConstructor<MultiModelSpectrumChannel>()
-
-        ;
+    static TypeId tid =
+        TypeId("ns3::MultiModelSpectrumChannel")
+            .SetParent<SpectrumChannel>()
+            .SetGroupName("Spectrum")
+            .AddConstructor<MultiModelSpectrumChannel>()
+            .AddAttribute("ReceiverCulling",
+                          "If true, the receivers beyond the distance at which the path loss "
+                          "exceeds MaxLossDb, as computed by the propagation loss model, are "
+                          "skipped without scheduling any event nor firing the Gain and "
+                          "PathLoss traces. The distance is only known for some propagation "
+                          "loss models that are not chained to other models (see "
+                          "PropagationLossModel::GetMaxRange).",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MultiModelSpectrumChannel::m_receiverCulling),
+                          MakeBooleanChecker())
+            .AddAttribute("MaxAntennaGainDb",
+                          "The maximum sum of the TX and RX antenna gains (dB), used to compute "
+                          "the distance beyond which the receivers are skipped when "
+                          "ReceiverCulling is enabled.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&MultiModelSpectrumChannel::m_maxAntennaGainDb),
+                          MakeDoubleChecker<double>());
     return tid;
 }
 
@@ -126,6 +151,8 @@ MultiModelSpectrumChannel::RemoveRx(Ptr<SpectrumPhy> phy)
         if (phyIt != rxInfoIterator->second.m_rxPhys.end())
         {
             rxInfoIterator->second.m_rxPhys.erase(phyIt);
+            // the indices of the receivers changed, hence the spatial index is rebuilt
+            m_receiverIndices.erase(rxInfoIterator->first);
             --m_numDevices;
             break; // there should be at most one entry
         }
@@ -156,6 +183,17 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     // prevented insertion. In both cases, add the phy to the element pointed to by rxInfoIterator
     rxInfoIterator->second.m_rxPhys.push_back(phy);
 
+    if (m_numDevices == 1 && !m_simulator)
+    {
+        m_simulator = MultithreadedSimulatorImpl::GetInstance();
+        if (m_simulator)
+        {
+            m_simulator->AddLookaheadSource(
+                MakeCallback(&MultiModelSpectrumChannel::GetLookahead,
+                             Ptr<MultiModelSpectrumChannel>(this)));
+        }
+    }
+
     if (inserted)
     {
         // create the necessary converters for all the TX spectrum models that we know of
@@ -180,6 +218,76 @@ MultiModelSpectrumChannel::AddRx(Ptr<SpectrumPhy> phy)
     }
 }
 
+void
+MultiModelSpectrumChannel::FindCandidateReceivers(SpectrumModelUid_t rxSpectrumModelUid,
+                                                  const std::vector<Ptr<SpectrumPhy>>& rxPhys,
+                                                  const Vector& txPosition,
+                                                  double range)
+{
+    NS_LOG_FUNCTION(this << rxSpectrumModelUid << txPosition << range);
+    auto& index = m_receiverIndices[rxSpectrumModelUid];
+    while (index.GetSize() < rxPhys.size())
+    {
+        index.Add(rxPhys[index.GetSize()]->GetMobility());
+    }
+    if (!index.IsCellSizeSet() && range > 0)
+    {
+        index.SetCellSize(range);
+    }
+    index.GetCandidates(txPosition, range, m_candidates);
+    NS_LOG_LOGIC(m_candidates.size() << " candidate receivers out of " << rxPhys.size());
+}
+
+Time
+MultiModelSpectrumChannel::GetLookahead() const
+{
+    NS_LOG_FUNCTION(this);
+    // the receivers without NetDevice receive in the partition of the transmitter
+    std::vector<std::pair<Ptr<MobilityModel>, uint32_t>> receivers;
+    for (const auto& [rxSpectrumModelUid, rxInfo] : m_rxSpectrumModelInfoMap)
+    {
+        for (const auto& rxPhy : rxInfo.m_rxPhys)
+        {
+            if (Ptr<NetDevice> rxNetDevice = rxPhy->GetDevice())
+            {
+                receivers.emplace_back(
+                    rxPhy->GetMobility(),
+                    m_simulator->GetPartitionId(rxNetDevice->GetNode()->GetId()));
+            }
+        }
+    }
+    m_shared = std::any_of(receivers.begin(), receivers.end(), [&](const auto& receiver) {
+        return receiver.second != receivers.front().second;
+    });
+    if (!m_shared)
+    {
+        return Time::Max();
+    }
+#ifndef NS3_MTP
+    NS_ABORT_MSG("The MultiModelSpectrumChannel is shared by several partitions of the "
+                 "MultithreadedSimulatorImpl, hence ns-3 must be built with NS3_MTP");
+#endif
+    if (!m_propagationDelay)
+    {
+        return Time(0);
+    }
+
+    Time lookahead = Time::Max();
+    for (const auto& [txMobility, txPartition] : receivers)
+    {
+        for (const auto& [rxMobility, rxPartition] : receivers)
+        {
+            if (txPartition != rxPartition && txMobility && rxMobility)
+            {
+                lookahead = std::min(lookahead,
+                                     m_propagationDelay->GetMinDelay(txMobility, rxMobility));
+            }
+        }
+    }
+    NS_LOG_LOGIC("lookahead = " << lookahead);
+    return lookahead;
+}
+
 TxSpectrumModelInfoMap_t::const_iterator
 MultiModelSpectrumChannel::FindAndEventuallyAddTxSpectrumModel(
     Ptr<const SpectrumModel> txSpectrumModel)
@@ -232,12 +340,46 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
 
     NS_ASSERT(txParams->txPhy);
     NS_ASSERT(txParams->psd);
-    Ptr<SpectrumSignalParameters> txParamsTrace =
-        txParams->Copy(); // copy it since traced value cannot be const (because of potential
-                          // underlying DynamicCasts)
-    m_txSigParamsTrace(txParamsTrace);
+    if (!m_txSigParamsTrace.IsEmpty())
+    {
+        Ptr<SpectrumSignalParameters> txParamsTrace =
+            txParams->Copy(); // copy it since traced value cannot be const (because of potential
+                              // underlying DynamicCasts)
+        m_txSigParamsTrace(txParamsTrace);
+    }
 
     Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility();
+    // the partitions sharing the channel transmit one at a time. The link cache and the
+    // spatial indices are not used since they are updated by the course changes of the
+    // nodes, which are notified by the threads of their partitions
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    uint32_t txPartition = 0;
+    std::map<uint32_t, Ptr<SpectrumSignalParameters>> txParamsCopies;
+    if (m_shared)
+    {
+        lock.lock();
+        txPartition = m_simulator->GetPartitionId(Simulator::GetContext());
+    }
+    // the propagation gain and delay of the links between static nodes are cached if the
+    // propagation models are deterministic
+    const bool useCache = !m_shared &&
+                          (!m_propagationLoss || m_propagationLoss->IsCacheable()) &&
+                          (!m_propagationDelay || m_propagationDelay->IsCacheable());
+    if (useCache)
+    {
+        m_linkCache.CheckVersions(m_propagationLoss ? m_propagationLoss->GetParametersVersion() : 0,
+                                  m_propagationDelay ? m_propagationDelay->GetParametersVersion()
+                                                     : 0);
+    }
+    // the receivers beyond the distance at which the path loss exceeds MaxLossDb are
+    // skipped, if enabled and if such a distance is known
+    double range = std::numeric_limits<double>::infinity();
+    if (m_receiverCulling && !m_shared && txMobility && m_propagationLoss)
+    {
+        range = m_propagationLoss->GetMaxRange(m_maxAntennaGainDb, -m_maxLossDb);
+        NS_LOG_LOGIC("range = " << range << " m");
+    }
+    const bool culling = std::isfinite(range);
     SpectrumModelUid_t txSpectrumModelUid = txParams->psd->GetSpectrumModelUid();
     NS_LOG_LOGIC("txSpectrumModelUid " << txSpectrumModelUid);
 
@@ -259,6 +401,18 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
         SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid();
         NS_LOG_LOGIC("rxSpectrumModelUids " << rxSpectrumModelUid);
 
+        if (culling)
+        {
+            FindCandidateReceivers(rxSpectrumModelUid,
+                                   rxInfoIterator->second.m_rxPhys,
+                                   txMobility->GetPosition(),
+                                   range);
+            if (m_candidates.empty())
+            {
+                continue;
+            }
+        }
+
         Ptr<SpectrumValue> convertedTxPowerSpectrum;
         if (txSpectrumModelUid == rxSpectrumModelUid)
         {
@@ -279,17 +433,18 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
             convertedTxPowerSpectrum = rxConverterIterator->second.Convert(txParams->psd);
         }
 
-        for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin();
-             rxPhyIterator != rxInfoIterator->second.m_rxPhys.end();
-             ++rxPhyIterator)
+        const auto& rxPhys = rxInfoIterator->second.m_rxPhys;
+        const std::size_t nReceivers = culling ? m_candidates.size() : rxPhys.size();
+        for (std::size_t n = 0; n < nReceivers; ++n)
         {
-            NS_ASSERT_MSG((*rxPhyIterator)->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
+            const auto& rxPhy = rxPhys[culling ? m_candidates[n] : n];
+            NS_ASSERT_MSG(rxPhy->GetRxSpectrumModel()->GetUid() == rxSpectrumModelUid,
                           "SpectrumModel change was not notified to MultiModelSpectrumChannel "
                           "(i.e., AddRx should be called again after model is changed)");
 
-            if ((*rxPhyIterator) != txParams->txPhy)
+            if (rxPhy != txParams->txPhy)
             {
-                Ptr<NetDevice> rxNetDevice = (*rxPhyIterator)->GetDevice();
+                Ptr<NetDevice> rxNetDevice = rxPhy->GetDevice();
                 Ptr<NetDevice> txNetDevice = txParams->txPhy->GetDevice();
 
                 if (rxNetDevice && txNetDevice)
@@ -304,20 +459,45 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     }
                 }
 
-                if (m_filter && m_filter->Filter(txParams, *rxPhyIterator))
+                if (m_filter && m_filter->Filter(txParams, rxPhy))
                 {
                     continue;
                 }
 
                 NS_LOG_LOGIC("copying signal parameters " << txParams);
-                Ptr<SpectrumSignalParameters> rxParams = txParams->Copy();
-                rxParams->psd = Copy<SpectrumValue>(convertedTxPowerSpectrum);
+                // the PSD is not copied along with the signal parameters, since the receiver
+                // gets the converted PSD scaled by the path gain
+                Ptr<SpectrumValue> txPsd = txParams->psd;
+                txParams->psd = nullptr;
+                Ptr<SpectrumSignalParameters> rxParams;
+                const uint32_t rxPartition =
+                    (m_shared && rxNetDevice)
+                        ? m_simulator->GetPartitionId(rxNetDevice->GetNode()->GetId())
+                        : txPartition;
+                if (rxPartition != txPartition)
+                {
+                    // the receivers of another partition share their own copy of the packets
+                    auto& txParamsCopy = txParamsCopies[rxPartition];
+                    if (!txParamsCopy)
+                    {
+                        txParamsCopy = txParams->DeepCopy();
+                    }
+                    rxParams = txParamsCopy->Copy();
+                }
+                else
+                {
+                    rxParams = txParams->Copy();
+                }
+                txParams->psd = txPsd;
                 Time delay = MicroSeconds(0);
+                double pathGainLinear = 1.0;
 
-                Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility();
+                Ptr<MobilityModel> receiverMobility = rxPhy->GetMobility();
 
                 if (txMobility && receiverMobility)
                 {
+                    const auto link =
+                        useCache ? m_linkCache.Find(txMobility, receiverMobility) : nullptr;
                     double txAntennaGain = 0;
                     double rxAntennaGain = 0;
                     double propagationGainDb = 0;
@@ -330,7 +510,7 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                         pathLossDb -= txAntennaGain;
                     }
                     Ptr<AntennaModel> rxAntenna =
-                        DynamicCast<AntennaModel>((*rxPhyIterator)->GetAntenna());
+                        DynamicCast<AntennaModel>(rxPhy->GetAntenna());
                     if (rxAntenna)
                     {
                         Angles rxAngles(txMobility->GetPosition(), receiverMobility->GetPosition());
@@ -341,10 +521,23 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                     if (m_propagationLoss)
                     {
                         propagationGainDb =
-                            m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
+                            link ? link->rxPowerDbm
+                                 : m_propagationLoss->CalcRxPower(0, txMobility, receiverMobility);
                         NS_LOG_LOGIC("propagationGainDb = " << propagationGainDb << " dB");
                         pathLossDb -= propagationGainDb;
                     }
+                    if (useCache && !link)
+                    {
+                        // the link is cached before the range check, so that links between
+                        // out of range nodes are cached as well
+                        Time linkDelay =
+                            m_propagationDelay
+                                ? m_propagationDelay->GetDelay(txMobility, receiverMobility)
+                                : Time();
+                        m_linkCache.Add(txMobility,
+                                        receiverMobility,
+                                        {0.0, propagationGainDb, linkDelay});
+                    }
                     NS_LOG_LOGIC("total pathLoss = " << pathLossDb << " dB");
                     // Gain trace
                     m_gainTrace(txMobility,
@@ -354,21 +547,27 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                                 propagationGainDb,
                                 pathLossDb);
                     // Pathloss trace
-                    m_pathLossTrace(txParams->txPhy, *rxPhyIterator, pathLossDb);
+                    m_pathLossTrace(txParams->txPhy, rxPhy, pathLossDb);
                     if (pathLossDb > m_maxLossDb)
                     {
                         // beyond range
                         continue;
                     }
-                    double pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
-                    *(rxParams->psd) *= pathGainLinear;
+                    pathGainLinear = std::pow(10.0, (-pathLossDb) / 10.0);
 
                     if (m_propagationDelay)
                     {
-                        delay = m_propagationDelay->GetDelay(txMobility, receiverMobility);
+                        delay = link ? link->delay
+                                     : m_propagationDelay->GetDelay(txMobility, receiverMobility);
                     }
                 }
 
+                // fill the PSD of the receiver with the converted PSD scaled by the path gain,
+                // in a single pass
+                rxParams->psd =
+                    Create<SpectrumValue>(convertedTxPowerSpectrum->GetSpectrumModel());
+                rxParams->psd->AssignScaled(*convertedTxPowerSpectrum, pathGainLinear);
+
                 if (rxNetDevice)
                 {
                     // the receiver has a NetDevice, so we expect that it is attached to a Node
@@ -378,7 +577,7 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                                                    &MultiModelSpectrumChannel::StartRx,
                                                    this,
                                                    rxParams,
-                                                   *rxPhyIterator);
+                                                   rxPhy);
                 }
                 else
                 {
@@ -388,7 +587,7 @@ MultiModelSpectrumChannel::StartTx(Ptr<SpectrumSignalParameters> txParams)
                                         &MultiModelSpectrumChannel::StartRx,
                                         this,
                                         rxParams,
-                                        *rxPhyIterator);
+                                        rxPhy);
                 }
             }
         }
@@ -399,6 +598,12 @@ void
 MultiModelSpectrumChannel::StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver)
 {
     NS_LOG_FUNCTION(this);
+    // the spectrum propagation loss models are not thread-safe
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if (m_shared && (m_spectrumPropagationLoss || m_phasedArraySpectrumPropagationLoss))
+    {
+        lock.lock();
+    }
     if (m_spectrumPropagationLoss)
     {
         params->psd =
@@ -424,6 +629,10 @@ MultiModelSpectrumChannel::StartRx(Ptr<SpectrumSignalParameters> params, Ptr<Spe
             txPhasedArrayModel,
             rxPhasedArrayModel);
     }
+    if (lock.owns_lock())
+    {
+        lock.unlock();
+    }
     receiver->StartRx(params);
 }
 
@@ -26,13 +26,18 @@
 #include "spectrum-value.h"
 
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spatial-index.h>
 
 #include <map>
+#include <mutex>
 #include <set>
+#include <vector>
 
 namespace ns3
 {
 
+class MultithreadedSimulatorImpl;
+
 /**
  * \ingroup spectrum
  * Container: SpectrumModelUid_t, SpectrumConverter
@@ -99,6 +104,15 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * If the MultithreadedSimulatorImpl is used, the channel provides the
+ * simulator with the minimum propagation delay between the nodes of
+ * different partitions (see PropagationDelayModel::GetMinDelay) as
+ * lookahead.  A channel shared by several partitions serializes the
+ * transmissions and the computation of the spectrum propagation loss, does
+ * not use the link cache nor the receiver culling, and delivers a deep copy
+ * of the signal parameters (see SpectrumSignalParameters::DeepCopy) to the
+ * receivers of each partition.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -145,6 +159,29 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      */
     virtual void StartRx(Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+    /**
+     * Store in m_candidates the indices (in the given container) of the receivers using the
+     * given RX spectrum model that may be within the given distance from the transmitter.
+     *
+     * \param rxSpectrumModelUid the UID of the RX spectrum model
+     * \param rxPhys the receivers using the given RX spectrum model
+     * \param txPosition the position of the transmitter
+     * \param range the distance (in meters)
+     */
+    void FindCandidateReceivers(SpectrumModelUid_t rxSpectrumModelUid,
+                                const std::vector<Ptr<SpectrumPhy>>& rxPhys,
+                                const Vector& txPosition,
+                                double range);
+
+    /**
+     * Get the minimum delay between the receivers of different partitions of the
+     * MultithreadedSimulatorImpl and check whether the channel is shared by several
+     * partitions.  This is the lookahead source of this channel.
+     *
+     * \return the minimum delay between the receivers of different partitions
+     */
+    Time GetLookahead() const;
+
     /**
      * Data structure holding, for each TX SpectrumModel,  all the
      * converters to any RX SpectrumModel, and all the corresponding
@@ -163,6 +200,15 @@ class MultiModelSpectrumChannel : public SpectrumChannel
      * Number of devices connected to the channel.
      */
     std::size_t m_numDevices;
+
+    bool m_receiverCulling;    //!< whether to skip the out of range receivers
+    double m_maxAntennaGainDb; //!< maximum sum of the TX and RX antenna gains (dB)
+    std::map<SpectrumModelUid_t, SpatialIndex>
+        m_receiverIndices;                 //!< spatial index over the receivers per RX model
+    std::vector<std::size_t> m_candidates; //!< indices of the candidate receivers
+    Ptr<MultithreadedSimulatorImpl> m_simulator; //!< the multithreaded simulator, if used
+    mutable bool m_shared;      //!< whether the receivers belong to several partitions
+    std::mutex m_mutex;         //!< mutex serializing the transmissions if m_shared
 };
 
 } // namespace ns3
@@ -176,8 +176,8 @@ SpectrumAnalyzer::UpdateEnergyReceivedSoFar()
     NS_LOG_FUNCTION(this);
     if (m_lastChangeTime < Now())
     {
-        (*m_energySpectralDensity) +=
-            (*m_sumPowerSpectralDensity) * ((Now() - m_lastChangeTime).GetSeconds());
+        m_energySpectralDensity->AddScaled(*m_sumPowerSpectralDensity,
+                                           (Now() - m_lastChangeTime).GetSeconds());
         m_lastChangeTime = Now();
     }
     else
@@ -46,6 +46,7 @@ SpectrumChannel::DoDispose()
     m_propagationLoss = nullptr;
     m_propagationDelay = nullptr;
     m_spectrumPropagationLoss = nullptr;
+    m_linkCache.Clear();
 }
 
 TypeId
@@ -121,6 +122,7 @@ SpectrumChannel::AddPropagationLossModel(Ptr<PropagationLossModel> loss)
         loss->SetNext(m_propagationLoss);
     }
     m_propagationLoss = loss;
+    m_linkCache.Clear();
 }
 
 void
@@ -169,6 +171,7 @@ SpectrumChannel::SetPropagationDelayModel(Ptr<PropagationDelayModel> delay)
 {
     NS_ASSERT(!m_propagationDelay);
     m_propagationDelay = delay;
+    m_linkCache.Clear();
 }
 
 Ptr<SpectrumPropagationLossModel>
@@ -27,6 +27,7 @@
 #include "spectrum-transmit-filter.h"
 
 #include <ns3/channel.h>
+#include <ns3/link-gain-cache.h>
 #include <ns3/mobility-model.h>
 #include <ns3/nstime.h>
 #include <ns3/object.h>
@@ -261,6 +262,12 @@ class SpectrumChannel : public Channel
      * Transmit filter to be used with this channel
      */
     Ptr<SpectrumTransmitFilter> m_filter{nullptr};
+
+    /**
+     * Gain of the single-frequency propagation loss model and propagation delay of the
+     * links between static nodes
+     */
+    LinkGainCache m_linkCache;
 };
 
 } // namespace ns3
@@ -22,6 +22,8 @@
 #include <ns3/log.h>
 #include <ns3/nstime.h>
 
+#include <cmath>
+
 namespace ns3
 {
 
@@ -76,20 +78,20 @@ void
 ShannonSpectrumErrorModel::EvaluateChunk(const SpectrumValue& sinr, Time duration)
 {
     NS_LOG_FUNCTION(this << sinr << duration);
-    SpectrumValue CapacityPerHertz = Log2(1 + sinr);
     double capacity = 0;
 
-    auto bi = CapacityPerHertz.ConstBandsBegin();
-    auto vi = CapacityPerHertz.ConstValuesBegin();
+    auto bi = sinr.ConstBandsBegin();
+    auto vi = sinr.ConstValuesBegin();
 
-    while (bi != CapacityPerHertz.ConstBandsEnd())
+    // accumulate the capacity per Hertz, i.e., log2(1 + sinr), without creating temporaries
+    while (bi != sinr.ConstBandsEnd())
     {
-        NS_ASSERT(vi != CapacityPerHertz.ConstValuesEnd());
-        capacity += (bi->fh - bi->fl) * (*vi);
+        NS_ASSERT(vi != sinr.ConstValuesEnd());
+        capacity += (bi->fh - bi->fl) * std::log2(1 + (*vi));
         ++bi;
         ++vi;
     }
-    NS_ASSERT(vi == CapacityPerHertz.ConstValuesEnd());
+    NS_ASSERT(vi == sinr.ConstValuesEnd());
     NS_LOG_LOGIC("ChunkCapacity = " << capacity);
     m_deliverableBytes += static_cast<uint32_t>(capacity * duration.GetSeconds() / 8);
     NS_LOG_LOGIC("DeliverableBytes = " << m_deliverableBytes);
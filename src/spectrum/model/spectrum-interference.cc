@@ -59,6 +59,7 @@ SpectrumInterference::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     m_rxSignal = nullptr;
+    m_sinr = SpectrumValue();
     m_allSignals = nullptr;
     m_noise = nullptr;
     m_errorModel = nullptr;
@@ -126,10 +127,20 @@ SpectrumInterference::ConditionallyEvaluateChunk()
     NS_LOG_LOGIC("if condition: " << condition);
     if (condition)
     {
-        SpectrumValue sinr = (*m_rxSignal) / ((*m_allSignals) - (*m_rxSignal) + (*m_noise));
+        // compute rxSignal / (allSignals - rxSignal + noise) in a single pass
+        NS_ASSERT(m_rxSignal->GetValuesN() == m_allSignals->GetValuesN());
+        NS_ASSERT(m_noise->GetValuesN() == m_allSignals->GetValuesN());
+        m_sinr.AssignScaled(*m_rxSignal, 1.0);
+        auto sinrIt = m_sinr.ValuesBegin();
+        auto allIt = m_allSignals->ConstValuesBegin();
+        auto noiseIt = m_noise->ConstValuesBegin();
+        for (; sinrIt != m_sinr.ValuesEnd(); ++sinrIt, ++allIt, ++noiseIt)
+        {
+            *sinrIt /= (*allIt) - (*sinrIt) + (*noiseIt);
+        }
         Time duration = Now() - m_lastChangeTime;
         NS_LOG_LOGIC("calling m_errorModel->EvaluateChunk (sinr, duration)");
-        m_errorModel->EvaluateChunk(sinr, duration);
+        m_errorModel->EvaluateChunk(m_sinr, duration);
     }
 }
 
@@ -135,6 +135,12 @@ class SpectrumInterference : public Object
 
     Ptr<const SpectrumValue> m_noise; //!< Noise spectral power density
 
+    /**
+     * Stores the SINR of the last evaluated chunk, so that its storage is reused
+     * across chunks
+     */
+    SpectrumValue m_sinr;
+
     Time m_lastChangeTime; //!< the time of the last change in m_TotalPower
 
     Ptr<SpectrumErrorModel> m_errorModel; //!< Error model
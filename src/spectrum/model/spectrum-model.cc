@@ -37,7 +37,11 @@ operator==(const SpectrumModel& lhs, const SpectrumModel& rhs)
     return (lhs.m_uid == rhs.m_uid);
 }
 
+#ifdef NS3_MTP
+std::atomic<SpectrumModelUid_t> SpectrumModel::m_uidCount{0};
+#else
 SpectrumModelUid_t SpectrumModel::m_uidCount = 0;
+#endif
 
 SpectrumModel::SpectrumModel(const std::vector<double>& centerFreqs)
 {
@@ -24,6 +24,10 @@
 
 #include <vector>
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
+
 namespace ns3
 {
 
@@ -143,7 +147,11 @@ class SpectrumModel : public SimpleRefCount<SpectrumModel>
   private:
     Bands m_bands;            //!< Actual definition of frequency bands within this SpectrumModel
     SpectrumModelUid_t m_uid; //!< unique id for a given set of frequencies
+#ifdef NS3_MTP
+    static std::atomic<SpectrumModelUid_t> m_uidCount; //!< counter to assign m_uids
+#else
     static SpectrumModelUid_t m_uidCount; //!< counter to assign m_uids
+#endif
 };
 
 } // namespace ns3
@@ -43,7 +43,10 @@ SpectrumSignalParameters::~SpectrumSignalParameters()
 SpectrumSignalParameters::SpectrumSignalParameters(const SpectrumSignalParameters& p)
 {
     NS_LOG_FUNCTION(this << &p);
-    psd = p.psd->Copy();
+    if (p.psd)
+    {
+        psd = p.psd->Copy();
+    }
     duration = p.duration;
     txPhy = p.txPhy;
     txAntenna = p.txAntenna;
@@ -56,4 +59,11 @@ SpectrumSignalParameters::Copy() const
     return Create<SpectrumSignalParameters>(*this);
 }
 
+Ptr<SpectrumSignalParameters>
+SpectrumSignalParameters::DeepCopy() const
+{
+    NS_LOG_FUNCTION(this);
+    return Copy();
+}
+
 } // namespace ns3
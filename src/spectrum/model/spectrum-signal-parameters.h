@@ -81,6 +81,18 @@ struct SpectrumSignalParameters : public SimpleRefCount<SpectrumSignalParameters
      */
     virtual Ptr<SpectrumSignalParameters> Copy() const;
 
+    /**
+     * make a "virtual" copy of this class that does not share any packet
+     * with this class, so that it can be delivered to the receivers of
+     * another partition of the MultithreadedSimulatorImpl. The default
+     * implementation returns Copy(), hence the classes inheriting from
+     * SpectrumSignalParameters which carry packets should override this
+     * method.
+     *
+     * \return a deep copy of the (possibly derived) class
+     */
+    virtual Ptr<SpectrumSignalParameters> DeepCopy() const;
+
     /**
      * The Power Spectral Density of the
      * waveform, in linear units. The exact unit will depend on the
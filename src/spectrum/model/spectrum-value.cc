@@ -374,6 +374,58 @@ Integral(const SpectrumValue& arg)
     return i;
 }
 
+SpectrumValue&
+SpectrumValue::AddScaled(const SpectrumValue& x, double s)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size());
+
+    const std::size_t n = m_values.size();
+    double* dst = m_values.data();
+    const double* src = x.m_values.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        dst[i] += src[i] * s;
+    }
+    return *this;
+}
+
+SpectrumValue&
+SpectrumValue::MultiplyAccumulate(const SpectrumValue& x, const SpectrumValue& y)
+{
+    NS_ASSERT(m_spectrumModel == x.m_spectrumModel);
+    NS_ASSERT(m_spectrumModel == y.m_spectrumModel);
+    NS_ASSERT(m_values.size() == x.m_values.size());
+    NS_ASSERT(m_values.size() == y.m_values.size());
+
+    const std::size_t n = m_values.size();
+    double* dst = m_values.data();
+    const double* src1 = x.m_values.data();
+    const double* src2 = y.m_values.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        dst[i] += src1[i] * src2[i];
+    }
+    return *this;
+}
+
+SpectrumValue&
+SpectrumValue::AssignScaled(const SpectrumValue& x, double s)
+{
+    m_spectrumModel = x.m_spectrumModel;
+    // resize () does not reallocate if the capacity is large enough
+    m_values.resize(x.m_values.size());
+
+    const std::size_t n = m_values.size();
+    double* dst = m_values.data();
+    const double* src = x.m_values.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        dst[i] = src[i] * s;
+    }
+    return *this;
+}
+
 Ptr<SpectrumValue>
 SpectrumValue::Copy() const
 {
@@ -410,6 +410,41 @@ class SpectrumValue : public SimpleRefCount<SpectrumValue>
      */
     SpectrumValue& operator=(double rhs);
 
+    /**
+     * Add the product of x and a scalar to *this, component by
+     * component, without creating any temporary SpectrumValue
+     * (i.e., *this += x * s).
+     *
+     * @param x the SpectrumValue to scale
+     * @param s the scalar
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& AddScaled(const SpectrumValue& x, double s);
+
+    /**
+     * Add the product of x and y to *this, component by component,
+     * without creating any temporary SpectrumValue (i.e., *this += x * y).
+     *
+     * @param x the first factor
+     * @param y the second factor
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& MultiplyAccumulate(const SpectrumValue& x, const SpectrumValue& y);
+
+    /**
+     * Assign the product of x and a scalar to *this, component by
+     * component, reusing the storage of *this (i.e., *this = x * s).
+     * *this takes the SpectrumModel of x.
+     *
+     * @param x the SpectrumValue to scale
+     * @param s the scalar
+     *
+     * @return a reference to *this
+     */
+    SpectrumValue& AssignScaled(const SpectrumValue& x, double s);
+
     /**
      *
      * @param x the operand
@@ -1821,6 +1821,72 @@ ThreeGppChannelModel::GenerateChannelParameters(const Ptr<const ChannelCondition
     return channelParams;
 }
 
+/**
+ * Buffers used by ThreeGppChannelModel::GetNewChannel to store the terms of the channel
+ * coefficients which only depend on one of the two antenna elements. They are reused across
+ * the calls to avoid allocating them for every new channel matrix, and they are thread local
+ * so that channel models used by different threads do not share them.
+ */
+struct ThreeGppChannelWorkspace
+{
+    std::vector<Vector> uLocs;                     //!< locations of the u antenna elements
+    std::vector<Vector> sLocs;                     //!< locations of the s antenna elements
+    ComplexMatrixArray rxRays;                     //!< rays terms times rx phase (ray, u, cluster)
+    ComplexMatrixArray txPhases;                   //!< tx phase terms (ray, s, cluster)
+    std::vector<std::complex<double>> losTxPhases; //!< tx phase terms of the LOS ray (s)
+};
+
+/**
+ * \param numRays the number of rays per cluster
+ * \param uSize the number of elements of the u antenna
+ * \param sSize the number of elements of the s antenna
+ * \param numClusters the number of clusters
+ * \return the workspace of the calling thread, sized for the given dimensions
+ */
+static ThreeGppChannelWorkspace&
+GetChannelWorkspace(size_t numRays, size_t uSize, size_t sSize, size_t numClusters)
+{
+    static thread_local ThreeGppChannelWorkspace workspace;
+    workspace.uLocs.resize(uSize);
+    workspace.sLocs.resize(sSize);
+    workspace.losTxPhases.resize(sSize);
+    if (workspace.rxRays.GetNumRows() != numRays || workspace.rxRays.GetNumCols() != uSize ||
+        workspace.rxRays.GetNumPages() != numClusters)
+    {
+        workspace.rxRays = ComplexMatrixArray(numRays, uSize, numClusters);
+    }
+    if (workspace.txPhases.GetNumRows() != numRays || workspace.txPhases.GetNumCols() != sSize ||
+        workspace.txPhases.GetNumPages() != numClusters)
+    {
+        workspace.txPhases = ComplexMatrixArray(numRays, sSize, numClusters);
+    }
+    return workspace;
+}
+
+/**
+ * Sum of the element-wise products of two arrays of complex values. The products are
+ * expanded on the real and imaginary parts, which yields the same values as the
+ * multiplication of std::complex (for finite values) while letting the compiler keep the
+ * loop free of the calls handling the infinite and NaN cases.
+ *
+ * \param a the first array
+ * \param b the second array
+ * \param size the number of values of each array
+ * \return the sum of the products
+ */
+static std::complex<double>
+SumOfProducts(const std::complex<double>* a, const std::complex<double>* b, size_t size)
+{
+    double re = 0;
+    double im = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        re += a[i].real() * b[i].real() - a[i].imag() * b[i].imag();
+        im += a[i].real() * b[i].imag() + a[i].imag() * b[i].real();
+    }
+    return {re, im};
+}
+
 Ptr<MatrixBasedChannelModel::ChannelMatrix>
 ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelParams,
                                     Ptr<const ParamsTable> table3gpp,
@@ -1842,29 +1908,18 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     // check if channelParams structure is generated in direction s-to-u or u-to-s
     bool isSameDirection = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
 
-    MatrixBasedChannelModel::Double2DVector rayAodRadian;
-    MatrixBasedChannelModel::Double2DVector rayAoaRadian;
-    MatrixBasedChannelModel::Double2DVector rayZodRadian;
-    MatrixBasedChannelModel::Double2DVector rayZoaRadian;
-
     // if channel params is generated in the same direction in which we
     // generate the channel matrix, angles and zenith od departure and arrival are ok,
-    // just set them to corresponding variable that will be used for the generation
-    // of channel matrix, otherwise we need to flip angles and zeniths of departure and arrival
-    if (isSameDirection)
-    {
-        rayAodRadian = channelParams->m_rayAodRadian;
-        rayAoaRadian = channelParams->m_rayAoaRadian;
-        rayZodRadian = channelParams->m_rayZodRadian;
-        rayZoaRadian = channelParams->m_rayZoaRadian;
-    }
-    else
-    {
-        rayAodRadian = channelParams->m_rayAoaRadian;
-        rayAoaRadian = channelParams->m_rayAodRadian;
-        rayZodRadian = channelParams->m_rayZoaRadian;
-        rayZoaRadian = channelParams->m_rayZodRadian;
-    }
+    // just refer to them when generating the channel matrix, otherwise we need to flip
+    // angles and zeniths of departure and arrival
+    const auto& rayAodRadian =
+        isSameDirection ? channelParams->m_rayAodRadian : channelParams->m_rayAoaRadian;
+    const auto& rayAoaRadian =
+        isSameDirection ? channelParams->m_rayAoaRadian : channelParams->m_rayAodRadian;
+    const auto& rayZodRadian =
+        isSameDirection ? channelParams->m_rayZodRadian : channelParams->m_rayZoaRadian;
+    const auto& rayZoaRadian =
+        isSameDirection ? channelParams->m_rayZoaRadian : channelParams->m_rayZodRadian;
 
     // Step 11: Generate channel coefficients for each cluster n and each receiver
     //  and transmitter element pair u,s.
@@ -1909,42 +1964,30 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     Angles sAngle(uMob->GetPosition(), sMob->GetPosition());
     Angles uAngle(sMob->GetPosition(), uMob->GetPosition());
 
-    Complex2DVector raysPreComp(channelParams->m_reducedClusterNumber,
-                                table3gpp->m_raysPerCluster); // stores part of the ray expression,
-    // cached as independent from the u- and s-indexes
-    Double2DVector sinCosA; // cached multiplications of sin and cos of the ZoA and AoA angles
-    Double2DVector sinSinA; // cached multiplications of sines of the ZoA and AoA angles
-    Double2DVector cosZoA;  // cached cos of the ZoA angle
-    Double2DVector sinCosD; // cached multiplications of sin and cos of the ZoD and AoD angles
-    Double2DVector sinSinD; // cached multiplications of the cosines of the ZoA and AoA angles
-    Double2DVector cosZoD;  // cached cos of the ZoD angle
-
-    // resize to appropriate dimensions
-    sinCosA.resize(channelParams->m_reducedClusterNumber);
-    sinSinA.resize(channelParams->m_reducedClusterNumber);
-    cosZoA.resize(channelParams->m_reducedClusterNumber);
-    sinCosD.resize(channelParams->m_reducedClusterNumber);
-    sinSinD.resize(channelParams->m_reducedClusterNumber);
-    cosZoD.resize(channelParams->m_reducedClusterNumber);
-    for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
+    const uint8_t numRays = table3gpp->m_raysPerCluster;
+    auto& workspace =
+        GetChannelWorkspace(numRays, uSize, sSize, channelParams->m_reducedClusterNumber);
+    for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+    {
+        workspace.uLocs[uIndex] = uAntenna->GetElementLocation(uIndex);
+    }
+    for (size_t sIndex = 0; sIndex < sSize; sIndex++)
     {
-        sinCosA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinA[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoA[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinCosD[nIndex].resize(table3gpp->m_raysPerCluster);
-        sinSinD[nIndex].resize(table3gpp->m_raysPerCluster);
-        cosZoD[nIndex].resize(table3gpp->m_raysPerCluster);
+        workspace.sLocs[sIndex] = sAntenna->GetElementLocation(sIndex);
     }
-    // pre-compute the terms which are independent from uIndex and sIndex
+
+    // pre-compute the terms which are independent from sIndex (rays terms times the rx phase)
+    // and those which are independent from uIndex (tx phase), so that the channel coefficient
+    // of each element pair only requires a multiply-accumulate over the rays
     for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
     {
-        for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+        for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
         {
-            DoubleVector initialPhase = channelParams->m_clusterPhase[nIndex][mIndex];
+            const DoubleVector& initialPhase = channelParams->m_clusterPhase[nIndex][mIndex];
             NS_ASSERT(4 <= initialPhase.size());
             double k = channelParams->m_crossPolarizationPowerRatios[nIndex][mIndex];
 
-            // cache the component of the "rays" terms which depend on the random angle of arrivals
+            // the component of the "rays" terms which depend on the random angle of arrivals
             // and departures and initial phases only
             auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
                 Angles(channelParams->m_rayAoaRadian[nIndex][mIndex],
@@ -1952,7 +1995,7 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
             auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
                 Angles(channelParams->m_rayAodRadian[nIndex][mIndex],
                        channelParams->m_rayZodRadian[nIndex][mIndex]));
-            raysPreComp(nIndex, mIndex) =
+            const std::complex<double> raysPreComp =
                 std::complex<double>(cos(initialPhase[0]), sin(initialPhase[0])) *
                     rxFieldPatternTheta * txFieldPatternTheta +
                 std::complex<double>(cos(initialPhase[1]), sin(initialPhase[1])) *
@@ -1962,23 +2005,41 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                 std::complex<double>(cos(initialPhase[3]), sin(initialPhase[3])) *
                     rxFieldPatternPhi * txFieldPatternPhi;
 
-            // cache the component of the "rxPhaseDiff" terms which depend on the random angle of
+            // the component of the "rxPhaseDiff" terms which depend on the random angle of
             // arrivals only
             double sinRayZoa = sin(rayZoaRadian[nIndex][mIndex]);
             double sinRayAoa = sin(rayAoaRadian[nIndex][mIndex]);
             double cosRayAoa = cos(rayAoaRadian[nIndex][mIndex]);
-            sinCosA[nIndex][mIndex] = sinRayZoa * cosRayAoa;
-            sinSinA[nIndex][mIndex] = sinRayZoa * sinRayAoa;
-            cosZoA[nIndex][mIndex] = cos(rayZoaRadian[nIndex][mIndex]);
+            const double sinCosA = sinRayZoa * cosRayAoa;
+            const double sinSinA = sinRayZoa * sinRayAoa;
+            const double cosZoA = cos(rayZoaRadian[nIndex][mIndex]);
 
-            // cache the component of the "txPhaseDiff" terms which depend on the random angle of
+            // the component of the "txPhaseDiff" terms which depend on the random angle of
             // departure only
             double sinRayZod = sin(rayZodRadian[nIndex][mIndex]);
             double sinRayAod = sin(rayAodRadian[nIndex][mIndex]);
             double cosRayAod = cos(rayAodRadian[nIndex][mIndex]);
-            sinCosD[nIndex][mIndex] = sinRayZod * cosRayAod;
-            sinSinD[nIndex][mIndex] = sinRayZod * sinRayAod;
-            cosZoD[nIndex][mIndex] = cos(rayZodRadian[nIndex][mIndex]);
+            const double sinCosD = sinRayZod * cosRayAod;
+            const double sinSinD = sinRayZod * sinRayAod;
+            const double cosZoD = cos(rayZodRadian[nIndex][mIndex]);
+
+            for (size_t uIndex = 0; uIndex < uSize; uIndex++)
+            {
+                const Vector& uLoc = workspace.uLocs[uIndex];
+                // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+                double rxPhaseDiff =
+                    2 * M_PI * (sinCosA * uLoc.x + sinSinA * uLoc.y + cosZoA * uLoc.z);
+                workspace.rxRays(mIndex, uIndex, nIndex) =
+                    raysPreComp * std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
+            }
+            for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+            {
+                const Vector& sLoc = workspace.sLocs[sIndex];
+                double txPhaseDiff =
+                    2 * M_PI * (sinCosD * sLoc.x + sinSinD * sLoc.y + cosZoD * sLoc.z);
+                workspace.txPhases(mIndex, sIndex, nIndex) =
+                    std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+            }
         }
     }
 
@@ -1987,39 +2048,23 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
     uint8_t numSubClustersAdded = 0;
     for (uint8_t nIndex = 0; nIndex < channelParams->m_reducedClusterNumber; nIndex++)
     {
+        const double rayScale =
+            sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const std::complex<double>* rxRays = &workspace.rxRays(0, uIndex, nIndex);
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
+                const std::complex<double>* txPhases = &workspace.txPhases(0, sIndex, nIndex);
                 // Compute the N-2 weakest cluster, assuming 0 slant angle and a
                 // polarization slant angle configured in the array (7.5-22)
                 if (nIndex != channelParams->m_cluster1st && nIndex != channelParams->m_cluster2nd)
                 {
-                    std::complex<double> rays(0, 0);
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
-                    {
-                        // lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
-                        // NOTE Doppler is computed in the CalcBeamformingGain function and is
-                        // simplified to only account for the center angle of each cluster.
-                        rays += raysPreComp(nIndex, mIndex) *
-                                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
-                    }
-                    rays *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    // NOTE Doppler is computed in the CalcBeamformingGain function and is
+                    // simplified to only account for the center angle of each cluster.
+                    std::complex<double> rays = SumOfProducts(rxRays, txPhases, numRays);
+                    rays *= rayScale;
                     hUsn(uIndex, sIndex, nIndex) = rays;
                 }
                 else //(7.5-28)
@@ -2028,24 +2073,11 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                     std::complex<double> raysSub2(0, 0);
                     std::complex<double> raysSub3(0, 0);
 
-                    for (uint8_t mIndex = 0; mIndex < table3gpp->m_raysPerCluster; mIndex++)
+                    for (uint8_t mIndex = 0; mIndex < numRays; mIndex++)
                     {
                         // ZML:Just remind me that the angle offsets for the 3 subclusters were not
                         // generated correctly.
-                        double rxPhaseDiff =
-                            2 * M_PI *
-                            (sinCosA[nIndex][mIndex] * uLoc.x + sinSinA[nIndex][mIndex] * uLoc.y +
-                             cosZoA[nIndex][mIndex] * uLoc.z);
-
-                        double txPhaseDiff =
-                            2 * M_PI *
-                            (sinCosD[nIndex][mIndex] * sLoc.x + sinSinD[nIndex][mIndex] * sLoc.y +
-                             cosZoD[nIndex][mIndex] * sLoc.z);
-
-                        std::complex<double> raySub =
-                            raysPreComp(nIndex, mIndex) *
-                            std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                            std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+                        std::complex<double> raySub = rxRays[mIndex] * txPhases[mIndex];
 
                         switch (mIndex)
                         {
@@ -2068,12 +2100,9 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
                             break;
                         }
                     }
-                    raysSub1 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub2 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
-                    raysSub3 *=
-                        sqrt(channelParams->m_clusterPower[nIndex] / table3gpp->m_raysPerCluster);
+                    raysSub1 *= rayScale;
+                    raysSub2 *= rayScale;
+                    raysSub3 *= rayScale;
                     hUsn(uIndex, sIndex, nIndex) = raysSub1;
                     hUsn(uIndex,
                          sIndex,
@@ -2106,44 +2135,50 @@ ThreeGppChannelModel::GetNewChannel(Ptr<const ThreeGppChannelParams> channelPara
         const double sinSAngleAz = sin(sAngle.GetAzimuth());
         const double cosSAngleAz = cos(sAngle.GetAzimuth());
 
+        // the field patterns only depend on the LOS angles, not on the element
+        auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
+            Angles(uAngle.GetAzimuth(), uAngle.GetInclination()));
+        auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
+            Angles(sAngle.GetAzimuth(), sAngle.GetInclination()));
+        const double fieldPattern =
+            rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi;
+
+        double kLinear = pow(10, channelParams->m_K_factor / 10.0);
+        const double nlosScale = sqrt(1.0 / (kLinear + 1));
+        const double losScale = sqrt(kLinear / (1 + kLinear));
+        // the LOS path should be attenuated if blockage is enabled.
+        const double losAttenuation = pow(10, channelParams->m_attenuation_dB[0] / 10.0);
+
+        for (size_t sIndex = 0; sIndex < sSize; sIndex++)
+        {
+            const Vector& sLoc = workspace.sLocs[sIndex];
+            double txPhaseDiff =
+                2 * M_PI *
+                (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
+                 cosSAngleIncl * sLoc.z);
+            workspace.losTxPhases[sIndex] =
+                std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
+        }
+
         for (size_t uIndex = 0; uIndex < uSize; uIndex++)
         {
-            Vector uLoc = uAntenna->GetElementLocation(uIndex);
+            const Vector& uLoc = workspace.uLocs[uIndex];
             double rxPhaseDiff = 2 * M_PI *
                                  (sinUAngleIncl * cosUAngleAz * uLoc.x +
                                   sinUAngleIncl * sinUAngleAz * uLoc.y + cosUAngleIncl * uLoc.z);
+            const std::complex<double> rxRay =
+                fieldPattern * phaseDiffDueToDistance *
+                std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff));
 
             for (size_t sIndex = 0; sIndex < sSize; sIndex++)
             {
-                Vector sLoc = sAntenna->GetElementLocation(sIndex);
-                std::complex<double> ray(0, 0);
-                double txPhaseDiff =
-                    2 * M_PI *
-                    (sinSAngleIncl * cosSAngleAz * sLoc.x + sinSAngleIncl * sinSAngleAz * sLoc.y +
-                     cosSAngleIncl * sLoc.z);
-
-                auto [rxFieldPatternPhi, rxFieldPatternTheta] = uAntenna->GetElementFieldPattern(
-                    Angles(uAngle.GetAzimuth(), uAngle.GetInclination()));
-                auto [txFieldPatternPhi, txFieldPatternTheta] = sAntenna->GetElementFieldPattern(
-                    Angles(sAngle.GetAzimuth(), sAngle.GetInclination()));
-
-                ray = (rxFieldPatternTheta * txFieldPatternTheta -
-                       rxFieldPatternPhi * txFieldPatternPhi) *
-                      phaseDiffDueToDistance *
-                      std::complex<double>(cos(rxPhaseDiff), sin(rxPhaseDiff)) *
-                      std::complex<double>(cos(txPhaseDiff), sin(txPhaseDiff));
-
-                double kLinear = pow(10, channelParams->m_K_factor / 10.0);
-                // the LOS path should be attenuated if blockage is enabled.
-                hUsn(uIndex, sIndex, 0) =
-                    sqrt(1.0 / (kLinear + 1)) * hUsn(uIndex, sIndex, 0) +
-                    sqrt(kLinear / (1 + kLinear)) * ray /
-                        pow(10,
-                            channelParams->m_attenuation_dB[0] / 10.0); //(7.5-30) for tau = tau1
+                std::complex<double> ray = rxRay * workspace.losTxPhases[sIndex];
+
+                hUsn(uIndex, sIndex, 0) = nlosScale * hUsn(uIndex, sIndex, 0) +
+                                          losScale * ray / losAttenuation; //(7.5-30) for tau = tau1
                 for (size_t nIndex = 1; nIndex < hUsn.GetNumPages(); nIndex++)
                 {
-                    hUsn(uIndex, sIndex, nIndex) *=
-                        sqrt(1.0 / (kLinear + 1)); //(7.5-30) for tau = tau2...tauN
+                    hUsn(uIndex, sIndex, nIndex) *= nlosScale; //(7.5-30) for tau = tau2...tauN
                 }
             }
         }
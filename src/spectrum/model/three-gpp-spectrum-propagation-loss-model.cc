@@ -173,29 +173,19 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
     // check if channelParams structure is generated in direction s-to-u or u-to-s
     bool isSameDirection = (channelParams->m_nodeIds == channelMatrix->m_nodeIds);
 
-    MatrixBasedChannelModel::DoubleVector zoa;
-    MatrixBasedChannelModel::DoubleVector zod;
-    MatrixBasedChannelModel::DoubleVector aoa;
-    MatrixBasedChannelModel::DoubleVector aod;
-
     // if channel params is generated in the same direction in which we
     // generate the channel matrix, angles and zenith od departure and arrival are ok,
-    // just set them to corresponding variable that will be used for the generation
-    // of channel matrix, otherwise we need to flip angles and zeniths of departure and arrival
-    if (isSameDirection)
-    {
-        zoa = channelParams->m_angle[MatrixBasedChannelModel::ZOA_INDEX];
-        zod = channelParams->m_angle[MatrixBasedChannelModel::ZOD_INDEX];
-        aoa = channelParams->m_angle[MatrixBasedChannelModel::AOA_INDEX];
-        aod = channelParams->m_angle[MatrixBasedChannelModel::AOD_INDEX];
-    }
-    else
-    {
-        zod = channelParams->m_angle[MatrixBasedChannelModel::ZOA_INDEX];
-        zoa = channelParams->m_angle[MatrixBasedChannelModel::ZOD_INDEX];
-        aod = channelParams->m_angle[MatrixBasedChannelModel::AOA_INDEX];
-        aoa = channelParams->m_angle[MatrixBasedChannelModel::AOD_INDEX];
-    }
+    // just refer to them when computing the doppler term, otherwise we need to flip
+    // angles and zeniths of departure and arrival
+    const auto& angle = channelParams->m_angle;
+    const auto& zoa = angle[isSameDirection ? MatrixBasedChannelModel::ZOA_INDEX
+                                            : MatrixBasedChannelModel::ZOD_INDEX];
+    const auto& zod = angle[isSameDirection ? MatrixBasedChannelModel::ZOD_INDEX
+                                            : MatrixBasedChannelModel::ZOA_INDEX];
+    const auto& aoa = angle[isSameDirection ? MatrixBasedChannelModel::AOA_INDEX
+                                            : MatrixBasedChannelModel::AOD_INDEX];
+    const auto& aod = angle[isSameDirection ? MatrixBasedChannelModel::AOD_INDEX
+                                            : MatrixBasedChannelModel::AOA_INDEX];
 
     for (uint16_t cIndex = 0; cIndex < numCluster; cIndex++)
     {
@@ -214,15 +204,20 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
         double D = channelParams->m_D[cIndex];
 
         // cluster angle angle[direction][n], where direction = 0(aoa), 1(zoa).
+        const double sinZoa = sin(zoa[cIndex] * M_PI / 180);
+        const double sinZod = sin(zod[cIndex] * M_PI / 180);
         double tempDoppler =
-            factor * ((sin(zoa[cIndex] * M_PI / 180) * cos(aoa[cIndex] * M_PI / 180) * uSpeed.x +
-                       sin(zoa[cIndex] * M_PI / 180) * sin(aoa[cIndex] * M_PI / 180) * uSpeed.y +
+            factor * ((sinZoa * cos(aoa[cIndex] * M_PI / 180) * uSpeed.x +
+                       sinZoa * sin(aoa[cIndex] * M_PI / 180) * uSpeed.y +
                        cos(zoa[cIndex] * M_PI / 180) * uSpeed.z) +
-                      (sin(zod[cIndex] * M_PI / 180) * cos(aod[cIndex] * M_PI / 180) * sSpeed.x +
-                       sin(zod[cIndex] * M_PI / 180) * sin(aod[cIndex] * M_PI / 180) * sSpeed.y +
+                      (sinZod * cos(aod[cIndex] * M_PI / 180) * sSpeed.x +
+                       sinZod * sin(aod[cIndex] * M_PI / 180) * sSpeed.y +
                        cos(zod[cIndex] * M_PI / 180) * sSpeed.z) +
                       2 * alpha * D);
-        doppler[cIndex] = std::complex<double>(cos(tempDoppler), sin(tempDoppler));
+        // the long term component is only combined with the doppler term, hence the product
+        // is computed once per cluster rather than once per sub-band
+        doppler[cIndex] =
+            longTerm[cIndex] * std::complex<double>(cos(tempDoppler), sin(tempDoppler));
     }
 
     NS_ASSERT(numCluster <= doppler.GetSize());
@@ -240,8 +235,8 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain(
             for (uint16_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
                 double delay = -2 * M_PI * fsb * (channelParams->m_delay[cIndex]);
-                subsbandGain = subsbandGain + longTerm[cIndex] * doppler[cIndex] *
-                                                  std::complex<double>(cos(delay), sin(delay));
+                subsbandGain =
+                    subsbandGain + doppler[cIndex] * std::complex<double>(cos(delay), sin(delay));
             }
             *vit = (*vit) * (norm(subsbandGain));
         }
@@ -30,6 +30,10 @@
 #include <cmath>
 #include <map>
 #include <sstream>
+#ifdef NS3_MTP
+#include <mutex>
+#endif
+#include <tuple>
 
 namespace ns3
 {
@@ -67,6 +71,118 @@ operator<(const WifiSpectrumModelId& a, const WifiSpectrumModelId& b)
 
 static std::map<WifiSpectrumModelId, Ptr<SpectrumModel>>
     g_wifiSpectrumModelMap; ///< static initializer for the class
+#ifdef NS3_MTP
+static std::mutex g_wifiSpectrumModelMutex; ///< mutex protecting g_wifiSpectrumModelMap
+#endif
+
+/// The transmit PSD creation methods whose masks are cached
+enum class WifiTxPsdType : uint8_t
+{
+    DSSS = 0,
+    OFDM,
+    DUPLICATED_20MHZ,
+    HT_OFDM,
+    HE_OFDM,
+    HE_MU_OFDM
+};
+
+///< Wifi transmit PSD template structure
+struct WifiTxPsdTemplateId
+{
+    WifiTxPsdType m_type;                     ///< the method creating the PSD
+    uint32_t m_centerFrequency;               ///< center frequency (in MHz)
+    uint16_t m_channelWidth;                  ///< channel width (in MHz)
+    uint16_t m_guardBandwidth;                ///< guard band width (in MHz)
+    double m_minInnerBandDbr;                 ///< minimum relative power in the inner band
+    double m_minOuterBandDbr;                 ///< minimum relative power in the outer band
+    double m_lowestPointDbr;                  ///< relative power of the outermost subcarriers
+    std::vector<bool> m_puncturedSubchannels; ///< bitmap of the punctured 20 MHz subchannels
+    WifiSpectrumBandIndices m_ru;             ///< the RU band (HE MU only)
+};
+
+/**
+ * Less than operator
+ * \param a the first transmit PSD template to compare
+ * \param b the second transmit PSD template to compare
+ * \returns true if the first template is less than the second template
+ */
+bool
+operator<(const WifiTxPsdTemplateId& a, const WifiTxPsdTemplateId& b)
+{
+    return std::tie(a.m_type,
+                    a.m_centerFrequency,
+                    a.m_channelWidth,
+                    a.m_guardBandwidth,
+                    a.m_minInnerBandDbr,
+                    a.m_minOuterBandDbr,
+                    a.m_lowestPointDbr,
+                    a.m_puncturedSubchannels,
+                    a.m_ru) < std::tie(b.m_type,
+                                       b.m_centerFrequency,
+                                       b.m_channelWidth,
+                                       b.m_guardBandwidth,
+                                       b.m_minInnerBandDbr,
+                                       b.m_minOuterBandDbr,
+                                       b.m_lowestPointDbr,
+                                       b.m_puncturedSubchannels,
+                                       b.m_ru);
+}
+
+// The templates are per thread, so that the PSDs can be created concurrently by the
+// partitions of the multithreaded simulator without locking (Ptr reference counts are
+// only atomic when built with NS3_MTP, hence the templates cannot be shared among
+// threads otherwise)
+static thread_local std::map<WifiTxPsdTemplateId, Ptr<const SpectrumValue>>
+    g_wifiTxPsdTemplateMap; ///< transmit PSDs for a transmit power of 1 W
+static thread_local uint64_t g_wifiTxPsdTemplateHits{0}; ///< number of PSDs created from a template
+static thread_local uint64_t g_wifiTxPsdTemplateMisses{0}; ///< number of PSDs built from scratch
+
+/**
+ * Create a transmit PSD by scaling the cached template matching the given parameters,
+ * if any. The mask of all the transmit PSDs scales linearly with the transmit power.
+ *
+ * \param key the parameters of the transmit PSD
+ * \param txPowerW the transmit power (W)
+ * \return the transmit PSD, or a null pointer if no template is cached
+ */
+static Ptr<SpectrumValue>
+FindTxPsdTemplate(const WifiTxPsdTemplateId& key, double txPowerW)
+{
+    if (txPowerW <= 0)
+    {
+        return nullptr;
+    }
+    auto it = g_wifiTxPsdTemplateMap.find(key);
+    if (it == g_wifiTxPsdTemplateMap.end())
+    {
+        ++g_wifiTxPsdTemplateMisses;
+        return nullptr;
+    }
+    ++g_wifiTxPsdTemplateHits;
+    auto psd = Create<SpectrumValue>();
+    psd->AssignScaled(*it->second, txPowerW);
+    return psd;
+}
+
+/**
+ * Cache the template of the given transmit PSD, i.e., the PSD scaled to a transmit
+ * power of 1 W.
+ *
+ * \param key the parameters of the transmit PSD
+ * \param psd the transmit PSD
+ * \param txPowerW the transmit power (W) of the transmit PSD
+ */
+static void
+AddTxPsdTemplate(const WifiTxPsdTemplateId& key, const SpectrumValue& psd, double txPowerW)
+{
+    if (txPowerW <= 0)
+    {
+        return;
+    }
+    auto unitPsd = Create<SpectrumValue>();
+    unitPsd->AssignScaled(psd, 1 / txPowerW);
+    g_wifiTxPsdTemplateMap.emplace(key, unitPsd);
+}
 
 Ptr<SpectrumModel>
 WifiSpectrumValueHelper::GetSpectrumModel(uint32_t centerFrequency,
@@ -77,6 +193,10 @@ WifiSpectrumValueHelper::GetSpectrumModel(uint32_t centerFrequency,
     NS_LOG_FUNCTION(centerFrequency << channelWidth << carrierSpacing << guardBandwidth);
     Ptr<SpectrumModel> ret;
     WifiSpectrumModelId key{centerFrequency, channelWidth, carrierSpacing, guardBandwidth};
+#ifdef NS3_MTP
+    // the spectrum models are shared by the partitions of the multithreaded simulator
+    std::lock_guard<std::mutex> lock(g_wifiSpectrumModelMutex);
+#endif
     auto it = g_wifiSpectrumModelMap.find(key);
     if (it != g_wifiSpectrumModelMap.end())
     {
@@ -129,6 +249,19 @@ WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(uint32_t centerFrequen
                                                           uint16_t guardBandwidth)
 {
     NS_LOG_FUNCTION(centerFrequency << txPowerW << +guardBandwidth);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::DSSS,
+                                  centerFrequency,
+                                  22,
+                                  guardBandwidth,
+                                  0,
+                                  0,
+                                  0,
+                                  {},
+                                  {}};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint16_t channelWidth = 22; // DSSS channels are 22 MHz wide
     uint32_t carrierSpacing = 312500;
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
@@ -147,6 +280,7 @@ WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(uint32_t centerFrequen
             *vit = txPowerPerBand / (bit->fh - bit->fl);
         }
     }
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -161,6 +295,19 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(uint32_t centerFrequen
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::OFDM,
+                                  centerFrequency,
+                                  channelWidth,
+                                  guardBandwidth,
+                                  minInnerBandDbr,
+                                  minOuterBandDbr,
+                                  lowestPointDbr,
+                                  {},
+                                  {}};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint32_t carrierSpacing = 0;
     uint32_t innerSlopeWidth = 0;
     switch (channelWidth)
@@ -218,6 +365,7 @@ WifiSpectrumValueHelper::CreateOfdmTxPowerSpectralDensity(uint32_t centerFrequen
                               lowestPointDbr);
     NormalizeSpectrumMask(c, txPowerW);
     NS_ASSERT_MSG(std::abs(txPowerW - Integral(*c)) < 1e-6, "Power allocation failed");
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -234,6 +382,19 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::DUPLICATED_20MHZ,
+                                  centerFrequency,
+                                  channelWidth,
+                                  guardBandwidth,
+                                  minInnerBandDbr,
+                                  minOuterBandDbr,
+                                  lowestPointDbr,
+                                  puncturedSubchannels,
+                                  {}};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint32_t carrierSpacing = 312500;
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequency, channelWidth, carrierSpacing, guardBandwidth));
@@ -294,6 +455,7 @@ WifiSpectrumValueHelper::CreateDuplicated20MhzTxPowerSpectralDensity(
                               lowestPointDbr);
     NormalizeSpectrumMask(c, txPowerW);
     NS_ASSERT_MSG(std::abs(txPowerW - Integral(*c)) < 1e-6, "Power allocation failed");
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -308,6 +470,19 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(uint32_t centerFrequ
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::HT_OFDM,
+                                  centerFrequency,
+                                  channelWidth,
+                                  guardBandwidth,
+                                  minInnerBandDbr,
+                                  minOuterBandDbr,
+                                  lowestPointDbr,
+                                  {},
+                                  {}};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint32_t carrierSpacing = 312500;
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequency, channelWidth, carrierSpacing, guardBandwidth));
@@ -359,6 +534,7 @@ WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(uint32_t centerFrequ
                               lowestPointDbr);
     NormalizeSpectrumMask(c, txPowerW);
     NS_ASSERT_MSG(std::abs(txPowerW - Integral(*c)) < 1e-6, "Power allocation failed");
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -375,6 +551,19 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << minInnerBandDbr
                                     << minOuterBandDbr << lowestPointDbr);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::HE_OFDM,
+                                  centerFrequency,
+                                  channelWidth,
+                                  guardBandwidth,
+                                  minInnerBandDbr,
+                                  minOuterBandDbr,
+                                  lowestPointDbr,
+                                  puncturedSubchannels,
+                                  {}};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint32_t carrierSpacing = 78125;
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequency, channelWidth, carrierSpacing, guardBandwidth));
@@ -493,6 +682,7 @@ WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(
                               puncturedSlopeWidth);
     NormalizeSpectrumMask(c, txPowerW);
     NS_ASSERT_MSG(std::abs(txPowerW - Integral(*c)) < 1e-6, "Power allocation failed");
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -505,6 +695,19 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(uint32_t centerFre
 {
     NS_LOG_FUNCTION(centerFrequency << channelWidth << txPowerW << guardBandwidth << ru.first
                                     << ru.second);
+    const WifiTxPsdTemplateId key{WifiTxPsdType::HE_MU_OFDM,
+                                  centerFrequency,
+                                  channelWidth,
+                                  guardBandwidth,
+                                  0,
+                                  0,
+                                  0,
+                                  {},
+                                  ru};
+    if (auto psd = FindTxPsdTemplate(key, txPowerW))
+    {
+        return psd;
+    }
     uint32_t carrierSpacing = 78125;
     Ptr<SpectrumValue> c = Create<SpectrumValue>(
         GetSpectrumModel(centerFrequency, channelWidth, carrierSpacing, guardBandwidth));
@@ -526,6 +729,7 @@ WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(uint32_t centerFre
         }
     }
 
+    AddTxPsdTemplate(key, *c, txPowerW);
     return c;
 }
 
@@ -781,6 +985,27 @@ WifiSpectrumValueHelper::NormalizeSpectrumMask(Ptr<SpectrumValue> c, double txPo
     }
 }
 
+uint64_t
+WifiSpectrumValueHelper::GetTxPsdTemplateHits()
+{
+    return g_wifiTxPsdTemplateHits;
+}
+
+uint64_t
+WifiSpectrumValueHelper::GetTxPsdTemplateMisses()
+{
+    return g_wifiTxPsdTemplateMisses;
+}
+
+void
+WifiSpectrumValueHelper::ClearTxPsdTemplates()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    g_wifiTxPsdTemplateMap.clear();
+    g_wifiTxPsdTemplateHits = 0;
+    g_wifiTxPsdTemplateMisses = 0;
+}
+
 double
 WifiSpectrumValueHelper::DbmToW(double dBm)
 {
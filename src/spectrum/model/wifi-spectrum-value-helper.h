@@ -303,6 +303,26 @@ class WifiSpectrumValueHelper
      */
     static void NormalizeSpectrumMask(Ptr<SpectrumValue> c, double txPowerW);
 
+    /**
+     * The transmit PSDs created by the methods above are cached as templates for a transmit
+     * power of 1 W, keyed by all the parameters but the transmit power, and subsequent PSDs
+     * with the same parameters are obtained by scaling the template by the transmit power.
+     * The templates and the counters are per thread.
+     *
+     * \return the number of transmit PSDs obtained by scaling a cached template
+     */
+    static uint64_t GetTxPsdTemplateHits();
+
+    /**
+     * \return the number of transmit PSDs built from scratch because no template was cached
+     */
+    static uint64_t GetTxPsdTemplateMisses();
+
+    /**
+     * Drop all the cached transmit PSD templates and reset the hit and miss counters.
+     */
+    static void ClearTxPsdTemplates();
+
     /**
      * Convert from dBm to Watts.
      * Taken from wifi-utils since the original method couldn't be called from here
@@ -268,6 +268,25 @@ SpectrumValueTestSuite::SpectrumValueTestSuite()
     v1rs3[4] = v1[1];
     tv1rs3 = v1 >> 3;
     AddTestCase(new SpectrumValueTestCase(tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
+
+    SpectrumValue tv11(f);
+    SpectrumValue tv12(f);
+    SpectrumValue tv13;
+    tv11 = v1;
+    tv11.AddScaled(v2, doubleValue);
+    tv12 = v3;
+    tv12.MultiplyAccumulate(v1, v2);
+    tv13.AssignScaled(v1, doubleValue);
+    AddTestCase(new SpectrumValueTestCase(tv11,
+                                          v1 + v2 * doubleValue,
+                                          "tv11 = v1, tv11 AddScaled (v2, doubleValue)"),
+                TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv12,
+                                          v3 + v5,
+                                          "tv12 = v3, tv12 MultiplyAccumulate (v1, v2)"),
+                TestCase::QUICK);
+    AddTestCase(new SpectrumValueTestCase(tv13, v9, "tv13 AssignScaled (v1, doubleValue)"),
+                TestCase::QUICK);
 }
 
 /**
@@ -22,6 +22,7 @@
 #include "ns3/command-line.h"
 #include "ns3/config.h"
 #include "ns3/double.h"
+#include "ns3/he-frame-exchange-manager.h"
 #include "ns3/he-phy.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
@@ -259,6 +260,36 @@ using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("he-wifi-network");
 
+/**
+ * Print the duration of the channel sounding processes run by the given AP, i.e., the time
+ * elapsed from the start of the NDPA transmission to the reception of the last report.
+ *
+ * \param heFem the HE Frame Exchange Manager of the AP
+ * \param instanceId the ID of the sensing measurement instance
+ * \param phase the sensing phase
+ * \param event the event that occurred in the given phase
+ * \param time the time the event occurred
+ */
+void
+PrintChannelSoundingDuration(Ptr<HeFrameExchangeManager> heFem,
+                             uint32_t instanceId,
+                             SensingPhase phase,
+                             SensingPhaseEvent event,
+                             Time time)
+{
+    static Time soundingStart;
+    if (phase == SensingPhase::NDPA_SOUNDING && event == SensingPhaseEvent::START)
+    {
+        soundingStart = time;
+    }
+    else if (phase == SensingPhase::REPORT && event == SensingPhaseEvent::COMPLETE)
+    {
+        std::cout << "Duration of channel sounding process: " << (time - soundingStart).As(Time::MS)
+                  << ", Number of stations: " << heFem->GetCsBeamformer()->GetNumCsStations()
+                  << std::endl;
+    }
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -342,9 +373,6 @@ main(int argc, char* argv[])
     Config::SetDefault("ns3::WifiDefaultAckManager::DlMuAckSequenceType",
                        EnumValue(WifiAcknowledgment::DL_MU_TF_MU_BAR));
 
-    Config::SetDefault("ns3::HeFrameExchangeManager::PrintChannelSoundingDuration",
-                       BooleanValue(printChannelSoundingDuration));
-
     Config::SetDefault("ns3::HeFrameExchangeManager::ChannelSoundingWifiMode", StringValue(csMode));
 
     std::cout << "MCS value"
@@ -465,6 +493,15 @@ main(int argc, char* argv[])
                 Ptr<NetDevice> dev = wifiApNode.Get(0)->GetDevice(0);
                 Ptr<WifiNetDevice> wifi_dev = DynamicCast<WifiNetDevice>(dev);
                 Ptr<WifiMac> wifi_mac = wifi_dev->GetMac();
+                if (printChannelSoundingDuration)
+                {
+                    auto heFem =
+                        DynamicCast<HeFrameExchangeManager>(wifi_mac->GetFrameExchangeManager());
+                    NS_ABORT_MSG_IF(!heFem, "Channel sounding requires an HE AP");
+                    heFem->TraceConnectWithoutContext(
+                        "SensingPhase",
+                        MakeBoundCallback(&PrintChannelSoundingDuration, heFem));
+                }
                 PointerValue ptr;
                 Ptr<QosTxop> edca;
                 wifi_mac->GetAttribute("BE_Txop", ptr);
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sensing-stats-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/he-frame-exchange-manager.h"
+#include "ns3/log.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-psdu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SensingStatsHelper");
+
+/***********************************************************
+ *          Streaming quantile
+ ***********************************************************/
+
+StreamingQuantile::StreamingQuantile(double p)
+    : m_p(p),
+      m_count(0)
+{
+    NS_ABORT_MSG_IF(p < 0 || p > 1, "Invalid quantile " << p);
+    Reset();
+}
+
+void
+StreamingQuantile::Reset()
+{
+    m_count = 0;
+    m_height.fill(0);
+    m_pos = {1, 2, 3, 4, 5};
+    m_desired = {1, 1 + 2 * m_p, 1 + 4 * m_p, 3 + 2 * m_p, 5};
+    m_incr = {0, m_p / 2, m_p, (1 + m_p) / 2, 1};
+}
+
+uint64_t
+StreamingQuantile::GetCount() const
+{
+    return m_count;
+}
+
+void
+StreamingQuantile::Add(double x)
+{
+    if (m_count < 5)
+    {
+        // the first five samples are the initial marker heights
+        m_height[m_count++] = x;
+        if (m_count == 5)
+        {
+            std::sort(m_height.begin(), m_height.end());
+        }
+        return;
+    }
+    m_count++;
+
+    // find the cell containing the new sample, extending the extreme markers if needed
+    std::size_t k;
+    if (x < m_height[0])
+    {
+        m_height[0] = x;
+        k = 0;
+    }
+    else if (x >= m_height[4])
+    {
+        m_height[4] = x;
+        k = 3;
+    }
+    else
+    {
+        k = std::upper_bound(m_height.begin() + 1, m_height.end(), x) - m_height.begin() - 1;
+    }
+
+    for (std::size_t i = k + 1; i < 5; i++)
+    {
+        m_pos[i]++;
+    }
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        m_desired[i] += m_incr[i];
+    }
+
+    // adjust the heights of the middle markers if they are off their desired positions
+    for (std::size_t i = 1; i < 4; i++)
+    {
+        const double d = m_desired[i] - m_pos[i];
+        if ((d >= 1 && m_pos[i + 1] - m_pos[i] > 1) || (d <= -1 && m_pos[i - 1] - m_pos[i] < -1))
+        {
+            const int64_t s = (d > 0 ? 1 : -1);
+            const auto np = static_cast<double>(m_pos[i + 1] - m_pos[i - 1]);
+            const auto nLow = static_cast<double>(m_pos[i] - m_pos[i - 1]);
+            const auto nHigh = static_cast<double>(m_pos[i + 1] - m_pos[i]);
+            // piecewise-parabolic prediction
+            double h = m_height[i] +
+                       s / np *
+                           ((nLow + s) * (m_height[i + 1] - m_height[i]) / nHigh +
+                            (nHigh - s) * (m_height[i] - m_height[i - 1]) / nLow);
+            if (h <= m_height[i - 1] || h >= m_height[i + 1])
+            {
+                // linear prediction
+                const std::size_t j = (s > 0 ? i + 1 : i - 1);
+                h = m_height[i] + s * (m_height[j] - m_height[i]) / (m_pos[j] - m_pos[i]);
+            }
+            m_height[i] = h;
+            m_pos[i] += s;
+        }
+    }
+}
+
+double
+StreamingQuantile::Get() const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    if (m_count < 5)
+    {
+        std::array<double, 5> sorted = m_height;
+        std::sort(sorted.begin(), sorted.begin() + m_count);
+        auto rank = static_cast<std::size_t>(std::ceil(m_p * m_count));
+        return sorted[std::max<std::size_t>(rank, 1) - 1];
+    }
+    return m_height[2];
+}
+
+/***********************************************************
+ *          Sensing statistics helper
+ ***********************************************************/
+
+SensingStatsHelper::ApStats::ApStats(Mac48Address apAddress, uint32_t apNodeId)
+    : address(apAddress),
+      nodeId(apNodeId),
+      nCompleted(0),
+      nCollisions(0),
+      nCsiReports(0),
+      totalLatency(Seconds(0)),
+      totalAttemptLatency(Seconds(0)),
+      maxLatency(Seconds(0)),
+      p50(0.5),
+      p99(0.99),
+      instanceStart(Seconds(0)),
+      attemptStart(Seconds(0)),
+      ongoing(false)
+{
+}
+
+Time
+SensingStatsHelper::ApStats::GetAverageLatency() const
+{
+    return nCompleted > 0 ? totalLatency / static_cast<int64_t>(nCompleted) : Seconds(0);
+}
+
+Time
+SensingStatsHelper::ApStats::GetAverageAttemptLatency() const
+{
+    return nCompleted > 0 ? totalAttemptLatency / static_cast<int64_t>(nCompleted) : Seconds(0);
+}
+
+SensingStatsHelper::SensingStatsHelper()
+    : m_p50(0.5),
+      m_p99(0.99)
+{
+    m_frameCounts.fill(0);
+}
+
+void
+SensingStatsHelper::Install(Ptr<NetDevice> apDevice)
+{
+    NS_LOG_FUNCTION(this << apDevice);
+    auto device = DynamicCast<WifiNetDevice>(apDevice);
+    NS_ABORT_MSG_IF(!device, "SensingStatsHelper can only be installed on Wi-Fi devices");
+
+    const std::size_t index = m_aps.size();
+    m_aps.emplace_back(device->GetMac()->GetAddress(), device->GetNode()->GetId());
+
+    device->GetPhy()->TraceConnectWithoutContext(
+        "MonitorChannelAccess",
+        MakeCallback(&SensingStatsHelper::NotifyChannelAccess, this, index));
+
+    for (uint8_t linkId = 0; linkId < device->GetNPhys(); linkId++)
+    {
+        auto heFem =
+            DynamicCast<HeFrameExchangeManager>(device->GetMac()->GetFrameExchangeManager(linkId));
+        if (heFem)
+        {
+            heFem->TraceConnectWithoutContext(
+                "BfReportReceived",
+                MakeCallback(&SensingStatsHelper::NotifyBfReport, this, index));
+        }
+    }
+}
+
+void
+SensingStatsHelper::Install(const NetDeviceContainer& apDevices)
+{
+    for (auto it = apDevices.Begin(); it != apDevices.End(); ++it)
+    {
+        Install(*it);
+    }
+}
+
+void
+SensingStatsHelper::EnableFrameCounters(Ptr<NetDevice> device)
+{
+    NS_LOG_FUNCTION(this << device);
+    auto wifiDevice = DynamicCast<WifiNetDevice>(device);
+    NS_ABORT_MSG_IF(!wifiDevice, "Frame counters can only be enabled on Wi-Fi devices");
+
+    for (uint8_t linkId = 0; linkId < wifiDevice->GetNPhys(); linkId++)
+    {
+        wifiDevice->GetPhy(linkId)->TraceConnectWithoutContext(
+            "PhyTxPsduBegin",
+            MakeCallback(&SensingStatsHelper::NotifyTxPsdu,
+                         this,
+                         wifiDevice->GetMac()->GetAddress()));
+    }
+}
+
+void
+SensingStatsHelper::EnableFrameCounters(const NetDeviceContainer& devices)
+{
+    for (auto it = devices.Begin(); it != devices.End(); ++it)
+    {
+        EnableFrameCounters(*it);
+    }
+}
+
+void
+SensingStatsHelper::Reset()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& ap : m_aps)
+    {
+        ap = ApStats(ap.address, ap.nodeId);
+    }
+    m_p50.Reset();
+    m_p99.Reset();
+    m_frameCounts.fill(0);
+}
+
+void
+SensingStatsHelper::NotifyChannelAccess(std::size_t index,
+                                        Mac48Address address,
+                                        Time now,
+                                        bool granted)
+{
+    NS_LOG_FUNCTION(this << index << address << now << granted);
+    ApStats& ap = m_aps[index];
+    if (!granted)
+    {
+        if (ap.ongoing)
+        {
+            ap.nCollisions++;
+        }
+        else
+        {
+            ap.instanceStart = now;
+        }
+        ap.attemptStart = now;
+        ap.ongoing = true;
+        return;
+    }
+    if (!ap.ongoing)
+    {
+        return;
+    }
+
+    const Time latency = now - ap.instanceStart;
+    ap.ongoing = false;
+    ap.nCompleted++;
+    ap.totalLatency += latency;
+    ap.totalAttemptLatency += now - ap.attemptStart;
+    ap.maxLatency = std::max(ap.maxLatency, latency);
+    ap.p50.Add(latency.GetSeconds());
+    ap.p99.Add(latency.GetSeconds());
+    m_p50.Add(latency.GetSeconds());
+    m_p99.Add(latency.GetSeconds());
+}
+
+void
+SensingStatsHelper::NotifyBfReport(std::size_t index, Ptr<const WifiMpdu> mpdu, uint16_t staId)
+{
+    NS_LOG_FUNCTION(this << index << *mpdu << staId);
+    m_aps[index].nCsiReports++;
+}
+
+void
+SensingStatsHelper::NotifyTxPsdu(Mac48Address address,
+                                 WifiConstPsduMap psduMap,
+                                 WifiTxVector txVector,
+                                 double txPowerW)
+{
+    for (const auto& [staId, psdu] : psduMap)
+    {
+        for (const auto& mpdu : *PeekPointer(psdu))
+        {
+            const WifiMacHeader& hdr = mpdu->GetHeader();
+            if (hdr.IsBeacon())
+            {
+                m_frameCounts[BEACON]++;
+            }
+            else if (hdr.IsCfPoll())
+            {
+                m_frameCounts[CF_POLL]++;
+            }
+            else if (hdr.IsCfEnd())
+            {
+                m_frameCounts[hdr.IsCfAck() ? CF_END_ACK : CF_END]++;
+            }
+            else if (hdr.IsNdpa())
+            {
+                m_frameCounts[NDPA]++;
+            }
+            else if (hdr.IsActionNoAck())
+            {
+                m_frameCounts[BF_REPORT]++;
+            }
+            else if (hdr.IsData())
+            {
+                m_frameCounts[hdr.HasData() ? DATA : DATA_NULL]++;
+            }
+            else if (hdr.IsCts())
+            {
+                m_frameCounts[hdr.GetAddr1() == address ? CTS_TO_SELF : CTS]++;
+            }
+        }
+    }
+}
+
+std::size_t
+SensingStatsHelper::GetNAps() const
+{
+    return m_aps.size();
+}
+
+const SensingStatsHelper::ApStats&
+SensingStatsHelper::GetApStats(std::size_t index) const
+{
+    NS_ASSERT(index < m_aps.size());
+    return m_aps[index];
+}
+
+uint64_t
+SensingStatsHelper::GetNCompleted() const
+{
+    uint64_t count = 0;
+    for (const auto& ap : m_aps)
+    {
+        count += ap.nCompleted;
+    }
+    return count;
+}
+
+uint64_t
+SensingStatsHelper::GetNCollisions() const
+{
+    uint64_t count = 0;
+    for (const auto& ap : m_aps)
+    {
+        count += ap.nCollisions;
+    }
+    return count;
+}
+
+uint64_t
+SensingStatsHelper::GetNCsiReports() const
+{
+    uint64_t count = 0;
+    for (const auto& ap : m_aps)
+    {
+        count += ap.nCsiReports;
+    }
+    return count;
+}
+
+Time
+SensingStatsHelper::GetAverageLatency() const
+{
+    Time total = Seconds(0);
+    for (const auto& ap : m_aps)
+    {
+        total += ap.totalLatency;
+    }
+    const uint64_t count = GetNCompleted();
+    return count > 0 ? total / static_cast<int64_t>(count) : Seconds(0);
+}
+
+Time
+SensingStatsHelper::GetAverageAttemptLatency() const
+{
+    Time total = Seconds(0);
+    for (const auto& ap : m_aps)
+    {
+        total += ap.totalAttemptLatency;
+    }
+    const uint64_t count = GetNCompleted();
+    return count > 0 ? total / static_cast<int64_t>(count) : Seconds(0);
+}
+
+Time
+SensingStatsHelper::GetMedianLatency() const
+{
+    return Seconds(m_p50.Get());
+}
+
+Time
+SensingStatsHelper::GetP99Latency() const
+{
+    return Seconds(m_p99.Get());
+}
+
+uint64_t
+SensingStatsHelper::GetFrameCount(FrameType type) const
+{
+    NS_ASSERT(type < N_FRAME_TYPES);
+    return m_frameCounts[type];
+}
+
+void
+SensingStatsHelper::Print(std::ostream& os) const
+{
+    for (const auto& ap : m_aps)
+    {
+        os << "AP " << ap.address << " (node " << ap.nodeId << "): completed=" << ap.nCompleted
+           << " collisions=" << ap.nCollisions << " reports=" << ap.nCsiReports
+           << " avg=" << ap.GetAverageLatency().As(Time::MS)
+           << " p50=" << Seconds(ap.p50.Get()).As(Time::MS)
+           << " p99=" << Seconds(ap.p99.Get()).As(Time::MS)
+           << " max=" << ap.maxLatency.As(Time::MS) << std::endl;
+    }
+    os << "Total: completed=" << GetNCompleted() << " collisions=" << GetNCollisions()
+       << " reports=" << GetNCsiReports() << " avg=" << GetAverageLatency().As(Time::MS)
+       << " p50=" << GetMedianLatency().As(Time::MS) << " p99=" << GetP99Latency().As(Time::MS)
+       << std::endl;
+}
+
+} // namespace ns3
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SENSING_STATS_HELPER_H
+#define SENSING_STATS_HELPER_H
+
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+#include "ns3/wifi-ppdu.h"
+#include "ns3/wifi-tx-vector.h"
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace ns3
+{
+
+class NetDevice;
+class NetDeviceContainer;
+class WifiMpdu;
+
+/**
+ * \ingroup wifi
+ *
+ * Estimate a quantile of a stream of samples in constant memory by means of the P^2
+ * algorithm (R. Jain and I. Chlamtac, "The P^2 algorithm for dynamic calculation of
+ * quantiles and histograms without storing observations", Communications of the ACM, 1985).
+ * The exact quantile is returned as long as fewer than five samples have been added.
+ */
+class StreamingQuantile
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param p the quantile to estimate (in [0, 1])
+     */
+    StreamingQuantile(double p);
+
+    /**
+     * Add a sample.
+     *
+     * \param x the sample
+     */
+    void Add(double x);
+
+    /**
+     * \return the estimate of the quantile, or zero if no sample has been added
+     */
+    double Get() const;
+
+    /**
+     * \return the number of samples added so far
+     */
+    uint64_t GetCount() const;
+
+    /**
+     * Drop all the samples.
+     */
+    void Reset();
+
+  private:
+    double m_p;                      //!< the quantile to estimate
+    uint64_t m_count;                //!< number of samples added so far
+    std::array<double, 5> m_height;  //!< marker heights
+    std::array<int64_t, 5> m_pos;    //!< actual marker positions
+    std::array<double, 5> m_desired; //!< desired marker positions
+    std::array<double, 5> m_incr;    //!< increments of the desired marker positions
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Collect the key performance indicators of the sensing measurement instances run by a set
+ * of APs. A sensing measurement instance starts when the AP requests channel access to
+ * sense and completes when the AP has received the channel information from all the
+ * stations. A request made while the previous instance is still ongoing counts as a
+ * collision, i.e., the AP attempts again to run the instance. The latency of an instance is
+ * measured from its first channel access request, while the attempt latency is measured from
+ * the last one, i.e., it only accounts for the successful attempt.
+ *
+ * Counters are kept in dense arrays indexed by the order in which the AP devices are
+ * installed and trace sinks are bound to that index, hence no lookup is performed when
+ * an event is notified. Latency percentiles are estimated in constant memory.
+ *
+ * The helper must outlive the simulation, since its trace sinks are bound to it.
+ */
+class SensingStatsHelper
+{
+  public:
+    /// Types of transmitted frames that are counted
+    enum FrameType : uint8_t
+    {
+        BEACON = 0,
+        CF_POLL,
+        CF_END,
+        CF_END_ACK,
+        NDPA,
+        BF_REPORT,
+        DATA_NULL,
+        DATA,
+        CTS,
+        CTS_TO_SELF,
+        N_FRAME_TYPES
+    };
+
+    /// Statistics of the sensing measurement instances run by an AP
+    struct ApStats
+    {
+        /**
+         * Constructor
+         *
+         * \param apAddress the MAC address of the AP
+         * \param apNodeId the ID of the node hosting the AP
+         */
+        ApStats(Mac48Address apAddress, uint32_t apNodeId);
+
+        Mac48Address address;  //!< MAC address of the AP
+        uint32_t nodeId;       //!< ID of the node hosting the AP
+        uint64_t nCompleted;   //!< number of completed instances
+        uint64_t nCollisions;  //!< number of instances restarted before completion
+        uint64_t nCsiReports;  //!< number of beamforming reports received
+        Time totalLatency;        //!< sum of the latencies of the completed instances
+        Time totalAttemptLatency; //!< sum of the attempt latencies of the completed instances
+        Time maxLatency;          //!< largest latency of a completed instance
+        StreamingQuantile p50;    //!< median latency estimator (seconds)
+        StreamingQuantile p99;    //!< 99th percentile latency estimator (seconds)
+        Time instanceStart;       //!< time of the first channel access request of the instance
+        Time attemptStart;        //!< time of the last channel access request of the instance
+        bool ongoing;             //!< whether an instance is ongoing
+
+        /**
+         * \return the average latency of the completed instances
+         */
+        Time GetAverageLatency() const;
+        /**
+         * \return the average attempt latency of the completed instances
+         */
+        Time GetAverageAttemptLatency() const;
+    };
+
+    SensingStatsHelper();
+
+    /// The trace sinks are bound to this object, which must therefore not be copied
+    SensingStatsHelper(const SensingStatsHelper&) = delete;
+    /**
+     * \return this object
+     */
+    SensingStatsHelper& operator=(const SensingStatsHelper&) = delete;
+
+    /**
+     * Collect the statistics of the sensing measurement instances run by the given AP.
+     *
+     * \param apDevice the WifiNetDevice of the AP
+     */
+    void Install(Ptr<NetDevice> apDevice);
+    /**
+     * Collect the statistics of the sensing measurement instances run by the given APs.
+     *
+     * \param apDevices the WifiNetDevices of the APs
+     */
+    void Install(const NetDeviceContainer& apDevices);
+
+    /**
+     * Count the frames transmitted by the given device, classified by FrameType.
+     *
+     * \param device the WifiNetDevice
+     */
+    void EnableFrameCounters(Ptr<NetDevice> device);
+    /**
+     * Count the frames transmitted by the given devices, classified by FrameType.
+     *
+     * \param devices the WifiNetDevices
+     */
+    void EnableFrameCounters(const NetDeviceContainer& devices);
+
+    /**
+     * Reset all the statistics collected so far. Ongoing instances are dropped.
+     */
+    void Reset();
+
+    /**
+     * \return the number of APs whose statistics are collected
+     */
+    std::size_t GetNAps() const;
+    /**
+     * \param index the index of the AP, in the order of installation
+     * \return the statistics of the given AP
+     */
+    const ApStats& GetApStats(std::size_t index) const;
+
+    /**
+     * \return the number of completed instances over all the APs
+     */
+    uint64_t GetNCompleted() const;
+    /**
+     * \return the number of collisions over all the APs
+     */
+    uint64_t GetNCollisions() const;
+    /**
+     * \return the number of beamforming reports received by all the APs
+     */
+    uint64_t GetNCsiReports() const;
+    /**
+     * \return the average latency of the instances completed by all the APs
+     */
+    Time GetAverageLatency() const;
+    /**
+     * \return the average attempt latency of the instances completed by all the APs
+     */
+    Time GetAverageAttemptLatency() const;
+    /**
+     * \return the median latency of the instances completed by all the APs
+     */
+    Time GetMedianLatency() const;
+    /**
+     * \return the 99th percentile of the latency of the instances completed by all the APs
+     */
+    Time GetP99Latency() const;
+    /**
+     * \param type the frame type
+     * \return the number of frames of the given type transmitted by the devices for which
+     *         frame counters are enabled
+     */
+    uint64_t GetFrameCount(FrameType type) const;
+
+    /**
+     * Print a summary of the statistics, one line per AP followed by the totals.
+     *
+     * \param os the output stream
+     */
+    void Print(std::ostream& os) const;
+
+  private:
+    /**
+     * Trace sink for the MonitorChannelAccess trace source of the AP PHY.
+     *
+     * \param index the index of the AP
+     * \param address the MAC address of the AP
+     * \param now the current time
+     * \param granted false if channel access is requested, true if the instance completed
+     */
+    void NotifyChannelAccess(std::size_t index, Mac48Address address, Time now, bool granted);
+
+    /**
+     * Trace sink for the BfReportReceived trace source of the AP Frame Exchange Manager.
+     *
+     * \param index the index of the AP
+     * \param mpdu the MPDU carrying the beamforming report
+     * \param staId the AID of the station that sent the report
+     */
+    void NotifyBfReport(std::size_t index, Ptr<const WifiMpdu> mpdu, uint16_t staId);
+
+    /**
+     * Trace sink for the PhyTxPsduBegin trace source.
+     *
+     * \param address the MAC address of the transmitting device
+     * \param psduMap the PSDU map being transmitted
+     * \param txVector the TXVECTOR
+     * \param txPowerW the transmit power in Watts
+     */
+    void NotifyTxPsdu(Mac48Address address,
+                      WifiConstPsduMap psduMap,
+                      WifiTxVector txVector,
+                      double txPowerW);
+
+    std::vector<ApStats> m_aps;                        //!< per-AP statistics
+    StreamingQuantile m_p50;                           //!< median over all the APs
+    StreamingQuantile m_p99;                           //!< 99th percentile over all the APs
+    std::array<uint64_t, N_FRAME_TYPES> m_frameCounts; //!< transmitted frames per type
+};
+
+} // namespace ns3
+
+#endif /* SENSING_STATS_HELPER_H */
@@ -23,12 +23,15 @@
 
 #include "ns3/ampdu-subframe-header.h"
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/channel-sounding.h"
 #include "ns3/config.h"
 #include "ns3/eht-configuration.h"
 #include "ns3/he-configuration.h"
+#include "ns3/he-frame-exchange-manager.h"
 #include "ns3/ht-configuration.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
+#include "ns3/multi-user-scheduler.h"
 #include "ns3/names.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/obss-pd-algorithm.h"
@@ -1033,11 +1036,37 @@ WifiHelper::AssignStreams(NetDeviceContainer c, int64_t stream)
             if (auto apMac = DynamicCast<ApWifiMac>(mac); apMac)
             {
                 currentStream += apMac->AssignStreams(currentStream);
+
+                // Handle the sounding schedule of the multi-user scheduler
+                if (auto muScheduler = apMac->GetObject<MultiUserScheduler>())
+                {
+                    currentStream += muScheduler->AssignStreams(currentStream);
+                }
+
+                // Handle the CSI generation of IEEE 802.11bf sensing beamformers
+                for (uint8_t linkId = 0; linkId < mac->GetNLinks(); linkId++)
+                {
+                    if (auto heFem = DynamicCast<HeFrameExchangeManager>(
+                            mac->GetFrameExchangeManager(linkId)))
+                    {
+                        currentStream += heFem->GetCsBeamformer()->AssignStreams(currentStream);
+                    }
+                }
             }
             // if a STA, handle any probe request jitter
             if (auto staMac = DynamicCast<StaWifiMac>(mac); staMac)
             {
                 currentStream += staMac->AssignStreams(currentStream);
+
+                // Handle the CSI generation of IEEE 802.11bf sensing beamformees
+                for (uint8_t linkId = 0; linkId < mac->GetNLinks(); linkId++)
+                {
+                    if (auto heFem = DynamicCast<HeFrameExchangeManager>(
+                            mac->GetFrameExchangeManager(linkId)))
+                    {
+                        currentStream += heFem->GetCsBeamformee()->AssignStreams(currentStream);
+                    }
+                }
             }
         }
     }
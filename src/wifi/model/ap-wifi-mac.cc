@@ -106,6 +106,11 @@ ApWifiMac::GetTypeId()
                             "A station lost association with this access point.",
                             MakeTraceSourceAccessor(&ApWifiMac::m_deAssocLogger),
                             "ns3::ApWifiMac::AssociationCallback")
+            .AddTraceSource("SensingPhase",
+                            "A phase of a sensing measurement instance started, completed, "
+                            "timed out or collided.",
+                            MakeTraceSourceAccessor(&ApWifiMac::m_sensingPhaseTrace),
+                            "ns3::ApWifiMac::SensingPhaseCallback")
             .AddAttribute(
                 "WiFiSensingSupported",
                 "This Boolean attribute is set to enable PCF support at this AP.",
@@ -135,7 +140,13 @@ ApWifiMac::GetTypeId()
                 "This integer attribute is set to determine the type of sensing interval",
                 UintegerValue(0),
                 MakeUintegerAccessor(&ApWifiMac::SetSensingIntervalType, &ApWifiMac::GetSensingIntervalType),
-                MakeUintegerChecker<uint16_t>());
+                MakeUintegerChecker<uint16_t>())
+            .AddAttribute("SensingMergeWindow",
+                          "Compatible sensing measurement setups whose instances are due within "
+                          "this window are served by a single measurement instance.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&ApWifiMac::m_sensingMergeWindow),
+                          MakeTimeChecker(Seconds(0)));
     return tid;
 }
 
@@ -432,7 +443,14 @@ ApWifiMac::ForwardDown(Ptr<Packet> packet, Mac48Address from, Mac48Address to, u
                 if (!m_SensingAppBegin)
                 {
                     m_SensingAppBegin = true;
-                    SendOneBeacon(0U);
+                    if (m_sensingSessions.IsEmpty())
+                    {
+                        SendOneBeacon(0U);
+                    }
+                    else
+                    {
+                        ScheduleNextSensingInstance();
+                    }
                 }
             }
             else
@@ -1508,11 +1526,27 @@ ApWifiMac::SendOneBeacon(uint8_t linkId)
         }
         StopCfPeriod();
 
-        if (m_SensingAppBegin)
+        if (m_SensingAppBegin && !m_sensingSessions.IsEmpty())
+        {
+            m_sensingInstance = m_sensingSessions.PopDue(Simulator::Now(), m_sensingMergeWindow);
+        }
+
+        if (m_SensingAppBegin && !m_sensingSessions.IsEmpty() && m_sensingInstance.IsEmpty())
+        {
+            // no setup is due (the setups due have been removed), wait for the next one. The
+            // slot time is updated nonetheless
+            ScheduleNextSensingInstance();
+        }
+        else if (m_SensingAppBegin)
         {
+            if (!m_sensingSessions.IsEmpty())
+            {
+                SetSensingPriority(m_sensingInstance.priority);
+            }
             // std::cout << "Sensing start from : " << GetAddress() << " " << Simulator::Now()
             //           << std::endl;
             GetWifiPhy()->NotifyMonitorChannelAccess(GetAddress(), Simulator::Now(), false);
+            ++m_sensingInstanceId;
             StartCfPeriod();
             GetQosTxop(AcIndex(m_SensingPriority))
                 ->SetTxOkCallback(MakeCallback(&ApWifiMac::TxOk, this));
@@ -1533,7 +1567,14 @@ ApWifiMac::SendOneBeacon(uint8_t linkId)
                     GetTxop()->Queue(packet, hdr);
                 }
             }
-            Simulator::Schedule(GetSensingInterval(), &ApWifiMac::SendOneBeacon, this, 0U);
+            if (m_sensingSessions.IsEmpty())
+            {
+                Simulator::Schedule(GetSensingInterval(), &ApWifiMac::SendOneBeacon, this, 0U);
+            }
+            else
+            {
+                ScheduleNextSensingInstance();
+            }
             // Simulator::Schedule(GetCfpMaxDuration()/2 - GetWifiPhy(0U)->GetPifs(),
             //                     &ApWifiMac::EndSensing,
             //                     this,
@@ -1702,6 +1743,7 @@ ApWifiMac::TxFailed(WifiMacDropReason timeoutReason, Ptr<const WifiMpdu> mpdu)
     }
     else if (hdr.IsCfPoll())
     {
+        NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::COLLISION);
         SensingRetransmission(0U);
         // IncrementPollingListIterator();
         // SendNextCfFrame(0U);
@@ -2133,11 +2175,29 @@ ApWifiMac::Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
                         break;
                     }
                 }
+                RemoveSbpRequester(from);
                 return;
             }
             case WIFI_MAC_MGT_ACTION: {
                 auto pkt = mpdu->GetPacket()->Copy();
                 auto [category, action] = WifiActionHeader::Remove(pkt);
+                if (category == WifiActionHeader::SENSING && IsAssociated(hdr->GetAddr2()))
+                {
+                    if (action.sensingAction == WifiActionHeader::SENSING_SBP_REQUEST)
+                    {
+                        MgtSbpRequestHeader frame;
+                        pkt->RemoveHeader(frame);
+                        ReceiveSbpRequest(frame, hdr->GetAddr2(), linkId);
+                        return;
+                    }
+                    if (action.sensingAction == WifiActionHeader::SENSING_SBP_TERMINATION)
+                    {
+                        MgtSbpTerminationHeader frame;
+                        pkt->RemoveHeader(frame);
+                        ReceiveSbpTermination(frame, hdr->GetAddr2());
+                        return;
+                    }
+                }
                 if (category == WifiActionHeader::PROTECTED_EHT &&
                     action.protectedEhtAction ==
                         WifiActionHeader::PROTECTED_EHT_EML_OPERATING_MODE_NOTIFICATION &&
@@ -2831,6 +2891,7 @@ ApWifiMac::StartSensing(uint8_t linkId)
     NS_LOG_FUNCTION(this);
     NS_ASSERT(GetPcfSupported() && GetQosSupported());
 
+    NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::START);
     GetQosTxop(AcIndex(m_SensingPriority))->SetInfMac(this);
     GetQosTxop(AcIndex(m_SensingPriority))
         ->SendCfFrame(WIFI_MAC_QOSDATA_CFPOLL, Mac48Address::GetBroadcast(), 0U);
@@ -2869,12 +2930,13 @@ ApWifiMac::SensingRetransmission(uint8_t linkId)
 
         GetQosTxop(AcIndex(m_SensingPriority))->SetInfMac(this);
         GetQosTxop(AcIndex(m_SensingPriority))->Queue(pollingPacket, pollingHeader);
+        NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::START);
         StartCfPeriod();
     }
     else
     {
-        std::cout << "Maximum CFP is not enough! : " << GetAddress() << " " << Simulator::Now()
-                  << std::endl;
+        NS_LOG_DEBUG("The remaining CFP is not enough to retransmit the polling frame");
+        NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::ABORTED);
         return;
     }
 }
@@ -3006,6 +3068,252 @@ ApWifiMac::GetSensingPriority(void) const
     return m_SensingCw;
 }
 
+uint32_t
+ApWifiMac::GetSensingInstanceId() const
+{
+    return m_sensingInstanceId;
+}
+
+void
+ApWifiMac::NotifySensingPhase(SensingPhase phase, SensingPhaseEvent event)
+{
+    NS_LOG_FUNCTION(this << m_sensingInstanceId << phase << event);
+    m_sensingPhaseTrace(m_sensingInstanceId, phase, event, Simulator::Now());
+}
+
+uint32_t
+ApWifiMac::AddSensingSetup(const SensingMeasurementSetup& setup, Time start)
+{
+    NS_LOG_FUNCTION(this << setup.interval << setup.priority << start);
+    // if the sensing application has not started yet, the setup is taken into account when
+    // it starts
+    auto setupId = m_sensingSessions.AddSetup(setup, Simulator::Now() + start);
+    if (m_sensingInstanceEvent.IsRunning() &&
+        start < Simulator::GetDelayLeft(m_sensingInstanceEvent))
+    {
+        // the new setup is due before the pending instance
+        m_sensingInstanceEvent.Cancel();
+        ScheduleNextSensingInstance();
+    }
+    return setupId;
+}
+
+void
+ApWifiMac::RemoveSensingSetup(uint32_t setupId)
+{
+    NS_LOG_FUNCTION(this << setupId);
+    m_sensingSessions.RemoveSetup(setupId);
+    if (m_sensingSessions.IsEmpty() && m_sensingInstanceEvent.IsRunning())
+    {
+        // do not fall back to the SensingInterval attribute; sensing resumes when the
+        // sensing application sends a new packet or a new setup is registered
+        NS_LOG_DEBUG("No sensing measurement setup left, stop sensing");
+        m_sensingInstanceEvent.Cancel();
+        m_SensingAppBegin = false;
+    }
+}
+
+const SensingSessionManager::Instance&
+ApWifiMac::GetSensingInstance() const
+{
+    return m_sensingInstance;
+}
+
+bool
+ApWifiMac::IsSensingParticipant(Mac48Address address) const
+{
+    return m_sensingInstance.IsParticipant(address);
+}
+
+void
+ApWifiMac::ScheduleNextSensingInstance()
+{
+    NS_LOG_FUNCTION(this);
+    Time nextDue = m_sensingSessions.GetNextDue();
+    if (nextDue == Time::Max())
+    {
+        NS_LOG_DEBUG("No sensing measurement setup registered");
+        return;
+    }
+    m_sensingInstanceEvent = Simulator::Schedule(Max(nextDue - Simulator::Now(), Seconds(0)),
+                                                 &ApWifiMac::SendOneBeacon,
+                                                 this,
+                                                 0U);
+}
+
+void
+ApWifiMac::ForwardSbpReport(Ptr<const WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << *mpdu);
+    const auto reporter = mpdu->GetHeader().GetAddr2();
+
+    for (const auto setupId : m_sensingInstance.setupIds)
+    {
+        auto it = m_sbpRequesters.find(setupId);
+        if (it == m_sbpRequesters.end())
+        {
+            // not a setup run by proxy
+            continue;
+        }
+        const auto& stations = m_sensingSessions.GetSetup(setupId).stations;
+        if (!stations.empty() && stations.count(reporter) == 0)
+        {
+            continue;
+        }
+        for (const auto& [requester, staSetupId] : it->second)
+        {
+            auto linkId = IsAssociated(requester);
+            if (!linkId)
+            {
+                continue;
+            }
+            NS_LOG_DEBUG("Forward report from " << reporter << " to " << requester);
+            // the copy shares the buffer holding the report with the received MPDU, hence
+            // the report is only copied if the buffer has no room for the SBP Report header
+            auto packet = mpdu->GetPacket()->Copy();
+            MgtSbpReportHeader report;
+            report.SetSetupId(staSetupId);
+            report.SetInstanceId(m_sensingInstanceId);
+            report.SetReporter(reporter);
+            packet->AddHeader(report);
+            SendSensingAction(requester, WifiActionHeader::SENSING_SBP_REPORT, packet, *linkId);
+        }
+    }
+}
+
+std::size_t
+ApWifiMac::GetNSbpSetups() const
+{
+    return m_sbpRequesters.size();
+}
+
+void
+ApWifiMac::ReceiveSbpRequest(const MgtSbpRequestHeader& frame,
+                             const Mac48Address& sender,
+                             uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << frame << sender << +linkId);
+
+    const auto& setup = frame.GetMeasurementSetup();
+    MgtSbpResponseHeader response;
+    response.SetSetupId(frame.GetSetupId());
+
+    if (!GetPcfSupported() || !setup.interval.IsStrictlyPositive())
+    {
+        NS_LOG_DEBUG("Decline SBP request from " << sender);
+        response.SetStatusCode(37); // the request has been declined
+    }
+    else
+    {
+        // a new request with an ID already in use replaces the previous one
+        RemoveSbpRequester(sender, frame.GetSetupId());
+
+        auto it = std::find_if(m_sbpRequesters.begin(),
+                               m_sbpRequesters.end(),
+                               [&](const auto& entry) {
+                                   return m_sensingSessions.GetSetup(entry.first) == setup;
+                               });
+        if (it != m_sbpRequesters.end())
+        {
+            NS_LOG_DEBUG("SBP request from " << sender << " served by setup " << it->first);
+            it->second.emplace(sender, frame.GetSetupId());
+        }
+        else
+        {
+            auto setupId = AddSensingSetup(setup);
+            NS_LOG_DEBUG("SBP request from " << sender << " served by new setup " << setupId);
+            m_sbpRequesters[setupId].emplace(sender, frame.GetSetupId());
+        }
+
+        if (!m_SensingAppBegin)
+        {
+            // no sensing application runs on the AP, start sensing on behalf of the stations
+            m_SensingAppBegin = true;
+            ScheduleNextSensingInstance();
+        }
+    }
+
+    auto packet = Create<Packet>();
+    packet->AddHeader(response);
+    SendSensingAction(sender, WifiActionHeader::SENSING_SBP_RESPONSE, packet, linkId);
+}
+
+void
+ApWifiMac::ReceiveSbpTermination(const MgtSbpTerminationHeader& frame, const Mac48Address& sender)
+{
+    NS_LOG_FUNCTION(this << frame << sender);
+    RemoveSbpRequester(sender, frame.GetSetupId());
+}
+
+void
+ApWifiMac::RemoveSbpRequester(const Mac48Address& address, std::optional<uint8_t> setupId)
+{
+    NS_LOG_FUNCTION(this << address << setupId.has_value());
+
+    for (auto it = m_sbpRequesters.begin(); it != m_sbpRequesters.end();)
+    {
+        auto& requesters = it->second;
+        for (auto reqIt = requesters.begin(); reqIt != requesters.end();)
+        {
+            if (reqIt->first == address && (!setupId || reqIt->second == *setupId))
+            {
+                reqIt = requesters.erase(reqIt);
+            }
+            else
+            {
+                ++reqIt;
+            }
+        }
+        if (requesters.empty())
+        {
+            NS_LOG_DEBUG("Setup " << it->first << " is no longer requested");
+            RemoveSensingSetup(it->first);
+            it = m_sbpRequesters.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void
+ApWifiMac::SendSensingAction(Mac48Address to,
+                             WifiActionHeader::SensingActionValue action,
+                             Ptr<Packet> packet,
+                             uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << to << +action << +linkId);
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_ACTION);
+    hdr.SetAddr1(to);
+    hdr.SetAddr2(GetLink(linkId).feManager->GetAddress());
+    hdr.SetAddr3(GetLink(linkId).feManager->GetAddress());
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+
+    WifiActionHeader actionHdr;
+    WifiActionHeader::ActionValue actionValue;
+    actionValue.sensingAction = action;
+    actionHdr.SetAction(WifiActionHeader::SENSING, actionValue);
+    packet->AddHeader(actionHdr);
+
+    if (!GetQosSupported())
+    {
+        GetTxop()->Queue(packet, hdr);
+    }
+    // use AC_VO to send management frames addressed to a QoS STA (Sec. 10.2.3.2 of
+    // 802.11-2020)
+    else if (!GetWifiRemoteStationManager(linkId)->GetQosSupported(to))
+    {
+        GetBEQueue()->Queue(packet, hdr);
+    }
+    else
+    {
+        GetVOQueue()->Queue(packet, hdr);
+    }
+}
+
 /*
 *************************************
 Attempt to add Channel Sounding from ns3.37
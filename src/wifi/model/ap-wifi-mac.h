@@ -23,8 +23,13 @@
 #define AP_WIFI_MAC_H
 
 #include "infrastructure-wifi-mac.h"
+#include "mgt-headers.h"
 #include "wifi-mac-header.h"
 
+#include "ns3/sbp-headers.h"
+#include "ns3/sensing-phase.h"
+#include "ns3/sensing-session-manager.h"
+
 #include <unordered_map>
 #include <variant>
 
@@ -266,6 +271,73 @@ class ApWifiMac : public InfrastructureWifiMac
      * Get the sensing priority.
      */
     std::pair<uint16_t, uint16_t> GetSensingPriority(void) const;
+    /**
+     * Get the ID of the current sensing measurement instance. The ID is incremented every
+     * time the AP requests channel access to start a new instance.
+     *
+     * \return the ID of the current sensing measurement instance
+     */
+    uint32_t GetSensingInstanceId() const;
+    /**
+     * Fire the SensingPhase trace source for the current sensing measurement instance.
+     *
+     * \param phase the sensing phase
+     * \param event the event that occurred in the given phase
+     */
+    void NotifySensingPhase(SensingPhase phase, SensingPhaseEvent event);
+    /**
+     * Register a sensing measurement setup. Once at least one setup is registered, the
+     * measurement instances are launched as the setups become due, and the SensingInterval,
+     * SensingIntervalType and SensingPriority attributes are no longer used. Compatible
+     * setups due within the SensingMergeWindow are served by a single instance.
+     *
+     * \param setup the parameters of the measurement setup
+     * \param start the delay after which the first instance of the setup is due. Instances
+     *              due before the sensing application starts are launched when it starts.
+     * \return the ID assigned to the setup
+     */
+    uint32_t AddSensingSetup(const SensingMeasurementSetup& setup, Time start = Seconds(0));
+    /**
+     * Deregister a sensing measurement setup.
+     *
+     * \param setupId the ID of the setup
+     */
+    void RemoveSensingSetup(uint32_t setupId);
+    /**
+     * \return the sensing measurement instance currently run by the AP
+     */
+    const SensingSessionManager::Instance& GetSensingInstance() const;
+    /**
+     * \param address the MAC address of a station
+     * \return whether the given station takes part in the current sensing measurement instance
+     */
+    bool IsSensingParticipant(Mac48Address address) const;
+    /**
+     * Forward a beamforming report received in the current sensing measurement instance to
+     * the stations that requested, by means of sensing by proxy, a measurement setup served
+     * by the current instance and including the reporting station. The report is forwarded
+     * as received, i.e., the CSI is not deserialized and serialized again.
+     *
+     * \param mpdu the MPDU carrying the beamforming report
+     */
+    void ForwardSbpReport(Ptr<const WifiMpdu> mpdu);
+    /**
+     * \return the number of measurement setups run on behalf of non-AP stations
+     */
+    std::size_t GetNSbpSetups() const;
+
+    /**
+     * TracedCallback signature for the phases of a sensing measurement instance.
+     *
+     * \param instanceId the ID of the sensing measurement instance
+     * \param phase the sensing phase
+     * \param event the event that occurred in the given phase
+     * \param timestamp the time the event occurred
+     */
+    typedef void (*SensingPhaseCallback)(uint32_t instanceId,
+                                         SensingPhase phase,
+                                         SensingPhaseEvent event,
+                                         Time timestamp);
     std::pair<uint16_t, uint16_t> m_SensingCw; //!< Sensing Cw based on priority
     u_int16_t m_SensingPriority;               //!< Sensing priority
     u_int64_t m_sensingIntervalType = 0;           //!< Sensing interval type
@@ -347,6 +419,49 @@ class ApWifiMac : public InfrastructureWifiMac
      */
     void ReceiveEmlOmn(MgtEmlOmn& frame, const Mac48Address& sender, uint8_t linkId);
 
+    /**
+     * Take necessary actions upon receiving the given SBP Request frame from the given
+     * station on the given link. A request whose parameters are identical to those of a
+     * measurement setup already run on behalf of another station is served by that setup.
+     *
+     * \param frame the received SBP Request frame
+     * \param sender the MAC address of the sender of the frame
+     * \param linkId the ID of the link over which the frame was received
+     */
+    void ReceiveSbpRequest(const MgtSbpRequestHeader& frame,
+                           const Mac48Address& sender,
+                           uint8_t linkId);
+    /**
+     * Take necessary actions upon receiving the given SBP Termination frame from the given
+     * station. The measurement setup is deregistered when no station requires it anymore.
+     *
+     * \param frame the received SBP Termination frame
+     * \param sender the MAC address of the sender of the frame
+     */
+    void ReceiveSbpTermination(const MgtSbpTerminationHeader& frame, const Mac48Address& sender);
+    /**
+     * Remove the given station from the requesters of the measurement setup it assigned the
+     * given ID to or, if no ID is provided, of all the measurement setups run on its behalf.
+     * The setups that are no longer requested by any station are deregistered.
+     *
+     * \param address the MAC address of the station
+     * \param setupId the ID assigned by the station to the measurement setup, if any
+     */
+    void RemoveSbpRequester(const Mac48Address& address,
+                            std::optional<uint8_t> setupId = std::nullopt);
+    /**
+     * Send a Sensing Action frame to the given station on the given link.
+     *
+     * \param to the MAC address of the receiver
+     * \param action the sensing action
+     * \param packet the frame body, without the Action field
+     * \param linkId the ID of the link over which the frame is sent
+     */
+    void SendSensingAction(Mac48Address to,
+                           WifiActionHeader::SensingActionValue action,
+                           Ptr<Packet> packet,
+                           uint8_t linkId);
+
     /**
      * The packet we sent was successfully received by the receiver
      * (i.e. we received an Ack from the receiver).  If the packet
@@ -454,6 +569,11 @@ class ApWifiMac : public InfrastructureWifiMac
      * \param linkId the ID of the given link
      */
     void SendOneBeacon(uint8_t linkId);
+    /**
+     * Schedule the launch of the next sensing measurement instance, according to the
+     * registered sensing measurement setups.
+     */
+    void ScheduleNextSensingInstance();
 
     /**
      * Process the Power Management bit in the Frame Control field of an MPDU
@@ -672,6 +792,19 @@ class ApWifiMac : public InfrastructureWifiMac
     TracedCallback<uint16_t /* AID */, Mac48Address> m_assocLogger;   ///< association logger
     TracedCallback<uint16_t /* AID */, Mac48Address> m_deAssocLogger; ///< deassociation logger
 
+    uint32_t m_sensingInstanceId{0}; //!< ID of the current sensing measurement instance
+    SensingSessionManager m_sensingSessions;     //!< registered sensing measurement setups
+    SensingSessionManager::Instance m_sensingInstance; //!< current sensing measurement instance
+    Time m_sensingMergeWindow; //!< max delay between the due times of merged setups
+    EventId m_sensingInstanceEvent; //!< event launching the next sensing measurement instance
+    /// A station that requested a measurement setup by means of sensing by proxy, along with
+    /// the ID it assigned to the setup
+    using SbpRequester = std::pair<Mac48Address, uint8_t>;
+    /// Requesters of each measurement setup run by proxy, indexed by setup ID
+    std::map<uint32_t, std::set<SbpRequester>> m_sbpRequesters;
+    TracedCallback<uint32_t, SensingPhase, SensingPhaseEvent, Time>
+        m_sensingPhaseTrace; //!< Trace source fired on the phases of sensing instances
+
     /*
         *************************************
         Attempt to add PCF from ns3.33
@@ -2398,6 +2398,18 @@ CtrlNdpaHeader::GetSoundingDialogToken() const
     return m_dialogToken;
 }
 
+void
+CtrlNdpaHeader::SetNonTbSensing(bool nonTb)
+{
+    m_dialogToken = nonTb ? (m_dialogToken | 0x80) : (m_dialogToken & 0x7f);
+}
+
+bool
+CtrlNdpaHeader::IsNonTbSensing() const
+{
+    return (m_dialogToken & 0x80) != 0;
+}
+
 uint32_t
 CtrlNdpaHeader::GetSerializedSize() const
 {
@@ -1476,6 +1476,20 @@ class CtrlNdpaHeader : public Header
      */
     uint8_t GetSoundingDialogToken() const;
 
+    /**
+     * Set whether this NDPA frame announces a non-TB sensing sounding, i.e., an I2R NDP
+     * followed by an R2I NDP sent by the (single) announced station. This model uses the
+     * most significant bit of the Sounding Dialog Token subfield as the indication.
+     *
+     * \param nonTb whether this NDPA frame announces a non-TB sensing sounding
+     */
+    void SetNonTbSensing(bool nonTb);
+
+    /**
+     * \return whether this NDPA frame announces a non-TB sensing sounding
+     */
+    bool IsNonTbSensing() const;
+
   private:
     uint8_t m_dialogToken;              //!< Sounding Dialog Token subfield
     std::list<StaInfo> m_staInfoFields; //!< list of STA Info fields
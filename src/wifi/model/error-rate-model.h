@@ -24,6 +24,9 @@
 
 #include "ns3/object.h"
 
+#include <utility>
+#include <vector>
+
 namespace ns3
 {
 
@@ -92,6 +95,33 @@ class ErrorRateModel : public Object
                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
                                uint16_t staId = SU_STA_ID) const;
 
+    /// SNR (linear scale) and number of bits of a chunk
+    using Chunk = std::pair<double, uint64_t>;
+
+    /**
+     * This method returns the probability that all the given chunks, which are
+     * transmitted with the same mode, are successfully received by the PHY, i.e.
+     * the product of the success rates returned by GetChunkSuccessRate for each
+     * chunk. It allows the subclasses to decode the mode and the TXVECTOR only
+     * once for all the chunks of a PSDU.
+     *
+     * \param mode the Wi-Fi mode applicable to the chunks
+     * \param txVector TXVECTOR of the overall transmission
+     * \param chunks the SNR and the number of bits of each chunk
+     * \param numRxAntennas the number of active RX antennas (1 if not provided)
+     * \param field the PPDU field to which the chunks belong to (assumes this is for the payload
+     * part if not provided)
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving all the chunks
+     */
+    double GetChunksSuccessRate(WifiMode mode,
+                                const WifiTxVector& txVector,
+                                const std::vector<Chunk>& chunks,
+                                uint8_t numRxAntennas = 1,
+                                WifiPpduField field = WIFI_PPDU_FIELD_DATA,
+                                uint16_t staId = SU_STA_ID) const;
+
     /**
      * Assign a fixed random variable stream number to the random variables
      * used by this model. Return the number of streams (possibly zero) that
@@ -123,6 +153,27 @@ class ErrorRateModel : public Object
                                          uint8_t numRxAntennas,
                                          WifiPpduField field,
                                          uint16_t staId) const = 0;
+
+    /**
+     * Return the probability of successfully receiving all the given chunks. The
+     * default implementation multiplies the success rates returned by
+     * DoGetChunkSuccessRate for each chunk, in order.
+     *
+     * \param mode the Wi-Fi mode applicable to the chunks
+     * \param txVector TXVECTOR of the overall transmission
+     * \param chunks the SNR and the number of bits of each chunk
+     * \param numRxAntennas the number of active RX antennas
+     * \param field the PPDU field to which the chunks belong to
+     * \param staId the station ID for MU
+     *
+     * \return probability of successfully receiving all the chunks
+     */
+    virtual double DoGetChunksSuccessRate(WifiMode mode,
+                                          const WifiTxVector& txVector,
+                                          const std::vector<Chunk>& chunks,
+                                          uint8_t numRxAntennas,
+                                          WifiPpduField field,
+                                          uint16_t staId) const;
 };
 
 } // namespace ns3
@@ -22,8 +22,9 @@
 #include "he-configuration.h"
 
 #include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
-#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
 #include "ns3/wifi-acknowledgment.h"
@@ -31,7 +32,9 @@
 #include <ns3/nstime.h>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 
 namespace ns3
 {
@@ -172,7 +175,9 @@ CsBeamformer::CsBeamformer()
 {
     m_sendNdpa = false;
     m_sendNdp = false;
+    m_nonTb = false;
     m_lastCs = MilliSeconds(0);
+    m_csiGenerator = CreateObject<RandomCsiGenerator>();
 }
 
 CsBeamformer::~CsBeamformer()
@@ -184,6 +189,13 @@ CsBeamformer::DoDispose()
 {
     NS_LOG_FUNCTION(this);
     ClearAllInfo();
+    m_lastFullReportList.clear();
+    m_channelInfoPool.Clear();
+    if (m_csiGenerator)
+    {
+        m_csiGenerator->Dispose();
+        m_csiGenerator = nullptr;
+    }
     ChannelSounding::DoDispose();
 }
 
@@ -197,32 +209,16 @@ CsBeamformer::DoInitialize()
 void
 CsBeamformer::ClearChannelInfo()
 {
-    auto staChannelInfo = m_channelInfoList.begin();
-    while (staChannelInfo != m_channelInfoList.end())
+    for (auto& staChannelInfo : m_channelInfoList)
     {
-        staChannelInfo->second.m_stStreamSnr.clear();
-
-        for (uint16_t i = 0; i < staChannelInfo->second.m_deltaSnr.size(); i++)
-        {
-            staChannelInfo->second.m_deltaSnr[i].clear();
-        }
-        staChannelInfo->second.m_deltaSnr.clear();
-
-        for (uint16_t i = 0; i < staChannelInfo->second.m_phi.size(); i++)
-        {
-            staChannelInfo->second.m_phi[i].clear();
-        }
-        staChannelInfo->second.m_phi.clear();
-
-        for (uint16_t i = 0; i < staChannelInfo->second.m_psi.size(); i++)
-        {
-            staChannelInfo->second.m_psi[i].clear();
-        }
-        staChannelInfo->second.m_psi.clear();
-
-        staChannelInfo++;
+        m_channelInfoPool.Release(std::move(staChannelInfo.second));
     }
     m_channelInfoList.clear();
+    for (auto& staChannelInfo : m_r2iChannelInfoList)
+    {
+        m_channelInfoPool.Release(std::move(staChannelInfo.second));
+    }
+    m_r2iChannelInfoList.clear();
 }
 
 void
@@ -235,39 +231,34 @@ CsBeamformer::ClearAllInfo()
 void
 CsBeamformer::PrintChannelInfo(void)
 {
-    auto channelInfo = m_channelInfoList.begin();
-    while (channelInfo != m_channelInfoList.end())
+    for (const auto& [staId, channelInfo] : m_channelInfoList)
     {
-        NS_LOG_INFO("STA ID:" << channelInfo->first);
-        for (uint16_t i = 0; i < channelInfo->second.m_stStreamSnr.size(); i++)
+        NS_LOG_INFO("STA ID:" << staId);
+        for (uint8_t i = 0; i < channelInfo.GetNc(); i++)
         {
-            NS_LOG_INFO("Average SNR of stream "
-                        << std::to_string(i) << ":"
-                        << std::to_string(channelInfo->second.m_stStreamSnr[i]));
+            NS_LOG_INFO("Average SNR of stream " << std::to_string(i) << ":"
+                                                 << std::to_string(channelInfo.GetStStreamSnr(i)));
         }
 
-        for (uint16_t i = 0; i < channelInfo->second.m_phi.size(); i++)
+        for (uint16_t i = 0; i < channelInfo.GetNs(); i++)
         {
             NS_LOG_INFO("Subcarrier " << std::to_string(i));
-            for (uint16_t j = 0; j < channelInfo->second.m_phi[0].size(); j++)
+            for (uint8_t j = 0; j < channelInfo.GetNa() / 2; j++)
             {
-                NS_LOG_INFO("Angle Phi " << std::to_string(j) << ":"
-                                         << channelInfo->second.m_phi[i][j]);
-                NS_LOG_INFO("Angle Psi " << std::to_string(j) << ":"
-                                         << channelInfo->second.m_psi[i][j]);
+                NS_LOG_INFO("Angle Phi " << std::to_string(j) << ":" << channelInfo.GetPhi(i, j));
+                NS_LOG_INFO("Angle Psi " << std::to_string(j) << ":" << channelInfo.GetPsi(i, j));
             }
         }
 
-        for (uint16_t i = 0; i < channelInfo->second.m_deltaSnr.size(); i++)
+        for (uint16_t i = 0; i < channelInfo.GetNs(); i++)
         {
             NS_LOG_INFO("Subcarrier " << std::to_string(i));
-            for (uint16_t j = 0; j < channelInfo->second.m_deltaSnr[0].size(); j++)
+            for (uint8_t j = 0; j < channelInfo.GetNc(); j++)
             {
                 NS_LOG_INFO("DeltaSnr " << std::to_string(j) << ":"
-                                        << std::to_string(channelInfo->second.m_deltaSnr[i][j]));
+                                        << std::to_string(channelInfo.GetDeltaSnr(i, j)));
             }
         }
-        channelInfo++;
     }
 }
 
@@ -297,13 +288,18 @@ void
 CsBeamformer::GenerateNdpaFrame(Mac48Address apAddress,
                                 std::list<Mac48Address> staMacAddrList,
                                 uint16_t bandwidth,
-                                Ptr<WifiRemoteStationManager> remoteStaManager)
+                                Ptr<WifiRemoteStationManager> remoteStaManager,
+                                bool nonTb,
+                                uint32_t instanceId)
 {
     if (staMacAddrList.empty())
     {
         NS_LOG_ERROR("Cannot generate NDPA frame due to empty list of beamformees.");
     }
+    NS_ABORT_MSG_IF(nonTb && staMacAddrList.size() > 1,
+                    "A non-TB sensing sounding involves a single station");
     m_csStaIdList.clear();
+    m_nonTb = nonTb;
 
     Mac48Address receiver =
         staMacAddrList.size() > 1 ? Mac48Address::GetBroadcast() : *staMacAddrList.begin();
@@ -337,7 +333,8 @@ CsBeamformer::GenerateNdpaFrame(Mac48Address apAddress,
     }
 
     CtrlNdpaHeader ndpaHeader;
-    ndpaHeader.SetSoundingDialogToken(1);
+    ndpaHeader.SetSoundingDialogToken(instanceId & 0x3f);
+    ndpaHeader.SetNonTbSensing(nonTb);
     auto staIt = staMacAddrList.begin();
     while (staIt != staMacAddrList.end())
     {
@@ -413,39 +410,128 @@ CsBeamformer::GenerateNdpaFrame(Mac48Address apAddress,
     m_beamformerFrameInfo.m_ndpa = Create<WifiMpdu>(packetNdpa, hdrNdpa);
 }
 
+bool
+CsBeamformer::IsNonTbSounding() const
+{
+    return m_nonTb;
+}
+
 void
 CsBeamformer::GetBfReportInfo(Ptr<const WifiMpdu> bfReport, uint16_t staId)
 {
-    ChannelInfo staChannelInfo;
-
     Ptr<Packet> bfPacket = bfReport->GetPacket()->Copy();
 
     // Get HE action field
     WifiActionHeader actionHdr;
     bfPacket->RemoveHeader(actionHdr);
 
+    if (actionHdr.GetCategory() == WifiActionHeader::SENSING &&
+        actionHdr.GetAction().sensingAction == WifiActionHeader::SENSING_NO_CHANGE_REPORT)
+    {
+        auto lastIt = m_lastFullReportList.find(staId);
+        if (lastIt == m_lastFullReportList.end())
+        {
+            NS_LOG_WARN("No change reported by STA " << staId << " without a previous report");
+            return;
+        }
+        const auto& last = lastIt->second;
+        auto [it, inserted] = m_channelInfoList.try_emplace(staId);
+        if (inserted)
+        {
+            it->second = m_channelInfoPool.Acquire(last.GetNs(), last.GetNa(), last.GetNc());
+        }
+        it->second = last;
+        return;
+    }
+
     // Get HE MIMO Control Info field
     HeMimoControlHeader heMimoControlHeader;
     bfPacket->RemoveHeader(heMimoControlHeader);
 
-    // Get Compressed Beamforming Report field
     HeCompressedBfReport heCompressedBfReport(heMimoControlHeader);
-    bfPacket->RemoveHeader(heCompressedBfReport);
+    uint16_t ns = heCompressedBfReport.GetNs();
+    uint8_t na = heCompressedBfReport.GetNa();
+    uint8_t nc = heCompressedBfReport.GetNc();
 
-    staChannelInfo.m_stStreamSnr = heCompressedBfReport.GetChannelInfo().m_stStreamSnr;
-    staChannelInfo.m_phi = heCompressedBfReport.GetChannelInfo().m_phi;
-    staChannelInfo.m_psi = heCompressedBfReport.GetChannelInfo().m_psi;
+    // Reuse the buffer of the previous report of this station, if any, or get one from the pool
+    auto [it, inserted] = m_channelInfoList.try_emplace(staId);
+    if (inserted)
+    {
+        it->second = m_channelInfoPool.Acquire(ns, na, nc);
+    }
+
+    // Get Compressed Beamforming Report field, decoded directly into the station's buffer
+    heCompressedBfReport.SetChannelInfoBuffer(it->second);
+    bfPacket->RemoveHeader(heCompressedBfReport);
 
     // Get MU Exclusive Beamforming Report field
     if (heMimoControlHeader.GetFeedbackType() == HeMimoControlHeader::MU)
     {
         HeMuExclusiveBfReport heMuExclusiveBfReport(heMimoControlHeader);
+        heMuExclusiveBfReport.SetChannelInfoBuffer(it->second);
         bfPacket->RemoveHeader(heMuExclusiveBfReport);
-        staChannelInfo.m_deltaSnr = heMuExclusiveBfReport.GetDeltaSnr();
     }
 
-    m_channelInfoList.erase(staId);
-    m_channelInfoList.insert(std::pair<uint16_t, ChannelInfo>(staId, staChannelInfo));
+    // Keep a copy of the report, to be used if the station later reports no change
+    m_lastFullReportList[staId] = it->second;
+}
+
+void
+CsBeamformer::GetR2iNdpInfo(WifiTxVector txVector, uint16_t staId, Mac48Address staAddress)
+{
+    NS_LOG_FUNCTION(this << txVector << staId << staAddress);
+    NS_ASSERT(m_beamformerFrameInfo.m_ndpa);
+
+    // the R2I NDP is measured with the parameters announced for the station in the NDPA
+    CtrlNdpaHeader ndpaHeader;
+    m_beamformerFrameInfo.m_ndpa->GetPacket()->PeekHeader(ndpaHeader);
+    HeMimoControlHeader heMimoControlHeader(ndpaHeader, staId & 0x07ff);
+    heMimoControlHeader.SetNr(txVector.GetNss() - 1);
+    heMimoControlHeader.SetNc(std::min(heMimoControlHeader.GetNc(), heMimoControlHeader.GetNr()));
+    heMimoControlHeader.SetBw(txVector.GetChannelWidth());
+
+    HeCompressedBfReport heCompressedBfReport(heMimoControlHeader);
+    auto [it, inserted] = m_r2iChannelInfoList.try_emplace(staId);
+    if (inserted)
+    {
+        it->second = m_channelInfoPool.Acquire(heCompressedBfReport.GetNs(),
+                                               heCompressedBfReport.GetNa(),
+                                               heCompressedBfReport.GetNc());
+    }
+    else
+    {
+        it->second.Reset(heCompressedBfReport.GetNs(),
+                         heCompressedBfReport.GetNa(),
+                         heCompressedBfReport.GetNc());
+    }
+    m_csiGenerator->Generate(heMimoControlHeader, staAddress, it->second);
+}
+
+const CsBeamformer::ChannelInfo&
+CsBeamformer::GetR2iChannelInfo(uint16_t staId) const
+{
+    static const ChannelInfo emptyChannelInfo;
+    auto it = m_r2iChannelInfoList.find(staId);
+    if (it == m_r2iChannelInfoList.end())
+    {
+        return emptyChannelInfo;
+    }
+    return it->second;
+}
+
+void
+CsBeamformer::SetCsiGenerator(Ptr<CsiGenerator> generator)
+{
+    NS_LOG_FUNCTION(this << generator);
+    NS_ASSERT(generator);
+    m_csiGenerator = generator;
+}
+
+int64_t
+CsBeamformer::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return m_csiGenerator->AssignStreams(stream);
 }
 
 std::list<uint16_t>
@@ -470,12 +556,30 @@ CsBeamformer::GetBeamformerFrameInfo()
     return m_beamformerFrameInfo;
 }
 
-std::map<uint16_t, CsBeamformer::ChannelInfo>
+const std::map<uint16_t, CsBeamformer::ChannelInfo>&
 CsBeamformer::GetChannelInfoList() const
 {
     return m_channelInfoList;
 }
 
+const CsBeamformer::ChannelInfo&
+CsBeamformer::GetChannelInfo(uint16_t staId) const
+{
+    static const ChannelInfo emptyChannelInfo;
+    auto it = m_channelInfoList.find(staId);
+    if (it == m_channelInfoList.end())
+    {
+        return emptyChannelInfo;
+    }
+    return it->second;
+}
+
+const CsiBufferPool&
+CsBeamformer::GetChannelInfoPool() const
+{
+    return m_channelInfoPool;
+}
+
 uint8_t
 CsBeamformer::GetNumCsStations() const
 {
@@ -519,6 +623,7 @@ CsBeamformer::SetBeamformerFrames(Ptr<WifiMpdu> mdpu, std::string frameType)
         m_csStaIdList.clear();
         CtrlNdpaHeader ndpaHeader;
         mdpu->GetPacket()->PeekHeader(ndpaHeader);
+        m_nonTb = ndpaHeader.IsNonTbSensing();
         auto sta = ndpaHeader.begin();
         while (sta != ndpaHeader.end())
         {
@@ -572,10 +677,28 @@ NS_OBJECT_ENSURE_REGISTERED(CsBeamformee);
 TypeId
 CsBeamformee::GetTypeId(void)
 {
-    static TypeId tid = TypeId("ns3::CsBeamformee")
-                            .SetParent<ChannelSounding>()
-                            .AddConstructor<CsBeamformee>()
-                            .SetGroupName("Wifi");
+    static TypeId tid =
+        TypeId("ns3::CsBeamformee")
+            .SetParent<ChannelSounding>()
+            .AddConstructor<CsBeamformee>()
+            .SetGroupName("Wifi")
+            .AddAttribute("ReportThreshold",
+                          "The distance between the measured channel information and the last "
+                          "reported one above which a full beamforming report is sent. Otherwise, "
+                          "a compact \"no change\" report is sent. Zero disables threshold-based "
+                          "reporting, i.e., a full report is always sent.",
+                          DoubleValue(0),
+                          MakeDoubleAccessor(&CsBeamformee::m_reportThreshold),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("ReportDistanceMetric",
+                          "The metric used to compare the measured channel information with "
+                          "the last reported one.",
+                          EnumValue(CsBeamformee::ANGLE_DISTANCE),
+                          MakeEnumAccessor(&CsBeamformee::m_distanceMetric),
+                          MakeEnumChecker(CsBeamformee::ANGLE_DISTANCE,
+                                          "Angle",
+                                          CsBeamformee::SNR_DISTANCE,
+                                          "Snr"));
 
     return tid;
 }
@@ -584,6 +707,9 @@ CsBeamformee::CsBeamformee()
 {
     m_receiveNdpa = false;
     m_receiveNdp = false;
+    m_noChangeReport = false;
+    m_nonTb = false;
+    m_csiGenerator = CreateObject<RandomCsiGenerator>();
 }
 
 CsBeamformee::~CsBeamformee()
@@ -597,6 +723,12 @@ CsBeamformee::DoDispose()
 
     m_bfReport = nullptr;
     ClearChannelInfo();
+    m_lastReportedChannelInfo.Clear();
+    if (m_csiGenerator)
+    {
+        m_csiGenerator->Dispose();
+        m_csiGenerator = nullptr;
+    }
     ChannelSounding::DoDispose();
 }
 
@@ -610,53 +742,35 @@ CsBeamformee::DoInitialize()
 void
 CsBeamformee::ClearChannelInfo()
 {
-    m_channelInfo.m_stStreamSnr.clear();
-
-    for (uint16_t i = 0; i < m_channelInfo.m_deltaSnr.size(); i++)
-    {
-        m_channelInfo.m_deltaSnr[i].clear();
-    }
-    m_channelInfo.m_deltaSnr.clear();
-
-    for (uint16_t i = 0; i < m_channelInfo.m_phi.size(); i++)
-    {
-        m_channelInfo.m_phi[i].clear();
-    }
-    m_channelInfo.m_phi.clear();
-
-    for (uint16_t i = 0; i < m_channelInfo.m_psi.size(); i++)
-    {
-        m_channelInfo.m_psi[i].clear();
-    }
-    m_channelInfo.m_psi.clear();
+    m_channelInfo.Clear();
 }
 
 void
 CsBeamformee::PrintChannelInfo(void)
 {
-    for (uint16_t i = 0; i < m_channelInfo.m_stStreamSnr.size(); i++)
+    for (uint8_t i = 0; i < m_channelInfo.GetNc(); i++)
     {
         NS_LOG_INFO("Average SNR of stream " << std::to_string(i) << ":"
-                                             << std::to_string(m_channelInfo.m_stStreamSnr[i]));
+                                             << std::to_string(m_channelInfo.GetStStreamSnr(i)));
     }
 
-    for (uint16_t i = 0; i < m_channelInfo.m_phi.size(); i++)
+    for (uint16_t i = 0; i < m_channelInfo.GetNs(); i++)
     {
         NS_LOG_INFO("Subcarrier " << std::to_string(i));
-        for (uint16_t j = 0; j < m_channelInfo.m_phi[0].size(); j++)
+        for (uint8_t j = 0; j < m_channelInfo.GetNa() / 2; j++)
         {
-            NS_LOG_INFO("Angle Phi " << std::to_string(j) << ":" << m_channelInfo.m_phi[i][j]);
-            NS_LOG_INFO("Angle Psi " << std::to_string(j) << ":" << m_channelInfo.m_psi[i][j]);
+            NS_LOG_INFO("Angle Phi " << std::to_string(j) << ":" << m_channelInfo.GetPhi(i, j));
+            NS_LOG_INFO("Angle Psi " << std::to_string(j) << ":" << m_channelInfo.GetPsi(i, j));
         }
     }
 
-    for (uint16_t i = 0; i < m_channelInfo.m_deltaSnr.size(); i++)
+    for (uint16_t i = 0; i < m_channelInfo.GetNs(); i++)
     {
         NS_LOG_INFO("Subcarrier " << std::to_string(i));
-        for (uint16_t j = 0; j < m_channelInfo.m_deltaSnr[0].size(); j++)
+        for (uint8_t j = 0; j < m_channelInfo.GetNc(); j++)
         {
             NS_LOG_INFO("DeltaSnr " << std::to_string(j) << ":"
-                                    << std::to_string(m_channelInfo.m_deltaSnr[i][j]));
+                                    << std::to_string(m_channelInfo.GetDeltaSnr(i, j)));
         }
     }
 }
@@ -670,6 +784,8 @@ CsBeamformee::GetNdpaInfo(Ptr<const WifiMpdu> ndpa, uint16_t staId)
     CtrlNdpaHeader ndpaHeader;
     ndpa->GetPacket()->PeekHeader(ndpaHeader);
     m_heMimoControlHeader = HeMimoControlHeader(ndpaHeader, aid11);
+    m_nonTb = ndpaHeader.IsNonTbSensing();
+    m_beamformer = ndpa->GetHeader().GetAddr2();
 }
 
 void
@@ -689,45 +805,78 @@ CsBeamformee::CalculateChannelInfo()
 {
     HeCompressedBfReport heCompressedBfReport(m_heMimoControlHeader);
 
-    uint16_t ns = heCompressedBfReport.GetNs();
-    uint8_t na = heCompressedBfReport.GetNa();
-    uint8_t nc = m_heMimoControlHeader.GetNc() + 1;
-    uint8_t bits1 = heCompressedBfReport.GetBits1();
-    uint8_t bits2 = heCompressedBfReport.GetBits2();
+    // The buffer keeps its storage across NDPs, so no allocation occurs if dimensions do not grow
+    m_channelInfo.Reset(heCompressedBfReport.GetNs(),
+                        heCompressedBfReport.GetNa(),
+                        heCompressedBfReport.GetNc());
+    m_csiGenerator->Generate(m_heMimoControlHeader, m_beamformer, m_channelInfo);
+}
+
+void
+CsBeamformee::SetCsiGenerator(Ptr<CsiGenerator> generator)
+{
+    NS_LOG_FUNCTION(this << generator);
+    NS_ASSERT(generator);
+    m_csiGenerator = generator;
+}
+
+Ptr<CsiGenerator>
+CsBeamformee::GetCsiGenerator() const
+{
+    return m_csiGenerator;
+}
 
-    Ptr<UniformRandomVariable> x = CreateObject<UniformRandomVariable>();
+int64_t
+CsBeamformee::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return m_csiGenerator->AssignStreams(stream);
+}
 
-    for (uint8_t i = 0; i < nc; i++)
+const ChannelSounding::ChannelInfo&
+CsBeamformee::GetChannelInfo() const
+{
+    return m_channelInfo;
+}
+
+double
+CsBeamformee::GetChannelInfoDistance(const ChannelInfo& lhs,
+                                     const ChannelInfo& rhs,
+                                     DistanceMetric metric)
+{
+    if (lhs.GetNs() != rhs.GetNs() || lhs.GetNa() != rhs.GetNa() || lhs.GetNc() != rhs.GetNc())
     {
-        m_channelInfo.m_stStreamSnr.push_back(x->GetInteger(0, std::pow(2, 8) - 1));
+        return std::numeric_limits<double>::infinity();
     }
 
-    for (uint16_t i = 0; i < ns; i++)
+    double sum = 0;
+    std::size_t count = 0;
+    switch (metric)
     {
-        std::vector<uint16_t> phi;
-        std::vector<uint16_t> psi;
-        std::vector<uint8_t> deltaSnr;
-
-        for (uint8_t j = 0; j < na / 2; j++)
+    case ANGLE_DISTANCE: {
+        // Phi and Psi angles are stored one after the other
+        count = 2 * static_cast<std::size_t>(lhs.GetNs()) * (lhs.GetNa() / 2);
+        const uint16_t* lhsAngles = lhs.GetPhiData();
+        const uint16_t* rhsAngles = rhs.GetPhiData();
+        for (std::size_t i = 0; i < count; ++i)
         {
-            phi.push_back(x->GetInteger(0, std::pow(2, bits1) - 1));
-            psi.push_back(x->GetInteger(0, std::pow(2, bits2) - 1));
+            sum += std::abs(static_cast<int>(lhsAngles[i]) - static_cast<int>(rhsAngles[i]));
         }
-
-        for (uint8_t j = 0; j < nc; j++)
+        break;
+    }
+    case SNR_DISTANCE:
+        // the average SNR is a two's complement value
+        count = lhs.GetNc();
+        for (uint8_t i = 0; i < lhs.GetNc(); ++i)
         {
-            deltaSnr.push_back(x->GetInteger(0, std::pow(2, 4) - 1));
+            sum += std::abs(static_cast<int8_t>(lhs.GetStStreamSnr(i)) -
+                            static_cast<int8_t>(rhs.GetStStreamSnr(i)));
         }
-        m_channelInfo.m_phi.push_back(phi);
-        m_channelInfo.m_psi.push_back(psi);
-        m_channelInfo.m_deltaSnr.push_back(deltaSnr);
+        break;
+    default:
+        NS_FATAL_ERROR("Unknown distance metric " << +metric);
     }
-}
-
-ChannelSounding::ChannelInfo
-CsBeamformee::GetChannelInfo() const
-{
-    return m_channelInfo;
+    return count == 0 ? 0 : sum / count;
 }
 
 void
@@ -747,20 +896,34 @@ CsBeamformee::GenerateBfReport(uint16_t staId,
 
     Ptr<Packet> packetBfReport = Create<Packet>();
 
+    m_noChangeReport =
+        m_reportThreshold > 0 && !m_lastReportedChannelInfo.IsEmpty() &&
+        GetChannelInfoDistance(m_channelInfo, m_lastReportedChannelInfo, m_distanceMetric) <=
+            m_reportThreshold;
+    if (m_noChangeReport)
+    {
+        NS_LOG_DEBUG("Channel information did not change, send a no change report");
+        WifiActionHeader actionHdr;
+        WifiActionHeader::ActionValue action;
+        action.sensingAction = WifiActionHeader::SENSING_NO_CHANGE_REPORT;
+        actionHdr.SetAction(WifiActionHeader::SENSING, action);
+        packetBfReport->AddHeader(actionHdr);
+        m_bfReport = Create<WifiMpdu>(packetBfReport, hdr);
+        return;
+    }
+    m_lastReportedChannelInfo = m_channelInfo;
+
     // Generate MU Exclusive Beamforming Report
     if (m_heMimoControlHeader.GetFeedbackType() == HeMimoControlHeader::MU)
     {
         HeMuExclusiveBfReport heMuExclusiveBfReport(m_heMimoControlHeader);
-        heMuExclusiveBfReport.SetDeltaSnr(m_channelInfo.m_deltaSnr);
+        heMuExclusiveBfReport.SetChannelInfo(m_channelInfo);
         packetBfReport->AddHeader(heMuExclusiveBfReport);
     }
 
     // Generate Compressed Beamforming Report
     HeCompressedBfReport heCompressedBfReport(m_heMimoControlHeader);
-    heCompressedBfReport.SetChannelInfo(
-        HeCompressedBfReport::ChannelInfo{m_channelInfo.m_stStreamSnr,
-                                          m_channelInfo.m_phi,
-                                          m_channelInfo.m_psi});
+    heCompressedBfReport.SetChannelInfo(m_channelInfo);
     packetBfReport->AddHeader(heCompressedBfReport);
 
     // Generate HE MIMO Control field
@@ -782,6 +945,18 @@ CsBeamformee::GetBfReport() const
     return m_bfReport;
 }
 
+bool
+CsBeamformee::IsNoChangeReport() const
+{
+    return m_noChangeReport;
+}
+
+bool
+CsBeamformee::IsNonTbSounding() const
+{
+    return m_nonTb;
+}
+
 HeMimoControlHeader
 CsBeamformee::GetHeMimoControlHeader() const
 {
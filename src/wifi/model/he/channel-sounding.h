@@ -20,6 +20,8 @@
 #ifndef CHANNEL_SOUNDING_H
 #define CHANNEL_SOUNDING_H
 
+#include "csi-buffer.h"
+#include "csi-generator.h"
 #include "multi-user-scheduler.h"
 
 #include "ns3/ctrl-headers.h"
@@ -53,16 +55,8 @@ class ChannelSounding : public Object
     ChannelSounding();
     virtual ~ChannelSounding();
 
-    struct ChannelInfo //!<  Channel information
-    {
-        std::vector<uint8_t> m_stStreamSnr; //!< Average SNR of space-time streams
-        std::vector<std::vector<uint8_t>>
-            m_deltaSnr; //!< Delta SNR information for each space-time stream
-        std::vector<std::vector<uint16_t>>
-            m_phi; //!< Phi angle (number of subcarriers * number of angles)
-        std::vector<std::vector<uint16_t>>
-            m_psi; //!< Psi angle (number of subcarriers * number of angles)
-    };
+    /// Channel information (average SNR, delta SNR, Phi and Psi angles) stored in a flat buffer
+    using ChannelInfo = CsiBuffer;
 
     /**
      * Calculate the number of bytes in the beamforming report given channel sounding parameters
@@ -128,20 +122,69 @@ class CsBeamformer : public ChannelSounding
      * \param staMacAddrList Mac addresses of stations
      * \param bandwidth channel bandwidth
      * \param remoteStaManager remote station manager
+     * \param nonTb whether the NDPA announces a non-TB sensing sounding
+     * \param instanceId the ID of the sensing measurement instance, carried (modulo 64) in the
+     *                   Sounding Dialog Token field
      */
     void GenerateNdpaFrame(Mac48Address apAddress,
                            std::list<Mac48Address> staMacAddrList,
                            uint16_t bandwidth,
-                           Ptr<WifiRemoteStationManager> remoteStaManager);
+                           Ptr<WifiRemoteStationManager> remoteStaManager,
+                           bool nonTb = false,
+                           uint32_t instanceId = 0);
+
+    /**
+     * Check whether the current NDPA frame announces a non-TB sensing sounding
+     *
+     * \return whether the current NDPA frame announces a non-TB sensing sounding
+     */
+    bool IsNonTbSounding() const;
 
     /**
-     * Get channel information in the beamforming report frame
+     * Get channel information in the beamforming report frame. If the frame is a "no change"
+     * report, the channel information carried by the last full report received from the
+     * given station is used.
      *
-     * \param bfReport beamforming report
+     * \param bfReport beamforming report or "no change" report
      * \param staId STA ID of the station which sends the beamforming report
      */
     void GetBfReportInfo(Ptr<const WifiMpdu> bfReport, uint16_t staId);
 
+    /**
+     * Calculate the channel information from the R2I NDP sent by the given station in a
+     * non-TB sensing sounding by means of the CSI generator
+     *
+     * \param txVector Tx vector of the R2I NDP
+     * \param staId STA ID of the station which sent the R2I NDP
+     * \param staAddress MAC address of the station which sent the R2I NDP
+     */
+    void GetR2iNdpInfo(WifiTxVector txVector, uint16_t staId, Mac48Address staAddress);
+
+    /**
+     * Get channel information measured on the R2I NDP sent by the given station
+     *
+     * \param staId STA ID of the station
+     * \return the channel information measured on the R2I NDP sent by the given station (empty
+     *         if no R2I NDP has been received from the given station)
+     */
+    const ChannelInfo& GetR2iChannelInfo(uint16_t staId) const;
+
+    /**
+     * Set the generator of the channel information measured on R2I NDPs
+     *
+     * \param generator the CSI generator
+     */
+    void SetCsiGenerator(Ptr<CsiGenerator> generator);
+
+    /**
+     * Assign a fixed random variable stream number to the random variables used by the
+     * CSI generator. Return the number of streams (possibly zero) that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this beamformer
+     */
+    int64_t AssignStreams(int64_t stream);
+
     /**
      * Check whether channel information of all the stations is received
      *
@@ -161,7 +204,23 @@ class CsBeamformer : public ChannelSounding
      *
      * \return a map of channel information and corresponding STA ID
      */
-    std::map<uint16_t, ChannelInfo> GetChannelInfoList() const;
+    const std::map<uint16_t, ChannelInfo>& GetChannelInfoList() const;
+
+    /**
+     * Get channel information reported by the given station
+     *
+     * \param staId STA ID of the station
+     * \return the channel information reported by the given station (empty if no report has
+     *         been received from the given station)
+     */
+    const ChannelInfo& GetChannelInfo(uint16_t staId) const;
+
+    /**
+     * Get the pool of buffers used to store channel information
+     *
+     * \return the pool of buffers used to store channel information
+     */
+    const CsiBufferPool& GetChannelInfoPool() const;
 
     /**
      * Set Tx parameters for frames that will be sent from the beamformer given frame type
@@ -228,11 +287,19 @@ class CsBeamformer : public ChannelSounding
   private:
     bool m_sendNdpa; //! Whether NDPA frame is sent out
     bool m_sendNdp;  //! Whether NDP frame is sent out
+    bool m_nonTb;    //! Whether the NDPA frame announces a non-TB sensing sounding
     BeamformerFrameInfo
         m_beamformerFrameInfo; //!< Store channel sounding frames sent from Bthe beamformer
     std::map<uint16_t, ChannelInfo>
         m_channelInfoList; //!<  Store channel information sent from all the beamformees:  station
                            //!<  AIDs and channel information
+    std::map<uint16_t, ChannelInfo>
+        m_lastFullReportList; //!< Channel information carried by the last full report received
+                              //!< from each station, used when a "no change" report is received
+    std::map<uint16_t, ChannelInfo>
+        m_r2iChannelInfoList; //!< Channel information measured on the R2I NDPs of the stations
+    CsiBufferPool m_channelInfoPool; //!< Buffers released from m_channelInfoList for reuse
+    Ptr<CsiGenerator> m_csiGenerator; //!< Generator of the channel information of R2I NDPs
     std::list<uint16_t>
         m_csStaIdList; //!< Store STA ID for all the stations that the beamformer requests CSI for
   private:
@@ -250,19 +317,62 @@ class CsBeamformee : public ChannelSounding
     CsBeamformee();
     virtual ~CsBeamformee();
 
+    /// Metrics used to compare the measured channel information with the last reported one
+    enum DistanceMetric : uint8_t
+    {
+        ANGLE_DISTANCE = 0, //!< mean absolute difference of the quantized Phi and Psi angles
+        SNR_DISTANCE        //!< mean absolute difference of the average SNR of the streams
+    };
+
+    /**
+     * Compute the distance between two sets of channel information
+     *
+     * \param lhs the first set of channel information
+     * \param rhs the second set of channel information
+     * \param metric the distance metric
+     * \return the distance between the two sets of channel information (infinity if they do
+     *         not have the same dimensions)
+     */
+    static double GetChannelInfoDistance(const ChannelInfo& lhs,
+                                         const ChannelInfo& rhs,
+                                         DistanceMetric metric);
+
     void ClearChannelInfo();
     void PrintChannelInfo();
 
     /**
-     * Calculate channel information (random channel information is generated)
+     * Calculate channel information by means of the CSI generator
      */
     virtual void CalculateChannelInfo();
 
+    /**
+     * Set the generator of the channel information reported by this beamformee
+     *
+     * \param generator the CSI generator
+     */
+    void SetCsiGenerator(Ptr<CsiGenerator> generator);
+
+    /**
+     * Get the generator of the channel information reported by this beamformee
+     *
+     * \return the CSI generator
+     */
+    Ptr<CsiGenerator> GetCsiGenerator() const;
+
+    /**
+     * Assign a fixed random variable stream number to the random variables used by the
+     * CSI generator. Return the number of streams (possibly zero) that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this beamformee
+     */
+    int64_t AssignStreams(int64_t stream);
+
     /**
      * Get measured channel information at the station
      * \return channel information
      */
-    ChannelInfo GetChannelInfo() const;
+    const ChannelInfo& GetChannelInfo() const;
 
     /**
      * Get information in all subfields of NDPA frame at user side
@@ -282,7 +392,9 @@ class CsBeamformee : public ChannelSounding
     virtual void GetNdpInfo(WifiTxVector txVector, uint16_t staId);
 
     /**
-     * Generate beamforming report at user side
+     * Generate beamforming report at user side. If a report threshold is set and the distance
+     * between the measured channel information and the last reported one does not exceed the
+     * threshold, a "no change" report is generated instead of a full report.
      * \param staId station ID of the given station
      * \param apAddress MAC address of AP
      * \param staAddress MAC address of the given station
@@ -299,6 +411,20 @@ class CsBeamformee : public ChannelSounding
      */
     Ptr<WifiMpdu> GetBfReport() const;
 
+    /**
+     * Check whether the last generated report is a "no change" report
+     *
+     * \return whether the last generated report is a "no change" report
+     */
+    bool IsNoChangeReport() const;
+
+    /**
+     * Check whether the last received NDPA frame announces a non-TB sensing sounding
+     *
+     * \return whether the last received NDPA frame announces a non-TB sensing sounding
+     */
+    bool IsNonTbSounding() const;
+
     /**
      * Get He MIMO Control Info field
      *
@@ -345,6 +471,13 @@ class CsBeamformee : public ChannelSounding
     HeMimoControlHeader m_heMimoControlHeader; //!< HE MIMO Control Info field used to transmit the
                                                //!< beamforming report
     ChannelInfo m_channelInfo;                 //!< Channel information measured by the beamformee
+    ChannelInfo m_lastReportedChannelInfo;     //!< Channel information of the last full report
+    Ptr<CsiGenerator> m_csiGenerator;          //!< Generator of the channel information
+    double m_reportThreshold;                  //!< Distance above which a full report is sent
+    DistanceMetric m_distanceMetric;           //!< Metric used to compare channel information
+    bool m_noChangeReport;                     //!< Whether the last report is a "no change" one
+    bool m_nonTb;                              //!< Whether the NDPA announces a non-TB sounding
+    Mac48Address m_beamformer;                 //!< MAC address of the transmitter of the NDPA
 };
 
 } // namespace ns3
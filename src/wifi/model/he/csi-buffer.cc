@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "csi-buffer.h"
+
+#include "ns3/assert.h"
+
+#include <utility>
+
+namespace ns3
+{
+
+/***********************************************************
+ *          CSI buffer
+ ***********************************************************/
+
+CsiBuffer::CsiBuffer()
+    : m_ns(0),
+      m_na(0),
+      m_nc(0),
+      m_phiOffset(0),
+      m_psiOffset(0),
+      m_deltaOffset(0)
+{
+}
+
+CsiBuffer::CsiBuffer(uint16_t ns, uint8_t na, uint8_t nc)
+    : CsiBuffer()
+{
+    Reset(ns, na, nc);
+}
+
+void
+CsiBuffer::Reset(uint16_t ns, uint8_t na, uint8_t nc)
+{
+    NS_ASSERT(na % 2 == 0);
+    m_ns = ns;
+    m_na = na;
+    m_nc = nc;
+
+    std::size_t anglesPerField = static_cast<std::size_t>(ns) * (na / 2);
+    m_phiOffset = nc;
+    m_psiOffset = m_phiOffset + anglesPerField;
+    m_deltaOffset = m_psiOffset + anglesPerField;
+
+    // assign() does not reallocate if the capacity is large enough
+    m_data.assign(m_deltaOffset + static_cast<std::size_t>(ns) * nc, 0);
+}
+
+void
+CsiBuffer::Clear()
+{
+    m_ns = 0;
+    m_na = 0;
+    m_nc = 0;
+    m_phiOffset = 0;
+    m_psiOffset = 0;
+    m_deltaOffset = 0;
+    m_data.clear();
+}
+
+bool
+CsiBuffer::IsEmpty() const
+{
+    return m_data.empty();
+}
+
+uint16_t
+CsiBuffer::GetNs() const
+{
+    return m_ns;
+}
+
+uint8_t
+CsiBuffer::GetNa() const
+{
+    return m_na;
+}
+
+uint8_t
+CsiBuffer::GetNc() const
+{
+    return m_nc;
+}
+
+std::size_t
+CsiBuffer::GetCapacity() const
+{
+    return m_data.capacity();
+}
+
+uint8_t
+CsiBuffer::GetStStreamSnr(uint8_t stream) const
+{
+    NS_ASSERT(stream < m_nc);
+    return m_data[stream];
+}
+
+void
+CsiBuffer::SetStStreamSnr(uint8_t stream, uint8_t snr)
+{
+    NS_ASSERT(stream < m_nc);
+    m_data[stream] = snr;
+}
+
+uint16_t
+CsiBuffer::GetPhi(uint16_t subcarrier, uint8_t angle) const
+{
+    NS_ASSERT(subcarrier < m_ns && angle < m_na / 2);
+    return m_data[m_phiOffset + subcarrier * (m_na / 2) + angle];
+}
+
+void
+CsiBuffer::SetPhi(uint16_t subcarrier, uint8_t angle, uint16_t phi)
+{
+    NS_ASSERT(subcarrier < m_ns && angle < m_na / 2);
+    m_data[m_phiOffset + subcarrier * (m_na / 2) + angle] = phi;
+}
+
+uint16_t
+CsiBuffer::GetPsi(uint16_t subcarrier, uint8_t angle) const
+{
+    NS_ASSERT(subcarrier < m_ns && angle < m_na / 2);
+    return m_data[m_psiOffset + subcarrier * (m_na / 2) + angle];
+}
+
+void
+CsiBuffer::SetPsi(uint16_t subcarrier, uint8_t angle, uint16_t psi)
+{
+    NS_ASSERT(subcarrier < m_ns && angle < m_na / 2);
+    m_data[m_psiOffset + subcarrier * (m_na / 2) + angle] = psi;
+}
+
+uint8_t
+CsiBuffer::GetDeltaSnr(uint16_t subcarrier, uint8_t stream) const
+{
+    NS_ASSERT(subcarrier < m_ns && stream < m_nc);
+    return m_data[m_deltaOffset + subcarrier * m_nc + stream];
+}
+
+void
+CsiBuffer::SetDeltaSnr(uint16_t subcarrier, uint8_t stream, uint8_t deltaSnr)
+{
+    NS_ASSERT(subcarrier < m_ns && stream < m_nc);
+    m_data[m_deltaOffset + subcarrier * m_nc + stream] = deltaSnr;
+}
+
+uint16_t*
+CsiBuffer::GetStStreamSnrData()
+{
+    return m_data.data();
+}
+
+const uint16_t*
+CsiBuffer::GetStStreamSnrData() const
+{
+    return m_data.data();
+}
+
+uint16_t*
+CsiBuffer::GetPhiData()
+{
+    return m_data.data() + m_phiOffset;
+}
+
+const uint16_t*
+CsiBuffer::GetPhiData() const
+{
+    return m_data.data() + m_phiOffset;
+}
+
+uint16_t*
+CsiBuffer::GetPsiData()
+{
+    return m_data.data() + m_psiOffset;
+}
+
+const uint16_t*
+CsiBuffer::GetPsiData() const
+{
+    return m_data.data() + m_psiOffset;
+}
+
+uint16_t*
+CsiBuffer::GetDeltaSnrData()
+{
+    return m_data.data() + m_deltaOffset;
+}
+
+const uint16_t*
+CsiBuffer::GetDeltaSnrData() const
+{
+    return m_data.data() + m_deltaOffset;
+}
+
+/***********************************************************
+ *          CSI buffer pool
+ ***********************************************************/
+
+CsiBufferPool::CsiBufferPool()
+{
+}
+
+CsiBuffer
+CsiBufferPool::Acquire(uint16_t ns, uint8_t na, uint8_t nc)
+{
+    if (m_free.empty())
+    {
+        return CsiBuffer(ns, na, nc);
+    }
+    CsiBuffer buffer = std::move(m_free.back());
+    m_free.pop_back();
+    buffer.Reset(ns, na, nc);
+    return buffer;
+}
+
+void
+CsiBufferPool::Release(CsiBuffer&& buffer)
+{
+    buffer.Clear();
+    m_free.push_back(std::move(buffer));
+}
+
+std::size_t
+CsiBufferPool::GetNAvailable() const
+{
+    return m_free.size();
+}
+
+void
+CsiBufferPool::Clear()
+{
+    m_free.clear();
+}
+
+} // namespace ns3
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CSI_BUFFER_H
+#define CSI_BUFFER_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ *
+ * Channel state information carried by a single beamforming report, stored as a
+ * struct of arrays in one contiguous allocation. The storage is laid out as follows:
+ *
+ * | Average SNR (Nc) | Phi (Ns x Na/2) | Psi (Ns x Na/2) | Delta SNR (Ns x Nc) |
+ *
+ * where the angles and the delta SNR values of a subcarrier are stored next to each
+ * other. Resizing a buffer to dimensions that fit in the current capacity does not
+ * allocate, hence buffers can be reused across reports (see CsiBufferPool).
+ */
+class CsiBuffer
+{
+  public:
+    CsiBuffer();
+
+    /**
+     * Constructor
+     *
+     * \param ns the number of subcarriers
+     * \param na the number of angles (Phi and Psi) per subcarrier
+     * \param nc the number of columns in the compressed beamforming feedback matrix
+     */
+    CsiBuffer(uint16_t ns, uint8_t na, uint8_t nc);
+
+    /**
+     * Set the dimensions of the buffer and zero its content. No memory is allocated
+     * if the current capacity is large enough to hold the new dimensions.
+     *
+     * \param ns the number of subcarriers
+     * \param na the number of angles (Phi and Psi) per subcarrier
+     * \param nc the number of columns in the compressed beamforming feedback matrix
+     */
+    void Reset(uint16_t ns, uint8_t na, uint8_t nc);
+
+    /**
+     * Drop the content of the buffer while keeping the allocated storage.
+     */
+    void Clear();
+
+    /**
+     * \return whether the buffer holds no channel information
+     */
+    bool IsEmpty() const;
+
+    /**
+     * \return the number of subcarriers
+     */
+    uint16_t GetNs() const;
+
+    /**
+     * \return the number of angles (Phi and Psi) per subcarrier
+     */
+    uint8_t GetNa() const;
+
+    /**
+     * \return the number of columns in the compressed beamforming feedback matrix
+     */
+    uint8_t GetNc() const;
+
+    /**
+     * \return the number of values that can be stored without reallocation
+     */
+    std::size_t GetCapacity() const;
+
+    /**
+     * \param stream the index of the space-time stream
+     * \return the average SNR of the given space-time stream
+     */
+    uint8_t GetStStreamSnr(uint8_t stream) const;
+
+    /**
+     * \param stream the index of the space-time stream
+     * \param snr the average SNR of the given space-time stream
+     */
+    void SetStStreamSnr(uint8_t stream, uint8_t snr);
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param angle the index of the Phi angle (less than Na/2)
+     * \return the quantized Phi angle
+     */
+    uint16_t GetPhi(uint16_t subcarrier, uint8_t angle) const;
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param angle the index of the Phi angle (less than Na/2)
+     * \param phi the quantized Phi angle
+     */
+    void SetPhi(uint16_t subcarrier, uint8_t angle, uint16_t phi);
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param angle the index of the Psi angle (less than Na/2)
+     * \return the quantized Psi angle
+     */
+    uint16_t GetPsi(uint16_t subcarrier, uint8_t angle) const;
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param angle the index of the Psi angle (less than Na/2)
+     * \param psi the quantized Psi angle
+     */
+    void SetPsi(uint16_t subcarrier, uint8_t angle, uint16_t psi);
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param stream the index of the space-time stream
+     * \return the delta SNR of the given subcarrier and space-time stream
+     */
+    uint8_t GetDeltaSnr(uint16_t subcarrier, uint8_t stream) const;
+
+    /**
+     * \param subcarrier the index of the subcarrier
+     * \param stream the index of the space-time stream
+     * \param deltaSnr the delta SNR of the given subcarrier and space-time stream
+     */
+    void SetDeltaSnr(uint16_t subcarrier, uint8_t stream, uint8_t deltaSnr);
+
+    /**
+     * \return a pointer to the Nc average SNR values
+     */
+    uint16_t* GetStStreamSnrData();
+    /**
+     * \return a pointer to the Nc average SNR values
+     */
+    const uint16_t* GetStStreamSnrData() const;
+    /**
+     * \return a pointer to the Ns x Na/2 Phi angles, stored subcarrier by subcarrier
+     */
+    uint16_t* GetPhiData();
+    /**
+     * \return a pointer to the Ns x Na/2 Phi angles, stored subcarrier by subcarrier
+     */
+    const uint16_t* GetPhiData() const;
+    /**
+     * \return a pointer to the Ns x Na/2 Psi angles, stored subcarrier by subcarrier
+     */
+    uint16_t* GetPsiData();
+    /**
+     * \return a pointer to the Ns x Na/2 Psi angles, stored subcarrier by subcarrier
+     */
+    const uint16_t* GetPsiData() const;
+    /**
+     * \return a pointer to the Ns x Nc delta SNR values, stored subcarrier by subcarrier
+     */
+    uint16_t* GetDeltaSnrData();
+    /**
+     * \return a pointer to the Ns x Nc delta SNR values, stored subcarrier by subcarrier
+     */
+    const uint16_t* GetDeltaSnrData() const;
+
+  private:
+    uint16_t m_ns;               //!< the number of subcarriers
+    uint8_t m_na;                //!< the number of angles per subcarrier
+    uint8_t m_nc;                //!< the number of columns of the feedback matrix
+    std::size_t m_phiOffset;     //!< offset of the Phi angles in m_data
+    std::size_t m_psiOffset;     //!< offset of the Psi angles in m_data
+    std::size_t m_deltaOffset;   //!< offset of the delta SNR values in m_data
+    std::vector<uint16_t> m_data; //!< contiguous storage of all the fields
+};
+
+/**
+ * \ingroup wifi
+ *
+ * A pool of CsiBuffer objects. Buffers released to the pool keep their storage and are
+ * handed out again by Acquire, so that the channel information of successive reports
+ * does not cause any allocation once the pool is warm.
+ */
+class CsiBufferPool
+{
+  public:
+    CsiBufferPool();
+
+    /**
+     * Get a buffer with the given dimensions, reusing a released one if available.
+     *
+     * \param ns the number of subcarriers
+     * \param na the number of angles (Phi and Psi) per subcarrier
+     * \param nc the number of columns in the compressed beamforming feedback matrix
+     * \return a zeroed buffer with the given dimensions
+     */
+    CsiBuffer Acquire(uint16_t ns, uint8_t na, uint8_t nc);
+
+    /**
+     * Return a buffer to the pool.
+     *
+     * \param buffer the buffer to return
+     */
+    void Release(CsiBuffer&& buffer);
+
+    /**
+     * \return the number of buffers currently available in the pool
+     */
+    std::size_t GetNAvailable() const;
+
+    /**
+     * Drop all the buffers held by the pool.
+     */
+    void Clear();
+
+  private:
+    std::vector<CsiBuffer> m_free; //!< buffers available for reuse
+};
+
+} // namespace ns3
+
+#endif /* CSI_BUFFER_H */
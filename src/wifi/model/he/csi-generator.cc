@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "csi-generator.h"
+
+#include "ns3/log.h"
+#include "ns3/mgt-headers.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("CsiGenerator");
+
+/***********************************************************
+ *          CSI generator
+ ***********************************************************/
+NS_OBJECT_ENSURE_REGISTERED(CsiGenerator);
+
+TypeId
+CsiGenerator::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::CsiGenerator").SetParent<Object>().SetGroupName("Wifi");
+    return tid;
+}
+
+CsiGenerator::CsiGenerator()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+CsiGenerator::~CsiGenerator()
+{
+    NS_LOG_FUNCTION_NOARGS();
+}
+
+/***********************************************************
+ *          Random CSI generator
+ ***********************************************************/
+NS_OBJECT_ENSURE_REGISTERED(RandomCsiGenerator);
+
+TypeId
+RandomCsiGenerator::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::RandomCsiGenerator")
+                            .SetParent<CsiGenerator>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<RandomCsiGenerator>();
+    return tid;
+}
+
+RandomCsiGenerator::RandomCsiGenerator()
+    : m_rng(CreateObject<UniformRandomVariable>()),
+      m_word(0),
+      m_nBits(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+RandomCsiGenerator::~RandomCsiGenerator()
+{
+    NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+RandomCsiGenerator::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_rng = nullptr;
+    CsiGenerator::DoDispose();
+}
+
+int64_t
+RandomCsiGenerator::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_rng->SetStream(stream);
+    // drop the bits drawn from the previous stream
+    m_nBits = 0;
+    return 1;
+}
+
+void
+RandomCsiGenerator::FillUniform(uint16_t* values, std::size_t count, uint8_t bits)
+{
+    NS_ASSERT(bits > 0 && bits <= 16);
+    const uint32_t mask = (1U << bits) - 1;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (m_nBits < bits)
+        {
+            m_word = m_rng->GetInteger(0, 0xffffffff);
+            m_nBits = 32;
+        }
+        values[i] = static_cast<uint16_t>(m_word & mask);
+        m_word >>= bits;
+        m_nBits -= bits;
+    }
+}
+
+void
+RandomCsiGenerator::Generate(const HeMimoControlHeader& heMimoControlHeader,
+                             Mac48Address transmitter,
+                             CsiBuffer& channelInfo)
+{
+    NS_LOG_FUNCTION(this << transmitter);
+    auto [bits1, bits2] = HeCompressedBfReport::GetAngleBits(heMimoControlHeader);
+
+    const std::size_t nAngles = static_cast<std::size_t>(channelInfo.GetNs()) *
+                                (channelInfo.GetNa() / 2);
+    const std::size_t nDeltaSnr =
+        static_cast<std::size_t>(channelInfo.GetNs()) * channelInfo.GetNc();
+
+    FillUniform(channelInfo.GetStStreamSnrData(), channelInfo.GetNc(), 8);
+    FillUniform(channelInfo.GetPhiData(), nAngles, bits1);
+    FillUniform(channelInfo.GetPsiData(), nAngles, bits2);
+    FillUniform(channelInfo.GetDeltaSnrData(), nDeltaSnr, 4);
+}
+
+} // namespace ns3
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CSI_GENERATOR_H
+#define CSI_GENERATOR_H
+
+#include "csi-buffer.h"
+
+#include "ns3/mac48-address.h"
+#include "ns3/object.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ns3
+{
+
+class HeMimoControlHeader;
+class UniformRandomVariable;
+
+/**
+ * \ingroup wifi
+ *
+ * Base class for the generation of the channel information that a beamformee reports
+ * in response to an NDP.
+ */
+class CsiGenerator : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    CsiGenerator();
+    ~CsiGenerator() override;
+
+    /**
+     * Fill the given buffer with channel information. The buffer has already been reset to
+     * the dimensions (Ns, Na and Nc) determined by the HE MIMO Control field.
+     *
+     * \param heMimoControlHeader the HE MIMO Control field of the beamforming report
+     * \param transmitter the MAC address of the transmitter of the measured NDP
+     * \param channelInfo the buffer to fill
+     */
+    virtual void Generate(const HeMimoControlHeader& heMimoControlHeader,
+                          Mac48Address transmitter,
+                          CsiBuffer& channelInfo) = 0;
+
+    /**
+     * Assign a fixed random variable stream number to the random variables used by this
+     * generator. Return the number of streams (possibly zero) that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this generator
+     */
+    virtual int64_t AssignStreams(int64_t stream) = 0;
+};
+
+/**
+ * \ingroup wifi
+ *
+ * Generate channel information made of uniformly distributed quantized values. A single
+ * random variable is used for the lifetime of the generator and each 32-bit draw is split
+ * into as many fields as it can hold, so that a whole report only costs a few draws per
+ * subcarrier and seeded runs produce identical reports.
+ */
+class RandomCsiGenerator : public CsiGenerator
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    RandomCsiGenerator();
+    ~RandomCsiGenerator() override;
+
+    void Generate(const HeMimoControlHeader& heMimoControlHeader,
+                  Mac48Address transmitter,
+                  CsiBuffer& channelInfo) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * Fill a block of values with uniformly distributed integers of the given width.
+     *
+     * \param values pointer to the first value to fill
+     * \param count the number of values to fill
+     * \param bits the width in bits (at most 16) of each value
+     */
+    void FillUniform(uint16_t* values, std::size_t count, uint8_t bits);
+
+    Ptr<UniformRandomVariable> m_rng; //!< random variable used to draw 32-bit words
+    uint32_t m_word;                  //!< random bits not consumed yet
+    uint8_t m_nBits;                  //!< number of random bits not consumed yet in m_word
+};
+
+} // namespace ns3
+
+#endif /* CSI_GENERATOR_H */
@@ -76,20 +76,40 @@ HeFrameExchangeManager::GetTypeId()
                           "If enabled, the duration of channel sounding process will be printed.",
                           BooleanValue(false),
                           MakeBooleanAccessor(&HeFrameExchangeManager::m_csDurationOutput),
-                          MakeBooleanChecker())
+                          MakeBooleanChecker(),
+                          TypeId::DEPRECATED,
+                          "The duration of the channel sounding process is logged at the INFO "
+                          "level; use the SensingPhase trace source to collect it")
             .AddAttribute(
                 "ChannelSoundingWifiMode",
                 "Wifi mode used for beamforming report feedback (If set as '0', wifi mode is "
                 "automatically selected as the same mode as in data transmission)",
                 StringValue("0"),
                 MakeStringAccessor(&HeFrameExchangeManager::m_csMode),
-                MakeStringChecker());
+                MakeStringChecker())
+            .AddTraceSource("BfReportReceived",
+                            "A beamforming report has been received from a station taking part "
+                            "in the ongoing channel sounding.",
+                            MakeTraceSourceAccessor(&HeFrameExchangeManager::m_bfReportRxTrace),
+                            "ns3::HeFrameExchangeManager::BfReportReceivedCallback")
+            .AddTraceSource("R2iNdpReceived",
+                            "An R2I NDP has been received from the station taking part in the "
+                            "ongoing non-TB sensing sounding.",
+                            MakeTraceSourceAccessor(&HeFrameExchangeManager::m_r2iNdpRxTrace),
+                            "ns3::HeFrameExchangeManager::BfReportReceivedCallback")
+            .AddTraceSource("SensingPhase",
+                            "A phase of a sensing measurement instance driven by this Frame "
+                            "Exchange Manager (AP) or taken part in (STA) started, completed, "
+                            "timed out, collided or was aborted.",
+                            MakeTraceSourceAccessor(&HeFrameExchangeManager::m_sensingPhaseTrace),
+                            "ns3::ApWifiMac::SensingPhaseCallback");
     return tid;
 }
 
 HeFrameExchangeManager::HeFrameExchangeManager()
     : m_intraBssNavEnd(0),
-      m_triggerFrameInAmpdu(false)
+      m_triggerFrameInAmpdu(false),
+      m_sensingInstanceId(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -133,12 +153,12 @@ HeFrameExchangeManager::SetWifiMac(const Ptr<WifiMac> mac)
     // CsBeamformee
     if (m_apMac != nullptr)
     {
-        m_csBeamformer = Create<CsBeamformer>();
+        m_csBeamformer = CreateObject<CsBeamformer>();
         m_csBeamformee = nullptr;
     }
     if (m_staMac != nullptr)
     {
-        m_csBeamformee = Create<CsBeamformee>();
+        m_csBeamformee = CreateObject<CsBeamformee>();
         m_csBeamformer = nullptr;
     }
 }
@@ -1586,7 +1606,7 @@ HeFrameExchangeManager::TbPpduTimeout(WifiPsduMap* psduMap, std::size_t nSolicit
         if (m_apMac && m_apMac->GetPcfSupported())
         {
             ResetSensingTimeout();
-            // std::cout << "--- Collision in polling phase ---" << std::endl;
+            NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::COLLISION);
             m_apMac->SensingRetransmission();
         }
         else
@@ -1601,7 +1621,7 @@ HeFrameExchangeManager::TbPpduTimeout(WifiPsduMap* psduMap, std::size_t nSolicit
         if (m_apMac && m_apMac->GetPcfSupported())
         {
             ResetSensingTimeout();
-            // std::cout << "--- Collision in polling phase ---" << std::endl;
+            NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::TIMEOUT);
             m_apMac->SensingRetransmission();
         }
         else
@@ -2612,34 +2632,25 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                                                    staId) != m_csBeamformer->GetCsStaIdList().end())
         {
             m_csBeamformer->GetBfReportInfo(mpdu, staId);
+            m_bfReportRxTrace(mpdu, staId);
+            m_apMac->ForwardSbpReport(mpdu);
             std::list<uint16_t> sta = m_csBeamformer->CheckAllChannelInfoReceived();
             if (sta.empty())
             {
                 NS_LOG_INFO("Receive CSI from all stations. Channel sounding process ends.");
                 m_txTimer.Cancel();
+                NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::COMPLETE);
                 m_csBeamformer->SetNdpaSent(false);
                 m_csBeamformer->SetNdpSent(false);
 
-                NS_LOG_DEBUG("Duration of channel sounding process: "
-                             << (Simulator::Now()).GetNanoSeconds() - m_lastCsTime.GetNanoSeconds()
-                             << ", Number of stations: " << m_csBeamformer->GetNumCsStations());
-
-                if (m_csDurationOutput)
-                {
-                    std::cout << "Duration of channel sounding process: "
-                              << ((Simulator::Now()).GetNanoSeconds() -
-                                  m_lastCsTime.GetNanoSeconds()) /
-                                     1000000.0
-                              << "ms, Number of stations: "
-                              << std::to_string(m_csBeamformer->GetNumCsStations()) << std::endl;
-                }
+                NS_LOG_INFO("Duration of channel sounding process: "
+                            << (Simulator::Now() - m_lastCsTime).As(Time::MS)
+                            << ", Number of stations: " << m_csBeamformer->GetNumCsStations());
 
                 if (m_apMac->GetPcfSupported() &&
                     (m_apMac->GetRemainingCfpDuration()).IsStrictlyPositive())
                 {
-                    if (m_muScheduler->GetSoundingType() == 0U &&
-                        m_muScheduler->DoSUNDPASoundingStation() &&
-                        m_muScheduler->GetPollingCandidatesSize() != 1)
+                    if (m_muScheduler->NextSoundingRound())
                     {
                         Simulator::Schedule(m_phy->GetSifs(),
                                             &HeFrameExchangeManager::StartFrameExchange,
@@ -2671,12 +2682,36 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
 
         return;
     }
+    // Changes to add support for IEEE 802.11bf : R2I NDP received in a non-TB sensing sounding
+    if (hdr.IsNdp() && m_apMac != nullptr && m_csBeamformer != nullptr &&
+        m_csBeamformer->IsNonTbSounding() && m_txTimer.IsRunning() &&
+        m_txTimer.GetReason() == WifiTxTimer::WAIT_BF_REPORT_AFTER_NDP)
+    {
+        uint16_t staId = m_apMac->GetAssociationId(hdr.GetAddr2(), m_linkId);
+        const auto staIdList = m_csBeamformer->GetCsStaIdList();
+        if (std::find(staIdList.begin(), staIdList.end(), staId) != staIdList.end())
+        {
+            m_csBeamformer->GetR2iNdpInfo(txVector, staId, hdr.GetAddr2());
+            m_r2iNdpRxTrace(mpdu, staId);
+
+            // the beamforming report follows the R2I NDP after a SIFS
+            WifiMacHeader reportHdr(WIFI_MAC_QOSDATA);
+            reportHdr.SetAddr1(GetAddress());
+            reportHdr.SetAddr2(hdr.GetAddr2());
+            WifiTxVector reportTxVector =
+                GetWifiRemoteStationManager()->GetDataTxVector(reportHdr, m_allowedWidth);
+            m_txTimer.Reschedule(m_phy->GetSifs() + m_phy->GetSlot() +
+                                 m_phy->CalculatePhyPreambleAndHeaderDuration(reportTxVector));
+        }
+        return;
+    }
     // Changes to add support for IEEE 802.11bf : add condition for case NDP frame is received
     if (hdr.IsNdp() && m_staMac != nullptr && m_csBeamformee != nullptr &&
         m_csBeamformee->IsNdpaReceived())
     {
         uint16_t staId = m_staMac->GetAssociationId();
         m_csBeamformee->GetNdpInfo(txVector, staId);
+        NotifySensingPhase(SensingPhase::NDP, SensingPhaseEvent::COMPLETE);
         m_csBeamformee->GenerateBfReport(staId, hdr.GetAddr2(), m_staMac->GetAddress(), m_bssid);
         if (mpdu->GetHeader().GetAddr1().IsBroadcast())
         {
@@ -2690,31 +2725,22 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
 
         if (m_csBeamformee->GetHeMimoControlHeader().GetFeedbackType() == HeMimoControlHeader::SU)
         {
-            m_txParams.Clear();
-            auto heConfiguration = m_mac->GetHeConfiguration();
-
-            WifiMacHeader hdr = m_csBeamformee->GetBfReport()->GetHeader();
-            hdr.SetType(WIFI_MAC_QOSDATA);
-            WifiTxVector suTxVector =
-                m_staMac->GetWifiRemoteStationManager()->GetDataTxVector(hdr, m_allowedWidth);
-            WifiMode csMode = m_csMode == "0" ? suTxVector.GetMode() : WifiMode(m_csMode);
-            suTxVector.SetMode(csMode);
-            suTxVector.SetNss(1);
-            m_txParams.m_txVector = suTxVector;
-
-            m_txParams.m_acknowledgment = std::unique_ptr<WifiAcknowledgment>(new WifiNoAck());
-            m_txParams.m_protection = std::unique_ptr<WifiProtection>(new WifiNoProtection());
-
-            m_txParams.AddMpdu(m_csBeamformee->GetBfReport());
-            UpdateTxDuration(m_csBeamformee->GetBfReport()->GetHeader().GetAddr1(), m_txParams);
-
-            Simulator::Schedule(
-                m_phy->GetSifs(),
-                &HeFrameExchangeManager::SendPsduMapWithProtection,
-                this,
-                WifiPsduMap{
-                    {staId, GetWifiPsdu(m_csBeamformee->GetBfReport(), m_txParams.m_txVector)}},
-                m_txParams);
+            if (m_csBeamformee->IsNonTbSounding())
+            {
+                Simulator::Schedule(m_phy->GetSifs(),
+                                    &HeFrameExchangeManager::SendR2iNdp,
+                                    this,
+                                    staId,
+                                    hdr.GetAddr2(),
+                                    txVector);
+            }
+            else
+            {
+                Simulator::Schedule(m_phy->GetSifs(),
+                                    &HeFrameExchangeManager::SendBfReport,
+                                    this,
+                                    staId);
+            }
         }
         return;
     }
@@ -2751,6 +2777,7 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                 {
                     // // we do not expect any other response
                     m_txTimer.Cancel();
+                    NotifySensingPhase(SensingPhase::POLLING, SensingPhaseEvent::COMPLETE);
                     return;
                 }
             }
@@ -3161,6 +3188,11 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
             {
                 m_csBeamformee->SetNdpaReceived(true);
                 m_csBeamformee->GetNdpaInfo(mpdu, staId);
+                // the Sounding Dialog Token carries the instance ID modulo 64: advance to the
+                // first instance ID not lower than the previous one that matches the token
+                m_sensingInstanceId +=
+                    (ndpaHeader.GetSoundingDialogToken() - m_sensingInstanceId) & 0x3f;
+                NotifySensingPhase(SensingPhase::NDPA_SOUNDING, SensingPhaseEvent::COMPLETE);
                 if (mpdu->GetHeader().GetAddr1().IsBroadcast())
                 {
                     NS_LOG_INFO("|");
@@ -3367,9 +3399,69 @@ HeFrameExchangeManager::ReceiveBfrpTrigger(const CtrlTriggerHeader& trigger,
 
     Ptr<WifiPsdu> psdu;
     psdu = GetWifiPsdu(m_csBeamformee->GetBfReport(), m_txParams.m_txVector);
+    NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::START);
     SendPsduMapWithProtection(WifiPsduMap{{staId, psdu}}, m_txParams);
 }
 
+void
+HeFrameExchangeManager::SendBfReport(uint16_t staId)
+{
+    NS_LOG_FUNCTION(this << staId);
+
+    WifiTxParameters txParams;
+
+    WifiMacHeader hdr = m_csBeamformee->GetBfReport()->GetHeader();
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    WifiTxVector suTxVector =
+        m_staMac->GetWifiRemoteStationManager()->GetDataTxVector(hdr, m_allowedWidth);
+    WifiMode csMode = m_csMode == "0" ? suTxVector.GetMode() : WifiMode(m_csMode);
+    suTxVector.SetMode(csMode);
+    suTxVector.SetNss(1);
+    txParams.m_txVector = suTxVector;
+
+    txParams.m_acknowledgment = std::unique_ptr<WifiAcknowledgment>(new WifiNoAck());
+    txParams.m_protection = std::unique_ptr<WifiProtection>(new WifiNoProtection());
+
+    txParams.AddMpdu(m_csBeamformee->GetBfReport());
+    UpdateTxDuration(m_csBeamformee->GetBfReport()->GetHeader().GetAddr1(), txParams);
+
+    NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::START);
+    SendPsduMapWithProtection(
+        WifiPsduMap{{staId, GetWifiPsdu(m_csBeamformee->GetBfReport(), txParams.m_txVector)}},
+        txParams);
+}
+
+void
+HeFrameExchangeManager::SendR2iNdp(uint16_t staId, Mac48Address apAddress, WifiTxVector i2rTxVector)
+{
+    NS_LOG_FUNCTION(this << staId << apAddress << i2rTxVector);
+
+    WifiMacHeader hdrNdp(WIFI_MAC_DATA_NULL);
+    hdrNdp.SetAddr1(apAddress);
+    hdrNdp.SetAddr2(m_self);
+    hdrNdp.SetAddr3(m_bssid);
+    hdrNdp.SetDsNotTo();
+    hdrNdp.SetDsNotFrom();
+    auto ndp = Create<WifiMpdu>(Create<Packet>(), hdrNdp);
+
+    // the R2I NDP uses the same format as the I2R NDP and sounds all the antennas of this station
+    WifiTxParameters txParams;
+    txParams.m_txVector = i2rTxVector;
+    txParams.m_txVector.SetNTx(m_phy->GetNumberOfAntennas());
+    txParams.m_txVector.SetNss(m_phy->GetMaxSupportedTxSpatialStreams());
+    txParams.m_acknowledgment = std::unique_ptr<WifiAcknowledgment>(new WifiNoAck());
+    txParams.m_protection = std::unique_ptr<WifiProtection>(new WifiNoProtection());
+    txParams.AddMpdu(ndp);
+    UpdateTxDuration(apAddress, txParams);
+
+    Simulator::Schedule(txParams.m_txDuration + m_phy->GetSifs(),
+                        &HeFrameExchangeManager::SendBfReport,
+                        this,
+                        staId);
+    SendPsduMapWithProtection(WifiPsduMap{{staId, GetWifiPsdu(ndp, txParams.m_txVector)}},
+                              txParams);
+}
+
 void
 HeFrameExchangeManager::BfReportTimeout(void)
 {
@@ -3382,10 +3474,10 @@ HeFrameExchangeManager::BfReportTimeout(void)
 
         if (sta.size() == m_csBeamformer->GetNumCsStations())
         {
+            NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::COLLISION);
             if (m_apMac && m_edca && m_apMac->GetPcfSupported())
             {
                 ResetSensingTimeout();
-                // std::cout << "--- Collision in reporting phase ---" << std::endl;
                 m_apMac->SensingRetransmission();
             }
             else
@@ -3396,10 +3488,10 @@ HeFrameExchangeManager::BfReportTimeout(void)
         }
         else
         {
+            NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::TIMEOUT);
             if (m_apMac && m_edca && m_apMac->GetPcfSupported())
             {
                 ResetSensingTimeout();
-                // std::cout << "--- Collision in reporting phase ---" << std::endl;
                 m_apMac->SensingRetransmission();
             }
             else
@@ -3418,7 +3510,8 @@ void
 HeFrameExchangeManager::SendCsFramesFromBeamformer()
 {
     m_csBeamformer->SetNdpaSent(true);
-    SendPsduMapWithProtection(
+    SendSoundingFrame(
+        SensingPhase::NDPA_SOUNDING,
         WifiPsduMap{
             {SU_STA_ID,
              GetWifiPsdu(m_csBeamformer->GetBeamformerFrameInfo().m_ndpa,
@@ -3429,8 +3522,9 @@ HeFrameExchangeManager::SendCsFramesFromBeamformer()
 
     Simulator::Schedule(
         ndpTime,
-        &HeFrameExchangeManager::SendPsduMapWithProtection,
+        &HeFrameExchangeManager::SendSoundingFrame,
         this,
+        SensingPhase::NDP,
         WifiPsduMap{
             {SU_STA_ID,
              GetWifiPsdu(m_csBeamformer->GetBeamformerFrameInfo().m_ndp,
@@ -3443,8 +3537,9 @@ HeFrameExchangeManager::SendCsFramesFromBeamformer()
                        m_phy->GetSifs();
         Simulator::Schedule(
             TF_time,
-            &HeFrameExchangeManager::SendPsduMapWithProtection,
+            &HeFrameExchangeManager::SendSoundingFrame,
             this,
+            SensingPhase::BFRP_TRIGGER,
             WifiPsduMap{
                 {SU_STA_ID,
                  GetWifiPsdu(
@@ -3454,6 +3549,48 @@ HeFrameExchangeManager::SendCsFramesFromBeamformer()
     }
 }
 
+void
+HeFrameExchangeManager::SendSoundingFrame(SensingPhase phase,
+                                          WifiPsduMap psduMap,
+                                          WifiTxParameters& txParams)
+{
+    NS_LOG_FUNCTION(this << phase);
+    NotifySensingPhase(phase, SensingPhaseEvent::START);
+    // txParams may be moved from when the PSDU map is sent
+    Simulator::Schedule(txParams.m_txDuration,
+                        &HeFrameExchangeManager::SoundingFrameSent,
+                        this,
+                        phase);
+    SendPsduMapWithProtection(psduMap, txParams);
+}
+
+void
+HeFrameExchangeManager::SoundingFrameSent(SensingPhase phase)
+{
+    NS_LOG_FUNCTION(this << phase);
+    NotifySensingPhase(phase, SensingPhaseEvent::COMPLETE);
+    if (phase == SensingPhase::BFRP_TRIGGER ||
+        (phase == SensingPhase::NDP && m_csBeamformer->GetNumCsStations() == 1))
+    {
+        NotifySensingPhase(SensingPhase::REPORT, SensingPhaseEvent::START);
+    }
+}
+
+void
+HeFrameExchangeManager::NotifySensingPhase(SensingPhase phase, SensingPhaseEvent event)
+{
+    NS_LOG_FUNCTION(this << phase << event);
+    if (m_apMac)
+    {
+        m_sensingPhaseTrace(m_apMac->GetSensingInstanceId(), phase, event, Simulator::Now());
+        m_apMac->NotifySensingPhase(phase, event);
+    }
+    else
+    {
+        m_sensingPhaseTrace(m_sensingInstanceId, phase, event, Simulator::Now());
+    }
+}
+
 Ptr<CsBeamformer>
 HeFrameExchangeManager::GetCsBeamformer() const
 {
@@ -22,7 +22,9 @@
 
 #include "channel-sounding.h"
 #include "mu-snr-tag.h"
+#include "sensing-phase.h"
 
+#include "ns3/traced-callback.h"
 #include "ns3/vht-frame-exchange-manager.h"
 
 #include <map>
@@ -176,6 +178,14 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
      */
     void ResetSensingTimeout();
 
+    /**
+     * TracedCallback signature for the reception of beamforming reports by a beamformer.
+     *
+     * \param mpdu the MPDU carrying the beamforming report
+     * \param staId the AID of the station that sent the beamforming report
+     */
+    typedef void (*BfReportReceivedCallback)(Ptr<const WifiMpdu> mpdu, uint16_t staId);
+
   protected:
     void DoDispose() override;
     void Reset() override;
@@ -443,13 +453,59 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
      * \param hdr the MAC header of the BFRP Trigger Frame
      */
     void ReceiveBfrpTrigger(const CtrlTriggerHeader& trigger, const WifiMacHeader& hdr);
+    /**
+     * Send the SU beamforming report (or "no change" report) generated by the beamformee.
+     *
+     * \param staId the STA ID of this station
+     */
+    void SendBfReport(uint16_t staId);
+    /**
+     * Send the R2I NDP of a non-TB sensing sounding in response to the I2R NDP and schedule
+     * the transmission of the beamforming report a SIFS after the end of the R2I NDP.
+     *
+     * \param staId the STA ID of this station
+     * \param apAddress the MAC address of the AP that sent the I2R NDP
+     * \param i2rTxVector the TXVECTOR of the I2R NDP
+     */
+    void SendR2iNdp(uint16_t staId, Mac48Address apAddress, WifiTxVector i2rTxVector);
     /**
      * Take the necessary actions after that some beamforming reports are missing.
      */
     void BfReportTimeout(void);
+    /**
+     * Transmit a frame of the channel sounding sequence (NDPA, NDP or BFRP Trigger Frame)
+     * and fire the SensingPhase trace source when the transmission starts and ends.
+     *
+     * \param phase the sensing phase corresponding to the frame
+     * \param psduMap the PSDU map to transmit
+     * \param txParams the TX parameters to use to transmit the PSDU map
+     */
+    void SendSoundingFrame(SensingPhase phase, WifiPsduMap psduMap, WifiTxParameters& txParams);
+    /**
+     * Called when the transmission of a frame of the channel sounding sequence ends.
+     * The reporting phase starts after the last frame of the sequence.
+     *
+     * \param phase the sensing phase corresponding to the frame
+     */
+    void SoundingFrameSent(SensingPhase phase);
+    /**
+     * Fire the SensingPhase trace sources of this Frame Exchange Manager and of the AP.
+     * On a STA, the instance ID is the one announced by the last NDPA addressed to the STA.
+     *
+     * \param phase the sensing phase
+     * \param event the event that occurred in the given phase
+     */
+    void NotifySensingPhase(SensingPhase phase, SensingPhaseEvent event);
     Time m_lastCsTime;       //!< Duration of channel sounding process
     bool m_csDurationOutput; //!< Whether to output the duration of channel sounding process
     std::string m_csMode;    //! Wifi mode used for beamforming report feedback
+    TracedCallback<Ptr<const WifiMpdu>, uint16_t>
+        m_bfReportRxTrace; //!< Trace source fired when a beamforming report is received
+    TracedCallback<Ptr<const WifiMpdu>, uint16_t>
+        m_r2iNdpRxTrace; //!< Trace source fired when an R2I NDP is received
+    TracedCallback<uint32_t, SensingPhase, SensingPhaseEvent, Time>
+        m_sensingPhaseTrace; //!< Trace source fired on the phases of sensing instances
+    uint32_t m_sensingInstanceId; //!< ID of the sensing instance of the last NDPA (STA only)
     bool m_NDPA_Sounding_mutex = 0;
     bool m_Polling_Receive_mutex = 0;
 };
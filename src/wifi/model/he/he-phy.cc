@@ -795,8 +795,7 @@ HePhy::DoStartReceivePayload(Ptr<Event> event)
 
     if (txVector.IsDlMu())
     {
-        Time payloadDuration =
-            ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
+        Time payloadDuration = ppdu->GetTxDuration() - ppdu->GetPreambleAndHeaderDuration();
         NotifyPayloadBegin(txVector, payloadDuration);
         return payloadDuration;
     }
@@ -951,8 +950,7 @@ HePhy::StartReceiveMuPayload(Ptr<Event> event)
     NS_ASSERT(itEvent != m_beginMuPayloadRxEvents.end() && itEvent->second.IsExpired());
     m_beginMuPayloadRxEvents.erase(itEvent);
 
-    Time payloadDuration =
-        ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(ppdu->GetTxVector());
+    Time payloadDuration = ppdu->GetTxDuration() - ppdu->GetPreambleAndHeaderDuration();
     Ptr<const WifiPsdu> psdu = GetAddressedPsduInPpdu(ppdu);
     ScheduleEndOfMpdus(event);
     m_endRxPayloadEvents.push_back(
@@ -311,7 +311,7 @@ HePpdu::SetHeMuUserInfos(WifiTxVector& txVector,
 }
 
 Time
-HePpdu::GetTxDuration() const
+HePpdu::DoGetTxDuration() const
 {
     Time ppduDuration = Seconds(0);
     const auto& txVector = GetTxVector();
@@ -463,6 +463,8 @@ HePpdu::UpdateTxVectorForUlMu(const std::optional<WifiTxVector>& trigVector) con
     }
     NS_ASSERT(GetModulation() >= WIFI_MOD_CLASS_HE);
     NS_ASSERT(GetType() == WIFI_PPDU_TYPE_UL_MU);
+    // the values derived from the TXVECTOR depend on the information added below
+    m_txInfo = {};
     // HE TB PPDU reception needs information from the TRIGVECTOR to be able to receive the PPDU
     const auto staId = GetStaId();
     if (trigVector.has_value() && trigVector->IsUlMu() &&
@@ -150,7 +150,6 @@ class HePpdu : public OfdmPpdu
            uint64_t uid,
            TxPsdFlag flag);
 
-    Time GetTxDuration() const override;
     Ptr<WifiPpdu> Copy() const override;
     WifiPpduType GetType() const override;
     uint16_t GetStaId() const override;
@@ -322,6 +321,7 @@ class HePpdu : public OfdmPpdu
   private:
     std::string PrintPayload() const override;
     WifiTxVector DoGetTxVector() const override;
+    Time DoGetTxDuration() const override;
 
     /**
      * Fill in the PHY headers.
@@ -392,4 +392,11 @@ void MultiUserScheduler::SensingTimeout()
     m_lastTxInfo[0U].lastTxFormat = NO_TX;
 }
 
+int64_t
+MultiUserScheduler::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return 0;
+}
+
 } // namespace ns3
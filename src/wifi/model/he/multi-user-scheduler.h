@@ -177,12 +177,29 @@ class MultiUserScheduler : public Object
 
     // modification for 11bf Polling Phase
     virtual void CheckRespondedPollingStation(Mac48Address address) = 0;
-    virtual bool DoSUNDPASoundingStation() = 0;
+    /**
+     * Select the stations to sound in the next round of the sounding schedule of the
+     * current CFP.
+     *
+     * \return false if all the rounds of the sounding schedule have been performed
+     */
+    virtual bool NextSoundingRound() = 0;
     virtual ns3::MultiUserScheduler::SoundingType GetSoundingType() = 0;
     virtual size_t GetPollingCandidatesSize() = 0;
-    bool m_nextSUSounding = 0; //!< Indicates next SU Sounding is still required>
+    bool m_nextSoundingRound = 0; //!< Indicates another sounding round is still required
     void SensingTimeout();
 
+    /**
+     * Assign a fixed random variable stream number to the random variables
+     * used by this scheduler. Return the number of streams (possibly zero) that
+     * have been assigned.
+     *
+     * \param stream first stream index to use.
+     *
+     * \return the number of stream indices assigned by this scheduler.
+     */
+    virtual int64_t AssignStreams(int64_t stream);
+
   protected:
     /**
      * Get the station manager attached to the AP on the given link.
@@ -126,16 +126,26 @@ RrMultiUserScheduler::GetTypeId()
                           "The type of sounding to be used",
                           UintegerValue(2),
                           MakeUintegerAccessor(&RrMultiUserScheduler::m_soundingType),
-                          MakeUintegerChecker<uint8_t>(0, 2));
+                          MakeUintegerChecker<uint8_t>(0, 2))
+            .AddAttribute("MaxSoundingGroupSize",
+                          "The maximum number of stations sounded by the same NDPA when MU "
+                          "sounding is used. The number of stations is further limited by the "
+                          "number of RUs available for the BFRP Trigger Frame.",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&RrMultiUserScheduler::m_maxSoundingGroupSize),
+                          MakeUintegerChecker<uint16_t>(1, 74));
     return tid;
 }
 
 RrMultiUserScheduler::RrMultiUserScheduler()
     // attempt to add Channel Sounding from ns3.37 : modification in constructor for initial values
-    : m_nssPerSta(1),
+    : m_soundingGroupsDirty(true),
+      m_soundingRound(0),
+      m_nssPerSta(1),
       m_csStart(false)
 {
     NS_LOG_FUNCTION(this);
+    m_soundingRandom = CreateObject<UniformRandomVariable>();
 }
 
 RrMultiUserScheduler::~RrMultiUserScheduler()
@@ -161,6 +171,14 @@ RrMultiUserScheduler::DoInitialize()
     MultiUserScheduler::DoInitialize();
 }
 
+int64_t
+RrMultiUserScheduler::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_soundingRandom->SetStream(stream);
+    return 1;
+}
+
 void
 RrMultiUserScheduler::DoDispose()
 {
@@ -169,6 +187,7 @@ RrMultiUserScheduler::DoDispose()
     m_staListUl.clear();
     m_candidates.clear();
     m_txParams.Clear();
+    m_soundingRandom = nullptr;
     m_apMac->TraceDisconnectWithoutContext(
         "AssociatedSta",
         MakeCallback(&RrMultiUserScheduler::NotifyStationAssociated, this));
@@ -196,25 +215,14 @@ RrMultiUserScheduler::SelectTxFormat()
         {
             if (IsChannelSoundingEnabled())
             {
-                if (m_soundingType == SU_only)
+                if (GetLastTxFormat(0U) == BF_POLL_DL_TX)
                 {
-                    if (GetLastTxFormat(0U) == BF_POLL_DL_TX)
-                    {
-                        return TryNDPASoundingPhase11bf();
-                    }
-                    else if (GetLastTxFormat(0U) == BF_NDPA_SOUNDING_TX_SU)
-                    {
-                        if (m_nextSUSounding)
-                        {
-                            return TryNDPASoundingPhase11bf();
-                        }
-                        else
-                        {
-                            return TryPollingPhase11bf();
-                        }
-                    }
+                    BuildSoundingSchedule();
+                    return TryNDPASoundingPhase11bf();
                 }
-                else if (GetLastTxFormat(0U) == BF_POLL_DL_TX)
+                else if ((GetLastTxFormat(0U) == BF_NDPA_SOUNDING_TX_SU ||
+                          GetLastTxFormat(0U) == BF_NDPA_SOUNDING_TX) &&
+                         m_nextSoundingRound)
                 {
                     return TryNDPASoundingPhase11bf();
                 }
@@ -638,6 +646,7 @@ RrMultiUserScheduler::NotifyStationAssociated(uint16_t aid, Mac48Address address
     {
         m_staListUl.push_back(MasterInfo{aid, *mldOrLinkAddress, 0.0});
     }
+    m_soundingGroupsDirty = true;
 }
 
 void
@@ -664,6 +673,7 @@ RrMultiUserScheduler::NotifyStationDeassociated(uint16_t aid, Mac48Address addre
         staList.second.remove_if([&aid](const MasterInfo& info) { return info.aid == aid; });
     }
     m_staListUl.remove_if([&aid](const MasterInfo& info) { return info.aid == aid; });
+    m_soundingGroupsDirty = true;
 }
 
 MultiUserScheduler::TxFormat
@@ -1067,7 +1077,9 @@ RrMultiUserScheduler::TryPollingPhase11bf()
 
     // Clear candidates for NDPA Sounding Phase
     m_candidatesCs.clear();
-    m_candidatesCsSU.clear();
+    m_respondedCs.clear();
+
+    RestrictToSensingWidth();
 
     /*
     ********************************************************************
@@ -1164,6 +1176,12 @@ RrMultiUserScheduler::TryPollingPhase11bf()
     while (staIt != m_staListDl[primaryAc].end() && m_candidatesPoll.size() < maxCount)
     {
         NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->address << ", AID=" << staIt->aid << ")");
+        if (!m_apMac->IsSensingParticipant(staIt->address))
+        {
+            NS_LOG_DEBUG("Skipping STA not taking part in the current sensing instance");
+            staIt++;
+            continue;
+        }
         if (txParamsPollingFrame.m_txVector.GetPreambleType() == WIFI_PREAMBLE_EHT_MU &&
             !m_apMac->GetEhtSupported(staIt->address))
         {
@@ -1503,17 +1521,10 @@ RrMultiUserScheduler::CheckRespondedPollingStation(Mac48Address address)
     {
         if (staIt->first->address == address)
         {
-            m_candidatesCs.emplace_back(staIt->first, mpduNdpa);
-            m_candidatesCsSU.emplace_back(staIt->first, mpduNdpa);
+            m_respondedCs.emplace_back(staIt->first, mpduNdpa);
         }
         staIt++;
     }
-
-    m_currentCsSUCandidate = m_candidatesCsSU.begin();
-    if (m_soundingType == SoundingType::SU_only && m_candidatesCs.size() > 1)
-    {
-        DoSUNDPASoundingStation();
-    }
 }
 
 MultiUserScheduler::TxFormat
@@ -1524,37 +1535,13 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
     Ptr<HeConfiguration> heConfiguration = m_apMac->GetHeConfiguration();
     NS_ASSERT(heConfiguration != 0);
 
-    if (m_soundingType == SU_and_MU)
+    RestrictToSensingWidth();
+
+    // the stations of the current round of the sounding schedule
+    if (m_candidatesCs.empty())
     {
-        Ptr<UniformRandomVariable> random_seed = CreateObject<UniformRandomVariable>();
-        int random = random_seed->GetInteger(1, m_candidatesCs.size());
-        auto m_candidateCs_copy = m_candidatesCs;
-        std::vector<int> random_index_vec;
-        m_candidatesCs.clear();
-        if (random > 1)
-        {
-            auto staIt = m_candidateCs_copy.begin();
-            for (int i = 0; i < random; i++)
-            {
-                m_candidatesCs.emplace_back(staIt->first, staIt->second);
-                staIt++;
-            }
-        }
-        else
-        {
-            auto staIt = m_candidateCs_copy.begin();
-            int random_index = random_seed->GetInteger(1, m_candidateCs_copy.size());
-            for (int i = 0; i < random_index - 1; i++)
-            {
-                staIt++;
-            }
-            m_candidatesCs.emplace_back(staIt->first, staIt->second);
-        }
-        if (m_candidatesCs.size() == 0)
-        {
-            SensingTimeout();
-            return NO_TX;
-        }
+        SensingTimeout();
+        return NO_TX;
     }
 
     /*
@@ -1633,6 +1620,12 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
 
     actualAvailableTime =
         actualAvailableTime - txParamsNdp.m_txDuration - m_apMac->GetWifiPhy()->GetSifs();
+    if (m_apMac->GetSensingInstance().reportFormat == SensingReportFormat::NON_TB)
+    {
+        // the station replies to the I2R NDP with an R2I NDP, which is assumed to last as
+        // long as the I2R NDP
+        actualAvailableTime -= txParamsNdp.m_txDuration + m_apMac->GetWifiPhy()->GetSifs();
+    }
     if (actualAvailableTime.IsNegative())
     {
         NS_LOG_DEBUG("Remaining TXOP duration is not enough for channel sounding");
@@ -1640,11 +1633,15 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
         SensingTimeout();
         return NO_TX;
     }
+    const Time availableTimeAfterNdp = actualAvailableTime;
 
     while (staIt != m_candidatesCs.end())
     {
         NS_LOG_DEBUG("Next candidate STA (MAC=" << staIt->first->address
                                                 << ", AID=" << staIt->first->aid << ")");
+        // the NDPA, the BFRP Trigger Frame and the reports must fit in the remaining time
+        // when the candidate station is added to the stations selected so far
+        actualAvailableTime = availableTimeAfterNdp;
 
         // check if the AP has at least one frame to be sent to the current station
 
@@ -1871,7 +1868,6 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
                     GetTriggerFrame(bfTfCtrlHeader, m_linkId),
                     "Trigger");
             }
-            break;
         }
 
         // move to the next station in the list
@@ -1889,7 +1885,9 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
             m_apMac->GetAddress(),
             staMacAddrList,
             m_allowedWidth,
-            GetWifiRemoteStationManager(m_linkId));
+            GetWifiRemoteStationManager(m_linkId),
+            m_apMac->GetSensingInstance().reportFormat == SensingReportFormat::NON_TB,
+            m_apMac->GetSensingInstanceId());
 
         if (GetHeFem(m_linkId)->GetCsBeamformer()->GetNumCsStations() == 1)
         {
@@ -1907,7 +1905,7 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
         NS_LOG_DEBUG("Number of stations scheduled in channel sounding"
                      << GetHeFem(m_linkId)->GetCsBeamformer()->GetNumCsStations());
 
-        if (m_soundingType == SU_only)
+        if (GetSoundingType() == SU_only)
         {
             return TxFormat::BF_NDPA_SOUNDING_TX_SU;
         }
@@ -1918,36 +1916,174 @@ RrMultiUserScheduler::TryNDPASoundingPhase11bf(void)
     }
 }
 
+void
+RrMultiUserScheduler::RestrictToSensingWidth()
+{
+    if (uint16_t width = m_apMac->GetSensingInstance().channelWidth; width > 0)
+    {
+        m_allowedWidth = std::min(m_allowedWidth, width);
+    }
+}
+
 bool
-RrMultiUserScheduler::DoSUNDPASoundingStation()
+RrMultiUserScheduler::NextSoundingRound()
 {
+    NS_LOG_FUNCTION(this);
     m_candidatesCs.clear();
-    if (m_currentCsSUCandidate == m_candidatesCsSU.begin())
+    if (m_soundingRound + 1 >= m_soundingRoundStart.size())
     {
-        m_candidatesCs.emplace_back(m_currentCsSUCandidate->first, m_currentCsSUCandidate->second);
-        m_currentCsSUCandidate++;
-        m_nextSUSounding = true;
-        return true;
+        m_nextSoundingRound = false;
+        return false;
     }
-    else if (m_currentCsSUCandidate != m_candidatesCsSU.end())
+    for (std::size_t i = m_soundingRoundStart[m_soundingRound];
+         i < m_soundingRoundStart[m_soundingRound + 1];
+         i++)
     {
-        m_candidatesCs.emplace_back(m_currentCsSUCandidate->first, m_currentCsSUCandidate->second);
-        m_currentCsSUCandidate++;
-        m_nextSUSounding = true;
-        return true;
+        m_candidatesCs.push_back(m_soundingSchedule[i]);
     }
-    else
+    m_soundingRound++;
+    m_nextSoundingRound = true;
+    return true;
+}
+
+void
+RrMultiUserScheduler::UpdateSoundingGroups()
+{
+    NS_LOG_FUNCTION(this);
+    m_soundingStaAddress.clear();
+    m_soundingStaIndex.clear();
+    m_soundingGroupStart.clear();
+    m_soundingGroupMembers.clear();
+
+    // sort the stations by the number of columns they feed back, so that stations with the
+    // same Nc are contiguous
+    std::vector<std::pair<uint8_t, std::size_t>> keys;
+    for (const auto& info : m_staListUl)
+    {
+        auto heCapabilities =
+            GetWifiRemoteStationManager(m_linkId)->GetStationHeCapabilities(info.address);
+        uint8_t nc = heCapabilities ? heCapabilities->GetMaxNc() : 0;
+        keys.emplace_back(nc, m_soundingStaAddress.size());
+        m_soundingStaIndex[info.address] = m_soundingStaAddress.size();
+        m_soundingStaAddress.push_back(info.address);
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (std::size_t i = 0; i < keys.size(); i++)
     {
-        m_candidatesCs.emplace_back(m_currentCsSUCandidate->first, m_currentCsSUCandidate->second);
-        m_nextSUSounding = false;
-        return false;
+        if (i == 0 || keys[i].first != keys[i - 1].first ||
+            m_soundingGroupMembers.size() - m_soundingGroupStart.back() == m_maxSoundingGroupSize)
+        {
+            m_soundingGroupStart.push_back(m_soundingGroupMembers.size());
+        }
+        m_soundingGroupMembers.push_back(keys[i].second);
     }
+    m_soundingGroupStart.push_back(m_soundingGroupMembers.size());
+    m_soundingGroupsDirty = false;
+
+    NS_LOG_DEBUG(m_soundingStaAddress.size() << " stations partitioned into "
+                                             << m_soundingGroupStart.size() - 1
+                                             << " sounding groups");
+}
+
+void
+RrMultiUserScheduler::BuildSoundingSchedule()
+{
+    NS_LOG_FUNCTION(this);
+    m_soundingSchedule.clear();
+    m_soundingRoundStart.clear();
+    m_soundingRound = 0;
+    RestrictToSensingWidth();
+
+    if (GetSoundingType() == SU_and_MU && !m_respondedCs.empty())
+    {
+        // sound a random subset of the stations that responded to polling in a single round
+        int random = m_soundingRandom->GetInteger(1, m_respondedCs.size());
+        m_soundingRoundStart.push_back(0);
+        if (random > 1)
+        {
+            m_soundingSchedule.assign(m_respondedCs.begin(), m_respondedCs.begin() + random);
+        }
+        else
+        {
+            int random_index = m_soundingRandom->GetInteger(1, m_respondedCs.size());
+            m_soundingSchedule.push_back(m_respondedCs[random_index - 1]);
+        }
+    }
+    else if (GetSoundingType() == SU_only)
+    {
+        // one round per station
+        for (const auto& candidate : m_respondedCs)
+        {
+            m_soundingRoundStart.push_back(m_soundingSchedule.size());
+            m_soundingSchedule.push_back(candidate);
+        }
+    }
+    else if (!m_respondedCs.empty())
+    {
+        if (m_soundingGroupsDirty)
+        {
+            UpdateSoundingGroups();
+        }
+
+        // map the group members to the stations that responded to polling
+        std::vector<const CandidateInfo*> responded(m_soundingStaAddress.size(), nullptr);
+        for (const auto& candidate : m_respondedCs)
+        {
+            if (auto it = m_soundingStaIndex.find(candidate.first->address);
+                it != m_soundingStaIndex.end())
+            {
+                responded[it->second] = &candidate;
+            }
+        }
+
+        // each station is allocated an RU in the TB PPDU carrying the reports
+        std::size_t maxRoundSize =
+            std::min<std::size_t>(m_maxSoundingGroupSize,
+                                  HeRu::GetNRus(m_allowedWidth, HeRu::RU_26_TONE));
+        for (std::size_t group = 0; group + 1 < m_soundingGroupStart.size(); group++)
+        {
+            std::size_t roundSize = 0;
+            for (std::size_t i = m_soundingGroupStart[group];
+                 i < m_soundingGroupStart[group + 1];
+                 i++)
+            {
+                if (const auto candidate = responded[m_soundingGroupMembers[i]])
+                {
+                    if (roundSize == 0 || roundSize == maxRoundSize)
+                    {
+                        m_soundingRoundStart.push_back(m_soundingSchedule.size());
+                        roundSize = 0;
+                    }
+                    m_soundingSchedule.push_back(*candidate);
+                    roundSize++;
+                }
+            }
+        }
+    }
+    m_soundingRoundStart.push_back(m_soundingSchedule.size());
+
+    NS_LOG_DEBUG("Sounding schedule of " << m_soundingSchedule.size() << " stations in "
+                                         << m_soundingRoundStart.size() - 1 << " rounds");
+    NextSoundingRound();
 }
 
 ns3::MultiUserScheduler::SoundingType
 RrMultiUserScheduler::GetSoundingType()
 {
-    return m_soundingType;
+    // the report format of the current sensing measurement instance takes precedence
+    switch (m_apMac->GetSensingInstance().reportFormat)
+    {
+    case SensingReportFormat::SU:
+    case SensingReportFormat::NON_TB:
+        return SU_only;
+    case SensingReportFormat::MU:
+        return MU_only;
+    default:
+        return m_soundingType;
+    }
 }
 
 size_t
@@ -22,7 +22,11 @@
 
 #include "multi-user-scheduler.h"
 
+#include "ns3/random-variable-stream.h"
+
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -59,9 +63,10 @@ class RrMultiUserScheduler : public MultiUserScheduler
     *************************************
     */
     void CheckRespondedPollingStation(Mac48Address address) override;
-    bool DoSUNDPASoundingStation() override;
+    bool NextSoundingRound() override;
     size_t GetPollingCandidatesSize() override;
     ns3::MultiUserScheduler::SoundingType GetSoundingType() override;
+    int64_t AssignStreams(int64_t stream) override;
 
   protected:
     void DoDispose() override;
@@ -225,12 +230,42 @@ class RrMultiUserScheduler : public MultiUserScheduler
      *  \return BF_NDPA_SOUNDING_TX if it is possible to do polling phase
      */
     virtual TxFormat TryNDPASoundingPhase11bf();
+    /**
+     * Restrict the allowed width to the channel width of the current sensing measurement
+     * instance, if any.
+     */
+    void RestrictToSensingWidth();
+    /**
+     * Partition the associated HE stations into sounding groups. The stations of a group
+     * feed back the same number of columns (Nc) and can therefore be sounded by the same
+     * NDPA and solicited by the same BFRP Trigger Frame. Groups are rebuilt only when the
+     * set of associated stations changes.
+     */
+    void UpdateSoundingGroups();
+    /**
+     * Build the sounding schedule of the current CFP out of the stations that responded to
+     * polling. Each round of the schedule sounds a single station (SU sounding) or the
+     * responding stations of a sounding group, up to the number of RUs available for
+     * the BFRP Trigger Frame (MU sounding).
+     */
+    void BuildSoundingSchedule();
 
     SoundingType m_soundingType = SoundingType::MU_only; //!< Type of sounding to perform
-    std::list<CandidateInfo> m_candidatesCs;     //!< Candidate stations for channel sounding
-    std::list<CandidateInfo> m_candidatesCsSU; //!< Candidate stations for SU transmission channel sounding
-    std::list<CandidateInfo>::iterator
-        m_currentCsSUCandidate;                //!< Current candidate for channel sounding
+    Ptr<UniformRandomVariable> m_soundingRandom; //!< Picks the stations of SU+MU soundings
+    std::list<CandidateInfo> m_candidatesCs; //!< Candidate stations for the current sounding round
+    std::vector<CandidateInfo> m_respondedCs; //!< Stations that responded to polling in this CFP
+    uint16_t m_maxSoundingGroupSize; //!< Maximum number of stations in a sounding group
+    bool m_soundingGroupsDirty;      //!< Whether sounding groups need to be rebuilt
+    std::vector<Mac48Address> m_soundingStaAddress; //!< Address of each station (by index)
+    std::unordered_map<Mac48Address, std::size_t, WifiAddressHash>
+        m_soundingStaIndex;                     //!< Index of each station (by address)
+    std::vector<std::size_t> m_soundingGroupStart; //!< Offset of each group in the member array,
+                                                   //!< followed by the total number of members
+    std::vector<std::size_t> m_soundingGroupMembers; //!< Station indices, grouped
+    std::vector<CandidateInfo> m_soundingSchedule;    //!< Stations of all the rounds of the CFP
+    std::vector<std::size_t> m_soundingRoundStart; //!< Offset of each round in the schedule,
+                                                   //!< followed by the schedule size
+    std::size_t m_soundingRound;                   //!< Index of the current sounding round
     std::list<CandidateInfo> m_candidatesPoll;   //!< Candidate stations for polling 11bf
     std::list<CandidateInfo> m_candidatesReport; //!< Candidate stations for reporting phase 11bf
     std::list<MasterInfo> m_staListPoll;         //!< List of stations to serve for polling 11bf
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sbp-headers.h"
+
+#include "ns3/address-utils.h"
+#include "ns3/assert.h"
+
+namespace ns3
+{
+
+/***************************************************
+ *              SBP Request
+ ***************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED(MgtSbpRequestHeader);
+
+MgtSbpRequestHeader::MgtSbpRequestHeader()
+    : m_setupId(0)
+{
+}
+
+TypeId
+MgtSbpRequestHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MgtSbpRequestHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<MgtSbpRequestHeader>();
+    return tid;
+}
+
+TypeId
+MgtSbpRequestHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+void
+MgtSbpRequestHeader::Print(std::ostream& os) const
+{
+    os << "Setup ID=" << +m_setupId << " Interval=" << m_setup.interval.As(Time::MS)
+       << " Priority=" << m_setup.priority << " Width=" << m_setup.channelWidth
+       << " Format=" << +static_cast<uint8_t>(m_setup.reportFormat)
+       << " Stations=" << m_setup.stations.size();
+}
+
+uint32_t
+MgtSbpRequestHeader::GetSerializedSize() const
+{
+    uint32_t size = 0;
+    size += 1; // Measurement setup ID
+    size += 4; // Interval
+    size += 1; // Priority
+    size += 2; // Channel width
+    size += 1; // Report format
+    size += 1; // Number of stations
+    size += 6 * m_setup.stations.size();
+    return size;
+}
+
+void
+MgtSbpRequestHeader::Serialize(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU8(m_setupId);
+    i.WriteHtolsbU32(static_cast<uint32_t>(m_setup.interval.GetMicroSeconds()));
+    i.WriteU8(static_cast<uint8_t>(m_setup.priority));
+    i.WriteHtolsbU16(m_setup.channelWidth);
+    i.WriteU8(static_cast<uint8_t>(m_setup.reportFormat));
+    i.WriteU8(static_cast<uint8_t>(m_setup.stations.size()));
+    for (const auto& address : m_setup.stations)
+    {
+        WriteTo(i, address);
+    }
+}
+
+uint32_t
+MgtSbpRequestHeader::Deserialize(Buffer::Iterator start)
+{
+    Buffer::Iterator i = start;
+    m_setupId = i.ReadU8();
+    m_setup.interval = MicroSeconds(i.ReadLsbtohU32());
+    m_setup.priority = i.ReadU8();
+    m_setup.channelWidth = i.ReadLsbtohU16();
+    m_setup.reportFormat = static_cast<SensingReportFormat>(i.ReadU8());
+    uint8_t nStations = i.ReadU8();
+    m_setup.stations.clear();
+    for (uint8_t n = 0; n < nStations; ++n)
+    {
+        Mac48Address address;
+        ReadFrom(i, address);
+        m_setup.stations.insert(address);
+    }
+    return i.GetDistanceFrom(start);
+}
+
+void
+MgtSbpRequestHeader::SetSetupId(uint8_t setupId)
+{
+    m_setupId = setupId;
+}
+
+uint8_t
+MgtSbpRequestHeader::GetSetupId() const
+{
+    return m_setupId;
+}
+
+void
+MgtSbpRequestHeader::SetMeasurementSetup(const SensingMeasurementSetup& setup)
+{
+    NS_ASSERT_MSG(setup.stations.size() <= 255, "Too many stations in the SBP request");
+    m_setup = setup;
+}
+
+const SensingMeasurementSetup&
+MgtSbpRequestHeader::GetMeasurementSetup() const
+{
+    return m_setup;
+}
+
+/***************************************************
+ *              SBP Response
+ ***************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED(MgtSbpResponseHeader);
+
+MgtSbpResponseHeader::MgtSbpResponseHeader()
+    : m_setupId(0),
+      m_statusCode(0)
+{
+}
+
+TypeId
+MgtSbpResponseHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MgtSbpResponseHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<MgtSbpResponseHeader>();
+    return tid;
+}
+
+TypeId
+MgtSbpResponseHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+void
+MgtSbpResponseHeader::Print(std::ostream& os) const
+{
+    os << "Setup ID=" << +m_setupId << " Status=" << m_statusCode;
+}
+
+uint32_t
+MgtSbpResponseHeader::GetSerializedSize() const
+{
+    return 3;
+}
+
+void
+MgtSbpResponseHeader::Serialize(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU8(m_setupId);
+    i.WriteHtolsbU16(m_statusCode);
+}
+
+uint32_t
+MgtSbpResponseHeader::Deserialize(Buffer::Iterator start)
+{
+    Buffer::Iterator i = start;
+    m_setupId = i.ReadU8();
+    m_statusCode = i.ReadLsbtohU16();
+    return i.GetDistanceFrom(start);
+}
+
+void
+MgtSbpResponseHeader::SetSetupId(uint8_t setupId)
+{
+    m_setupId = setupId;
+}
+
+uint8_t
+MgtSbpResponseHeader::GetSetupId() const
+{
+    return m_setupId;
+}
+
+void
+MgtSbpResponseHeader::SetStatusCode(uint16_t statusCode)
+{
+    m_statusCode = statusCode;
+}
+
+uint16_t
+MgtSbpResponseHeader::GetStatusCode() const
+{
+    return m_statusCode;
+}
+
+bool
+MgtSbpResponseHeader::IsSuccess() const
+{
+    return m_statusCode == 0;
+}
+
+/***************************************************
+ *              SBP Termination
+ ***************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED(MgtSbpTerminationHeader);
+
+MgtSbpTerminationHeader::MgtSbpTerminationHeader()
+    : m_setupId(0)
+{
+}
+
+TypeId
+MgtSbpTerminationHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MgtSbpTerminationHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<MgtSbpTerminationHeader>();
+    return tid;
+}
+
+TypeId
+MgtSbpTerminationHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+void
+MgtSbpTerminationHeader::Print(std::ostream& os) const
+{
+    os << "Setup ID=" << +m_setupId;
+}
+
+uint32_t
+MgtSbpTerminationHeader::GetSerializedSize() const
+{
+    return 1;
+}
+
+void
+MgtSbpTerminationHeader::Serialize(Buffer::Iterator start) const
+{
+    start.WriteU8(m_setupId);
+}
+
+uint32_t
+MgtSbpTerminationHeader::Deserialize(Buffer::Iterator start)
+{
+    m_setupId = start.ReadU8();
+    return 1;
+}
+
+void
+MgtSbpTerminationHeader::SetSetupId(uint8_t setupId)
+{
+    m_setupId = setupId;
+}
+
+uint8_t
+MgtSbpTerminationHeader::GetSetupId() const
+{
+    return m_setupId;
+}
+
+/***************************************************
+ *              SBP Report
+ ***************************************************/
+
+NS_OBJECT_ENSURE_REGISTERED(MgtSbpReportHeader);
+
+MgtSbpReportHeader::MgtSbpReportHeader()
+    : m_setupId(0),
+      m_instanceId(0)
+{
+}
+
+TypeId
+MgtSbpReportHeader::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::MgtSbpReportHeader")
+                            .SetParent<Header>()
+                            .SetGroupName("Wifi")
+                            .AddConstructor<MgtSbpReportHeader>();
+    return tid;
+}
+
+TypeId
+MgtSbpReportHeader::GetInstanceTypeId() const
+{
+    return GetTypeId();
+}
+
+void
+MgtSbpReportHeader::Print(std::ostream& os) const
+{
+    os << "Setup ID=" << +m_setupId << " Instance ID=" << m_instanceId
+       << " Reporter=" << m_reporter;
+}
+
+uint32_t
+MgtSbpReportHeader::GetSerializedSize() const
+{
+    return 11;
+}
+
+void
+MgtSbpReportHeader::Serialize(Buffer::Iterator start) const
+{
+    Buffer::Iterator i = start;
+    i.WriteU8(m_setupId);
+    i.WriteHtolsbU32(m_instanceId);
+    WriteTo(i, m_reporter);
+}
+
+uint32_t
+MgtSbpReportHeader::Deserialize(Buffer::Iterator start)
+{
+    Buffer::Iterator i = start;
+    m_setupId = i.ReadU8();
+    m_instanceId = i.ReadLsbtohU32();
+    ReadFrom(i, m_reporter);
+    return i.GetDistanceFrom(start);
+}
+
+void
+MgtSbpReportHeader::SetSetupId(uint8_t setupId)
+{
+    m_setupId = setupId;
+}
+
+uint8_t
+MgtSbpReportHeader::GetSetupId() const
+{
+    return m_setupId;
+}
+
+void
+MgtSbpReportHeader::SetInstanceId(uint32_t instanceId)
+{
+    m_instanceId = instanceId;
+}
+
+uint32_t
+MgtSbpReportHeader::GetInstanceId() const
+{
+    return m_instanceId;
+}
+
+void
+MgtSbpReportHeader::SetReporter(Mac48Address address)
+{
+    m_reporter = address;
+}
+
+Mac48Address
+MgtSbpReportHeader::GetReporter() const
+{
+    return m_reporter;
+}
+
+} // namespace ns3
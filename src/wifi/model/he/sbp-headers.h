@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SBP_HEADERS_H
+#define SBP_HEADERS_H
+
+#include "sensing-session-manager.h"
+
+#include "ns3/header.h"
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * Implement the body of the SBP Request frame, which a non-AP STA sends to its AP to
+ * request that the AP runs a sensing measurement setup on its behalf (sensing by proxy).
+ *
+ * Body format: | setup ID: 1 | interval (us): 4 | priority: 1 | channel width: 2 |
+ *              | report format: 1 | number of stations: 1 | station addresses: 6 * N |
+ */
+class MgtSbpRequestHeader : public Header
+{
+  public:
+    MgtSbpRequestHeader();
+
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    void Print(std::ostream& os) const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+
+    /**
+     * Set the ID assigned by the requesting STA to the measurement setup.
+     *
+     * \param setupId the measurement setup ID
+     */
+    void SetSetupId(uint8_t setupId);
+    /**
+     * \return the ID assigned by the requesting STA to the measurement setup
+     */
+    uint8_t GetSetupId() const;
+    /**
+     * Set the parameters of the requested measurement setup. At most 255 stations can be
+     * listed.
+     *
+     * \param setup the parameters of the measurement setup
+     */
+    void SetMeasurementSetup(const SensingMeasurementSetup& setup);
+    /**
+     * \return the parameters of the requested measurement setup
+     */
+    const SensingMeasurementSetup& GetMeasurementSetup() const;
+
+  private:
+    uint8_t m_setupId;               //!< measurement setup ID
+    SensingMeasurementSetup m_setup; //!< parameters of the measurement setup
+};
+
+/**
+ * \ingroup wifi
+ * Implement the body of the SBP Response frame, which an AP sends in response to an
+ * SBP Request frame.
+ *
+ * Body format: | setup ID: 1 | status code: 2 |
+ */
+class MgtSbpResponseHeader : public Header
+{
+  public:
+    MgtSbpResponseHeader();
+
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    void Print(std::ostream& os) const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+
+    /**
+     * Set the ID assigned by the requesting STA to the measurement setup.
+     *
+     * \param setupId the measurement setup ID
+     */
+    void SetSetupId(uint8_t setupId);
+    /**
+     * \return the ID assigned by the requesting STA to the measurement setup
+     */
+    uint8_t GetSetupId() const;
+    /**
+     * Set the status code (0 means that the request was accepted).
+     *
+     * \param statusCode the status code
+     */
+    void SetStatusCode(uint16_t statusCode);
+    /**
+     * \return the status code
+     */
+    uint16_t GetStatusCode() const;
+    /**
+     * \return whether the request was accepted
+     */
+    bool IsSuccess() const;
+
+  private:
+    uint8_t m_setupId;     //!< measurement setup ID
+    uint16_t m_statusCode; //!< status code
+};
+
+/**
+ * \ingroup wifi
+ * Implement the body of the SBP Termination frame, which a non-AP STA sends to its AP
+ * to tear down a measurement setup run on its behalf.
+ *
+ * Body format: | setup ID: 1 |
+ */
+class MgtSbpTerminationHeader : public Header
+{
+  public:
+    MgtSbpTerminationHeader();
+
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    void Print(std::ostream& os) const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+
+    /**
+     * Set the ID assigned by the requesting STA to the measurement setup.
+     *
+     * \param setupId the measurement setup ID
+     */
+    void SetSetupId(uint8_t setupId);
+    /**
+     * \return the ID assigned by the requesting STA to the measurement setup
+     */
+    uint8_t GetSetupId() const;
+
+  private:
+    uint8_t m_setupId; //!< measurement setup ID
+};
+
+/**
+ * \ingroup wifi
+ * Implement the header of the SBP Report frame, which an AP uses to forward to the
+ * requesting STA the beamforming report received from a sensing responder. The header is
+ * followed by the beamforming report as received by the AP (including its Action field).
+ *
+ * Header format: | setup ID: 1 | instance ID: 4 | reporting STA address: 6 |
+ */
+class MgtSbpReportHeader : public Header
+{
+  public:
+    MgtSbpReportHeader();
+
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+    void Print(std::ostream& os) const override;
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+
+    /**
+     * Set the ID assigned by the requesting STA to the measurement setup.
+     *
+     * \param setupId the measurement setup ID
+     */
+    void SetSetupId(uint8_t setupId);
+    /**
+     * \return the ID assigned by the requesting STA to the measurement setup
+     */
+    uint8_t GetSetupId() const;
+    /**
+     * Set the ID of the measurement instance in which the report was collected.
+     *
+     * \param instanceId the measurement instance ID
+     */
+    void SetInstanceId(uint32_t instanceId);
+    /**
+     * \return the ID of the measurement instance in which the report was collected
+     */
+    uint32_t GetInstanceId() const;
+    /**
+     * Set the MAC address of the station that sent the beamforming report.
+     *
+     * \param address the MAC address of the reporting station
+     */
+    void SetReporter(Mac48Address address);
+    /**
+     * \return the MAC address of the station that sent the beamforming report
+     */
+    Mac48Address GetReporter() const;
+
+  private:
+    uint8_t m_setupId;       //!< measurement setup ID
+    uint32_t m_instanceId;   //!< measurement instance ID
+    Mac48Address m_reporter; //!< address of the reporting station
+};
+
+} // namespace ns3
+
+#endif /* SBP_HEADERS_H */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SENSING_PHASE_H
+#define SENSING_PHASE_H
+
+#include "ns3/fatal-error.h"
+
+#include <cstdint>
+#include <ostream>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * The phases of a TB sensing measurement instance.
+ */
+enum class SensingPhase : uint8_t
+{
+    POLLING = 0,   //!< CF-Poll/polling trigger and CTS responses
+    NDPA_SOUNDING, //!< transmission of the NDP Announcement
+    NDP,           //!< transmission of the NDP
+    BFRP_TRIGGER,  //!< transmission of the BFRP Trigger Frame
+    REPORT         //!< reception of the beamforming reports
+};
+
+/**
+ * \ingroup wifi
+ * The events that delimit a phase of a sensing measurement instance.
+ */
+enum class SensingPhaseEvent : uint8_t
+{
+    START = 0, //!< the phase started
+    COMPLETE,  //!< the phase completed successfully
+    TIMEOUT,   //!< some, but not all, of the expected responses were received
+    COLLISION, //!< none of the expected responses were received
+    ABORTED    //!< the phase could not be (re)started, e.g., the remaining CFP is too short
+};
+
+/**
+ * \brief Stream insertion operator.
+ *
+ * \param os the stream
+ * \param phase the sensing phase
+ * \returns a reference to the stream
+ */
+inline std::ostream&
+operator<<(std::ostream& os, SensingPhase phase)
+{
+    switch (phase)
+    {
+    case SensingPhase::POLLING:
+        return (os << "POLLING");
+    case SensingPhase::NDPA_SOUNDING:
+        return (os << "NDPA_SOUNDING");
+    case SensingPhase::NDP:
+        return (os << "NDP");
+    case SensingPhase::BFRP_TRIGGER:
+        return (os << "BFRP_TRIGGER");
+    case SensingPhase::REPORT:
+        return (os << "REPORT");
+    default:
+        NS_FATAL_ERROR("Invalid sensing phase");
+        return (os << "INVALID");
+    }
+}
+
+/**
+ * \brief Stream insertion operator.
+ *
+ * \param os the stream
+ * \param event the sensing phase event
+ * \returns a reference to the stream
+ */
+inline std::ostream&
+operator<<(std::ostream& os, SensingPhaseEvent event)
+{
+    switch (event)
+    {
+    case SensingPhaseEvent::START:
+        return (os << "START");
+    case SensingPhaseEvent::COMPLETE:
+        return (os << "COMPLETE");
+    case SensingPhaseEvent::TIMEOUT:
+        return (os << "TIMEOUT");
+    case SensingPhaseEvent::COLLISION:
+        return (os << "COLLISION");
+    case SensingPhaseEvent::ABORTED:
+        return (os << "ABORTED");
+    default:
+        NS_FATAL_ERROR("Invalid sensing phase event");
+        return (os << "INVALID");
+    }
+}
+
+} // namespace ns3
+
+#endif /* SENSING_PHASE_H */
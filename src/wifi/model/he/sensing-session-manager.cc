@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sensing-session-manager.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SensingSessionManager");
+
+bool
+operator==(const SensingMeasurementSetup& lhs, const SensingMeasurementSetup& rhs)
+{
+    return lhs.interval == rhs.interval && lhs.priority == rhs.priority &&
+           lhs.stations == rhs.stations && lhs.channelWidth == rhs.channelWidth &&
+           lhs.reportFormat == rhs.reportFormat;
+}
+
+bool
+SensingSessionManager::Instance::IsEmpty() const
+{
+    return setupIds.empty();
+}
+
+bool
+SensingSessionManager::Instance::IsParticipant(Mac48Address address) const
+{
+    return stations.empty() || stations.count(address) > 0;
+}
+
+SensingSessionManager::SensingSessionManager()
+    : m_nextSetupId(0)
+{
+}
+
+uint32_t
+SensingSessionManager::AddSetup(const SensingMeasurementSetup& setup, Time firstDue)
+{
+    NS_LOG_FUNCTION(this << setup.interval << setup.priority << firstDue);
+    NS_ASSERT_MSG(setup.interval.IsStrictlyPositive(), "The sensing interval must be positive");
+
+    uint32_t setupId = m_nextSetupId++;
+    m_setups.emplace(setupId, Entry{setup, firstDue});
+    PushHeap({firstDue, setupId});
+    return setupId;
+}
+
+void
+SensingSessionManager::RemoveSetup(uint32_t setupId)
+{
+    NS_LOG_FUNCTION(this << setupId);
+    // the heap entry is dropped when it reaches the top of the heap
+    m_setups.erase(setupId);
+}
+
+const SensingMeasurementSetup&
+SensingSessionManager::GetSetup(uint32_t setupId) const
+{
+    auto it = m_setups.find(setupId);
+    NS_ASSERT_MSG(it != m_setups.end(), "No sensing measurement setup with ID " << setupId);
+    return it->second.setup;
+}
+
+std::size_t
+SensingSessionManager::GetNSetups() const
+{
+    return m_setups.size();
+}
+
+bool
+SensingSessionManager::IsEmpty() const
+{
+    return m_setups.empty();
+}
+
+Time
+SensingSessionManager::GetNextDue()
+{
+    PurgeHeap();
+    return m_heap.empty() ? Time::Max() : m_heap.front().first;
+}
+
+SensingSessionManager::Instance
+SensingSessionManager::PopDue(Time now, Time mergeWindow)
+{
+    NS_LOG_FUNCTION(this << now << mergeWindow);
+
+    Instance instance;
+    PurgeHeap();
+    if (m_heap.empty() || m_heap.front().first > now + mergeWindow)
+    {
+        return instance;
+    }
+
+    const auto& leader = m_setups.at(m_heap.front().second).setup;
+    instance.priority = leader.priority;
+    instance.channelWidth = leader.channelWidth;
+    instance.reportFormat = leader.reportFormat;
+    bool allStations = false;
+    const Time horizon = std::max(now, m_heap.front().first) + mergeWindow;
+
+    // entries are pushed back into the heap after the loop, so that a setup whose interval does
+    // not exceed the merge window is not launched twice in the same instance
+    std::vector<HeapEntry> skipped;
+    std::vector<HeapEntry> rescheduled;
+    while (!m_heap.empty() && m_heap.front().first <= horizon)
+    {
+        auto [due, setupId] = PopHeap();
+        auto it = m_setups.find(setupId);
+        if (it == m_setups.end() || it->second.nextDue != due)
+        {
+            continue;
+        }
+        const auto& setup = it->second.setup;
+        if (setup.priority != instance.priority || setup.channelWidth != instance.channelWidth ||
+            setup.reportFormat != instance.reportFormat)
+        {
+            skipped.emplace_back(due, setupId);
+            continue;
+        }
+
+        NS_LOG_DEBUG("Launching sensing measurement setup " << setupId << " due at " << due);
+        instance.setupIds.push_back(setupId);
+        if (setup.stations.empty())
+        {
+            allStations = true;
+        }
+        instance.stations.insert(setup.stations.cbegin(), setup.stations.cend());
+
+        // schedule the next instance one interval after the current one, unless the current
+        // one was launched so late that the next one would be overdue already
+        Time nextDue = due + setup.interval;
+        if (nextDue <= now)
+        {
+            nextDue = now + setup.interval;
+        }
+        it->second.nextDue = nextDue;
+        rescheduled.emplace_back(nextDue, setupId);
+    }
+
+    for (const auto& entry : skipped)
+    {
+        PushHeap(entry);
+    }
+    for (const auto& entry : rescheduled)
+    {
+        PushHeap(entry);
+    }
+    if (allStations)
+    {
+        instance.stations.clear();
+    }
+    return instance;
+}
+
+void
+SensingSessionManager::PurgeHeap()
+{
+    while (!m_heap.empty())
+    {
+        auto it = m_setups.find(m_heap.front().second);
+        if (it != m_setups.end() && it->second.nextDue == m_heap.front().first)
+        {
+            break;
+        }
+        PopHeap();
+    }
+}
+
+void
+SensingSessionManager::PushHeap(HeapEntry entry)
+{
+    m_heap.push_back(entry);
+    std::push_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>());
+}
+
+SensingSessionManager::HeapEntry
+SensingSessionManager::PopHeap()
+{
+    NS_ASSERT(!m_heap.empty());
+    std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<HeapEntry>());
+    HeapEntry entry = m_heap.back();
+    m_heap.pop_back();
+    return entry;
+}
+
+} // namespace ns3
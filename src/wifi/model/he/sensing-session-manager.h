@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SENSING_SESSION_MANAGER_H
+#define SENSING_SESSION_MANAGER_H
+
+#include "ns3/mac48-address.h"
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ * The format of the beamforming reports solicited by a sensing measurement setup.
+ */
+enum class SensingReportFormat : uint8_t
+{
+    DEFAULT = 0, //!< use the sounding type configured on the Multi-User Scheduler
+    SU,          //!< SU feedback, one station sounded at a time
+    MU,          //!< MU feedback, all the stations sounded at once
+    NON_TB       //!< non-TB sounding, I2R and R2I NDPs exchanged with one station at a time
+};
+
+/**
+ * \ingroup wifi
+ * The parameters of a sensing measurement setup, i.e., of a sensing application whose
+ * measurement instances are run periodically by an AP.
+ */
+struct SensingMeasurementSetup
+{
+    Time interval{MilliSeconds(1000)}; //!< time between two measurement instances
+    uint16_t priority{4};              //!< sensing priority (see ApWifiMac::SetSensingPriority)
+    std::set<Mac48Address> stations;   //!< participating stations (empty means all)
+    uint16_t channelWidth{0};          //!< channel width in MHz (0 means the operating width)
+    SensingReportFormat reportFormat{SensingReportFormat::DEFAULT}; //!< report format
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \param lhs the left hand side measurement setup
+ * \param rhs the right hand side measurement setup
+ * \returns true if the two measurement setups have the same parameters
+ */
+bool operator==(const SensingMeasurementSetup& lhs, const SensingMeasurementSetup& rhs);
+
+/**
+ * \ingroup wifi
+ *
+ * Keep track of the sensing measurement setups registered on an AP and decide which
+ * measurement instance to launch next. The due times of the setups are kept in a
+ * min-heap. Setups that are due within a merge window of the earliest one and that
+ * are compatible with it (same priority, channel width and report format) are merged
+ * into a single measurement instance, so that they share the polling and the NDPA
+ * sounding phases.
+ */
+class SensingSessionManager
+{
+  public:
+    /// A measurement instance made of one or more merged measurement setups
+    struct Instance
+    {
+        std::vector<uint32_t> setupIds;  //!< IDs of the merged setups
+        uint16_t priority{4};            //!< sensing priority
+        std::set<Mac48Address> stations; //!< participating stations (empty means all)
+        uint16_t channelWidth{0};        //!< channel width in MHz (0 means the operating width)
+        SensingReportFormat reportFormat{SensingReportFormat::DEFAULT}; //!< report format
+
+        /**
+         * \return whether the instance does not include any setup
+         */
+        bool IsEmpty() const;
+        /**
+         * \param address the MAC address of a station
+         * \return whether the given station takes part in this instance
+         */
+        bool IsParticipant(Mac48Address address) const;
+    };
+
+    SensingSessionManager();
+
+    /**
+     * Register a measurement setup.
+     *
+     * \param setup the parameters of the measurement setup
+     * \param firstDue the time the first measurement instance of the setup is due
+     * \return the ID assigned to the setup
+     */
+    uint32_t AddSetup(const SensingMeasurementSetup& setup, Time firstDue);
+    /**
+     * Deregister a measurement setup. Nothing is done if no setup has the given ID.
+     *
+     * \param setupId the ID of the setup
+     */
+    void RemoveSetup(uint32_t setupId);
+    /**
+     * \param setupId the ID of the setup
+     * \return the parameters of the given setup
+     */
+    const SensingMeasurementSetup& GetSetup(uint32_t setupId) const;
+    /**
+     * \return the number of registered setups
+     */
+    std::size_t GetNSetups() const;
+    /**
+     * \return whether no setup is registered
+     */
+    bool IsEmpty() const;
+
+    /**
+     * \return the time the next measurement instance is due, or Time::Max () if no setup is
+     *         registered
+     */
+    Time GetNextDue();
+    /**
+     * Remove from the schedule the setups whose instance is due at the earliest time, if
+     * that is not later than the given time plus the merge window, along with all the
+     * compatible setups due within the merge window. The next instance of each of the
+     * returned setups is scheduled one interval after the current one.
+     *
+     * \param now the current time
+     * \param mergeWindow the maximum delay between the due times of merged setups
+     * \return the measurement instance to launch (empty if no setup is due)
+     */
+    Instance PopDue(Time now, Time mergeWindow);
+
+  private:
+    /// Due time and ID of a setup, as stored in the min-heap
+    using HeapEntry = std::pair<Time, uint32_t>;
+
+    /// A registered setup
+    struct Entry
+    {
+        SensingMeasurementSetup setup; //!< the parameters of the setup
+        Time nextDue;                  //!< the time the next instance is due
+    };
+
+    /**
+     * Pop the heap entries that refer to removed or rescheduled setups.
+     */
+    void PurgeHeap();
+    /**
+     * Push an entry into the min-heap.
+     *
+     * \param entry the entry
+     */
+    void PushHeap(HeapEntry entry);
+    /**
+     * Pop the entry with the earliest due time from the min-heap.
+     *
+     * \return the entry
+     */
+    HeapEntry PopHeap();
+
+    std::map<uint32_t, Entry> m_setups; //!< registered setups indexed by ID
+    std::vector<HeapEntry> m_heap;      //!< min-heap of the due times
+    uint32_t m_nextSetupId;             //!< ID to assign to the next setup
+};
+
+} // namespace ns3
+
+#endif /* SENSING_SESSION_MANAGER_H */
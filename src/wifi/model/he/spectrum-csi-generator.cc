@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "spectrum-csi-generator.h"
+
+#include "he-ru.h"
+
+#include "ns3/abort.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/matrix-based-channel-model.h"
+#include "ns3/mgt-headers.h"
+#include "ns3/mobility-model.h"
+#include "ns3/phased-array-model.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-phy.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/wifi-spectrum-signal-parameters.h"
+#include "ns3/wifi-utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SpectrumCsiGenerator");
+
+NS_OBJECT_ENSURE_REGISTERED(SpectrumCsiGenerator);
+
+namespace
+{
+/// Maximum number of rows or columns of a beamforming matrix
+constexpr uint8_t MAX_BF_DIM = 8;
+/// Boltzmann constant (J/K) times the reference temperature (290 K)
+constexpr double KT = 1.3803e-23 * 290;
+} // namespace
+
+TypeId
+SpectrumCsiGenerator::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SpectrumCsiGenerator")
+            .SetParent<CsiGenerator>()
+            .SetGroupName("Wifi")
+            .AddConstructor<SpectrumCsiGenerator>()
+            .AddAttribute("CoherenceTime",
+                          "The channel information computed for a transmitter is reused for "
+                          "the NDPs received from that transmitter within this time.",
+                          TimeValue(MilliSeconds(10)),
+                          MakeTimeAccessor(&SpectrumCsiGenerator::m_coherenceTime),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("NoiseFigure",
+                          "The noise figure (dB) of the receiver used to compute the SNR.",
+                          DoubleValue(7),
+                          MakeDoubleAccessor(&SpectrumCsiGenerator::m_noiseFigureDb),
+                          MakeDoubleChecker<double>())
+            .AddAttribute("SubspaceIterations",
+                          "The number of iterations used to compute the beamforming matrices.",
+                          UintegerValue(8),
+                          MakeUintegerAccessor(&SpectrumCsiGenerator::m_nIterations),
+                          MakeUintegerChecker<uint8_t>(1))
+            .AddAttribute("ChannelModel",
+                          "The matrix-based channel model (e.g., ThreeGppChannelModel) between "
+                          "the beamformer and this station, if any.",
+                          PointerValue(),
+                          MakePointerAccessor(&SpectrumCsiGenerator::m_channelModel),
+                          MakePointerChecker<MatrixBasedChannelModel>())
+            .AddAttribute("LocalAntenna",
+                          "The antenna array of this station, used with the channel model.",
+                          PointerValue(),
+                          MakePointerAccessor(&SpectrumCsiGenerator::m_localAntenna),
+                          MakePointerChecker<PhasedArrayModel>())
+            .AddAttribute("PeerAntenna",
+                          "The antenna array of the beamformer, used with the channel model.",
+                          PointerValue(),
+                          MakePointerAccessor(&SpectrumCsiGenerator::m_peerAntenna),
+                          MakePointerChecker<PhasedArrayModel>());
+    return tid;
+}
+
+SpectrumCsiGenerator::SpectrumCsiGenerator()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+SpectrumCsiGenerator::~SpectrumCsiGenerator()
+{
+    NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+SpectrumCsiGenerator::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_phy)
+    {
+        m_phy->TraceDisconnectWithoutContext(
+            "WifiSignalArrival",
+            MakeCallback(&SpectrumCsiGenerator::NotifyWifiSignal, this));
+    }
+    m_phy = nullptr;
+    m_channelModel = nullptr;
+    m_localAntenna = nullptr;
+    m_peerAntenna = nullptr;
+    m_ndps.clear();
+    m_cache.clear();
+    CsiGenerator::DoDispose();
+}
+
+void
+SpectrumCsiGenerator::SetWifiPhy(Ptr<WifiPhy> phy)
+{
+    NS_LOG_FUNCTION(this << phy);
+    bool connected = phy->TraceConnectWithoutContext(
+        "WifiSignalArrival",
+        MakeCallback(&SpectrumCsiGenerator::NotifyWifiSignal, this));
+    NS_ABORT_MSG_UNLESS(connected, "SpectrumCsiGenerator requires a SpectrumWifiPhy");
+    m_phy = phy;
+}
+
+int64_t
+SpectrumCsiGenerator::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    return 0;
+}
+
+void
+SpectrumCsiGenerator::NotifyWifiSignal(Ptr<const WifiSpectrumSignalParameters> params,
+                                       uint32_t senderNodeId)
+{
+    Ptr<const WifiPsdu> psdu = params->ppdu->GetPsdu();
+    if (!psdu || psdu->GetNMpdus() == 0 || !psdu->GetHeader(0).IsNdp())
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this << params << senderNodeId);
+    auto& ndp = m_ndps[psdu->GetHeader(0).GetAddr2()];
+    ndp.psd = params->psd;
+    ndp.mobility = params->txPhy ? params->txPhy->GetMobility() : nullptr;
+}
+
+void
+SpectrumCsiGenerator::Generate(const HeMimoControlHeader& heMimoControlHeader,
+                               Mac48Address transmitter,
+                               CsiBuffer& channelInfo)
+{
+    NS_LOG_FUNCTION(this << transmitter);
+    auto ndpIt = m_ndps.find(transmitter);
+    if (ndpIt == m_ndps.end())
+    {
+        NS_LOG_WARN("No NDP received from " << transmitter << ", channel information left empty");
+        return;
+    }
+
+    const uint8_t nr = heMimoControlHeader.GetNr() + 1;
+    auto [bits1, bits2] = HeCompressedBfReport::GetAngleBits(heMimoControlHeader);
+
+    auto [it, inserted] = m_cache.try_emplace(transmitter);
+    CachedCsi& cached = it->second;
+    if (!inserted && Simulator::Now() - cached.computedAt < m_coherenceTime &&
+        cached.channelInfo.GetNs() == channelInfo.GetNs() &&
+        cached.channelInfo.GetNa() == channelInfo.GetNa() &&
+        cached.channelInfo.GetNc() == channelInfo.GetNc() && cached.nr == nr &&
+        cached.bits1 == bits1 && cached.bits2 == bits2 &&
+        cached.ruStart == heMimoControlHeader.GetRuStart() &&
+        cached.ruEnd == heMimoControlHeader.GetRuEnd())
+    {
+        NS_LOG_DEBUG("Reuse channel information computed at " << cached.computedAt.As(Time::US)
+                                                              << " for " << transmitter);
+        channelInfo = cached.channelInfo;
+        return;
+    }
+
+    const NdpMeasurement& ndp = ndpIt->second;
+    Compute(heMimoControlHeader, ndp.psd, ndp.mobility, channelInfo);
+
+    cached.channelInfo = channelInfo;
+    cached.computedAt = Simulator::Now();
+    cached.nr = nr;
+    cached.bits1 = bits1;
+    cached.bits2 = bits2;
+    cached.ruStart = heMimoControlHeader.GetRuStart();
+    cached.ruEnd = heMimoControlHeader.GetRuEnd();
+}
+
+void
+SpectrumCsiGenerator::Compute(const HeMimoControlHeader& heMimoControlHeader,
+                              Ptr<const SpectrumValue> psd,
+                              Ptr<const MobilityModel> peerMobility,
+                              CsiBuffer& channelInfo)
+{
+    NS_LOG_FUNCTION(this << psd << peerMobility);
+    const uint16_t ns = channelInfo.GetNs();
+    const uint8_t nc = channelInfo.GetNc();
+    const uint8_t nr = heMimoControlHeader.GetNr() + 1;
+    const uint8_t nPairs = channelInfo.GetNa() / 2;
+    auto [bits1, bits2] = HeCompressedBfReport::GetAngleBits(heMimoControlHeader);
+    NS_ABORT_MSG_IF(nr > MAX_BF_DIM || nc > MAX_BF_DIM, "Unsupported beamforming matrix size");
+
+    // Find the bins of the PSD that fall within the sounded bandwidth
+    const uint16_t bw = heMimoControlHeader.GetBw();
+    const double centerFrequency = m_phy->GetFrequency() * 1e6;
+    std::size_t firstBin = 0;
+    std::size_t nInBandBins = 0;
+    std::size_t bin = 0;
+    for (auto band = psd->ConstBandsBegin(); band != psd->ConstBandsEnd(); ++band, ++bin)
+    {
+        if (std::abs(band->fc - centerFrequency) < bw * 0.5e6)
+        {
+            firstBin = (nInBandBins == 0 ? bin : firstBin);
+            nInBandBins++;
+        }
+    }
+    NS_ABORT_MSG_IF(nInBandBins == 0, "The PSD of the NDP does not cover the sounded bandwidth");
+
+    // Map the reported subcarriers uniformly onto the bins of the sounded RUs
+    const double nRus = HeRu::GetNRus(bw, HeRu::RU_26_TONE);
+    const double ruOffset = heMimoControlHeader.GetRuStart() / nRus;
+    const double ruSpan =
+        (heMimoControlHeader.GetRuEnd() + 1 - heMimoControlHeader.GetRuStart()) / nRus;
+    const double snrPerWattPerHz =
+        DbToRatio(m_phy->GetRxGain()) / (KT * DbToRatio(m_noiseFigureDb));
+    const auto bands = psd->ConstBandsBegin();
+    m_frequency.resize(ns);
+    m_snr.resize(ns);
+    for (uint16_t k = 0; k < ns; k++)
+    {
+        auto offset = static_cast<std::size_t>((ruOffset + ruSpan * (k + 0.5) / ns) * nInBandBins);
+        bin = firstBin + std::min(offset, nInBandBins - 1);
+        m_frequency[k] = bands[bin].fc;
+        m_snr[k] = (*psd)[bin] * snrPerWattPerHz;
+    }
+
+    if (ComputeGramMatrices(peerMobility, nr))
+    {
+        ComputeEigenvectors(nr, nc);
+    }
+    else
+    {
+        // flat channel: the beamforming matrix is made of the first columns of the identity
+        m_vRe.assign(static_cast<std::size_t>(nr) * nc * ns, 0);
+        m_vIm.assign(m_vRe.size(), 0);
+        m_eigenvalues.assign(static_cast<std::size_t>(nc) * ns, 1);
+        for (uint8_t c = 0; c < std::min(nr, nc); c++)
+        {
+            std::fill_n(m_vRe.begin() + (c * nc + c) * ns, ns, 1);
+        }
+    }
+
+    // Compress the beamforming matrices
+    std::array<std::complex<double>, MAX_BF_DIM * MAX_BF_DIM> v;
+    std::array<double, MAX_BF_DIM * MAX_BF_DIM / 2> phi{};
+    std::array<double, MAX_BF_DIM * MAX_BF_DIM / 2> psi{};
+    uint16_t* phiData = channelInfo.GetPhiData();
+    uint16_t* psiData = channelInfo.GetPsiData();
+    for (uint16_t k = 0; k < ns; k++, phiData += nPairs, psiData += nPairs)
+    {
+        for (std::size_t e = 0; e < static_cast<std::size_t>(nr) * nc; e++)
+        {
+            v[e] = {m_vRe[e * ns + k], m_vIm[e * ns + k]};
+        }
+        DecomposeBeamformingMatrix(v.data(), nr, nc, phi.data(), psi.data());
+        for (uint8_t a = 0; a < nPairs; a++)
+        {
+            phiData[a] = QuantizePhi(phi[a], bits1);
+            psiData[a] = QuantizePsi(psi[a], bits2);
+        }
+    }
+
+    // Average SNR of each space-time stream, in 0.25 dB steps from -10 dB (-128) to 53.75 dB
+    // (127), and per-subcarrier deviation from it, in 1 dB steps from -8 dB to 7 dB
+    uint16_t* deltaSnr = channelInfo.GetDeltaSnrData();
+    for (uint8_t c = 0; c < nc; c++)
+    {
+        const double* eigenvalue = m_eigenvalues.data() + c * ns;
+        double sum = 0;
+        for (uint16_t k = 0; k < ns; k++)
+        {
+            sum += m_snr[k] * eigenvalue[k] / nc;
+        }
+        const double avgSnrDb = RatioToDb(std::max(sum / ns, 1e-30));
+        const auto avgSnr = static_cast<int>(std::lround((avgSnrDb - 22) * 4));
+        channelInfo.SetStStreamSnr(c, static_cast<uint8_t>(std::clamp(avgSnr, -128, 127)));
+        for (uint16_t k = 0; k < ns; k++)
+        {
+            const double snr = std::max(m_snr[k] * eigenvalue[k] / nc, 1e-30);
+            const auto delta = static_cast<int>(std::lround(RatioToDb(snr) - avgSnrDb));
+            deltaSnr[k * nc + c] = std::clamp(delta, -8, 7) & 0xf;
+        }
+    }
+}
+
+bool
+SpectrumCsiGenerator::ComputeGramMatrices(Ptr<const MobilityModel> peerMobility, uint8_t nr)
+{
+    NS_LOG_FUNCTION(this << peerMobility << +nr);
+    Ptr<MobilityModel> localMobility = m_phy->GetMobility();
+    if (!m_channelModel || !m_localAntenna || !m_peerAntenna || !peerMobility || !localMobility)
+    {
+        return false;
+    }
+
+    auto channel =
+        m_channelModel->GetChannel(localMobility, peerMobility, m_localAntenna, m_peerAntenna);
+    auto params = m_channelModel->GetParams(localMobility, peerMobility);
+    // H[u][s][n]: make u index the antennas of this station and s those of the beamformer
+    const bool reverse = channel->IsReverse(m_localAntenna->GetId(), m_peerAntenna->GetId());
+    const auto& h = channel->m_channel;
+    const std::size_t nRx = reverse ? h.GetNumCols() : h.GetNumRows();
+    const std::size_t nTx = std::min<std::size_t>(reverse ? h.GetNumRows() : h.GetNumCols(), nr);
+    const std::size_t nClusters = std::min<std::size_t>(h.GetNumPages(), params->m_delay.size());
+    const std::size_t ns = m_snr.size();
+
+    // Frequency response on the reported subcarriers, zero for the missing transmit antennas
+    m_hRe.assign(nRx * nr * ns, 0);
+    m_hIm.assign(m_hRe.size(), 0);
+    m_rotRe.resize(ns);
+    m_rotIm.resize(ns);
+    for (std::size_t n = 0; n < nClusters; n++)
+    {
+        for (std::size_t k = 0; k < ns; k++)
+        {
+            const double phase = -2 * M_PI * m_frequency[k] * params->m_delay[n];
+            m_rotRe[k] = std::cos(phase);
+            m_rotIm[k] = std::sin(phase);
+        }
+        for (std::size_t u = 0; u < nRx; u++)
+        {
+            for (std::size_t s = 0; s < nTx; s++)
+            {
+                const std::complex<double> coeff = reverse ? h(s, u, n) : h(u, s, n);
+                double* hRe = m_hRe.data() + (u * nr + s) * ns;
+                double* hIm = m_hIm.data() + (u * nr + s) * ns;
+                for (std::size_t k = 0; k < ns; k++)
+                {
+                    hRe[k] += coeff.real() * m_rotRe[k] - coeff.imag() * m_rotIm[k];
+                    hIm[k] += coeff.real() * m_rotIm[k] + coeff.imag() * m_rotRe[k];
+                }
+            }
+        }
+    }
+
+    double power = 0;
+    for (std::size_t e = 0; e < m_hRe.size(); e++)
+    {
+        power += m_hRe[e] * m_hRe[e] + m_hIm[e] * m_hIm[e];
+    }
+    if (power <= 0)
+    {
+        return false;
+    }
+    const double scale = static_cast<double>(ns * nRx * nTx) / power;
+
+    // Gram matrices A = H^H * H
+    m_gramRe.assign(static_cast<std::size_t>(nr) * nr * ns, 0);
+    m_gramIm.assign(m_gramRe.size(), 0);
+    for (std::size_t i = 0; i < nr; i++)
+    {
+        for (std::size_t j = 0; j < nr; j++)
+        {
+            double* aRe = m_gramRe.data() + (i * nr + j) * ns;
+            double* aIm = m_gramIm.data() + (i * nr + j) * ns;
+            for (std::size_t u = 0; u < nRx; u++)
+            {
+                const double* hiRe = m_hRe.data() + (u * nr + i) * ns;
+                const double* hiIm = m_hIm.data() + (u * nr + i) * ns;
+                const double* hjRe = m_hRe.data() + (u * nr + j) * ns;
+                const double* hjIm = m_hIm.data() + (u * nr + j) * ns;
+                for (std::size_t k = 0; k < ns; k++)
+                {
+                    aRe[k] += (hiRe[k] * hjRe[k] + hiIm[k] * hjIm[k]) * scale;
+                    aIm[k] += (hiRe[k] * hjIm[k] - hiIm[k] * hjRe[k]) * scale;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void
+SpectrumCsiGenerator::ComputeEigenvectors(uint8_t nr, uint8_t nc)
+{
+    NS_LOG_FUNCTION(this << +nr << +nc);
+    const std::size_t ns = m_snr.size();
+    const std::size_t size = static_cast<std::size_t>(nr) * nc * ns;
+    m_vRe.resize(size);
+    m_vIm.assign(size, 0);
+    m_wRe.resize(size);
+    m_wIm.resize(size);
+    m_eigenvalues.resize(static_cast<std::size_t>(nc) * ns);
+
+    // Starting subspace: columns of the identity with a small common component, so that
+    // no column is orthogonal to the dominant eigenvectors by construction
+    for (std::size_t r = 0; r < nr; r++)
+    {
+        for (std::size_t c = 0; c < nc; c++)
+        {
+            std::fill_n(m_vRe.begin() + (r * nc + c) * ns, ns, (r == c ? 1.0 : 0.1));
+        }
+    }
+
+    // W = A * V, computed on all subcarriers at once
+    auto multiply = [&]() {
+        std::fill(m_wRe.begin(), m_wRe.end(), 0);
+        std::fill(m_wIm.begin(), m_wIm.end(), 0);
+        for (std::size_t i = 0; i < nr; i++)
+        {
+            for (std::size_t j = 0; j < nr; j++)
+            {
+                const double* aRe = m_gramRe.data() + (i * nr + j) * ns;
+                const double* aIm = m_gramIm.data() + (i * nr + j) * ns;
+                for (std::size_t c = 0; c < nc; c++)
+                {
+                    const double* vRe = m_vRe.data() + (j * nc + c) * ns;
+                    const double* vIm = m_vIm.data() + (j * nc + c) * ns;
+                    double* wRe = m_wRe.data() + (i * nc + c) * ns;
+                    double* wIm = m_wIm.data() + (i * nc + c) * ns;
+                    for (std::size_t k = 0; k < ns; k++)
+                    {
+                        wRe[k] += aRe[k] * vRe[k] - aIm[k] * vIm[k];
+                        wIm[k] += aRe[k] * vIm[k] + aIm[k] * vRe[k];
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<double>& dotRe = m_rotRe;
+    std::vector<double>& dotIm = m_rotIm;
+    dotRe.resize(ns);
+    dotIm.resize(ns);
+    for (uint8_t iteration = 0; iteration < m_nIterations; iteration++)
+    {
+        multiply();
+        // modified Gram-Schmidt orthonormalization of the columns of W into V
+        for (std::size_t c = 0; c < nc; c++)
+        {
+            for (std::size_t p = 0; p < c; p++)
+            {
+                std::fill(dotRe.begin(), dotRe.end(), 0);
+                std::fill(dotIm.begin(), dotIm.end(), 0);
+                for (std::size_t r = 0; r < nr; r++)
+                {
+                    const double* vRe = m_vRe.data() + (r * nc + p) * ns;
+                    const double* vIm = m_vIm.data() + (r * nc + p) * ns;
+                    const double* wRe = m_wRe.data() + (r * nc + c) * ns;
+                    const double* wIm = m_wIm.data() + (r * nc + c) * ns;
+                    for (std::size_t k = 0; k < ns; k++)
+                    {
+                        dotRe[k] += vRe[k] * wRe[k] + vIm[k] * wIm[k];
+                        dotIm[k] += vRe[k] * wIm[k] - vIm[k] * wRe[k];
+                    }
+                }
+                for (std::size_t r = 0; r < nr; r++)
+                {
+                    const double* vRe = m_vRe.data() + (r * nc + p) * ns;
+                    const double* vIm = m_vIm.data() + (r * nc + p) * ns;
+                    double* wRe = m_wRe.data() + (r * nc + c) * ns;
+                    double* wIm = m_wIm.data() + (r * nc + c) * ns;
+                    for (std::size_t k = 0; k < ns; k++)
+                    {
+                        wRe[k] -= dotRe[k] * vRe[k] - dotIm[k] * vIm[k];
+                        wIm[k] -= dotRe[k] * vIm[k] + dotIm[k] * vRe[k];
+                    }
+                }
+            }
+            std::fill(dotRe.begin(), dotRe.end(), 0);
+            for (std::size_t r = 0; r < nr; r++)
+            {
+                const double* wRe = m_wRe.data() + (r * nc + c) * ns;
+                const double* wIm = m_wIm.data() + (r * nc + c) * ns;
+                for (std::size_t k = 0; k < ns; k++)
+                {
+                    dotRe[k] += wRe[k] * wRe[k] + wIm[k] * wIm[k];
+                }
+            }
+            for (std::size_t k = 0; k < ns; k++)
+            {
+                dotRe[k] = (dotRe[k] > 0 ? 1 / std::sqrt(dotRe[k]) : 0);
+            }
+            for (std::size_t r = 0; r < nr; r++)
+            {
+                const double* wRe = m_wRe.data() + (r * nc + c) * ns;
+                const double* wIm = m_wIm.data() + (r * nc + c) * ns;
+                double* vRe = m_vRe.data() + (r * nc + c) * ns;
+                double* vIm = m_vIm.data() + (r * nc + c) * ns;
+                for (std::size_t k = 0; k < ns; k++)
+                {
+                    vRe[k] = wRe[k] * dotRe[k];
+                    vIm[k] = wIm[k] * dotRe[k];
+                }
+            }
+        }
+    }
+
+    // Eigenvalues as Rayleigh quotients v^H * A * v
+    multiply();
+    std::fill(m_eigenvalues.begin(), m_eigenvalues.end(), 0);
+    for (std::size_t c = 0; c < nc; c++)
+    {
+        double* eigenvalue = m_eigenvalues.data() + c * ns;
+        for (std::size_t r = 0; r < nr; r++)
+        {
+            const double* vRe = m_vRe.data() + (r * nc + c) * ns;
+            const double* vIm = m_vIm.data() + (r * nc + c) * ns;
+            const double* wRe = m_wRe.data() + (r * nc + c) * ns;
+            const double* wIm = m_wIm.data() + (r * nc + c) * ns;
+            for (std::size_t k = 0; k < ns; k++)
+            {
+                eigenvalue[k] += vRe[k] * wRe[k] + vIm[k] * wIm[k];
+            }
+        }
+    }
+}
+
+void
+SpectrumCsiGenerator::DecomposeBeamformingMatrix(std::complex<double>* v,
+                                                 uint8_t nr,
+                                                 uint8_t nc,
+                                                 double* phi,
+                                                 double* psi)
+{
+    auto at = [v, nc](std::size_t row, std::size_t col) -> std::complex<double>& {
+        return v[row * nc + col];
+    };
+
+    // make the last row real and non-negative (multiplication by D~^H)
+    for (std::size_t c = 0; c < nc; c++)
+    {
+        const std::complex<double> rot = std::polar(1.0, -std::arg(at(nr - 1, c)));
+        for (std::size_t r = 0; r < nr; r++)
+        {
+            at(r, c) *= rot;
+        }
+    }
+
+    std::size_t nPhi = 0;
+    std::size_t nPsi = 0;
+    for (std::size_t i = 0; i < std::min<std::size_t>(nc, nr - 1); i++)
+    {
+        // multiplication by D_i^H: make the elements of column i real and non-negative
+        for (std::size_t l = i; l < nr - 1U; l++)
+        {
+            double angle = std::arg(at(l, i));
+            const std::complex<double> rot = std::polar(1.0, -angle);
+            for (std::size_t c = 0; c < nc; c++)
+            {
+                at(l, c) *= rot;
+            }
+            phi[nPhi++] = (angle < 0 ? angle + 2 * M_PI : angle);
+        }
+        // multiplications by G_li: zero the elements of column i below the diagonal
+        for (std::size_t l = i + 1; l < nr; l++)
+        {
+            double angle = std::atan2(at(l, i).real(), at(i, i).real());
+            angle = std::clamp(angle, 0.0, M_PI / 2);
+            const double cosAngle = std::cos(angle);
+            const double sinAngle = std::sin(angle);
+            for (std::size_t c = 0; c < nc; c++)
+            {
+                const std::complex<double> vi = at(i, c);
+                const std::complex<double> vl = at(l, c);
+                at(i, c) = cosAngle * vi + sinAngle * vl;
+                at(l, c) = -sinAngle * vi + cosAngle * vl;
+            }
+            psi[nPsi++] = angle;
+        }
+    }
+}
+
+uint16_t
+SpectrumCsiGenerator::QuantizePhi(double phi, uint8_t bits)
+{
+    // phi = k * pi / 2^(b-1) + pi / 2^b, k = 0, ..., 2^b - 1
+    const auto k = static_cast<int64_t>(std::floor(phi * (1 << (bits - 1)) / M_PI));
+    return static_cast<uint16_t>(std::clamp<int64_t>(k, 0, (1 << bits) - 1));
+}
+
+uint16_t
+SpectrumCsiGenerator::QuantizePsi(double psi, uint8_t bits)
+{
+    // psi = k * pi / 2^(b+1) + pi / 2^(b+2), k = 0, ..., 2^b - 1
+    const auto k = static_cast<int64_t>(std::floor(psi * (1 << (bits + 1)) / M_PI));
+    return static_cast<uint16_t>(std::clamp<int64_t>(k, 0, (1 << bits) - 1));
+}
+
+} // namespace ns3
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SPECTRUM_CSI_GENERATOR_H
+#define SPECTRUM_CSI_GENERATOR_H
+
+#include "csi-generator.h"
+
+#include "ns3/nstime.h"
+
+#include <complex>
+#include <map>
+#include <vector>
+
+namespace ns3
+{
+
+class MatrixBasedChannelModel;
+class MobilityModel;
+class PhasedArrayModel;
+class SpectrumValue;
+class WifiPhy;
+struct WifiSpectrumSignalParameters;
+
+/**
+ * \ingroup wifi
+ *
+ * Generate channel information from the signal actually received over the spectrum channel.
+ *
+ * The generator is attached to a SpectrumWifiPhy and keeps the PSD of the last NDP received
+ * from each transmitter, identified by the transmitter address of the NDP, so that the
+ * channel information of a sounding is always derived from the NDP sent by the beamformer
+ * announced by the NDPA, even if NDPs of other (possibly overlapping) BSSs have been received
+ * in the meantime. The per-subcarrier SNR is derived from that PSD and the receiver
+ * noise figure. If a matrix-based channel model (e.g., ThreeGppChannelModel) and the antenna
+ * arrays of both ends are provided, the frequency response of the MIMO channel is computed
+ * on each reported subcarrier and its right singular vectors are obtained by a subspace
+ * iteration run across all subcarriers at once; the resulting beamforming matrices are then
+ * compressed into Givens rotation angles as specified in IEEE 802.11ax. Otherwise, the
+ * channel is considered flat in space and only the SNR fields carry information.
+ *
+ * The channel information computed for a transmitter is reused as long as the coherence time
+ * has not expired, which bounds the cost when the sounding interval is short.
+ */
+class SpectrumCsiGenerator : public CsiGenerator
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+    SpectrumCsiGenerator();
+    ~SpectrumCsiGenerator() override;
+
+    /**
+     * Attach this generator to the given PHY, which must be a SpectrumWifiPhy.
+     *
+     * \param phy the PHY receiving the NDPs
+     */
+    void SetWifiPhy(Ptr<WifiPhy> phy);
+
+    void Generate(const HeMimoControlHeader& heMimoControlHeader,
+                  Mac48Address transmitter,
+                  CsiBuffer& channelInfo) override;
+    int64_t AssignStreams(int64_t stream) override;
+
+    /**
+     * Compress a beamforming matrix into the angles of a sequence of Givens rotations, as
+     * specified in Section 19.3.12.3.6 of IEEE 802.11-2020. The matrix is modified in place.
+     * Angles are stored in the order in which they are generated, i.e., for each column i,
+     * the Phi angles of rows i to Nr-1 followed by the Psi angles of rows i+1 to Nr.
+     *
+     * \param v the Nr x Nc beamforming matrix, stored row by row
+     * \param nr the number of rows
+     * \param nc the number of columns
+     * \param phi the Phi angles (in [0, 2*pi))
+     * \param psi the Psi angles (in [0, pi/2])
+     */
+    static void DecomposeBeamformingMatrix(std::complex<double>* v,
+                                           uint8_t nr,
+                                           uint8_t nc,
+                                           double* phi,
+                                           double* psi);
+
+    /**
+     * Quantize a Phi angle.
+     *
+     * \param phi the angle (in [0, 2*pi))
+     * \param bits the number of bits
+     * \return the quantized angle
+     */
+    static uint16_t QuantizePhi(double phi, uint8_t bits);
+
+    /**
+     * Quantize a Psi angle.
+     *
+     * \param psi the angle (in [0, pi/2])
+     * \param bits the number of bits
+     * \return the quantized angle
+     */
+    static uint16_t QuantizePsi(double psi, uint8_t bits);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /**
+     * Callback invoked when the PHY starts to process a Wi-Fi signal.
+     *
+     * \param params the parameters of the received signal
+     * \param senderNodeId node Id of the sender of the signal
+     */
+    void NotifyWifiSignal(Ptr<const WifiSpectrumSignalParameters> params, uint32_t senderNodeId);
+
+    /**
+     * Compute the channel information from the given NDP measurement.
+     *
+     * \param heMimoControlHeader the HE MIMO Control field of the beamforming report
+     * \param psd the PSD of the NDP
+     * \param peerMobility the mobility model of the transmitter of the NDP
+     * \param channelInfo the buffer to fill
+     */
+    void Compute(const HeMimoControlHeader& heMimoControlHeader,
+                 Ptr<const SpectrumValue> psd,
+                 Ptr<const MobilityModel> peerMobility,
+                 CsiBuffer& channelInfo);
+
+    /**
+     * Fill the per-subcarrier matrices H^H * H from the channel model, normalized to a unit
+     * average gain per antenna pair. Return false if no channel matrix is available.
+     *
+     * \param peerMobility the mobility model of the transmitter of the NDP
+     * \param nr the number of transmit antennas of the beamformer
+     * \return whether the matrices have been computed
+     */
+    bool ComputeGramMatrices(Ptr<const MobilityModel> peerMobility, uint8_t nr);
+
+    /**
+     * Compute the nc dominant eigenvectors and eigenvalues of the Gram matrices of all
+     * subcarriers by means of a subspace iteration.
+     *
+     * \param nr the order of the Gram matrices
+     * \param nc the number of eigenvectors
+     */
+    void ComputeEigenvectors(uint8_t nr, uint8_t nc);
+
+    /// The last NDP received from a transmitter
+    struct NdpMeasurement
+    {
+        Ptr<const SpectrumValue> psd;      //!< PSD of the NDP
+        Ptr<const MobilityModel> mobility; //!< mobility model of the transmitter
+    };
+
+    /// Channel information computed for a transmitter
+    struct CachedCsi
+    {
+        CsiBuffer channelInfo; //!< the channel information
+        Time computedAt;       //!< the time the channel information was computed
+        uint8_t nr;            //!< number of rows of the beamforming matrices
+        uint8_t bits1;         //!< number of bits of the Phi angles
+        uint8_t bits2;         //!< number of bits of the Psi angles
+        uint8_t ruStart;       //!< first RU of the report
+        uint8_t ruEnd;         //!< last RU of the report
+    };
+
+    Ptr<WifiPhy> m_phy;                          //!< the PHY receiving the NDPs
+    Ptr<MatrixBasedChannelModel> m_channelModel; //!< the optional channel model
+    Ptr<PhasedArrayModel> m_localAntenna;        //!< the antenna array of this station
+    Ptr<PhasedArrayModel> m_peerAntenna;         //!< the antenna array of the beamformer
+    Time m_coherenceTime;                        //!< channel coherence time
+    double m_noiseFigureDb;                      //!< receiver noise figure (dB)
+    uint8_t m_nIterations;                       //!< number of subspace iterations
+    std::map<Mac48Address, NdpMeasurement> m_ndps; //!< last NDP per transmitter
+    std::map<Mac48Address, CachedCsi> m_cache;     //!< channel information per transmitter
+
+    // Workspace reused across computations. The values of a matrix element on all the
+    // reported subcarriers are contiguous, so that the inner loops run over the subcarriers.
+    std::vector<double> m_frequency;   //!< center frequency of each reported subcarrier (Hz)
+    std::vector<double> m_snr;         //!< SNR of each reported subcarrier (linear)
+    std::vector<double> m_hRe;         //!< channel frequency response, real part
+    std::vector<double> m_hIm;         //!< channel frequency response, imaginary part
+    std::vector<double> m_rotRe;       //!< per-cluster phase rotation, real part
+    std::vector<double> m_rotIm;       //!< per-cluster phase rotation, imaginary part
+    std::vector<double> m_gramRe;      //!< Gram matrices, real part
+    std::vector<double> m_gramIm;      //!< Gram matrices, imaginary part
+    std::vector<double> m_vRe;         //!< eigenvectors, real part
+    std::vector<double> m_vIm;         //!< eigenvectors, imaginary part
+    std::vector<double> m_wRe;         //!< subspace iteration product, real part
+    std::vector<double> m_wIm;         //!< subspace iteration product, imaginary part
+    std::vector<double> m_eigenvalues; //!< eigenvalues
+};
+
+} // namespace ns3
+
+#endif /* SPECTRUM_CSI_GENERATOR_H */
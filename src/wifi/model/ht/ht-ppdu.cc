@@ -107,7 +107,7 @@ HtPpdu::SetTxVectorFromPhyHeaders(WifiTxVector& txVector,
 }
 
 Time
-HtPpdu::GetTxDuration() const
+HtPpdu::DoGetTxDuration() const
 {
     const auto& txVector = GetTxVector();
     const auto htLength = m_htSig.GetHtLength();
@@ -137,11 +137,11 @@ class HtPpdu : public OfdmPpdu
            Time ppduDuration,
            uint64_t uid);
 
-    Time GetTxDuration() const override;
     Ptr<WifiPpdu> Copy() const override;
 
   private:
     WifiTxVector DoGetTxVector() const override;
+    Time DoGetTxDuration() const override;
 
     /**
      * Fill in the PHY headers.
@@ -205,12 +205,10 @@ void
 InterferenceHelper::DoDispose()
 {
     NS_LOG_FUNCTION(this);
-    for (auto it : m_niChanges)
-    {
-        it.second.clear();
-    }
     m_niChanges.clear();
     m_firstPowers.clear();
+    m_bands.clear();
+    m_bandIds.clear();
     m_errorRateModel = nullptr;
 }
 
@@ -242,27 +240,26 @@ InterferenceHelper::AddForeignSignal(Time duration, RxPowerWattPerChannelBand& r
 bool
 InterferenceHelper::HasBands() const
 {
-    return !m_niChanges.empty();
+    return !m_bands.empty();
 }
 
 bool
 InterferenceHelper::HasBand(const WifiSpectrumBandInfo& band) const
 {
-    return (m_niChanges.count(band) > 0);
+    return (m_bandIds.count(band) > 0);
 }
 
 void
 InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
 {
     NS_LOG_FUNCTION(this << band);
-    NS_ASSERT(m_niChanges.count(band) == 0);
-    NS_ASSERT(m_firstPowers.count(band) == 0);
-    NiChanges niChanges;
-    auto result = m_niChanges.insert({band, niChanges});
+    auto result = m_bandIds.insert({band, m_bands.size()});
     NS_ASSERT(result.second);
+    m_bands.push_back(band);
+    m_niChanges.emplace_back();
     // Always have a zero power noise event in the list
-    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), result.first);
-    m_firstPowers.insert({band, 0.0});
+    AddNiChangeEvent(Time(0), NiChange(0.0, nullptr), result.first->second);
+    m_firstPowers.push_back(0.0);
 }
 
 void
@@ -270,30 +267,37 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
                                 const FrequencyRange& freqRange)
 {
     NS_LOG_FUNCTION(this << freqRange);
-    for (auto it = m_niChanges.begin(); it != m_niChanges.end();)
+    // keep the bands that are outside the frequency range or that belong to the new bands, and
+    // compact the remaining ones so that band IDs stay dense
+    std::size_t nextId = 0;
+    for (std::size_t id = 0; id < m_bands.size(); ++id)
     {
-        if (!IsBandInFrequencyRange(it->first, freqRange))
+        bool keep = !IsBandInFrequencyRange(m_bands[id], freqRange);
+        if (!keep)
         {
-            it++;
-            continue;
+            const auto frequencies = m_bands[id].frequencies;
+            keep = std::find_if(bands.cbegin(), bands.cend(), [frequencies](const auto& item) {
+                       return frequencies == item.frequencies;
+                   }) != std::end(bands);
         }
-        const auto frequencies = it->first.frequencies;
-        const auto found =
-            std::find_if(bands.cbegin(), bands.cend(), [frequencies](const auto& item) {
-                return frequencies == item.frequencies;
-            }) != std::end(bands);
-        if (!found)
+        if (!keep)
         {
             // band does not belong to the new bands, erase it
-            m_firstPowers.erase(it->first);
-            it->second.clear();
-            it = m_niChanges.erase(it);
+            m_bandIds.erase(m_bands[id]);
+            continue;
         }
-        else
+        if (nextId != id)
         {
-            it++;
+            m_bands[nextId] = std::move(m_bands[id]);
+            m_niChanges[nextId] = std::move(m_niChanges[id]);
+            m_firstPowers[nextId] = m_firstPowers[id];
+            m_bandIds[m_bands[nextId]] = nextId;
         }
+        ++nextId;
     }
+    m_bands.resize(nextId);
+    m_niChanges.resize(nextId);
+    m_firstPowers.resize(nextId);
     for (const auto& band : bands)
     {
         if (!HasBand(band))
@@ -304,6 +308,14 @@ InterferenceHelper::UpdateBands(const std::vector<WifiSpectrumBandInfo>& bands,
     }
 }
 
+std::size_t
+InterferenceHelper::GetBandId(const WifiSpectrumBandInfo& band) const
+{
+    auto it = m_bandIds.find(band);
+    NS_ABORT_IF(it == m_bandIds.end());
+    return it->second;
+}
+
 void
 InterferenceHelper::SetNoiseFigure(double value)
 {
@@ -333,14 +345,14 @@ InterferenceHelper::GetEnergyDuration(double energyW, const WifiSpectrumBandInfo
 {
     NS_LOG_FUNCTION(this << energyW << band);
     Time now = Simulator::Now();
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto i = GetPreviousPosition(now, niIt);
-    Time end = i->first;
-    for (; i != niIt->second.end(); ++i)
+    const auto bandId = GetBandId(band);
+    const auto& niChanges = m_niChanges[bandId];
+    auto i = GetPreviousPosition(now, bandId);
+    Time end = niChanges[i].first;
+    for (; i < niChanges.size(); ++i)
     {
-        double noiseInterferenceW = i->second.GetPower();
-        end = i->first;
+        double noiseInterferenceW = niChanges[i].second.GetPower();
+        end = niChanges[i].first;
         if (noiseInterferenceW < energyW)
         {
             break;
@@ -355,32 +367,35 @@ InterferenceHelper::AppendEvent(Ptr<Event> event, bool isStartHePortionRxing)
     NS_LOG_FUNCTION(this << event << isStartHePortionRxing);
     for (const auto& [band, power] : event->GetRxPowerWPerBand())
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
+        const auto bandId = GetBandId(band);
+        auto& niChanges = m_niChanges[bandId];
         double previousPowerStart = 0;
         double previousPowerEnd = 0;
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
+        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), bandId);
+        previousPowerStart = niChanges[previousPowerPosition].second.GetPower();
+        previousPowerEnd =
+            niChanges[GetPreviousPosition(event->GetEndTime(), bandId)].second.GetPower();
         if (!m_rxing)
         {
-            m_firstPowers.find(band)->second = previousPowerStart;
-            // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
+            m_firstPowers[bandId] = previousPowerStart;
+            // Always leave the first zero power noise event in the list. Expired NI changes
+            // are removed in a single erase, which keeps the capacity of the array.
+            niChanges.erase(niChanges.begin() + 1, niChanges.begin() + previousPowerPosition + 1);
         }
         else if (isStartHePortionRxing)
         {
             // When the first HE portion is received, we need to set m_firstPowerPerBand
             // so that it takes into account interferences that arrived between the start of the
             // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
+            m_firstPowers[bandId] = previousPowerStart;
         }
         auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), bandId);
+        auto last =
+            AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), bandId);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            niChanges[i].second.AddPower(power);
         }
     }
 }
@@ -392,13 +407,13 @@ InterferenceHelper::UpdateEvent(Ptr<Event> event, const RxPowerWattPerChannelBan
     // This is called for UL MU events, in order to scale power as long as UL MU PPDUs arrive
     for (const auto& [band, power] : rxPower)
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        auto first = GetPreviousPosition(event->GetStartTime(), niIt);
-        auto last = GetPreviousPosition(event->GetEndTime(), niIt);
+        const auto bandId = GetBandId(band);
+        auto& niChanges = m_niChanges[bandId];
+        auto first = GetPreviousPosition(event->GetStartTime(), bandId);
+        auto last = GetPreviousPosition(event->GetEndTime(), bandId);
         for (auto i = first; i != last; ++i)
         {
-            i->second.AddPower(power);
+            niChanges[i].second.AddPower(power);
         }
     }
     event->UpdateRxPowerW(rxPower);
@@ -437,50 +452,58 @@ InterferenceHelper::CalculateSnr(double signal,
 }
 
 double
-InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
-                                                NiChangesPerBand& nis,
-                                                const WifiSpectrumBandInfo& band) const
+InterferenceHelper::CalculateNoiseInterferenceW(Ptr<const Event> event,
+                                                std::size_t bandId,
+                                                NiChangeRange& range) const
 {
+    const auto& band = m_bands[bandId];
     NS_LOG_FUNCTION(this << band);
-    auto firstPower_it = m_firstPowers.find(band);
-    NS_ABORT_IF(firstPower_it == m_firstPowers.end());
-    double noiseInterferenceW = firstPower_it->second;
-    auto niIt = m_niChanges.find(band);
-    NS_ABORT_IF(niIt == m_niChanges.end());
-    auto it = niIt->second.find(event->GetStartTime());
+    double noiseInterferenceW = m_firstPowers[bandId];
+    const auto& niChanges = m_niChanges[bandId];
+    const auto start = static_cast<std::size_t>(
+        std::lower_bound(niChanges.cbegin(),
+                         niChanges.cend(),
+                         event->GetStartTime(),
+                         [](const auto& niChange, Time t) { return niChange.first < t; }) -
+        niChanges.cbegin());
     double muMimoPowerW = (event->GetPpdu()->GetType() == WIFI_PPDU_TYPE_UL_MU)
-                              ? CalculateMuMimoPowerW(event, band)
+                              ? CalculateMuMimoPowerW(event, bandId, band)
                               : 0.0;
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    for (auto i = start; i < niChanges.size() && niChanges[i].first < Simulator::Now(); ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()) &&
-            (event != it->second.GetEvent()))
+        if (IsSameMuMimoTransmission(event, niChanges[i].second.GetEvent()) &&
+            (event != niChanges[i].second.GetEvent()))
         {
             // Do not calculate noiseInterferenceW if events belong to the same MU-MIMO transmission
             // unless this is the same event
             continue;
         }
-        noiseInterferenceW = it->second.GetPower() - event->GetRxPowerW(band) - muMimoPowerW;
+        noiseInterferenceW =
+            niChanges[i].second.GetPower() - event->GetRxPowerW(band) - muMimoPowerW;
         if (std::abs(noiseInterferenceW) < std::numeric_limits<double>::epsilon())
         {
             // fix some possible rounding issues with double values
             noiseInterferenceW = 0.0;
         }
     }
-    it = niIt->second.find(event->GetStartTime());
-    NS_ABORT_IF(it == niIt->second.end());
-    for (; it != niIt->second.end() && it->second.GetEvent() != event; ++it)
+    // The NI changes relevant to the event are the ones between the NI change added at the
+    // start of the event and the NI change added at the end of the event, which are referenced
+    // in place rather than copied
+    range.bandId = bandId;
+    range.first = start;
+    for (; range.first < niChanges.size() && niChanges[range.first].second.GetEvent() != event;
+         ++range.first)
     {
         ;
     }
-    NiChanges ni;
-    ni.emplace(event->GetStartTime(), NiChange(0, event));
-    while (++it != niIt->second.end() && it->second.GetEvent() != event)
+    NS_ABORT_IF(range.first == niChanges.size());
+    range.last = range.first + 1;
+    for (; range.last < niChanges.size() && niChanges[range.last].second.GetEvent() != event;
+         ++range.last)
     {
-        ni.insert(*it);
+        ;
     }
-    ni.emplace(event->GetEndTime(), NiChange(0, event));
-    nis.insert({band, ni});
+    NS_ABORT_IF(range.last == niChanges.size());
     NS_ASSERT_MSG(noiseInterferenceW >= 0.0,
                   "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
     return noiseInterferenceW;
@@ -488,35 +511,30 @@ InterferenceHelper::CalculateNoiseInterferenceW(Ptr<Event> event,
 
 double
 InterferenceHelper::CalculateMuMimoPowerW(Ptr<const Event> event,
+                                          std::size_t bandId,
                                           const WifiSpectrumBandInfo& band) const
 {
-    auto niIt = m_niChanges.find(band);
-    NS_ASSERT(niIt != m_niChanges.end());
-    auto it = niIt->second.begin();
-    ++it;
+    const auto& niChanges = m_niChanges[bandId];
     double muMimoPowerW = 0.0;
-    for (; it != niIt->second.end() && it->first < Simulator::Now(); ++it)
+    for (std::size_t i = 1; i < niChanges.size() && niChanges[i].first < Simulator::Now(); ++i)
     {
-        if (IsSameMuMimoTransmission(event, it->second.GetEvent()))
+        const auto& otherEvent = niChanges[i].second.GetEvent();
+        if (IsSameMuMimoTransmission(event, otherEvent))
         {
-            auto hePpdu = DynamicCast<HePpdu>(it->second.GetEvent()->GetPpdu()->Copy());
+            auto hePpdu = DynamicCast<HePpdu>(otherEvent->GetPpdu()->Copy());
             NS_ASSERT(hePpdu);
             HePpdu::TxPsdFlag psdFlag = hePpdu->GetTxPsdFlag();
             if (psdFlag == HePpdu::PSD_HE_PORTION)
             {
                 const auto staId =
                     event->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
-                const auto otherStaId = it->second.GetEvent()
-                                            ->GetPpdu()
-                                            ->GetTxVector()
-                                            .GetHeMuUserInfoMap()
-                                            .cbegin()
-                                            ->first;
+                const auto otherStaId =
+                    otherEvent->GetPpdu()->GetTxVector().GetHeMuUserInfoMap().cbegin()->first;
                 if (staId == otherStaId)
                 {
                     break;
                 }
-                muMimoPowerW += it->second.GetEvent()->GetRxPowerW(band);
+                muMimoPowerW += otherEvent->GetRxPowerW(band);
             }
         }
     }
@@ -569,74 +587,81 @@ InterferenceHelper::CalculatePayloadChunkSuccessRate(double snir,
 double
 InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
                                         uint16_t channelWidth,
-                                        NiChangesPerBand* nis,
+                                        const NiChangeRange& range,
                                         const WifiSpectrumBandInfo& band,
                                         uint16_t staId,
                                         std::pair<Time, Time> window) const
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << window.first << window.second);
-    double psr = 1.0; /* Packet Success Rate */
-    const auto& niIt = nis->find(band)->second;
-    auto j = niIt.cbegin();
-    Time previous = j->first;
+    const auto& niChanges = m_niChanges[range.bandId];
+    auto j = range.first;
+    Time previous = niChanges[j].first;
     double muMimoPowerW = 0.0;
-    WifiMode payloadMode = event->GetPpdu()->GetTxVector().GetMode(staId);
-    Time phyPayloadStart = j->first;
+    const auto& txVector = event->GetPpdu()->GetTxVector();
+    WifiMode payloadMode = txVector.GetMode(staId);
+    const auto nss = txVector.GetNss(staId);
+    // the chunks are collected and evaluated all at once by the error rate model
+    m_payloadChunks.clear();
+    auto addChunk = [&](double snr, Time duration) {
+        if (!duration.IsZero())
+        {
+            uint64_t rate = payloadMode.GetDataRate(txVector, staId);
+            auto nbits = static_cast<uint64_t>(rate * duration.GetSeconds());
+            nbits /= nss; // divide effective number of bits by NSS to achieve same chunk
+                          // error rate as SISO for AWGN
+            m_payloadChunks.emplace_back(snr, nbits);
+        }
+    };
+    Time phyPayloadStart = previous;
     if (event->GetPpdu()->GetType() != WIFI_PPDU_TYPE_UL_MU &&
         event->GetPpdu()->GetType() !=
-            WIFI_PPDU_TYPE_DL_MU) // j->first corresponds to the start of the MU payload
+            WIFI_PPDU_TYPE_DL_MU) // previous corresponds to the start of the MU payload
     {
-        phyPayloadStart = j->first + WifiPhy::CalculatePhyPreambleAndHeaderDuration(
-                                         event->GetPpdu()->GetTxVector());
+        phyPayloadStart = previous + event->GetPpdu()->GetPreambleAndHeaderDuration();
     }
     else
     {
-        muMimoPowerW = CalculateMuMimoPowerW(event, band);
+        muMimoPowerW = CalculateMuMimoPowerW(event, range.bandId, band);
     }
     Time windowStart = phyPayloadStart + window.first;
     Time windowEnd = phyPayloadStart + window.second;
-    NS_ABORT_IF(m_firstPowers.count(band) == 0);
-    double noiseInterferenceW = m_firstPowers.at(band);
+    double noiseInterferenceW = m_firstPowers[range.bandId];
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.cend())
+    while (++j <= range.last)
     {
-        Time current = j->first;
+        Time current = niChanges[j].first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
-        double snr = CalculateSnr(powerW,
-                                  noiseInterferenceW,
-                                  channelWidth,
-                                  event->GetPpdu()->GetTxVector().GetNss(staId));
+        double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, nss);
         // Case 1: Both previous and current point to the windowed payload
         if (previous >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - previous,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            addChunk(snr, Min(windowEnd, current) - previous);
             NS_LOG_DEBUG("Both previous and current point to the windowed payload: mode="
-                         << payloadMode << ", psr=" << psr);
+                         << payloadMode << ", snr=" << snr);
         }
         // Case 2: previous is before windowed payload and current is in the windowed payload
         else if (current >= windowStart)
         {
-            psr *= CalculatePayloadChunkSuccessRate(snr,
-                                                    Min(windowEnd, current) - windowStart,
-                                                    event->GetPpdu()->GetTxVector(),
-                                                    staId);
+            addChunk(snr, Min(windowEnd, current) - windowStart);
             NS_LOG_DEBUG(
                 "previous is before windowed payload and current is in the windowed payload: mode="
-                << payloadMode << ", psr=" << psr);
+                << payloadMode << ", snr=" << snr);
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        if (IsSameMuMimoTransmission(event, j->second.GetEvent()))
+        if (j == range.last)
         {
-            muMimoPowerW += j->second.GetEvent()->GetRxPowerW(band);
+            // the NI change at the end of the event only closes the last chunk
+            break;
+        }
+        noiseInterferenceW = niChanges[j].second.GetPower() - powerW;
+        if (IsSameMuMimoTransmission(event, niChanges[j].second.GetEvent()))
+        {
+            muMimoPowerW += niChanges[j].second.GetEvent()->GetRxPowerW(band);
             NS_LOG_DEBUG(
                 "PPDU belongs to same MU-MIMO transmission: muMimoPowerW=" << muMimoPowerW);
         }
         noiseInterferenceW -= muMimoPowerW;
-        previous = j->first;
+        previous = current;
         if (previous > windowEnd)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous
@@ -644,6 +669,13 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
             break;
         }
     }
+    double psr = m_errorRateModel->GetChunksSuccessRate(payloadMode,
+                                                        txVector,
+                                                        m_payloadChunks,
+                                                        m_numRxAntennas,
+                                                        WIFI_PPDU_FIELD_DATA,
+                                                        staId); /* Packet Success Rate */
+    NS_LOG_DEBUG(m_payloadChunks.size() << " chunks: psr=" << psr);
     double per = 1 - psr;
     return per;
 }
@@ -651,15 +683,15 @@ InterferenceHelper::CalculatePayloadPer(Ptr<const Event> event,
 double
 InterferenceHelper::CalculatePhyHeaderSectionPsr(
     Ptr<const Event> event,
-    NiChangesPerBand* nis,
+    const NiChangeRange& range,
     uint16_t channelWidth,
     const WifiSpectrumBandInfo& band,
     PhyEntity::PhyHeaderSections phyHeaderSections) const
 {
     NS_LOG_FUNCTION(this << band);
     double psr = 1.0; /* Packet Success Rate */
-    auto niIt = nis->find(band)->second;
-    auto j = niIt.begin();
+    const auto& niChanges = m_niChanges[range.bandId];
+    auto j = range.first;
 
     NS_ASSERT(!phyHeaderSections.empty());
     Time stopLastSection = Seconds(0);
@@ -668,13 +700,12 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
         stopLastSection = Max(stopLastSection, section.second.first.second);
     }
 
-    Time previous = j->first;
-    NS_ABORT_IF(m_firstPowers.count(band) == 0);
-    double noiseInterferenceW = m_firstPowers.at(band);
+    Time previous = niChanges[j].first;
+    double noiseInterferenceW = m_firstPowers[range.bandId];
     double powerW = event->GetRxPowerW(band);
-    while (++j != niIt.end())
+    while (++j <= range.last)
     {
-        Time current = j->first;
+        Time current = niChanges[j].first;
         NS_LOG_DEBUG("previous= " << previous << ", current=" << current);
         NS_ASSERT(current >= previous);
         double snr = CalculateSnr(powerW, noiseInterferenceW, channelWidth, 1);
@@ -700,8 +731,13 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
                 }
             }
         }
-        noiseInterferenceW = j->second.GetPower() - powerW;
-        previous = j->first;
+        if (j == range.last)
+        {
+            // the NI change at the end of the event only closes the last chunk
+            break;
+        }
+        noiseInterferenceW = niChanges[j].second.GetPower() - powerW;
+        previous = current;
         if (previous > stopLastSection)
         {
             NS_LOG_DEBUG("Stop: new previous=" << previous << " after stop of last section="
@@ -714,19 +750,19 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr(
 
 double
 InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
-                                          NiChangesPerBand* nis,
+                                          const NiChangeRange& range,
                                           uint16_t channelWidth,
                                           const WifiSpectrumBandInfo& band,
                                           WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    auto niIt = nis->find(band)->second;
     auto phyEntity =
         WifiPhy::GetStaticPhyEntity(event->GetPpdu()->GetTxVector().GetModulationClass());
 
     PhyEntity::PhyHeaderSections sections;
     for (const auto& section :
-         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(), niIt.begin()->first))
+         phyEntity->GetPhyHeaderSections(event->GetPpdu()->GetTxVector(),
+                                         m_niChanges[range.bandId][range.first].first))
     {
         if (section.first == header)
         {
@@ -737,7 +773,7 @@ InterferenceHelper::CalculatePhyHeaderPer(Ptr<const Event> event,
     double psr = 1.0;
     if (!sections.empty())
     {
-        psr = CalculatePhyHeaderSectionPsr(event, nis, channelWidth, band, sections);
+        psr = CalculatePhyHeaderSectionPsr(event, range, channelWidth, band, sections);
     }
     return 1 - psr;
 }
@@ -751,8 +787,8 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
 {
     NS_LOG_FUNCTION(this << channelWidth << band << staId << relativeMpduStartStop.first
                          << relativeMpduStartStop.second);
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    NiChangeRange range;
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, GetBandId(band), range);
     double snr = CalculateSnr(event->GetRxPowerW(band),
                               noiseInterferenceW,
                               channelWidth,
@@ -761,7 +797,8 @@ InterferenceHelper::CalculatePayloadSnrPer(Ptr<Event> event,
     /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePayloadPer(event, channelWidth, &ni, band, staId, relativeMpduStartStop);
+    double per =
+        CalculatePayloadPer(event, channelWidth, range, band, staId, relativeMpduStartStop);
 
     return PhyEntity::SnrPer(snr, per);
 }
@@ -772,8 +809,8 @@ InterferenceHelper::CalculateSnr(Ptr<Event> event,
                                  uint8_t nss,
                                  const WifiSpectrumBandInfo& band) const
 {
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    NiChangeRange range;
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, GetBandId(band), range);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, nss);
     return snr;
 }
@@ -785,38 +822,47 @@ InterferenceHelper::CalculatePhyHeaderSnrPer(Ptr<Event> event,
                                              WifiPpduField header) const
 {
     NS_LOG_FUNCTION(this << band << header);
-    NiChangesPerBand ni;
-    double noiseInterferenceW = CalculateNoiseInterferenceW(event, ni, band);
+    NiChangeRange range;
+    double noiseInterferenceW = CalculateNoiseInterferenceW(event, GetBandId(band), range);
     double snr = CalculateSnr(event->GetRxPowerW(band), noiseInterferenceW, channelWidth, 1);
 
     /* calculate the SNIR at the start of the PHY header and accumulate
      * all SNIR changes in the SNIR vector.
      */
-    double per = CalculatePhyHeaderPer(event, &ni, channelWidth, band, header);
+    double per = CalculatePhyHeaderPer(event, range, channelWidth, band, header);
 
     return PhyEntity::SnrPer(snr, per);
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetNextPosition(Time moment, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::GetNextPosition(Time moment, std::size_t bandId) const
 {
-    return niIt->second.upper_bound(moment);
+    const auto& niChanges = m_niChanges[bandId];
+    return static_cast<std::size_t>(
+        std::upper_bound(niChanges.cbegin(),
+                         niChanges.cend(),
+                         moment,
+                         [](Time t, const auto& niChange) { return t < niChange.first; }) -
+        niChanges.cbegin());
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::GetPreviousPosition(Time moment, std::size_t bandId) const
 {
-    auto it = GetNextPosition(moment, niIt);
+    auto it = GetNextPosition(moment, bandId);
     // This is safe since there is always an NiChange at time 0,
     // before moment.
     --it;
     return it;
 }
 
-InterferenceHelper::NiChanges::iterator
-InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
+std::size_t
+InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, std::size_t bandId)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), std::make_pair(moment, change));
+    auto& niChanges = m_niChanges[bandId];
+    auto it = niChanges.insert(niChanges.cbegin() + GetNextPosition(moment, bandId),
+                               std::make_pair(moment, change));
+    return static_cast<std::size_t>(it - niChanges.begin());
 }
 
 void
@@ -832,16 +878,16 @@ InterferenceHelper::NotifyRxEnd(Time endTime, const FrequencyRange& freqRange)
     NS_LOG_FUNCTION(this << endTime << freqRange);
     m_rxing = false;
     // Update m_firstPowers for frame capture
-    for (auto niIt = m_niChanges.begin(); niIt != m_niChanges.end(); ++niIt)
+    for (std::size_t bandId = 0; bandId < m_bands.size(); ++bandId)
     {
-        if (!IsBandInFrequencyRange(niIt->first, freqRange))
+        if (!IsBandInFrequencyRange(m_bands[bandId], freqRange))
         {
             continue;
         }
-        NS_ASSERT(niIt->second.size() > 1);
-        auto it = GetPreviousPosition(endTime, niIt);
+        NS_ASSERT(m_niChanges[bandId].size() > 1);
+        auto it = GetPreviousPosition(endTime, bandId);
         it--;
-        m_firstPowers.find(niIt->first)->second = it->second.GetPower();
+        m_firstPowers[bandId] = m_niChanges[bandId][it].second.GetPower();
     }
 }
 
@@ -387,19 +387,27 @@ class InterferenceHelper : public Object
     };
 
     /**
-     * typedef for a multimap of NiChange
+     * The NI changes of a band, sorted by time in a contiguous array. NI changes occurring at
+     * the same time are kept in insertion order.
      */
-    using NiChanges = std::multimap<Time, NiChange>;
+    using NiChanges = std::vector<std::pair<Time, NiChange>>;
 
     /**
-     * Map of NiChanges per band
+     * The NI changes of a band that are relevant to an event, i.e., the NI changes from the
+     * one marking the start of the event to the one marking the end of the event (included).
      */
-    using NiChangesPerBand = std::map<WifiSpectrumBandInfo, NiChanges>;
+    struct NiChangeRange
+    {
+        std::size_t bandId; //!< the ID of the band
+        std::size_t first;  //!< the index of the NI change at the start of the event
+        std::size_t last;   //!< the index of the NI change at the end of the event
+    };
 
     /**
-     * Map of first power per band
+     * \param band the band
+     * \return the dense ID of the given band, which must be tracked by this interference helper
      */
-    using FirstPowerPerBand = std::map<WifiSpectrumBandInfo, double>;
+    std::size_t GetBandId(const WifiSpectrumBandInfo& band) const;
 
     /**
      * Check whether a given band is tracked by this interference helper.
@@ -432,26 +440,29 @@ class InterferenceHelper : public Object
      * Calculate noise and interference power in W.
      *
      * \param event the event
-     * \param nis the NiChanges
-     * \param band the band
+     * \param bandId the ID of the band
+     * \param range the NI changes relevant to the event (set by this function)
      *
      * \return noise and interference power
      */
-    double CalculateNoiseInterferenceW(Ptr<Event> event,
-                                       NiChangesPerBand& nis,
-                                       const WifiSpectrumBandInfo& band) const;
+    double CalculateNoiseInterferenceW(Ptr<const Event> event,
+                                       std::size_t bandId,
+                                       NiChangeRange& range) const;
 
     /**
      * Calculate power of all other events preceding a given event that belong to the same MU-MIMO
      * transmission.
      *
      * \param event the event
+     * \param bandId the ID of the band
      * \param band the band
      *
      * \return the power of all other events preceding the event that belong to the same MU-MIMO
      * transmission
      */
-    double CalculateMuMimoPowerW(Ptr<const Event> event, const WifiSpectrumBandInfo& band) const;
+    double CalculateMuMimoPowerW(Ptr<const Event> event,
+                                 std::size_t bandId,
+                                 const WifiSpectrumBandInfo& band) const;
 
     /**
      * Calculate the error rate of the given PHY payload only in the provided time
@@ -460,7 +471,7 @@ class InterferenceHelper : public Object
      *
      * \param event the event
      * \param channelWidth the channel width used to transmit the PSDU (in MHz)
-     * \param nis the NiChanges
+     * \param range the NI changes relevant to the event
      * \param band identify the band used by the PSDU
      * \param staId the station ID of the PSDU (only used for MU)
      * \param window time window (pair of start and end times) of PHY payload to focus on
@@ -469,7 +480,7 @@ class InterferenceHelper : public Object
      */
     double CalculatePayloadPer(Ptr<const Event> event,
                                uint16_t channelWidth,
-                               NiChangesPerBand* nis,
+                               const NiChangeRange& range,
                                const WifiSpectrumBandInfo& band,
                                uint16_t staId,
                                std::pair<Time, Time> window) const;
@@ -478,7 +489,7 @@ class InterferenceHelper : public Object
      * can be divided into multiple chunks (e.g. due to interference from other transmissions).
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param range the NI changes relevant to the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param header the PHY header to consider
@@ -486,7 +497,7 @@ class InterferenceHelper : public Object
      * \return the error rate of the HT PHY header
      */
     double CalculatePhyHeaderPer(Ptr<const Event> event,
-                                 NiChangesPerBand* nis,
+                                 const NiChangeRange& range,
                                  uint16_t channelWidth,
                                  const WifiSpectrumBandInfo& band,
                                  WifiPpduField header) const;
@@ -494,7 +505,7 @@ class InterferenceHelper : public Object
      * Calculate the success rate of the PHY header sections for the provided event.
      *
      * \param event the event
-     * \param nis the NiChanges
+     * \param range the NI changes relevant to the event
      * \param channelWidth the channel width (in MHz) for header measurement
      * \param band the band
      * \param phyHeaderSections the map of PHY header sections (\see PhyEntity::PhyHeaderSections)
@@ -502,47 +513,49 @@ class InterferenceHelper : public Object
      * \return the success rate of the PHY header sections
      */
     double CalculatePhyHeaderSectionPsr(Ptr<const Event> event,
-                                        NiChangesPerBand* nis,
+                                        const NiChangeRange& range,
                                         uint16_t channelWidth,
                                         const WifiSpectrumBandInfo& band,
                                         PhyEntity::PhyHeaderSections phyHeaderSections) const;
 
     double m_noiseFigure;                 //!< noise figure (linear)
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
-    uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
-    NiChangesPerBand m_niChanges;    //!< NI Changes for each band
-    FirstPowerPerBand m_firstPowers; //!< first power of each band in watts
-    bool m_rxing;                    //!< flag whether it is in receiving state
+    uint8_t m_numRxAntennas; //!< the number of RX antennas in the corresponding receiver
+    std::map<WifiSpectrumBandInfo, std::size_t> m_bandIds; //!< dense ID of each band
+    std::vector<WifiSpectrumBandInfo> m_bands;             //!< bands indexed by ID
+    std::vector<NiChanges> m_niChanges;                    //!< NI Changes indexed by band ID
+    std::vector<double> m_firstPowers; //!< first power in watts indexed by band ID
+    bool m_rxing;                      //!< flag whether it is in receiving state
+    mutable std::vector<std::pair<double, uint64_t>>
+        m_payloadChunks; //!< SNR and number of bits of the payload chunks being evaluated
 
     /**
-     * Returns an iterator to the first NiChange that is later than moment
+     * Returns the index of the first NiChange that is later than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
+     * \param bandId the ID of the band to check
+     * \returns the index of the first NiChange that is later than moment
      */
-    NiChanges::iterator GetNextPosition(Time moment, NiChangesPerBand::iterator niIt);
+    std::size_t GetNextPosition(Time moment, std::size_t bandId) const;
     /**
-     * Returns an iterator to the last NiChange that is before than moment
+     * Returns the index of the last NiChange that is before than moment
      *
      * \param moment time to check from
-     * \param niIt iterator of the band to check
-     * \returns an iterator to the list of NiChanges
+     * \param bandId the ID of the band to check
+     * \returns the index of the last NiChange that is before than moment
      */
-    NiChanges::iterator GetPreviousPosition(Time moment, NiChangesPerBand::iterator niIt);
+    std::size_t GetPreviousPosition(Time moment, std::size_t bandId) const;
 
     /**
      * Add NiChange to the list at the appropriate position and
-     * return the iterator of the new event.
+     * return the index of the new event.
      *
      * \param moment time to check from
      * \param change the NiChange to add
-     * \param niIt iterator of the band to check
-     * \returns the iterator of the new event
+     * \param bandId the ID of the band to check
+     * \returns the index of the new event
      */
-    NiChanges::iterator AddNiChangeEvent(Time moment,
-                                         NiChange change,
-                                         NiChangesPerBand::iterator niIt);
+    std::size_t AddNiChangeEvent(Time moment, NiChange change, std::size_t bandId);
 
     /**
      * Return whether another event is a MU-MIMO event that belongs to the same transmission and to
@@ -653,6 +653,10 @@ WifiActionHeader::SetAction(WifiActionHeader::CategoryValue type,
         m_actionValue = static_cast<uint8_t>(action.protectedEhtAction);
         break;
     }
+    case SENSING: {
+        m_actionValue = static_cast<uint8_t>(action.sensingAction);
+        break;
+    }
     case VENDOR_SPECIFIC_ACTION: {
         break;
     }
@@ -689,6 +693,8 @@ WifiActionHeader::GetCategory() const
         return UNPROTECTED_DMG;
     case PROTECTED_EHT:
         return PROTECTED_EHT;
+    case SENSING:
+        return SENSING;
     case VENDOR_SPECIFIC_ACTION:
         return VENDOR_SPECIFIC_ACTION;
     default:
@@ -1039,6 +1045,30 @@ WifiActionHeader::GetAction() const
         }
         break;
 
+    case SENSING:
+        switch (m_actionValue)
+        {
+        case SENSING_SBP_REQUEST:
+            retval.sensingAction = SENSING_SBP_REQUEST;
+            break;
+        case SENSING_SBP_RESPONSE:
+            retval.sensingAction = SENSING_SBP_RESPONSE;
+            break;
+        case SENSING_SBP_TERMINATION:
+            retval.sensingAction = SENSING_SBP_TERMINATION;
+            break;
+        case SENSING_SBP_REPORT:
+            retval.sensingAction = SENSING_SBP_REPORT;
+            break;
+        case SENSING_NO_CHANGE_REPORT:
+            retval.sensingAction = SENSING_NO_CHANGE_REPORT;
+            break;
+        default:
+            NS_FATAL_ERROR("Unknown sensing action code");
+            retval.sensingAction = SENSING_SBP_REQUEST; /* quiet compiler */
+        }
+        break;
+
     default:
         NS_FATAL_ERROR("Unsupported action");
         retval.selfProtectedAction = PEER_LINK_OPEN; /* quiet compiler */
@@ -1254,6 +1284,19 @@ WifiActionHeader::Print(std::ostream& os) const
             NS_FATAL_ERROR("Unknown Protected EHT action code");
         }
         break;
+    case SENSING:
+        os << "SENSING[";
+        switch (m_actionValue)
+        {
+            CASE_ACTION_VALUE(SENSING_SBP_REQUEST);
+            CASE_ACTION_VALUE(SENSING_SBP_RESPONSE);
+            CASE_ACTION_VALUE(SENSING_SBP_TERMINATION);
+            CASE_ACTION_VALUE(SENSING_SBP_REPORT);
+            CASE_ACTION_VALUE(SENSING_NO_CHANGE_REPORT);
+        default:
+            NS_FATAL_ERROR("Unknown sensing action code");
+        }
+        break;
     case VENDOR_SPECIFIC_ACTION:
         os << "VENDOR_SPECIFIC_ACTION";
         break;
@@ -2297,12 +2340,148 @@ HeMimoControlHeader::GetDisallowedSubchannelBitmap() const
     return m_disallowedSubchannelBitmap;
 }
 
+/***************************************************
+ *          Beamforming report bit codec
+ ****************************************************/
+
+namespace
+{
+
+/**
+ * Write fields of arbitrary bit width (up to 16 bits) into a buffer, most significant bit
+ * first. Bits are accumulated in a 64-bit word and flushed to the buffer 32 bits at a time.
+ */
+class BfReportBitWriter
+{
+  public:
+    /**
+     * Constructor
+     * \param start the buffer iterator to write into
+     */
+    BfReportBitWriter(Buffer::Iterator start)
+        : m_it(start)
+    {
+    }
+
+    /**
+     * Append a field to the bit stream
+     * \param value the value of the field
+     * \param bits the width of the field in bits
+     */
+    void Write(uint16_t value, uint8_t bits)
+    {
+        m_acc = (m_acc << bits) | (value & ((1U << bits) - 1));
+        m_nBits += bits;
+        if (m_nBits >= 32)
+        {
+            m_nBits -= 32;
+            m_it.WriteHtonU32(static_cast<uint32_t>(m_acc >> m_nBits));
+        }
+    }
+
+    /**
+     * Write the remaining bits, padding the last byte with zeros
+     * \return the iterator pointing past the last written byte
+     */
+    Buffer::Iterator Flush()
+    {
+        while (m_nBits >= 8)
+        {
+            m_nBits -= 8;
+            m_it.WriteU8(static_cast<uint8_t>(m_acc >> m_nBits));
+        }
+        if (m_nBits > 0)
+        {
+            m_it.WriteU8(static_cast<uint8_t>(m_acc << (8 - m_nBits)));
+            m_nBits = 0;
+        }
+        return m_it;
+    }
+
+  private:
+    Buffer::Iterator m_it; //!< the buffer iterator
+    uint64_t m_acc{0};     //!< bits not yet written (the m_nBits least significant ones)
+    uint8_t m_nBits{0};    //!< number of bits not yet written
+};
+
+/**
+ * Read fields of arbitrary bit width (up to 16 bits) from a buffer, most significant bit
+ * first. The buffer is read 32 bits at a time as long as enough bytes are left.
+ */
+class BfReportBitReader
+{
+  public:
+    /**
+     * Constructor
+     * \param start the buffer iterator to read from
+     * \param nBytes the number of bytes that can be read
+     */
+    BfReportBitReader(Buffer::Iterator start, uint32_t nBytes)
+        : m_it(start),
+          m_remainingBytes(nBytes)
+    {
+    }
+
+    /**
+     * Read the next field of the bit stream
+     * \param bits the width of the field in bits
+     * \return the value of the field
+     */
+    uint16_t Read(uint8_t bits)
+    {
+        while (m_nBits < bits)
+        {
+            NS_ASSERT_MSG(m_remainingBytes > 0, "Reading past the end of the beamforming report");
+            if (m_remainingBytes >= 4)
+            {
+                m_acc = (m_acc << 32) | m_it.ReadNtohU32();
+                m_nBits += 32;
+                m_remainingBytes -= 4;
+            }
+            else
+            {
+                m_acc = (m_acc << 8) | m_it.ReadU8();
+                m_nBits += 8;
+                m_remainingBytes--;
+            }
+        }
+        m_nBits -= bits;
+        return static_cast<uint16_t>((m_acc >> m_nBits) & ((1U << bits) - 1));
+    }
+
+    /**
+     * Skip the padding bits and the bytes that have not been read yet
+     * \return the iterator pointing past the last byte of the bit stream
+     */
+    Buffer::Iterator Finish()
+    {
+        m_it.Next(m_remainingBytes);
+        m_remainingBytes = 0;
+        m_nBits = 0;
+        return m_it;
+    }
+
+  private:
+    Buffer::Iterator m_it;     //!< the buffer iterator
+    uint32_t m_remainingBytes; //!< number of bytes not yet read from the buffer
+    uint64_t m_acc{0};         //!< bits read but not yet consumed (the m_nBits least significant)
+    uint8_t m_nBits{0};        //!< number of bits read but not yet consumed
+};
+
+} // namespace
+
 /***************************************************
  *                 HE Compressed Beamforming Report field
  ****************************************************/
 NS_OBJECT_ENSURE_REGISTERED(HeCompressedBfReport);
 
 HeCompressedBfReport::HeCompressedBfReport()
+    : m_nc(0),
+      m_nr(0),
+      m_na(0),
+      m_ns(0),
+      m_bits1(0),
+      m_bits2(0)
 {
 }
 
@@ -2347,7 +2526,7 @@ HeCompressedBfReport::Print(std::ostream& os) const
 uint32_t
 HeCompressedBfReport::GetSerializedSize() const
 {
-    return m_nc + ceil((m_na / 2 * (m_bits1 + m_bits2) * m_ns) / 8.0);
+    return m_nc + (m_na / 2 * (m_bits1 + m_bits2) * m_ns + 7) / 8;
 }
 
 uint8_t
@@ -2507,548 +2686,60 @@ HeCompressedBfReport::SetHeMimoControlHeader(const HeMimoControlHeader& heMimoCo
 }
 
 void
-HeCompressedBfReport::SetChannelInfo(ChannelInfo channelInfo)
+HeCompressedBfReport::SetChannelInfo(const CsiBuffer& channelInfo)
 {
-    m_channelInfo.m_stStreamSnr = channelInfo.m_stStreamSnr;
-    m_channelInfo.m_phi = channelInfo.m_phi;
-    m_channelInfo.m_psi = channelInfo.m_psi;
+    m_txChannelInfo = &channelInfo;
 }
 
-HeCompressedBfReport::ChannelInfo
-HeCompressedBfReport::GetChannelInfo()
+void
+HeCompressedBfReport::SetChannelInfoBuffer(CsiBuffer& channelInfo)
 {
-    return m_channelInfo;
+    m_rxChannelInfo = &channelInfo;
 }
 
-std::tuple<std::vector<uint16_t>, std::vector<uint8_t>>
-HeCompressedBfReport::PrepareWriteBfBuffer() const
+const CsiBuffer&
+HeCompressedBfReport::GetChannelInfo() const
 {
-    // Total number of values that needs to be write into the buffer of compressed beamforming
-    // report
-    uint16_t numValues = m_nc + m_ns * m_na;
-    // A vector containing all the values that needs to be write into the buffer
-    std::vector<uint16_t> values(numValues, 0);
-    // A vector containing the bits needed to quantize each value
-    std::vector<uint8_t> bits(numValues, 0);
-
-    uint16_t idxValues = 0;
-    for (idxValues = 0; idxValues < m_nc; idxValues++)
+    if (m_rxChannelInfo)
     {
-        values[idxValues] = m_channelInfo.m_stStreamSnr[idxValues];
-        bits[idxValues] = 8;
+        return *m_rxChannelInfo;
     }
-
-    idxValues = m_nc;
-    switch (m_na)
+    if (m_txChannelInfo)
     {
-    case 2:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            for (uint8_t j = 0; j < m_na / 2; j++)
-            {
-                values[idxValues] = m_channelInfo.m_phi[i][j];
-                bits[idxValues] = m_bits1;
-
-                values[idxValues + 1] = m_channelInfo.m_psi[i][j];
-                bits[idxValues + 1] = m_bits2;
-            }
-            idxValues = idxValues + m_na;
-        }
-
-        break;
-    case 4:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            values[idxValues] = m_channelInfo.m_phi[i][0];
-            bits[idxValues] = m_bits1;
-
-            values[idxValues + 1] = m_channelInfo.m_phi[i][1];
-            bits[idxValues + 1] = m_bits1;
-
-            values[idxValues + 2] = m_channelInfo.m_psi[i][0];
-            bits[idxValues + 2] = m_bits2;
-
-            values[idxValues + 3] = m_channelInfo.m_psi[i][1];
-            bits[idxValues + 3] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-        break;
-    case 6:
-        if (m_nr == 3)
-        {
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                values[idxValues] = m_channelInfo.m_phi[i][0];
-                bits[idxValues] = m_bits1;
-
-                values[idxValues + 1] = m_channelInfo.m_phi[i][1];
-                bits[idxValues + 1] = m_bits1;
-
-                values[idxValues + 2] = m_channelInfo.m_psi[i][0];
-                bits[idxValues + 2] = m_bits2;
-
-                values[idxValues + 3] = m_channelInfo.m_psi[i][1];
-                bits[idxValues + 3] = m_bits2;
-
-                values[idxValues + 4] = m_channelInfo.m_phi[i][2];
-                bits[idxValues + 4] = m_bits1;
-
-                values[idxValues + 5] = m_channelInfo.m_psi[i][2];
-                bits[idxValues + 5] = m_bits2;
-
-                idxValues = idxValues + m_na;
-            }
-        }
-        else if (m_nr == 4)
-        {
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                values[idxValues] = m_channelInfo.m_phi[i][0];
-                bits[idxValues] = m_bits1;
-
-                values[idxValues + 1] = m_channelInfo.m_phi[i][1];
-                bits[idxValues + 1] = m_bits1;
-
-                values[idxValues + 2] = m_channelInfo.m_phi[i][2];
-                bits[idxValues + 2] = m_bits1;
-
-                values[idxValues + 3] = m_channelInfo.m_psi[i][0];
-                bits[idxValues + 3] = m_bits2;
-
-                values[idxValues + 4] = m_channelInfo.m_psi[i][1];
-                bits[idxValues + 4] = m_bits2;
-
-                values[idxValues + 5] = m_channelInfo.m_psi[i][2];
-                bits[idxValues + 5] = m_bits2;
-
-                idxValues = idxValues + m_na;
-            }
-        }
-        else
-        {
-            NS_FATAL_ERROR("Improper number of angles");
-        }
-        break;
-    case 10:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            values[idxValues] = m_channelInfo.m_phi[i][0];
-            bits[idxValues] = m_bits1;
-
-            values[idxValues + 1] = m_channelInfo.m_phi[i][1];
-            bits[idxValues + 1] = m_bits1;
-
-            values[idxValues + 2] = m_channelInfo.m_phi[i][2];
-            bits[idxValues + 2] = m_bits1;
-
-            values[idxValues + 3] = m_channelInfo.m_psi[i][0];
-            bits[idxValues + 3] = m_bits2;
-
-            values[idxValues + 4] = m_channelInfo.m_psi[i][1];
-            bits[idxValues + 4] = m_bits2;
-
-            values[idxValues + 5] = m_channelInfo.m_psi[i][2];
-            bits[idxValues + 5] = m_bits2;
-
-            values[idxValues + 6] = m_channelInfo.m_phi[i][3];
-            bits[idxValues + 6] = m_bits1;
-
-            values[idxValues + 7] = m_channelInfo.m_phi[i][4];
-            bits[idxValues + 7] = m_bits1;
-
-            values[idxValues + 8] = m_channelInfo.m_psi[i][3];
-            bits[idxValues + 8] = m_bits2;
-
-            values[idxValues + 9] = m_channelInfo.m_psi[i][4];
-            bits[idxValues + 9] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-        break;
-    case 12:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            values[idxValues] = m_channelInfo.m_phi[i][0];
-            bits[idxValues] = m_bits1;
-
-            values[idxValues + 1] = m_channelInfo.m_phi[i][1];
-            bits[idxValues + 1] = m_bits1;
-
-            values[idxValues + 2] = m_channelInfo.m_phi[i][2];
-            bits[idxValues + 2] = m_bits1;
-
-            values[idxValues + 3] = m_channelInfo.m_psi[i][0];
-            bits[idxValues + 3] = m_bits2;
-
-            values[idxValues + 4] = m_channelInfo.m_psi[i][1];
-            bits[idxValues + 4] = m_bits2;
-
-            values[idxValues + 5] = m_channelInfo.m_psi[i][2];
-            bits[idxValues + 5] = m_bits2;
-
-            values[idxValues + 6] = m_channelInfo.m_phi[i][3];
-            bits[idxValues + 6] = m_bits1;
-
-            values[idxValues + 7] = m_channelInfo.m_phi[i][4];
-            bits[idxValues + 7] = m_bits1;
-
-            values[idxValues + 8] = m_channelInfo.m_psi[i][3];
-            bits[idxValues + 8] = m_bits2;
-
-            values[idxValues + 9] = m_channelInfo.m_psi[i][4];
-            bits[idxValues + 9] = m_bits2;
-
-            values[idxValues + 10] = m_channelInfo.m_phi[i][5];
-            bits[idxValues + 10] = m_bits1;
-
-            values[idxValues + 11] = m_channelInfo.m_psi[i][5];
-            bits[idxValues + 11] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-        break;
-    default:
-        NS_FATAL_ERROR("Improper number of angles");
-    }
-    return std::make_tuple(values, bits);
-}
-
-std::vector<uint8_t>
-HeCompressedBfReport::WriteBfReportBuffer(std::vector<uint16_t> values,
-                                          std::vector<uint8_t> bits) const
-{
-    // total number of values that will be write into the buffer
-    uint16_t num = values.size();
-
-    // total number of bytes that will be write into the buffer
-    uint16_t numBytes = 0;
-    for (uint16_t i = 0; i < num; i++)
-    {
-        numBytes += bits[i];
+        return *m_txChannelInfo;
     }
-    numBytes = ceil(numBytes / 8.0);
-
-    // Create buffer that contains beamforming report information
-    std::vector<uint8_t> buffer(numBytes, 0);
-
-    // index of the current byte in the buffer
-    uint16_t idxBuffer = 0;
-    // remaining bits of the current byte in the buffer
-    uint8_t remainingBits = 8;
-
-    for (uint16_t i = 0; i < num; i++)
-    {
-        if (remainingBits >= bits[i])
-        {
-            buffer[idxBuffer] = (buffer[idxBuffer] << bits[i]) |
-                                (values[i] & static_cast<uint16_t>(pow(2, bits[i]) - 1));
-            remainingBits = remainingBits - bits[i];
-        }
-        else
-        {
-            buffer[idxBuffer] = (buffer[idxBuffer] << remainingBits) |
-                                ((values[i] & static_cast<uint16_t>(pow(2, bits[i]) - 1)) >>
-                                 (bits[i] - remainingBits));
-            idxBuffer++;
-            buffer[idxBuffer] |=
-                values[i] & static_cast<uint16_t>(pow(2, bits[i] - remainingBits) - 1);
-            remainingBits = 8 - (bits[i] - remainingBits);
-        }
-
-        if (remainingBits == 0 && i < num - 1)
-        {
-            remainingBits = 8;
-            idxBuffer++;
-        }
-    }
-    if (remainingBits < 8)
-    {
-        buffer[idxBuffer] = buffer[idxBuffer] << remainingBits;
-    }
-
-    NS_ASSERT(buffer.size() == m_nc + ceil(m_ns * m_na / 2 * (m_bits1 + m_bits2) / 8.0));
-    return buffer;
-}
-
-std::vector<uint16_t>
-HeCompressedBfReport::ReadBfReportBuffer(std::vector<uint8_t> buffer,
-                                         std::vector<uint8_t> bits,
-                                         uint16_t idxBuffer) const
-{
-    uint16_t numBytes = 0;      // total number of bytes
-    uint16_t num = bits.size(); // total number of values
-    std::vector<uint16_t> values(num, 0);
-
-    for (uint16_t i = 0; i < num; i++)
-    {
-        numBytes += bits[i];
-    }
-    numBytes = ceil(numBytes / 8.0);
-
-    uint8_t remainingBits = 8;
-    for (uint16_t i = 0; i < num; i++)
-    {
-        if (remainingBits >= bits[i])
-        {
-            values[i] = (buffer[idxBuffer] &
-                         (static_cast<uint16_t>(pow(2, bits[i]) - 1) << (8 - bits[i]))) >>
-                        (8 - bits[i]);
-            buffer[idxBuffer] = buffer[idxBuffer] << bits[i];
-            remainingBits = remainingBits - bits[i];
-        }
-        else
-        {
-            uint16_t value = 0;
-            if (bits[i] == 9)
-            {
-                value |= (buffer[idxBuffer] &
-                          (static_cast<uint16_t>(pow(2, remainingBits) - 1) << (8 - remainingBits)))
-                         << (bits[i] - 8);
-            }
-            else
-            {
-                value |= (buffer[idxBuffer] & (static_cast<uint16_t>(pow(2, remainingBits) - 1)
-                                               << (8 - remainingBits))) >>
-                         (8 - remainingBits - (bits[i] - remainingBits));
-            }
-            idxBuffer += 1;
-            value |= (buffer[idxBuffer] & static_cast<uint16_t>(pow(2, bits[i] - remainingBits) - 1)
-                                              << (8 - (bits[i] - remainingBits))) >>
-                     (8 - (bits[i] - remainingBits));
-            values[i] = value;
-            buffer[idxBuffer] = buffer[idxBuffer] << (bits[i] - remainingBits);
-            remainingBits = 8 - (bits[i] - remainingBits);
-        }
-
-        if (remainingBits == 0 && i < num - 1)
-        {
-            remainingBits = 8;
-            idxBuffer++;
-        }
-    }
-    return values;
+    return m_channelInfo;
 }
 
-void
-HeCompressedBfReport::ReadChannelInfoFromBuffer(std::vector<uint8_t> buffer)
+std::array<uint8_t, 12>
+HeCompressedBfReport::GetAngleOrder(uint8_t na, uint8_t nr)
 {
-    NS_ASSERT(buffer.size() == m_nc + ceil(m_ns * m_na / 2 * (m_bits1 + m_bits2) / 8.0));
-
-    m_channelInfo.m_stStreamSnr.clear();
-    m_channelInfo.m_phi.clear();
-    m_channelInfo.m_psi.clear();
-    for (uint16_t i = 0; i < m_ns; i++)
-    {
-        m_channelInfo.m_phi.emplace_back(std::vector<uint16_t>(m_na / 2, 0));
-        m_channelInfo.m_psi.emplace_back(std::vector<uint16_t>(m_na / 2, 0));
-    }
-
-    // Read space-time stream SNR
-    for (uint8_t i = 0; i < m_nc; i++)
+    const uint8_t psi = ANGLE_ORDER_PSI;
+    switch (na)
     {
-        m_channelInfo.m_stStreamSnr.push_back(buffer[i]);
-    }
-
-    // Total number of the Phi and Psi angle values that needs to be read from the buffer of
-    // compressed beamforming report
-    uint16_t numValues = m_ns * m_na;
-
-    // A vector containing all the Phi and Psi angle values that needs to be write into the buffer
-    std::vector<uint16_t> values(numValues, 0);
-    std::vector<uint8_t> bits(numValues, 0);
-    uint16_t idxValues = 0;
-    uint16_t idxBuffer = m_nc;
-
-    switch (m_na)
-    {
-    case 2: {
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            bits[idxValues] = m_bits1;
-            bits[idxValues + 1] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-
-        values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-        idxValues = 0;
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            m_channelInfo.m_phi[i][0] = values[idxValues];
-            m_channelInfo.m_psi[i][0] = values[idxValues + 1];
-            idxValues = idxValues + m_na;
-        }
-        break;
-    }
+    case 2:
+        return {0, psi | 0};
     case 4:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            bits[idxValues] = m_bits1;
-            bits[idxValues + 1] = m_bits1;
-            bits[idxValues + 2] = m_bits2;
-            bits[idxValues + 3] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-
-        values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-        idxValues = 0;
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            m_channelInfo.m_phi[i][0] = values[idxValues];
-            m_channelInfo.m_phi[i][1] = values[idxValues + 1];
-            m_channelInfo.m_psi[i][0] = values[idxValues + 2];
-            m_channelInfo.m_psi[i][1] = values[idxValues + 3];
-
-            idxValues = idxValues + m_na;
-        }
-        break;
+        return {0, 1, psi | 0, psi | 1};
     case 6:
-        if (m_nr == 3)
+        if (nr == 3)
         {
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                bits[idxValues] = m_bits1;
-                bits[idxValues + 1] = m_bits1;
-                bits[idxValues + 2] = m_bits2;
-                bits[idxValues + 3] = m_bits2;
-                bits[idxValues + 4] = m_bits1;
-                bits[idxValues + 5] = m_bits2;
-
-                idxValues = idxValues + m_na;
-            }
-
-            values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-            idxValues = 0;
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                m_channelInfo.m_phi[i][0] = values[idxValues];
-                m_channelInfo.m_phi[i][1] = values[idxValues + 1];
-                m_channelInfo.m_psi[i][0] = values[idxValues + 2];
-                m_channelInfo.m_psi[i][1] = values[idxValues + 3];
-                m_channelInfo.m_phi[i][2] = values[idxValues + 4];
-                m_channelInfo.m_psi[i][2] = values[idxValues + 5];
-
-                idxValues = idxValues + m_na;
-            }
-        }
-        else if (m_nr == 4)
-        {
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                bits[idxValues] = m_bits1;
-                bits[idxValues + 1] = m_bits1;
-                bits[idxValues + 2] = m_bits1;
-                bits[idxValues + 3] = m_bits2;
-                bits[idxValues + 4] = m_bits2;
-                bits[idxValues + 5] = m_bits2;
-
-                idxValues = idxValues + m_na;
-            }
-
-            values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-            idxValues = 0;
-            for (uint16_t i = 0; i < m_ns; i++)
-            {
-                m_channelInfo.m_phi[i][0] = values[idxValues];
-                m_channelInfo.m_phi[i][1] = values[idxValues + 1];
-                m_channelInfo.m_phi[i][2] = values[idxValues + 2];
-                m_channelInfo.m_psi[i][0] = values[idxValues + 3];
-                m_channelInfo.m_psi[i][1] = values[idxValues + 4];
-                m_channelInfo.m_psi[i][2] = values[idxValues + 5];
-
-                idxValues = idxValues + m_na;
-            }
+            return {0, 1, psi | 0, psi | 1, 2, psi | 2};
         }
-        else
+        else if (nr == 4)
         {
-            NS_FATAL_ERROR("Improper number of angles");
+            return {0, 1, 2, psi | 0, psi | 1, psi | 2};
         }
+        NS_FATAL_ERROR("Improper number of angles");
         break;
     case 10:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            bits[idxValues] = m_bits1;
-            bits[idxValues + 1] = m_bits1;
-            bits[idxValues + 2] = m_bits1;
-            bits[idxValues + 3] = m_bits2;
-            bits[idxValues + 4] = m_bits2;
-            bits[idxValues + 5] = m_bits2;
-            bits[idxValues + 6] = m_bits1;
-            bits[idxValues + 7] = m_bits1;
-            bits[idxValues + 8] = m_bits2;
-            bits[idxValues + 9] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-
-        values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-        idxValues = 0;
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            m_channelInfo.m_phi[i][0] = values[idxValues];
-            m_channelInfo.m_phi[i][1] = values[idxValues + 1];
-            m_channelInfo.m_phi[i][2] = values[idxValues + 2];
-            m_channelInfo.m_psi[i][0] = values[idxValues + 3];
-            m_channelInfo.m_psi[i][1] = values[idxValues + 4];
-            m_channelInfo.m_psi[i][2] = values[idxValues + 5];
-            m_channelInfo.m_phi[i][3] = values[idxValues + 6];
-            m_channelInfo.m_phi[i][4] = values[idxValues + 7];
-            m_channelInfo.m_psi[i][3] = values[idxValues + 8];
-            m_channelInfo.m_psi[i][4] = values[idxValues + 9];
-
-            idxValues = idxValues + m_na;
-        }
-        break;
+        return {0, 1, 2, psi | 0, psi | 1, psi | 2, 3, 4, psi | 3, psi | 4};
     case 12:
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            bits[idxValues] = m_bits1;
-            bits[idxValues + 1] = m_bits1;
-            bits[idxValues + 2] = m_bits1;
-            bits[idxValues + 3] = m_bits2;
-            bits[idxValues + 4] = m_bits2;
-            bits[idxValues + 5] = m_bits2;
-            bits[idxValues + 6] = m_bits1;
-            bits[idxValues + 7] = m_bits1;
-            bits[idxValues + 8] = m_bits2;
-            bits[idxValues + 9] = m_bits2;
-            bits[idxValues + 10] = m_bits1;
-            bits[idxValues + 11] = m_bits2;
-
-            idxValues = idxValues + m_na;
-        }
-
-        values = ReadBfReportBuffer(buffer, bits, idxBuffer);
-
-        idxValues = 0;
-        for (uint16_t i = 0; i < m_ns; i++)
-        {
-            m_channelInfo.m_phi[i][0] = values[idxValues];
-            m_channelInfo.m_phi[i][1] = values[idxValues + 1];
-            m_channelInfo.m_phi[i][2] = values[idxValues + 2];
-            m_channelInfo.m_psi[i][0] = values[idxValues + 3];
-            m_channelInfo.m_psi[i][1] = values[idxValues + 4];
-            m_channelInfo.m_psi[i][2] = values[idxValues + 5];
-            m_channelInfo.m_phi[i][3] = values[idxValues + 6];
-            m_channelInfo.m_phi[i][4] = values[idxValues + 7];
-            m_channelInfo.m_psi[i][3] = values[idxValues + 8];
-            m_channelInfo.m_psi[i][4] = values[idxValues + 9];
-            m_channelInfo.m_phi[i][5] = values[idxValues + 10];
-            m_channelInfo.m_psi[i][5] = values[idxValues + 11];
-
-            idxValues = idxValues + m_na;
-        }
-        break;
+        return {0, 1, 2, psi | 0, psi | 1, psi | 2, 3, 4, psi | 3, psi | 4, 5, psi | 5};
     default:
         NS_FATAL_ERROR("Improper number of angles");
     }
+    return {};
 }
 
 uint8_t
@@ -3168,38 +2859,72 @@ HeCompressedBfReport::GetNSubcarriers(uint8_t ruStart, uint8_t ruEnd, uint8_t ng
 void
 HeCompressedBfReport::Serialize(Buffer::Iterator start) const
 {
-    NS_ASSERT(m_channelInfo.m_stStreamSnr.size() == m_nc);
-    NS_ASSERT(m_channelInfo.m_phi.size() == m_ns && m_channelInfo.m_phi.size() == m_ns);
-    NS_ASSERT(m_channelInfo.m_phi[0].size() == m_na / 2 &&
-              m_channelInfo.m_phi[0].size() == m_na / 2);
+    const CsiBuffer& channelInfo = m_txChannelInfo ? *m_txChannelInfo : m_channelInfo;
+    NS_ASSERT(channelInfo.GetNc() == m_nc);
+    NS_ASSERT(channelInfo.GetNs() == m_ns && channelInfo.GetNa() == m_na);
 
-    std::vector<uint16_t> values;
-    std::vector<uint8_t> bits;
-    std::tie(values, bits) = PrepareWriteBfBuffer();
-    std::vector<uint8_t> buffer = WriteBfReportBuffer(values, bits);
+    const auto order = GetAngleOrder(m_na, m_nr);
+    const uint8_t nPairs = m_na / 2;
+    const uint16_t* stStreamSnr = channelInfo.GetStStreamSnrData();
+    const uint16_t* phi = channelInfo.GetPhiData();
+    const uint16_t* psi = channelInfo.GetPsiData();
 
-    Buffer::Iterator i = start;
-    for (uint16_t j = 0; j < buffer.size(); j++)
+    BfReportBitWriter writer(start);
+    for (uint8_t i = 0; i < m_nc; i++)
     {
-        i.WriteU8(buffer[j]);
+        writer.Write(stStreamSnr[i], 8);
+    }
+    for (uint16_t i = 0; i < m_ns; i++, phi += nPairs, psi += nPairs)
+    {
+        for (uint8_t j = 0; j < m_na; j++)
+        {
+            uint8_t idx = order[j] & ~ANGLE_ORDER_PSI;
+            if (order[j] & ANGLE_ORDER_PSI)
+            {
+                writer.Write(psi[idx], m_bits2);
+            }
+            else
+            {
+                writer.Write(phi[idx], m_bits1);
+            }
+        }
     }
+    writer.Flush();
 }
 
 uint32_t
 HeCompressedBfReport::Deserialize(Buffer::Iterator start)
 {
-    Buffer::Iterator i = start;
+    CsiBuffer& channelInfo = m_rxChannelInfo ? *m_rxChannelInfo : m_channelInfo;
+    channelInfo.Reset(m_ns, m_na, m_nc);
 
-    std::vector<uint8_t> buffer;
-    uint16_t numBytes = m_nc + ceil(((m_bits1 + m_bits2) * m_na / 2) * m_ns / 8.0);
+    const auto order = GetAngleOrder(m_na, m_nr);
+    const uint8_t nPairs = m_na / 2;
+    uint16_t* stStreamSnr = channelInfo.GetStStreamSnrData();
+    uint16_t* phi = channelInfo.GetPhiData();
+    uint16_t* psi = channelInfo.GetPsiData();
 
-    for (uint16_t j = 0; j < numBytes; j++)
+    BfReportBitReader reader(start, GetSerializedSize());
+    for (uint8_t i = 0; i < m_nc; i++)
     {
-        buffer.push_back(i.ReadU8());
+        stStreamSnr[i] = reader.Read(8);
     }
-    ReadChannelInfoFromBuffer(buffer);
-
-    return i.GetDistanceFrom(start);
+    for (uint16_t i = 0; i < m_ns; i++, phi += nPairs, psi += nPairs)
+    {
+        for (uint8_t j = 0; j < m_na; j++)
+        {
+            uint8_t idx = order[j] & ~ANGLE_ORDER_PSI;
+            if (order[j] & ANGLE_ORDER_PSI)
+            {
+                psi[idx] = reader.Read(m_bits2);
+            }
+            else
+            {
+                phi[idx] = reader.Read(m_bits1);
+            }
+        }
+    }
+    return reader.Finish().GetDistanceFrom(start);
 }
 
 /***************************************************
@@ -3208,12 +2933,16 @@ HeCompressedBfReport::Deserialize(Buffer::Iterator start)
 NS_OBJECT_ENSURE_REGISTERED(HeMuExclusiveBfReport);
 
 HeMuExclusiveBfReport::HeMuExclusiveBfReport()
+    : m_nc(0),
+      m_na(0),
+      m_ns(0)
 {
 }
 
 HeMuExclusiveBfReport::HeMuExclusiveBfReport(const HeMimoControlHeader& heMimoControlHeader)
 {
     m_nc = heMimoControlHeader.GetNc() + 1;
+    m_na = HeCompressedBfReport::CalculateNa(m_nc, heMimoControlHeader.GetNr() + 1);
     m_ns = HeCompressedBfReport::GetNSubcarriers(heMimoControlHeader.GetRuStart(),
                                                  heMimoControlHeader.GetRuEnd(),
                                                  heMimoControlHeader.GetNg());
@@ -3247,72 +2976,70 @@ HeMuExclusiveBfReport::Print(std::ostream& os) const
 uint32_t
 HeMuExclusiveBfReport::GetSerializedSize() const
 {
-    return ceil((4 * m_nc * m_ns) / 8.0);
+    return (4 * m_nc * m_ns + 7) / 8;
 }
 
 void
 HeMuExclusiveBfReport::Serialize(Buffer::Iterator start) const
 {
-    NS_ASSERT(m_deltaSnr.size() == m_ns && m_deltaSnr[0].size() == m_nc);
+    const CsiBuffer& channelInfo = m_txChannelInfo ? *m_txChannelInfo : m_channelInfo;
+    NS_ASSERT(channelInfo.GetNs() == m_ns && channelInfo.GetNc() == m_nc);
 
-    Buffer::Iterator i = start;
-    uint8_t buffer = 0;
-    for (uint16_t k = 0; k < m_ns; k++)
+    const uint16_t* deltaSnr = channelInfo.GetDeltaSnrData();
+    const uint32_t nValues = static_cast<uint32_t>(m_ns) * m_nc;
+
+    BfReportBitWriter writer(start);
+    for (uint32_t k = 0; k < nValues; k++)
     {
-        for (uint8_t j = 0; j < m_nc; j++)
-        {
-            if ((k * m_nc + j) % 2)
-            {
-                buffer |= (m_deltaSnr[k][j] & 0x0f);
-                i.WriteU8(buffer);
-                buffer = 0;
-            }
-            else
-            {
-                buffer |= ((m_deltaSnr[k][j] & 0x0f) << 4);
-            }
-        }
+        writer.Write(deltaSnr[k], 4);
     }
+    writer.Flush();
 }
 
 uint32_t
 HeMuExclusiveBfReport::Deserialize(Buffer::Iterator start)
 {
-    Buffer::Iterator i = start;
+    CsiBuffer& channelInfo = m_rxChannelInfo ? *m_rxChannelInfo : m_channelInfo;
+    if (channelInfo.GetNs() != m_ns || channelInfo.GetNc() != m_nc)
+    {
+        channelInfo.Reset(m_ns, m_na, m_nc);
+    }
 
-    m_deltaSnr.clear();
+    uint16_t* deltaSnr = channelInfo.GetDeltaSnrData();
+    const uint32_t nValues = static_cast<uint32_t>(m_ns) * m_nc;
 
-    uint8_t buffer = 0;
-    for (uint16_t k = 0; k < m_ns; k++)
+    BfReportBitReader reader(start, GetSerializedSize());
+    for (uint32_t k = 0; k < nValues; k++)
     {
-        m_deltaSnr.emplace_back(std::vector<uint8_t>(m_nc, 0));
-        for (uint8_t j = 0; j < m_nc; j++)
-        {
-            if ((k * m_nc + j) % 2 == 0)
-            {
-                buffer = i.ReadU8();
-                m_deltaSnr[k][j] = ((buffer >> 4) & 0x0f);
-            }
-            else
-            {
-                m_deltaSnr[k][j] = (buffer & 0x0f);
-            }
-        }
+        deltaSnr[k] = reader.Read(4);
     }
+    return reader.Finish().GetDistanceFrom(start);
+}
 
-    return i.GetDistanceFrom(start);
+void
+HeMuExclusiveBfReport::SetChannelInfo(const CsiBuffer& channelInfo)
+{
+    m_txChannelInfo = &channelInfo;
 }
 
 void
-HeMuExclusiveBfReport::SetDeltaSnr(std::vector<std::vector<uint8_t>> deltaSnr)
+HeMuExclusiveBfReport::SetChannelInfoBuffer(CsiBuffer& channelInfo)
 {
-    m_deltaSnr = deltaSnr;
+    m_rxChannelInfo = &channelInfo;
 }
 
-std::vector<std::vector<uint8_t>>
-HeMuExclusiveBfReport::GetDeltaSnr()
+const CsiBuffer&
+HeMuExclusiveBfReport::GetChannelInfo() const
 {
-    return m_deltaSnr;
+    if (m_rxChannelInfo)
+    {
+        return *m_rxChannelInfo;
+    }
+    if (m_txChannelInfo)
+    {
+        return *m_txChannelInfo;
+    }
+    return m_channelInfo;
 }
 
 } // namespace ns3
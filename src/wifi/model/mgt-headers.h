@@ -34,6 +34,7 @@
 #include "wifi-mgt-header.h"
 
 #include "ns3/cf-parameter-set.h"
+#include "ns3/csi-buffer.h"
 #include "ns3/dsss-parameter-set.h"
 #include "ns3/eht-capabilities.h"
 #include "ns3/eht-operation.h"
@@ -49,6 +50,7 @@
 #include "ns3/vht-capabilities.h"
 #include "ns3/vht-operation.h"
 
+#include <array>
 #include <list>
 
 namespace ns3
@@ -588,6 +590,7 @@ class WifiActionHeader : public Header
         UNPROTECTED_DMG = 20,  // Category: Unprotected DMG
         HE = 30,               // Category: He (Attempt to add Channel Sounding from ns3.37)
         PROTECTED_EHT = 37,    // Category: Protected EHT
+        SENSING = 38,          // Category: Sensing (IEEE 802.11bf, value not yet assigned)
         // Since vendor specific action has no stationary Action value,the parse process is not
         // here. Refer to vendor-specific-action in wave module.
         VENDOR_SPECIFIC_ACTION = 127,
@@ -752,6 +755,16 @@ class WifiActionHeader : public Header
     *************************************
     */
 
+    /// SensingActionValue enumeration
+    enum SensingActionValue
+    {
+        SENSING_SBP_REQUEST = 0,
+        SENSING_SBP_RESPONSE = 1,
+        SENSING_SBP_TERMINATION = 2,
+        SENSING_SBP_REPORT = 3,
+        SENSING_NO_CHANGE_REPORT = 4,
+    };
+
     /// HeActionValue enumeration
     enum HeActionValue
     {
@@ -776,6 +789,7 @@ class WifiActionHeader : public Header
         UnprotectedDmgActionValue unprotectedDmgAction;     ///< unprotected dmg
         HeActionValue he; ///< he (Attempt to add Channel Sounding from ns3.37)
         ProtectedEhtActionValue protectedEhtAction; ///< protected eht
+        SensingActionValue sensingAction;           ///< sensing
     } ActionValue;                                  ///< the action value
 
     /**
@@ -1447,16 +1461,6 @@ class HeCompressedBfReport : public Header
     HeCompressedBfReport(const HeMimoControlHeader& heMimoControlHeader);
     ~HeCompressedBfReport() override;
 
-    // Channel information
-    struct ChannelInfo
-    {
-        std::vector<uint8_t> m_stStreamSnr; //!< Average SNR of space-time streams
-        std::vector<std::vector<uint16_t>>
-            m_phi; //!< Phi angle (number of subcarriers * number of angles)
-        std::vector<std::vector<uint16_t>>
-            m_psi; //!< Psi angle (number of subcarriers * number of angles)
-    };
-
     /**
      * Register this type.
      * \return The TypeId.
@@ -1478,16 +1482,27 @@ class HeCompressedBfReport : public Header
     void SetHeMimoControlHeader(const HeMimoControlHeader& heMimoControlHeader);
 
     /**
-     * Set channel information to build compressed beamforming
+     * Set the channel information to serialize. The channel information is not copied, hence
+     * the given buffer must be kept alive and unchanged until the header is serialized.
+     *
      * \param channelInfo channel information
      */
-    void SetChannelInfo(ChannelInfo channelInfo);
+    void SetChannelInfo(const CsiBuffer& channelInfo);
+
+    /**
+     * Set the buffer into which the channel information is written upon deserialization.
+     * If no buffer is set, the channel information is stored in the header itself. The
+     * buffer is resized to the dimensions of the report, reusing its storage if possible.
+     *
+     * \param channelInfo the buffer to deserialize channel information into
+     */
+    void SetChannelInfoBuffer(CsiBuffer& channelInfo);
 
     /**
      * Get channel information
      * \return channelInfo channel information
      */
-    ChannelInfo GetChannelInfo();
+    const CsiBuffer& GetChannelInfo() const;
 
     /**
      * Get the number of columns Nc in a compressed beamforming feedback matrix
@@ -1526,42 +1541,17 @@ class HeCompressedBfReport : public Header
     uint8_t GetBits2() const;
 
     /**
-     * Prepare neccessary information to serialize channel information into compressed beamforming
-     * report \return the tuple containing information to serialize channel information: a vector of
-     * values arranges in order that will be serialized, a vector of bits used to quantize each
-     * value
-     */
-    std::tuple<std::vector<uint16_t>, std::vector<uint8_t>> PrepareWriteBfBuffer() const;
-
-    /**
-     * Write beamforming report information into a buffer
-     * \param values a vector of values that will be written into a buffer
-     * \param bits a vector of number of bits corresponding to each value in the "values" vector
-     *
-     * \return a buffer containing beamforming report
-     */
-    std::vector<uint8_t> WriteBfReportBuffer(std::vector<uint16_t> values,
-                                             std::vector<uint8_t> bits) const;
-
-    /**
-     * Read beamforming report information and store channel information in m_channelInfo
-     * \param buffer a vector containing channel information values
+     * Get the order in which the Phi and Psi angles of a subcarrier appear in the compressed
+     * beamforming report. Each entry is the index of the angle among the Phi (or Psi) angles
+     * of the subcarrier, with ANGLE_ORDER_PSI set for Psi angles.
      *
+     * \param na number of angles on each subcarrier
+     * \param nr number of rows in a compressed beamforming feedback matrix
+     * \return the order of the angles of a subcarrier
      */
-    void ReadChannelInfoFromBuffer(std::vector<uint8_t> buffer);
+    static std::array<uint8_t, 12> GetAngleOrder(uint8_t na, uint8_t nr);
 
-    /**
-     * Read beamforming report information
-     * \param buffer a vector containing beamforming report
-     * \param bits a vector of number of bits arranged in order which is used to quantize each value
-     * in the beamforming report \param idxBuffer the index of byte where to start reading the
-     * buffer
-     *
-     * \return an vector of values read from the buffer
-     */
-    std::vector<uint16_t> ReadBfReportBuffer(std::vector<uint8_t> buffer,
-                                             std::vector<uint8_t> bits,
-                                             uint16_t idxBuffer) const;
+    static constexpr uint8_t ANGLE_ORDER_PSI = 0x80; //!< flag marking Psi angles in angle order
 
     /**
      * Generate number of angles on each subcarrier in beamforming report matrix
@@ -1586,7 +1576,9 @@ class HeCompressedBfReport : public Header
     uint16_t m_ns;   //!< The number of subcarriers
     uint8_t m_bits1; //!< The `number of bits representing angle Phi
     uint8_t m_bits2; //!< The number of bits representing angle Psis
-    ChannelInfo m_channelInfo; //!< Channel information
+    CsiBuffer m_channelInfo;            //!< Channel information owned by the header
+    const CsiBuffer* m_txChannelInfo{}; //!< Channel information to serialize, if not owned
+    CsiBuffer* m_rxChannelInfo{};       //!< Buffer to deserialize into, if not owned
 };
 
 class HeMuExclusiveBfReport : public Header
@@ -1608,22 +1600,38 @@ class HeMuExclusiveBfReport : public Header
     uint32_t Deserialize(Buffer::Iterator start) override;
 
     /**
-     * Set Delta SNR information for the HE MU Exclusive beamforming report
-     * \param deltaSnr Delta SNR information
+     * Set the channel information whose delta SNR values are serialized. The channel
+     * information is not copied, hence the given buffer must be kept alive and unchanged until
+     * the header is serialized.
+     *
+     * \param channelInfo channel information
+     */
+    void SetChannelInfo(const CsiBuffer& channelInfo);
+
+    /**
+     * Set the buffer into which the delta SNR values are written upon deserialization. If no
+     * buffer is set, the delta SNR values are stored in the header itself. A buffer that does
+     * not have the dimensions of the report is reset first; otherwise, only its delta SNR values
+     * are overwritten, so that the same buffer can be passed to the HE Compressed Beamforming
+     * Report deserialized before this header.
+     *
+     * \param channelInfo the buffer to deserialize delta SNR values into
      */
-    void SetDeltaSnr(std::vector<std::vector<uint8_t>> deltaSnr);
+    void SetChannelInfoBuffer(CsiBuffer& channelInfo);
 
     /**
-     * Get Delta SNR information for the HE MU Exclusive beamforming report
-     * \return deltaSnr Delta SNR information
+     * Get the channel information holding the delta SNR values
+     * \return channel information
      */
-    std::vector<std::vector<uint8_t>> GetDeltaSnr();
+    const CsiBuffer& GetChannelInfo() const;
 
   private:
     uint8_t m_nc;  //!< The number of columns Nc in a compressed beamforming feedback matrix
+    uint8_t m_na;  //!< The number of compressed angles
     uint16_t m_ns; //!< The number of subcarriers
-    std::vector<std::vector<uint8_t>>
-        m_deltaSnr; //!< Delta SNR information for each space-time stream
+    CsiBuffer m_channelInfo;            //!< Channel information owned by the header
+    const CsiBuffer* m_txChannelInfo{}; //!< Channel information to serialize, if not owned
+    CsiBuffer* m_rxChannelInfo{};       //!< Buffer to deserialize into, if not owned
 };
 
 } // namespace ns3
@@ -26,6 +26,8 @@
 
 #include <bitset>
 #include <cmath>
+#include <map>
+#include <tuple>
 
 namespace ns3
 {
@@ -85,13 +87,7 @@ double
 NistErrorRateModel::GetFecBpskBer(double snr, uint64_t nbits, uint8_t bValue) const
 {
     NS_LOG_FUNCTION(this << snr << nbits << +bValue);
-    double ber = GetBpskBer(snr);
-    if (ber == 0.0)
-    {
-        return 1.0;
-    }
-    double pe = CalculatePe(ber, bValue);
-    pe = std::min(pe, 1.0);
+    double pe = GetCodedBer(2, snr, bValue);
     double pms = std::pow(1 - pe, nbits);
     return pms;
 }
@@ -100,13 +96,7 @@ double
 NistErrorRateModel::GetFecQpskBer(double snr, uint64_t nbits, uint8_t bValue) const
 {
     NS_LOG_FUNCTION(this << snr << nbits << +bValue);
-    double ber = GetQpskBer(snr);
-    if (ber == 0.0)
-    {
-        return 1.0;
-    }
-    double pe = CalculatePe(ber, bValue);
-    pe = std::min(pe, 1.0);
+    double pe = GetCodedBer(4, snr, bValue);
     double pms = std::pow(1 - pe, nbits);
     return pms;
 }
@@ -169,17 +159,45 @@ NistErrorRateModel::GetFecQamBer(uint16_t constellationSize,
                                  uint8_t bValue) const
 {
     NS_LOG_FUNCTION(this << constellationSize << snr << nbits << +bValue);
-    double ber = GetQamBer(constellationSize, snr);
-    if (ber == 0.0)
-    {
-        return 1.0;
-    }
-    double pe = CalculatePe(ber, bValue);
-    pe = std::min(pe, 1.0);
+    double pe = GetCodedBer(constellationSize, snr, bValue);
     double pms = std::pow(1 - pe, nbits);
     return pms;
 }
 
+/// Maximum number of coded BERs memoized by the NIST error rate models
+static const std::size_t NIST_CODED_BER_CACHE_SIZE = 4096;
+
+/// Coded BERs memoized by the NIST error rate models, indexed by constellation size,
+/// bValue and SNR (linear scale). There is one table per thread, so that the partitions
+/// of the multithreaded simulator do not race on it.
+static thread_local std::map<std::tuple<uint16_t, uint8_t, double>, double> g_nistCodedBers;
+
+double
+NistErrorRateModel::GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+    NS_LOG_FUNCTION(this << constellationSize << snr << +bValue);
+    const auto key = std::make_tuple(constellationSize, bValue, snr);
+    if (auto it = g_nistCodedBers.find(key); it != g_nistCodedBers.end())
+    {
+        return it->second;
+    }
+    double ber = (constellationSize == 2)   ? GetBpskBer(snr)
+                 : (constellationSize == 4) ? GetQpskBer(snr)
+                                            : GetQamBer(constellationSize, snr);
+    double pe = 0.0;
+    if (ber != 0.0)
+    {
+        pe = CalculatePe(ber, bValue);
+        pe = std::min(pe, 1.0);
+    }
+    if (g_nistCodedBers.size() >= NIST_CODED_BER_CACHE_SIZE)
+    {
+        g_nistCodedBers.clear();
+    }
+    g_nistCodedBers.emplace(key, pe);
+    return pe;
+}
+
 uint8_t
 NistErrorRateModel::GetBValue(WifiCodeRate codeRate) const
 {
@@ -232,4 +250,27 @@ NistErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     return 0;
 }
 
+double
+NistErrorRateModel::DoGetChunksSuccessRate(WifiMode mode,
+                                           const WifiTxVector& txVector,
+                                           const std::vector<Chunk>& chunks,
+                                           uint8_t numRxAntennas,
+                                           WifiPpduField field,
+                                           uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << mode << chunks.size() << +numRxAntennas << field << staId);
+    if (mode.GetModulationClass() < WIFI_MOD_CLASS_ERP_OFDM)
+    {
+        return chunks.empty() ? 1.0 : 0.0;
+    }
+    const auto constellationSize = mode.GetConstellationSize();
+    const auto bValue = GetBValue(mode.GetCodeRate());
+    double psr = 1.0;
+    for (const auto& [snr, nbits] : chunks)
+    {
+        psr *= std::pow(1 - GetCodedBer(constellationSize, snr, bValue), nbits);
+    }
+    return psr;
+}
+
 } // namespace ns3
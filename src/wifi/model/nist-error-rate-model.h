@@ -53,6 +53,24 @@ class NistErrorRateModel : public ErrorRateModel
                                  uint8_t numRxAntennas,
                                  WifiPpduField field,
                                  uint16_t staId) const override;
+    double DoGetChunksSuccessRate(WifiMode mode,
+                                  const WifiTxVector& txVector,
+                                  const std::vector<Chunk>& chunks,
+                                  uint8_t numRxAntennas,
+                                  WifiPpduField field,
+                                  uint16_t staId) const override;
+    /**
+     * Return the coded BER of the given constellation at the given SNR. Since
+     * computing it is expensive, the coded BERs of the last SNRs are memoized and
+     * shared by all the NIST error rate models.
+     *
+     * \param constellationSize the constellation size (M)
+     * \param snr SNR ratio (in linear scale)
+     * \param bValue the bValue such that coding rate = bValue / (bValue + 1)
+     *
+     * \return the coded BER (0 if the uncoded BER is null)
+     */
+    double GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const;
     /**
      * Return the bValue such that coding rate = bValue / (bValue + 1).
      *
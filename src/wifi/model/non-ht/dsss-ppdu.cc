@@ -78,7 +78,7 @@ DsssPpdu::SetTxVectorFromDsssHeader(WifiTxVector& txVector, const DsssSigHeader&
 }
 
 Time
-DsssPpdu::GetTxDuration() const
+DsssPpdu::DoGetTxDuration() const
 {
     const auto& txVector = GetTxVector();
     const auto length = m_dsssSig.GetLength();
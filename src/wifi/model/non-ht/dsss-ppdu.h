@@ -98,11 +98,11 @@ class DsssPpdu : public WifiPpdu
              Time ppduDuration,
              uint64_t uid);
 
-    Time GetTxDuration() const override;
     Ptr<WifiPpdu> Copy() const override;
 
   private:
     WifiTxVector DoGetTxVector() const override;
+    Time DoGetTxDuration() const override;
 
     /**
      * Fill in the PHY headers.
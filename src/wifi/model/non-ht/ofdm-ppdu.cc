@@ -81,7 +81,7 @@ OfdmPpdu::SetTxVectorFromLSigHeader(WifiTxVector& txVector, const LSigHeader& lS
 }
 
 Time
-OfdmPpdu::GetTxDuration() const
+OfdmPpdu::DoGetTxDuration() const
 {
     const auto& txVector = GetTxVector();
     const auto length = m_lSig.GetLength();
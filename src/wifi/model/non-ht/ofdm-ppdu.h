@@ -103,7 +103,6 @@ class OfdmPpdu : public WifiPpdu
              uint64_t uid,
              bool instantiateLSig = true);
 
-    Time GetTxDuration() const override;
     Ptr<WifiPpdu> Copy() const override;
 
   protected:
@@ -111,6 +110,7 @@ class OfdmPpdu : public WifiPpdu
 
   private:
     WifiTxVector DoGetTxVector() const override;
+    Time DoGetTxDuration() const override;
 
     /**
      * Fill in the PHY headers.
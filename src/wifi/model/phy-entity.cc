@@ -76,7 +76,11 @@ operator<<(std::ostream& os, const PhyEntity::PhyFieldRxStatus& status)
  *       Abstract base class for PHY entities
  *******************************************************/
 
+#ifdef NS3_MTP
+std::atomic<uint64_t> PhyEntity::m_globalPpduUid{0};
+#else
 uint64_t PhyEntity::m_globalPpduUid = 0;
+#endif
 
 PhyEntity::~PhyEntity()
 {
@@ -587,7 +591,7 @@ PhyEntity::DoStartReceivePayload(Ptr<Event> event)
     m_statusPerMpduMap.insert({std::make_pair(ppdu->GetUid(), staId), std::vector<bool>()});
     ScheduleEndOfMpdus(event);
     const auto& txVector = event->GetPpdu()->GetTxVector();
-    Time payloadDuration = ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
+    Time payloadDuration = ppdu->GetTxDuration() - ppdu->GetPreambleAndHeaderDuration();
     m_wifiPhy->m_phyRxPayloadBeginTrace(
         txVector,
         payloadDuration); // this callback (equivalent to PHY-RXSTART primitive) is triggered only
@@ -608,7 +612,7 @@ PhyEntity::ScheduleEndOfMpdus(Ptr<Event> event)
     uint16_t staId = GetStaId(ppdu);
     Time endOfMpduDuration = NanoSeconds(0);
     Time relativeStart = NanoSeconds(0);
-    Time psduDuration = ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
+    Time psduDuration = ppdu->GetTxDuration() - ppdu->GetPreambleAndHeaderDuration();
     Time remainingAmpduDuration = psduDuration;
     size_t nMpdus = psdu->GetNMpdus();
     MpduType mpduType =
@@ -702,8 +706,7 @@ PhyEntity::EndReceivePayload(Ptr<Event> event)
 {
     const auto ppdu = event->GetPpdu();
     const auto& txVector = ppdu->GetTxVector();
-    const auto psduDuration =
-        ppdu->GetTxDuration() - CalculatePhyPreambleAndHeaderDuration(txVector);
+    const auto psduDuration = ppdu->GetTxDuration() - ppdu->GetPreambleAndHeaderDuration();
     NS_LOG_FUNCTION(this << *event << psduDuration);
     NS_ASSERT(event->GetEndTime() == Simulator::Now());
     const auto staId = GetStaId(ppdu);
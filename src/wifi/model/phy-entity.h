@@ -32,6 +32,9 @@
 #include "ns3/nstime.h"
 #include "ns3/simple-ref-count.h"
 
+#ifdef NS3_MTP
+#include <atomic>
+#endif
 #include <list>
 #include <map>
 #include <optional>
@@ -1004,8 +1007,12 @@ class PhyEntity : public SimpleRefCount<PhyEntity>
         m_signalNoiseMap; //!< Map of the latest signal power and noise power in dBm (noise power
                           //!< includes the noise figure)
 
+#ifdef NS3_MTP
+    static std::atomic<uint64_t> m_globalPpduUid; //!< Global counter of the PPDU UID
+#else
     static uint64_t m_globalPpduUid; //!< Global counter of the PPDU UID
-};                                   // class PhyEntity
+#endif
+}; // class PhyEntity
 
 /**
  * \brief Stream insertion operator.
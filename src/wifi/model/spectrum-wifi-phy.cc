@@ -88,7 +88,11 @@ SpectrumWifiPhy::GetTypeId()
             .AddTraceSource("SignalArrival",
                             "Signal arrival",
                             MakeTraceSourceAccessor(&SpectrumWifiPhy::m_signalCb),
-                            "ns3::SpectrumWifiPhy::SignalArrivalCallback");
+                            "ns3::SpectrumWifiPhy::SignalArrivalCallback")
+            .AddTraceSource("WifiSignalArrival",
+                            "Arrival of a Wi-Fi signal, with the received signal parameters",
+                            MakeTraceSourceAccessor(&SpectrumWifiPhy::m_wifiSignalCb),
+                            "ns3::SpectrumWifiPhy::WifiSignalArrivalCallback");
     return tid;
 }
 
@@ -422,6 +426,9 @@ SpectrumWifiPhy::StartRx(Ptr<SpectrumSignalParameters> rxParams,
         interface ? interface->GetBands() : m_currentSpectrumPhyInterface->GetBands();
     double totalRxPowerW = 0;
     RxPowerWattPerChannelBand rxPowerW;
+    // the received PSD may have been shaped per receiver by the channel (e.g., by a
+    // spectrum propagation loss model), hence the band powers are integrated per receiver
+    const auto rxGain = DbToRatio(GetRxGain());
 
     std::size_t index = 0;
     uint16_t prevBw = 0;
@@ -434,7 +441,7 @@ SpectrumWifiPhy::StartRx(Ptr<SpectrumSignalParameters> rxParams,
             WifiSpectrumValueHelper::GetBandPowerW(receivedSignalPsd, band.indices);
         NS_LOG_DEBUG("Signal power received (watts) before antenna gain for "
                      << bw << " MHz channel band " << index << ": " << band);
-        rxPowerPerBandW *= DbToRatio(GetRxGain());
+        rxPowerPerBandW *= rxGain;
         rxPowerW.insert({band, rxPowerPerBandW});
         NS_LOG_DEBUG("Signal power received after antenna gain for "
                      << bw << " MHz channel band " << index << ": " << rxPowerPerBandW << " W ("
@@ -459,7 +466,7 @@ SpectrumWifiPhy::StartRx(Ptr<SpectrumSignalParameters> rxParams,
                          << ru.GetRuType() << " and index " << ru.GetIndex() << " -> ("
                          << band.indices.first << "; " << band.indices.second
                          << "): " << rxPowerPerBandW);
-            rxPowerPerBandW *= DbToRatio(GetRxGain());
+            rxPowerPerBandW *= rxGain;
             NS_LOG_DEBUG("Signal power received after antenna gain for RU with type "
                          << ru.GetRuType() << " and index " << ru.GetIndex() << " -> ("
                          << band.indices.first << "; " << band.indices.second << "): "
@@ -476,6 +483,10 @@ SpectrumWifiPhy::StartRx(Ptr<SpectrumSignalParameters> rxParams,
 
     // Log the signal arrival to the trace source
     m_signalCb(bool(wifiRxParams), senderNodeId, WToDbm(totalRxPowerW), rxDuration);
+    if (wifiRxParams)
+    {
+        m_wifiSignalCb(wifiRxParams, senderNodeId);
+    }
 
     if (!wifiRxParams)
     {
@@ -134,6 +134,15 @@ class SpectrumWifiPhy : public WifiPhy
                                           double rxPower,
                                           Time duration);
 
+    /**
+     * Callback invoked when the PHY model starts to process a Wi-Fi signal
+     *
+     * \param params the parameters of the received signal, including its PSD
+     * \param senderNodeId node Id of the sender of the signal
+     */
+    typedef void (*WifiSignalArrivalCallback)(Ptr<const WifiSpectrumSignalParameters> params,
+                                              uint32_t senderNodeId);
+
     /**
      * Configure a non-active spectrum PHY interface to operate on a given frequency with a given
      * width. The function searches for the non-active PHY interface that operates on the frequency
@@ -287,6 +296,8 @@ class SpectrumWifiPhy : public WifiPhy
                                            //!< PHY interfaces are tracked
 
     TracedCallback<bool, uint32_t, double, Time> m_signalCb; //!< Signal callback
+    TracedCallback<Ptr<const WifiSpectrumSignalParameters>, uint32_t>
+        m_wifiSignalCb; //!< Wi-Fi signal callback
 
     double m_txMaskInnerBandMinimumRejection; //!< The minimum rejection (in dBr) for the inner band
                                               //!< of the transmit spectrum mask
@@ -42,6 +42,7 @@
 #include "ns3/pair.h"
 #include "ns3/pointer.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/sbp-headers.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
 
@@ -145,6 +146,16 @@ StaWifiMac::GetTypeId()
                             "Information about every received Beacon frame",
                             MakeTraceSourceAccessor(&StaWifiMac::m_beaconInfo),
                             "ns3::ApInfo::TracedCallback")
+            .AddTraceSource("SbpResponse",
+                            "An SBP Response frame was received from the AP. Provides the ID of "
+                            "the measurement setup and whether the AP accepted to run it",
+                            MakeTraceSourceAccessor(&StaWifiMac::m_sbpResponseTrace),
+                            "ns3::StaWifiMac::SbpResponseCallback")
+            .AddTraceSource("SbpReport",
+                            "A beamforming report collected by the AP in a measurement setup run "
+                            "on behalf of this station was forwarded by the AP",
+                            MakeTraceSourceAccessor(&StaWifiMac::m_sbpReportTrace),
+                            "ns3::StaWifiMac::SbpReportCallback")
             .AddAttribute(
                 "WiFiSensingSupported",
                 "This Boolean attribute is set to enable PCF support at this STA.",
@@ -1239,6 +1250,11 @@ StaWifiMac::Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
         break;
 
     case WIFI_MAC_MGT_ACTION:
+        if (WifiActionHeader::Peek(packet).first == WifiActionHeader::SENSING)
+        {
+            ReceiveSensingAction(mpdu, linkId);
+            break;
+        }
         if (auto [category, action] = WifiActionHeader::Peek(packet);
             category == WifiActionHeader::PROTECTED_EHT &&
             action.protectedEhtAction ==
@@ -1261,6 +1277,102 @@ StaWifiMac::Receive(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
     }
 }
 
+uint8_t
+StaWifiMac::RequestSensingByProxy(const SensingMeasurementSetup& setup)
+{
+    NS_LOG_FUNCTION(this << setup.interval << setup.priority);
+    NS_ABORT_MSG_IF(!IsAssociated(), "Cannot request sensing by proxy if not associated");
+
+    MgtSbpRequestHeader frame;
+    frame.SetSetupId(m_nextSbpSetupId++);
+    frame.SetMeasurementSetup(setup);
+    auto packet = Create<Packet>();
+    packet->AddHeader(frame);
+    SendSensingAction(WifiActionHeader::SENSING_SBP_REQUEST, packet);
+    return frame.GetSetupId();
+}
+
+void
+StaWifiMac::TerminateSensingByProxy(uint8_t setupId)
+{
+    NS_LOG_FUNCTION(this << +setupId);
+    if (!IsAssociated())
+    {
+        // the AP tears down our setups when we disassociate
+        return;
+    }
+
+    MgtSbpTerminationHeader frame;
+    frame.SetSetupId(setupId);
+    auto packet = Create<Packet>();
+    packet->AddHeader(frame);
+    SendSensingAction(WifiActionHeader::SENSING_SBP_TERMINATION, packet);
+}
+
+void
+StaWifiMac::SendSensingAction(WifiActionHeader::SensingActionValue action, Ptr<Packet> packet)
+{
+    NS_LOG_FUNCTION(this << +action << packet);
+    auto linkId = *GetSetupLinkIds().begin();
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_MGT_ACTION);
+    hdr.SetAddr1(GetBssid(linkId));
+    hdr.SetAddr2(GetFrameExchangeManager(linkId)->GetAddress());
+    hdr.SetAddr3(GetBssid(linkId));
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+
+    WifiActionHeader actionHdr;
+    WifiActionHeader::ActionValue actionValue;
+    actionValue.sensingAction = action;
+    actionHdr.SetAction(WifiActionHeader::SENSING, actionValue);
+    packet->AddHeader(actionHdr);
+
+    if (GetQosSupported())
+    {
+        // Use AC_VO to send management frame addressed to a QoS AP (Sec. 10.2.3.2 of
+        // 802.11-2020)
+        GetQosTxop(AC_VO)->Queue(packet, hdr);
+    }
+    else
+    {
+        GetTxop()->Queue(packet, hdr);
+    }
+}
+
+void
+StaWifiMac::ReceiveSensingAction(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
+{
+    NS_LOG_FUNCTION(this << *mpdu << +linkId);
+    const auto& hdr = mpdu->GetHeader();
+    if (!IsAssociated() || hdr.GetAddr3() != GetBssid(linkId))
+    {
+        NS_LOG_LOGIC("Sensing Action frame not sent by our AP");
+        return;
+    }
+
+    auto packet = mpdu->GetPacket()->Copy();
+    auto [category, action] = WifiActionHeader::Remove(packet);
+    switch (action.sensingAction)
+    {
+    case WifiActionHeader::SENSING_SBP_RESPONSE: {
+        MgtSbpResponseHeader frame;
+        packet->RemoveHeader(frame);
+        NS_LOG_DEBUG("SBP response received: " << frame);
+        m_sbpResponseTrace(frame.GetSetupId(), frame.IsSuccess());
+        break;
+    }
+    case WifiActionHeader::SENSING_SBP_REPORT: {
+        MgtSbpReportHeader frame;
+        packet->RemoveHeader(frame);
+        m_sbpReportTrace(frame.GetSetupId(), frame.GetInstanceId(), frame.GetReporter(), packet);
+        break;
+    }
+    default:
+        NS_LOG_LOGIC("Sensing Action frame aimed at an AP, ignore it");
+    }
+}
+
 void
 StaWifiMac::ReceiveBeacon(Ptr<const WifiMpdu> mpdu, uint8_t linkId)
 {
@@ -26,6 +26,8 @@
 #include "infrastructure-wifi-mac.h"
 #include "mgt-headers.h"
 
+#include "ns3/sensing-session-manager.h"
+
 #include <set>
 #include <variant>
 
@@ -262,6 +264,44 @@ class StaWifiMac : public InfrastructureWifiMac
      */
     bool IsAssociated() const;
 
+    /**
+     * Request the AP to run the given sensing measurement setup on our behalf (sensing by
+     * proxy). The AP serves the setup with its TB sensing measurement instances, possibly
+     * shared with the setups requested by other stations, and forwards to us the
+     * beamforming reports sent by the stations included in the setup. Including this
+     * station in the setup makes the AP sense the channel between the AP and this station.
+     *
+     * \param setup the parameters of the measurement setup
+     * \return the ID assigned to the measurement setup
+     */
+    uint8_t RequestSensingByProxy(const SensingMeasurementSetup& setup);
+    /**
+     * Request the AP to stop running the given sensing measurement setup on our behalf.
+     *
+     * \param setupId the ID of the measurement setup
+     */
+    void TerminateSensingByProxy(uint8_t setupId);
+
+    /**
+     * TracedCallback signature for SBP Response frames.
+     *
+     * \param setupId the ID of the measurement setup
+     * \param accepted whether the AP accepted to run the measurement setup
+     */
+    typedef void (*SbpResponseCallback)(uint8_t setupId, bool accepted);
+    /**
+     * TracedCallback signature for the beamforming reports forwarded by the AP.
+     *
+     * \param setupId the ID of the measurement setup
+     * \param instanceId the ID of the AP measurement instance in which the report was collected
+     * \param reporter the MAC address of the station that sent the report
+     * \param report the beamforming report, starting with its Action field
+     */
+    typedef void (*SbpReportCallback)(uint8_t setupId,
+                                      uint32_t instanceId,
+                                      Mac48Address reporter,
+                                      Ptr<const Packet> report);
+
     /**
      * Get the IDs of the setup links (if any).
      *
@@ -459,6 +499,22 @@ class StaWifiMac : public InfrastructureWifiMac
      */
     void ReceiveAssocResp(Ptr<const WifiMpdu> mpdu, uint8_t linkId);
 
+    /**
+     * Process the Sensing Action frame received on the given link.
+     *
+     * \param mpdu the MPDU containing the Sensing Action frame
+     * \param linkId the ID of the given link
+     */
+    void ReceiveSensingAction(Ptr<const WifiMpdu> mpdu, uint8_t linkId);
+
+    /**
+     * Send a Sensing Action frame to the AP we are associated with.
+     *
+     * \param action the sensing action
+     * \param packet the frame body, without the Action field
+     */
+    void SendSensingAction(WifiActionHeader::SensingActionValue action, Ptr<Packet> packet);
+
     /**
      * Update associated AP's information from the given management frame (Beacon,
      * Probe Response or Association Response). If STA is not associated, this
@@ -659,6 +715,10 @@ class StaWifiMac : public InfrastructureWifiMac
     TracedCallback<uint8_t, Mac48Address> m_setupCanceled;  ///< link setup canceled logger
     TracedCallback<Time> m_beaconArrival;                   ///< beacon arrival logger
     TracedCallback<ApInfo> m_beaconInfo;                    ///< beacon info logger
+    TracedCallback<uint8_t, bool> m_sbpResponseTrace;       ///< SBP response logger
+    TracedCallback<uint8_t, uint32_t, Mac48Address, Ptr<const Packet>>
+        m_sbpReportTrace;  ///< forwarded beamforming report logger
+    uint8_t m_nextSbpSetupId{0}; ///< ID to assign to the next SBP measurement setup
 
     /// TracedCallback signature for link setup completed/canceled events
     using LinkSetupCallback = void (*)(uint8_t /* link ID */, Mac48Address /* AP address */);
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
 
 namespace ns3
 {
@@ -146,93 +147,132 @@ TableBasedErrorRateModel::GetMcsForMode(WifiMode mode)
     return mcs;
 }
 
-double
-TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
-                                                const WifiTxVector& txVector,
-                                                double snr,
-                                                uint64_t nbits,
-                                                uint8_t numRxAntennas,
-                                                WifiPpduField field,
-                                                uint16_t staId) const
+std::optional<uint8_t>
+TableBasedErrorRateModel::GetTableMcs(WifiMode mode, bool ldpc) const
 {
-    NS_LOG_FUNCTION(this << mode << txVector << snr << nbits << +numRxAntennas << field << staId);
-    uint64_t size = std::max<uint64_t>(1, (nbits / 8));
-    double roundedSnr = RoundSnr(RatioToDb(snr), SNR_PRECISION);
-    uint8_t mcs;
-    if (auto ret = GetMcsForMode(mode); ret.has_value())
-    {
-        mcs = ret.value();
-    }
-    else
+    auto mcs = GetMcsForMode(mode);
+    if (!mcs.has_value())
     {
         NS_LOG_DEBUG("No MCS found for mode " << mode << ": use fallback error rate model");
-        return m_fallbackErrorModel
-            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+        return std::nullopt;
     }
-    bool ldpc = txVector.IsLdpc();
-    NS_LOG_FUNCTION(this << +mcs << roundedSnr << size << ldpc);
 
     // HT: for MCS greater than 7, use 0 - 7 curves for data rate
     if (mode.GetModulationClass() == WIFI_MOD_CLASS_HT)
     {
-        mcs = mcs % 8;
+        mcs = *mcs % 8;
     }
 
-    if (mcs >= (ldpc ? ERROR_TABLE_LDPC_MAX_NUM_MCS : ERROR_TABLE_BCC_MAX_NUM_MCS))
+    if (*mcs >= (ldpc ? ERROR_TABLE_LDPC_MAX_NUM_MCS : ERROR_TABLE_BCC_MAX_NUM_MCS))
     {
         NS_LOG_WARN("Table missing for MCS: "
-                    << +mcs << " in TableBasedErrorRateModel: use fallback error rate model");
-        return m_fallbackErrorModel
-            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+                    << +*mcs << " in TableBasedErrorRateModel: use fallback error rate model");
+        return std::nullopt;
     }
+    return mcs;
+}
 
-    auto errorTable = (ldpc ? AwgnErrorTableLdpc1458
-                            : (size < m_threshold ? AwgnErrorTableBcc32 : AwgnErrorTableBcc1458));
-    const auto& itVector = errorTable[mcs];
-    auto itTable = std::find_if(itVector.cbegin(),
-                                itVector.cend(),
+/**
+ * Get the PER of the given table at the given SNR, interpolating linearly between the
+ * entries of the table.
+ *
+ * \param table the table
+ * \param roundedSnr the SNR (in dB) rounded to the precision of the tables
+ * \return the PER
+ */
+static double
+InterpolatePer(const SnrPerTable& table, double roundedSnr)
+{
+    auto itTable = std::find_if(table.cbegin(),
+                                table.cend(),
                                 [&roundedSnr](const std::pair<double, double>& element) {
                                     return element.first == roundedSnr;
                                 });
-    double minSnr = itVector.cbegin()->first;
-    double maxSnr = (--itVector.cend())->first;
-    double per;
-    if (itTable == itVector.cend())
+    if (itTable != table.cend())
     {
-        if (roundedSnr < minSnr)
-        {
-            per = 1.0;
-        }
-        else if (roundedSnr > maxSnr)
+        return itTable->second;
+    }
+    double a = 0.0;
+    double b = 0.0;
+    double previousSnr = 0.0;
+    double nextSnr = 0.0;
+    for (auto i = table.cbegin(); i != table.cend(); ++i)
+    {
+        if (i->first < roundedSnr)
         {
-            per = 0.0;
+            previousSnr = i->first;
+            a = i->second;
         }
         else
         {
-            double a = 0.0;
-            double b = 0.0;
-            double previousSnr = 0.0;
-            double nextSnr = 0.0;
-            for (auto i = itVector.cbegin(); i != itVector.cend(); ++i)
-            {
-                if (i->first < roundedSnr)
-                {
-                    previousSnr = i->first;
-                    a = i->second;
-                }
-                else
-                {
-                    nextSnr = i->first;
-                    b = i->second;
-                    break;
-                }
-            }
-            per = a + (roundedSnr - previousSnr) * (b - a) / (nextSnr - previousSnr);
+            nextSnr = i->first;
+            b = i->second;
+            break;
         }
     }
+    return a + (roundedSnr - previousSnr) * (b - a) / (nextSnr - previousSnr);
+}
+
+/// Dense PER tables, with one PER per SNR step of the precision of the tables starting
+/// from the lowest SNR of the table, indexed by the original table. They are built on
+/// first use and shared by all the error rate models of a thread (each partition of the
+/// multithreaded simulator builds its own).
+static thread_local std::map<const SnrPerTable*, std::vector<double>> g_densePerTables;
+
+/**
+ * \param table a table
+ * \return the dense version of the given table
+ */
+static const std::vector<double>&
+GetDensePerTable(const SnrPerTable& table)
+{
+    auto it = g_densePerTables.find(&table);
+    if (it != g_densePerTables.end())
+    {
+        return it->second;
+    }
+    const double multiplier = std::round(std::pow(10.0, SNR_PRECISION));
+    const auto first = std::llround(table.cbegin()->first * multiplier);
+    const auto last = std::llround((--table.cend())->first * multiplier);
+    std::vector<double> perTable(last - first + 1);
+    for (auto n = first; n <= last; ++n)
+    {
+        perTable[n - first] = InterpolatePer(table, n / multiplier);
+    }
+    return g_densePerTables.emplace(&table, std::move(perTable)).first->second;
+}
+
+double
+TableBasedErrorRateModel::GetTablePer(uint8_t mcs, bool ldpc, double snr, uint64_t nbits) const
+{
+    uint64_t size = std::max<uint64_t>(1, (nbits / 8));
+    double roundedSnr = RoundSnr(RatioToDb(snr), SNR_PRECISION);
+    NS_LOG_FUNCTION(this << +mcs << roundedSnr << size << ldpc);
+
+    auto errorTable = (ldpc ? AwgnErrorTableLdpc1458
+                            : (size < m_threshold ? AwgnErrorTableBcc32 : AwgnErrorTableBcc1458));
+    const auto& itVector = errorTable[mcs];
+    double minSnr = itVector.cbegin()->first;
+    double maxSnr = (--itVector.cend())->first;
+    double per;
+    if (roundedSnr < minSnr)
+    {
+        per = 1.0;
+    }
+    else if (roundedSnr > maxSnr)
+    {
+        per = 0.0;
+    }
     else
     {
-        per = itTable->second;
+        // the rounded SNR is a multiple of the precision, hence an entry of the dense table
+        const double multiplier = std::round(std::pow(10.0, SNR_PRECISION));
+        const auto& perTable = GetDensePerTable(itVector);
+        const auto index =
+            std::llround(roundedSnr * multiplier) - std::llround(minSnr * multiplier);
+        per = (index >= 0 && static_cast<std::size_t>(index) < perTable.size())
+                  ? perTable[index]
+                  : InterpolatePer(itVector, roundedSnr);
     }
 
     uint16_t tableSize = (ldpc ? ERROR_TABLE_LDPC_FRAME_SIZE
@@ -248,8 +288,52 @@ TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     {
         per = 0.0;
     }
+    return per;
+}
+
+double
+TableBasedErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
+                                                const WifiTxVector& txVector,
+                                                double snr,
+                                                uint64_t nbits,
+                                                uint8_t numRxAntennas,
+                                                WifiPpduField field,
+                                                uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << mode << txVector << snr << nbits << +numRxAntennas << field << staId);
+    bool ldpc = txVector.IsLdpc();
+    auto mcs = GetTableMcs(mode, ldpc);
+    if (!mcs.has_value())
+    {
+        return m_fallbackErrorModel
+            ->GetChunkSuccessRate(mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+    return 1.0 - GetTablePer(*mcs, ldpc, snr, nbits);
+}
 
-    return 1.0 - per;
+double
+TableBasedErrorRateModel::DoGetChunksSuccessRate(WifiMode mode,
+                                                 const WifiTxVector& txVector,
+                                                 const std::vector<Chunk>& chunks,
+                                                 uint8_t numRxAntennas,
+                                                 WifiPpduField field,
+                                                 uint16_t staId) const
+{
+    NS_LOG_FUNCTION(this << mode << txVector << chunks.size() << +numRxAntennas << field
+                         << staId);
+    bool ldpc = txVector.IsLdpc();
+    auto mcs = GetTableMcs(mode, ldpc);
+    if (!mcs.has_value())
+    {
+        return m_fallbackErrorModel
+            ->GetChunksSuccessRate(mode, txVector, chunks, numRxAntennas, field, staId);
+    }
+    double psr = 1.0;
+    for (const auto& [snr, nbits] : chunks)
+    {
+        psr *= 1.0 - GetTablePer(*mcs, ldpc, snr, nbits);
+    }
+    return psr;
 }
 
 } // namespace ns3
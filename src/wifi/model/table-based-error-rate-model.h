@@ -65,6 +65,32 @@ class TableBasedErrorRateModel : public ErrorRateModel
                                  uint8_t numRxAntennas,
                                  WifiPpduField field,
                                  uint16_t staId) const override;
+    double DoGetChunksSuccessRate(WifiMode mode,
+                                  const WifiTxVector& txVector,
+                                  const std::vector<Chunk>& chunks,
+                                  uint8_t numRxAntennas,
+                                  WifiPpduField field,
+                                  uint16_t staId) const override;
+
+    /**
+     * Get the MCS whose table is to be used for the given mode.
+     *
+     * \param mode the Wi-Fi mode
+     * \param ldpc whether LDPC is used
+     * \return the MCS of the table, if there is a table for the given mode
+     */
+    std::optional<uint8_t> GetTableMcs(WifiMode mode, bool ldpc) const;
+
+    /**
+     * Get the PER of a chunk from the tables, scaled to the size of the chunk.
+     *
+     * \param mcs the MCS of the table (see GetTableMcs)
+     * \param ldpc whether LDPC is used
+     * \param snr the SNR of the chunk (linear scale)
+     * \param nbits the number of bits of the chunk
+     * \return the PER of the chunk
+     */
+    double GetTablePer(uint8_t mcs, bool ldpc, double snr, uint64_t nbits) const;
 
     /**
      * Round SNR (in dB) to the specified precision
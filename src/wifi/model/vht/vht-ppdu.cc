@@ -109,7 +109,7 @@ VhtPpdu::SetTxVectorFromPhyHeaders(WifiTxVector& txVector,
 }
 
 Time
-VhtPpdu::GetTxDuration() const
+VhtPpdu::DoGetTxDuration() const
 {
     const auto& txVector = GetTxVector();
     const auto length = m_lSig.GetLength();
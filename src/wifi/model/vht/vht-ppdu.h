@@ -152,12 +152,12 @@ class VhtPpdu : public OfdmPpdu
             Time ppduDuration,
             uint64_t uid);
 
-    Time GetTxDuration() const override;
     Ptr<WifiPpdu> Copy() const override;
     WifiPpduType GetType() const override;
 
   private:
     WifiTxVector DoGetTxVector() const override;
+    Time DoGetTxDuration() const override;
 
     /**
      * Fill in the PHY headers.
@@ -135,9 +135,16 @@ WifiMpdu::GetHeader() const
 WifiMacHeader&
 WifiMpdu::GetHeader()
 {
+    ++m_modificationCount;
     return m_header;
 }
 
+uint32_t
+WifiMpdu::GetModificationCount() const
+{
+    return m_modificationCount;
+}
+
 Mac48Address
 WifiMpdu::GetDestinationAddress() const
 {
@@ -182,6 +189,7 @@ WifiMpdu::Aggregate(Ptr<const WifiMpdu> msdu)
                     "This method can only be called on the original version of the MPDU");
 
     auto& original = std::get<OriginalInfo>(m_instanceInfo);
+    ++m_modificationCount;
 
     if (original.m_msduList.empty())
     {
@@ -339,10 +347,12 @@ WifiMpdu::AssignSeqNo(uint16_t seqNo)
     NS_LOG_FUNCTION(this << seqNo);
 
     m_header.SetSequenceNumber(seqNo);
+    ++m_modificationCount;
     // if this is an alias, set the sequence number on the original copy, too
     if (auto originalPtr = std::get_if<ALIAS>(&m_instanceInfo))
     {
         (*originalPtr)->m_header.SetSequenceNumber(seqNo);
+        ++(*originalPtr)->m_modificationCount;
     }
     GetOriginalInfo().m_seqNoAssigned = true;
 }
@@ -95,10 +95,25 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
 
     /**
      * \brief Get the header stored in this item
+     *
+     * The header may be modified through the returned reference, hence calling this method
+     * increments the modification counter of this item (see GetModificationCount()).
+     *
      * \return the header stored in this item.
      */
     WifiMacHeader& GetHeader();
 
+    /**
+     * The modification counter is incremented every time the header or the payload of this
+     * item may be modified, i.e., when the non-const GetHeader() is called, when an MSDU is
+     * aggregated and when a sequence number is assigned. It allows objects that cache
+     * information built from this item (e.g., WifiPsdu::GetPacket()) to detect that such
+     * information is stale.
+     *
+     * \return the modification counter of this item
+     */
+    uint32_t GetModificationCount() const;
+
     /**
      * \brief Return the destination address present in the header
      * \return the destination address
@@ -276,7 +291,8 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
     /**
      * Information stored by both the original copy and the aliases
      */
-    WifiMacHeader m_header; //!< Wifi MAC header associated with the packet
+    WifiMacHeader m_header;          //!< Wifi MAC header associated with the packet
+    uint32_t m_modificationCount{0}; //!< modification counter of the header and payload
 
     /**
      * Information stored by the original copy only.
@@ -46,6 +46,7 @@
 #include "ns3/vht-configuration.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -1510,16 +1511,60 @@ WifiPhy::CalculatePhyPreambleAndHeaderDuration(const WifiTxVector& txVector)
         ->CalculatePhyPreambleAndHeaderDuration(txVector);
 }
 
+/// Arguments and result of a call to WifiPhy::CalculateTxDuration
+struct WifiTxDurationEntry
+{
+    uint32_t size;         //!< the size of the PSDU
+    WifiTxVector txVector; //!< the TXVECTOR
+    WifiPhyBand band;      //!< the PHY band
+    uint16_t staId;        //!< the STA-ID of the PSDU
+    Time duration;         //!< the resulting transmission duration
+};
+
+/// Maximum number of transmission durations memoized by WifiPhy::CalculateTxDuration
+static const std::size_t WIFI_TX_DURATION_CACHE_SIZE = 4096;
+
+/// Transmission durations memoized by WifiPhy::CalculateTxDuration, indexed by a hash of
+/// the arguments combining the PSDU size, the signature of the TXVECTOR, the band and the
+/// STA-ID. The MAC computes the durations of the same (mostly control and fixed-size
+/// management) frames with the same TXVECTORs over and over. The table is per thread,
+/// since the PHYs of different partitions of the multithreaded simulator may run
+/// concurrently.
+static thread_local std::unordered_multimap<std::size_t, WifiTxDurationEntry> g_wifiTxDurations;
+
 Time
 WifiPhy::CalculateTxDuration(uint32_t size,
                              const WifiTxVector& txVector,
                              WifiPhyBand band,
                              uint16_t staId)
 {
-    Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
-                    GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
-    NS_ASSERT(duration.IsStrictlyPositive());
-    return duration;
+    std::size_t hash = txVector.GetSignature();
+    for (const std::size_t value : {std::size_t{size}, std::size_t{band}, std::size_t{staId}})
+    {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    auto [first, last] = g_wifiTxDurations.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+        const auto& entry = it->second;
+        if (entry.size == size && entry.band == band && entry.staId == staId &&
+            entry.txVector == txVector)
+        {
+            return entry.duration;
+        }
+    }
+
+    // the TXVECTOR is copied before computing the duration, which may initialize some of
+    // its fields (e.g., the RU_ALLOCATION field), for later calls with the same TXVECTOR
+    WifiTxDurationEntry entry{size, txVector, band, staId, Time()};
+    entry.duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
+                     GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+    NS_ASSERT(entry.duration.IsStrictlyPositive());
+    if (g_wifiTxDurations.size() >= WIFI_TX_DURATION_CACHE_SIZE)
+    {
+        g_wifiTxDurations.clear();
+    }
+    return g_wifiTxDurations.emplace(hash, std::move(entry))->second.duration;
 }
 
 Time
@@ -20,6 +20,7 @@
 #include "wifi-ppdu.h"
 
 #include "wifi-phy-operating-channel.h"
+#include "wifi-phy.h"
 #include "wifi-psdu.h"
 
 #include "ns3/log.h"
@@ -107,6 +108,7 @@ WifiPpdu::ResetTxVector() const
 {
     NS_LOG_FUNCTION(this);
     m_txVector.reset();
+    m_txInfo = {};
 }
 
 void
@@ -218,6 +220,27 @@ WifiPpdu::GetStaId() const
 
 Time
 WifiPpdu::GetTxDuration() const
+{
+    if (!m_txInfo.txDuration.has_value())
+    {
+        m_txInfo.txDuration = DoGetTxDuration();
+    }
+    return *m_txInfo.txDuration;
+}
+
+Time
+WifiPpdu::GetPreambleAndHeaderDuration() const
+{
+    if (!m_txInfo.preambleAndHeaderDuration.has_value())
+    {
+        m_txInfo.preambleAndHeaderDuration =
+            WifiPhy::CalculatePhyPreambleAndHeaderDuration(GetTxVector());
+    }
+    return *m_txInfo.preambleAndHeaderDuration;
+}
+
+Time
+WifiPpdu::DoGetTxDuration() const
 {
     NS_FATAL_ERROR("This method should not be called for the base WifiPpdu class. Use the "
                    "overloaded version in the amendment-specific PPDU subclasses instead!");
@@ -248,6 +271,18 @@ WifiPpdu::Copy() const
     return Ptr<WifiPpdu>(new WifiPpdu(*this), false);
 }
 
+Ptr<WifiPpdu>
+WifiPpdu::DeepCopy() const
+{
+    NS_LOG_FUNCTION(this);
+    auto copy = Copy();
+    for (auto& [staId, psdu] : copy->m_psdus)
+    {
+        psdu = psdu->DeepCopy();
+    }
+    return copy;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Ptr<const WifiPpdu>& ppdu)
 {
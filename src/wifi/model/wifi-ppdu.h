@@ -122,11 +122,21 @@ class WifiPpdu : public SimpleRefCount<WifiPpdu>
     void SetTruncatedTx();
 
     /**
-     * Get the total transmission duration of the PPDU.
+     * Get the total transmission duration of the PPDU. The duration is computed once
+     * from the TXVECTOR and shared by all the PHYs receiving this PPDU.
      *
      * \return the transmission duration of the PPDU
      */
-    virtual Time GetTxDuration() const;
+    Time GetTxDuration() const;
+
+    /**
+     * Get the duration of the preamble and of the PHY header of the PPDU, i.e. the
+     * duration of the PPDU up to the PHY payload. As the total transmission duration,
+     * it is computed once from the TXVECTOR and shared by all the receivers.
+     *
+     * \return the duration of the preamble and of the PHY header of the PPDU
+     */
+    Time GetPreambleAndHeaderDuration() const;
 
     /**
      * Get the channel width over which the PPDU will effectively be
@@ -179,6 +189,17 @@ class WifiPpdu : public SimpleRefCount<WifiPpdu>
      */
     virtual Ptr<WifiPpdu> Copy() const;
 
+    /**
+     * \brief Copy this instance, including the PSDUs it contains.
+     *
+     * The PSDUs of the copies returned by Copy() are shared, whereas the PSDUs of the
+     * returned copy are deep copies (\see WifiPsdu::DeepCopy), hence it can be delivered
+     * to the PHYs of another partition of the MultithreadedSimulatorImpl.
+     *
+     * \return a Ptr to a deep copy of this instance.
+     */
+    Ptr<WifiPpdu> DeepCopy() const;
+
     /**
      * Return the PPDU type (\see WifiPpduType)
      * \return the PPDU type
@@ -209,7 +230,28 @@ class WifiPpdu : public SimpleRefCount<WifiPpdu>
                     //!< std::nullopt if TXVECTOR has not been reconstructed yet)
     const WifiPhyOperatingChannel& m_operatingChannel; //!< the operating channel of the PHY
 
+    /**
+     * Values derived from the TXVECTOR. A PPDU is shared by all the PHYs it is delivered
+     * to, hence these values are computed by the first receiver that needs them and
+     * reused by the others. They are reset whenever the TXVECTOR is reset or updated.
+     */
+    struct TxInfo
+    {
+        std::optional<Time> txDuration;                //!< the transmission duration
+        std::optional<Time> preambleAndHeaderDuration; //!< the preamble and PHY header duration
+    };
+
+    mutable TxInfo m_txInfo; //!< the values derived from the TXVECTOR
+
   private:
+    /**
+     * Compute the total transmission duration of the PPDU from the TXVECTOR and the
+     * PHY headers.
+     *
+     * \return the transmission duration of the PPDU
+     */
+    virtual Time DoGetTxDuration() const;
+
     /**
      * Get the TXVECTOR used to send the PPDU.
      *
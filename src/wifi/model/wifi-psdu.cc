@@ -27,6 +27,8 @@
 #include "ns3/log.h"
 #include "ns3/packet.h"
 
+#include <memory>
+
 namespace ns3
 {
 
@@ -88,11 +90,26 @@ WifiPsdu::IsAggregate() const
 Ptr<const Packet>
 WifiPsdu::GetPacket() const
 {
+    if (m_packet)
+    {
+        // the MPDUs may be shared with other PSDUs or with the MAC queues, hence their
+        // headers (e.g., the Retry flag) may have been modified after the packet was built
+        bool modified = (m_modificationCounts.size() != m_mpduList.size());
+        for (std::size_t i = 0; i < m_mpduList.size() && !modified; i++)
+        {
+            modified = (m_mpduList[i]->GetModificationCount() != m_modificationCounts[i]);
+        }
+        if (!modified)
+        {
+            return m_packet;
+        }
+    }
+
     Ptr<Packet> packet = Create<Packet>();
     if (m_mpduList.size() == 1 && !m_isSingle)
     {
         packet = m_mpduList.at(0)->GetPacket()->Copy();
-        packet->AddHeader(m_mpduList.at(0)->GetHeader());
+        packet->AddHeader(GetHeader(0));
         AddWifiMacTrailer(packet);
     }
     else if (m_isSingle)
@@ -106,17 +123,88 @@ WifiPsdu::GetPacket() const
             MpduAggregator::Aggregate(mpdu, packet, false);
         }
     }
-    return packet;
+    m_packet = packet;
+    m_modificationCounts.clear();
+    for (const auto& mpdu : m_mpduList)
+    {
+        m_modificationCounts.push_back(mpdu->GetModificationCount());
+    }
+    return m_packet;
+}
+
+/**
+ * Copy the given packet by serializing it, so that the copy does not share any reference
+ * counted object (e.g., the buffer or the tags) with the given packet.
+ *
+ * \param packet the given packet
+ * \return the copy of the given packet
+ */
+static Ptr<Packet>
+DeepCopyPacket(Ptr<const Packet> packet)
+{
+    std::vector<uint8_t> buffer(packet->GetSerializedSize());
+    packet->Serialize(buffer.data(), buffer.size());
+    auto copy = Create<Packet>(buffer.data(), buffer.size(), true);
+
+    // the tags are not serialized
+    auto makeTag = [](TypeId tid) -> std::unique_ptr<Tag> {
+        if (!tid.HasConstructor())
+        {
+            NS_LOG_WARN("Tag " << tid.GetName() << " cannot be copied");
+            return nullptr;
+        }
+        return std::unique_ptr<Tag>(dynamic_cast<Tag*>(tid.GetConstructor()()));
+    };
+    auto packetTags = packet->GetPacketTagIterator();
+    while (packetTags.HasNext())
+    {
+        auto item = packetTags.Next();
+        if (auto tag = makeTag(item.GetTypeId()))
+        {
+            item.GetTag(*tag);
+            copy->AddPacketTag(*tag);
+        }
+    }
+    auto byteTags = packet->GetByteTagIterator();
+    while (byteTags.HasNext())
+    {
+        auto item = byteTags.Next();
+        if (auto tag = makeTag(item.GetTypeId()))
+        {
+            item.GetTag(*tag);
+            copy->AddByteTag(*tag, item.GetStart(), item.GetEnd());
+        }
+    }
+    return copy;
+}
+
+Ptr<WifiPsdu>
+WifiPsdu::DeepCopy() const
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (const auto& mpdu : m_mpduList)
+    {
+        mpduList.push_back(Create<WifiMpdu>(DeepCopyPacket(mpdu->GetPacket()),
+                                            mpdu->GetHeader(),
+                                            mpdu->GetTimestamp()));
+    }
+    if (mpduList.size() == 1)
+    {
+        // a single MPDU may or may not be an S-MPDU
+        return Create<WifiPsdu>(mpduList.front(), m_isSingle);
+    }
+    return Create<WifiPsdu>(mpduList);
 }
 
 Mac48Address
 WifiPsdu::GetAddr1() const
 {
-    Mac48Address ra = m_mpduList.at(0)->GetHeader().GetAddr1();
+    Mac48Address ra = GetHeader(0).GetAddr1();
     // check that the other MPDUs have the same RA
     for (std::size_t i = 1; i < m_mpduList.size(); i++)
     {
-        if (m_mpduList.at(i)->GetHeader().GetAddr1() != ra)
+        if (GetHeader(i).GetAddr1() != ra)
         {
             NS_ABORT_MSG("MPDUs in an A-AMPDU must have the same receiver address");
         }
@@ -127,11 +215,11 @@ WifiPsdu::GetAddr1() const
 Mac48Address
 WifiPsdu::GetAddr2() const
 {
-    Mac48Address ta = m_mpduList.at(0)->GetHeader().GetAddr2();
+    Mac48Address ta = GetHeader(0).GetAddr2();
     // check that the other MPDUs have the same TA
     for (std::size_t i = 1; i < m_mpduList.size(); i++)
     {
-        if (m_mpduList.at(i)->GetHeader().GetAddr2() != ta)
+        if (GetHeader(i).GetAddr2() != ta)
         {
             NS_ABORT_MSG("MPDUs in an A-AMPDU must have the same transmitter address");
         }
@@ -146,17 +234,17 @@ WifiPsdu::HasNav() const
     // are greater than 32 768, the contents are interpreted as appropriate for the frame
     // type and subtype or ignored if the receiving MAC entity does not have a defined
     // interpretation for that type and subtype (IEEE 802.11-2016 sec. 10.27.3)
-    return (m_mpduList.at(0)->GetHeader().GetRawDuration() & 0x8000) == 0;
+    return (GetHeader(0).GetRawDuration() & 0x8000) == 0;
 }
 
 Time
 WifiPsdu::GetDuration() const
 {
-    Time duration = m_mpduList.at(0)->GetHeader().GetDuration();
+    Time duration = GetHeader(0).GetDuration();
     // check that the other MPDUs have the same Duration/ID
     for (std::size_t i = 1; i < m_mpduList.size(); i++)
     {
-        if (m_mpduList.at(i)->GetHeader().GetDuration() != duration)
+        if (GetHeader(i).GetDuration() != duration)
         {
             NS_ABORT_MSG("MPDUs in an A-AMPDU must have the same Duration/ID");
         }
@@ -168,6 +256,7 @@ void
 WifiPsdu::SetDuration(Time duration)
 {
     NS_LOG_FUNCTION(this << duration);
+    m_packet = nullptr;
     for (auto& mpdu : m_mpduList)
     {
         mpdu->GetHeader().SetDuration(duration);
@@ -178,7 +267,7 @@ std::set<uint8_t>
 WifiPsdu::GetTids() const
 {
     std::set<uint8_t> s;
-    for (auto& mpdu : m_mpduList)
+    for (Ptr<const WifiMpdu> mpdu : m_mpduList)
     {
         if (mpdu->GetHeader().IsQosData())
         {
@@ -193,31 +282,31 @@ WifiPsdu::GetAckPolicyForTid(uint8_t tid) const
 {
     NS_LOG_FUNCTION(this << +tid);
     WifiMacHeader::QosAckPolicy policy;
-    auto it = m_mpduList.begin();
+    std::size_t i = 0;
     bool found = false;
 
     // find the first QoS Data frame with the given TID
     do
     {
-        if ((*it)->GetHeader().IsQosData() && (*it)->GetHeader().GetQosTid() == tid)
+        if (GetHeader(i).IsQosData() && GetHeader(i).GetQosTid() == tid)
         {
-            policy = (*it)->GetHeader().GetQosAckPolicy();
+            policy = GetHeader(i).GetQosAckPolicy();
             found = true;
         }
-        it++;
-    } while (!found && it != m_mpduList.end());
+        i++;
+    } while (!found && i < m_mpduList.size());
 
     NS_ABORT_MSG_IF(!found, "No QoS Data frame in the PSDU");
 
     // check that the other QoS Data frames with the given TID have the same ack policy
-    while (it != m_mpduList.end())
+    while (i < m_mpduList.size())
     {
-        if ((*it)->GetHeader().IsQosData() && (*it)->GetHeader().GetQosTid() == tid &&
-            (*it)->GetHeader().GetQosAckPolicy() != policy)
+        if (GetHeader(i).IsQosData() && GetHeader(i).GetQosTid() == tid &&
+            GetHeader(i).GetQosAckPolicy() != policy)
         {
             NS_ABORT_MSG("QoS Data frames with the same TID must have the same QoS Ack Policy");
         }
-        it++;
+        i++;
     }
     return policy;
 }
@@ -226,6 +315,7 @@ void
 WifiPsdu::SetAckPolicyForTid(uint8_t tid, WifiMacHeader::QosAckPolicy policy)
 {
     NS_LOG_FUNCTION(this << +tid << policy);
+    m_packet = nullptr;
     for (auto& mpdu : m_mpduList)
     {
         if (mpdu->GetHeader().IsQosData() && mpdu->GetHeader().GetQosTid() == tid)
@@ -243,7 +333,7 @@ WifiPsdu::GetMaxDistFromStartingSeq(uint16_t startingSeq) const
     uint16_t maxDistFromStartingSeq = 0;
     bool foundFirst = false;
 
-    for (auto& mpdu : m_mpduList)
+    for (Ptr<const WifiMpdu> mpdu : m_mpduList)
     {
         uint16_t currSeqNum = mpdu->GetHeader().GetSequenceNumber();
 
@@ -278,12 +368,15 @@ WifiPsdu::GetSize() const
 const WifiMacHeader&
 WifiPsdu::GetHeader(std::size_t i) const
 {
-    return m_mpduList.at(i)->GetHeader();
+    // read the header through a const MPDU, so as not to increment its modification counter
+    const WifiMpdu& mpdu = *m_mpduList.at(i);
+    return mpdu.GetHeader();
 }
 
 WifiMacHeader&
 WifiPsdu::GetHeader(std::size_t i)
 {
+    m_packet = nullptr;
     return m_mpduList.at(i)->GetHeader();
 }
 
@@ -338,6 +431,7 @@ WifiPsdu::begin() const
 std::vector<Ptr<WifiMpdu>>::iterator
 WifiPsdu::begin()
 {
+    m_packet = nullptr;
     return m_mpduList.begin();
 }
 
@@ -350,6 +444,7 @@ WifiPsdu::end() const
 std::vector<Ptr<WifiMpdu>>::iterator
 WifiPsdu::end()
 {
+    m_packet = nullptr;
     return m_mpduList.end();
 }
 
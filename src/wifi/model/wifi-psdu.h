@@ -93,10 +93,30 @@ class WifiPsdu : public SimpleRefCount<WifiPsdu>
 
     /**
      * \brief Get the PSDU as a single packet
+     *
+     * The packet (including the A-MPDU subframe headers and padding, if any) is only
+     * built the first time this method is called and is returned by the subsequent calls,
+     * until the MPDUs are modified, either through this PSDU or directly (the MPDUs may be
+     * shared, e.g., with the MAC queues). The latter case is detected by means of the
+     * modification counters of the MPDUs.
+     *
      * \return the PSDU.
      */
     Ptr<const Packet> GetPacket() const;
 
+    /**
+     * \brief Copy this PSDU, including the payloads of its MPDUs
+     *
+     * Unlike the copies made by the PHYs, which share the MPDUs and their payloads, the
+     * returned PSDU does not share any reference counted object with this PSDU, hence it
+     * can be handed over to another partition of the MultithreadedSimulatorImpl. The
+     * packet tags and the byte tags are copied if their type can be constructed from
+     * their TypeId.
+     *
+     * \return a deep copy of this PSDU
+     */
+    Ptr<WifiPsdu> DeepCopy() const;
+
     /**
      * \brief Get the header of the i-th MPDU
      * \param i index in the list of MPDUs
@@ -254,6 +274,9 @@ class WifiPsdu : public SimpleRefCount<WifiPsdu>
     bool m_isSingle;                       //!< true for an S-MPDU
     std::vector<Ptr<WifiMpdu>> m_mpduList; //!< list of constituent MPDUs
     uint32_t m_size;                       //!< the size of the PSDU in bytes
+    mutable Ptr<const Packet> m_packet;    //!< the PSDU as a single packet, if already built
+    mutable std::vector<uint32_t>
+        m_modificationCounts; //!< modification counters of the MPDUs when m_packet was built
 };
 
 /**
@@ -57,4 +57,13 @@ WifiSpectrumSignalParameters::Copy() const
     return wssp;
 }
 
+Ptr<SpectrumSignalParameters>
+WifiSpectrumSignalParameters::DeepCopy() const
+{
+    NS_LOG_FUNCTION(this);
+    Ptr<WifiSpectrumSignalParameters> wssp(new WifiSpectrumSignalParameters(*this), false);
+    wssp->ppdu = ppdu->DeepCopy();
+    return wssp;
+}
+
 } // namespace ns3
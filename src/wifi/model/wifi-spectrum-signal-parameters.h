@@ -36,6 +36,7 @@ class WifiPpdu;
 struct WifiSpectrumSignalParameters : public SpectrumSignalParameters
 {
     Ptr<SpectrumSignalParameters> Copy() const override;
+    Ptr<SpectrumSignalParameters> DeepCopy() const override;
 
     /**
      * default constructor
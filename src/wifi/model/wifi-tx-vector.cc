@@ -450,6 +450,53 @@ WifiTxVector::GetEhtPpduType() const
     return m_ehtPpduType;
 }
 
+bool
+WifiTxVector::operator==(const WifiTxVector& other) const
+{
+    return m_modeInitialized == other.m_modeInitialized && m_mode == other.m_mode &&
+           m_txPowerLevel == other.m_txPowerLevel && m_preamble == other.m_preamble &&
+           m_channelWidth == other.m_channelWidth && m_guardInterval == other.m_guardInterval &&
+           m_nTx == other.m_nTx && m_nss == other.m_nss && m_ness == other.m_ness &&
+           m_aggregation == other.m_aggregation && m_stbc == other.m_stbc &&
+           m_ldpc == other.m_ldpc && m_bssColor == other.m_bssColor &&
+           m_length == other.m_length && m_triggerResponding == other.m_triggerResponding &&
+           m_muUserInfos == other.m_muUserInfos &&
+           m_inactiveSubchannels == other.m_inactiveSubchannels &&
+           m_sigBMcs == other.m_sigBMcs && m_ruAllocation == other.m_ruAllocation &&
+           m_center26ToneRuIndication == other.m_center26ToneRuIndication &&
+           m_ehtPpduType == other.m_ehtPpduType;
+}
+
+bool
+WifiTxVector::operator!=(const WifiTxVector& other) const
+{
+    return !(*this == other);
+}
+
+std::size_t
+WifiTxVector::GetSignature() const
+{
+    // boost::hash_combine
+    std::size_t signature = 0;
+    auto combine = [&signature](std::size_t value) {
+        signature ^= value + 0x9e3779b9 + (signature << 6) + (signature >> 2);
+    };
+    combine(m_modeInitialized ? m_mode.GetUid() : 0);
+    combine(m_preamble);
+    combine(m_channelWidth);
+    combine(m_guardInterval);
+    combine((m_nTx << 16) | (m_nss << 8) | m_ness);
+    combine((m_aggregation << 3) | (m_stbc << 2) | (m_ldpc << 1) | m_triggerResponding);
+    combine(m_length);
+    combine(m_ehtPpduType);
+    for (const auto& [staId, userInfo] : m_muUserInfos)
+    {
+        combine((staId << 16) | (userInfo.mcs << 8) | userInfo.nss);
+        combine((userInfo.ru.GetRuType() << 8) | userInfo.ru.GetIndex());
+    }
+    return signature;
+}
+
 bool
 WifiTxVector::IsValid() const
 {
@@ -526,6 +526,31 @@ class WifiTxVector
      */
     uint8_t GetEhtPpduType() const;
 
+    /**
+     * Compare this TXVECTOR to the given TXVECTOR.
+     *
+     * \param other the given TXVECTOR
+     * \return true if all the parameters of this TXVECTOR compare equal to the parameters
+     *         of the given TXVECTOR, false otherwise
+     */
+    bool operator==(const WifiTxVector& other) const;
+    /**
+     * Compare this TXVECTOR to the given TXVECTOR.
+     *
+     * \param other the given TXVECTOR
+     * \return true if this TXVECTOR differs from the given TXVECTOR, false otherwise
+     */
+    bool operator!=(const WifiTxVector& other) const;
+
+    /**
+     * Get a compact signature of the parameters of this TXVECTOR, e.g., to index tables
+     * of values derived from TXVECTORs. Equal TXVECTORs have the same signature, but
+     * different TXVECTORs may have the same signature as well.
+     *
+     * \return the signature of this TXVECTOR
+     */
+    std::size_t GetSignature() const;
+
   private:
     /**
      * Derive the RU_ALLOCATION field from the TXVECTOR
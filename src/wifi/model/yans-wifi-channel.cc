@@ -25,14 +25,22 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
+#include "ns3/multithreaded-simulator-impl.h"
 #include "ns3/node.h"
 #include "ns3/pointer.h"
 #include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+
 namespace ns3
 {
 
@@ -57,11 +65,22 @@ YansWifiChannel::GetTypeId()
                           "A pointer to the propagation delay model attached to this channel.",
                           PointerValue(),
                           MakePointerAccessor(&YansWifiChannel::m_delay),
-                          MakePointerChecker<PropagationDelayModel>());
+                          MakePointerChecker<PropagationDelayModel>())
+            .AddAttribute("ReceiverCulling",
+                          "If true, the PHYs that are out of the range of the sender, as "
+                          "computed by the propagation loss model from the RX sensitivity of "
+                          "the PHYs, are skipped without scheduling any event. The range is "
+                          "only known for some propagation loss models that are not chained "
+                          "to other models (see PropagationLossModel::GetMaxRange).",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&YansWifiChannel::m_receiverCulling),
+                          MakeBooleanChecker());
     return tid;
 }
 
 YansWifiChannel::YansWifiChannel()
+    : m_receiverCulling(false),
+      m_shared(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -72,11 +91,22 @@ YansWifiChannel::~YansWifiChannel()
     m_phyList.clear();
 }
 
+void
+YansWifiChannel::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_linkCache.Clear();
+    m_receiverIndex.Clear();
+    m_simulator = nullptr;
+    Channel::DoDispose();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel(const Ptr<PropagationLossModel> loss)
 {
     NS_LOG_FUNCTION(this << loss);
     m_loss = loss;
+    m_linkCache.Clear();
 }
 
 void
@@ -84,6 +114,7 @@ YansWifiChannel::SetPropagationDelayModel(const Ptr<PropagationDelayModel> delay
 {
     NS_LOG_FUNCTION(this << delay);
     m_delay = delay;
+    m_linkCache.Clear();
 }
 
 void
@@ -92,24 +123,69 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
     NS_LOG_FUNCTION(this << sender << ppdu << txPowerDbm);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
-    for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
+    // the partitions sharing the channel transmit one at a time. The link cache and the
+    // spatial index are not used since they are updated by the course changes of the
+    // nodes, which are notified by the threads of their partitions
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    uint32_t senderPartition = 0;
+    std::map<uint32_t, Ptr<const WifiPpdu>> ppduCopies;
+    if (m_shared)
     {
-        if (sender != (*i))
+        lock.lock();
+        senderPartition = m_simulator->GetPartitionId(Simulator::GetContext());
+    }
+    // the propagation results of the links between static nodes are cached if the
+    // propagation models are deterministic
+    const bool useCache = !m_shared && m_loss && m_delay && m_loss->IsCacheable() &&
+                          m_delay->IsCacheable();
+    if (useCache)
+    {
+        m_linkCache.CheckVersions(m_loss->GetParametersVersion(), m_delay->GetParametersVersion());
+    }
+    const bool receiverCulling = m_receiverCulling && !m_shared;
+    if (receiverCulling)
+    {
+        FindCandidateReceivers(senderMobility, ppdu, txPowerDbm);
+    }
+    const std::size_t nReceivers = receiverCulling ? m_candidates.size() : m_phyList.size();
+    for (std::size_t n = 0; n < nReceivers; ++n)
+    {
+        const auto& receiver = m_phyList[receiverCulling ? m_candidates[n] : n];
+        if (sender != receiver)
         {
             // For now don't account for inter channel interference nor channel bonding
-            if ((*i)->GetChannelNumber() != sender->GetChannelNumber())
+            if (receiver->GetChannelNumber() != sender->GetChannelNumber())
             {
                 continue;
             }
 
-            Ptr<MobilityModel> receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            Time delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            double rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
+            Ptr<MobilityModel> receiverMobility =
+                receiver->GetMobility()->GetObject<MobilityModel>();
+            Time delay;
+            double rxPowerDbm;
+            const auto link = useCache ? m_linkCache.Find(senderMobility, receiverMobility)
+                                       : nullptr;
+            if (link && link->txPowerDbm == txPowerDbm)
+            {
+                delay = link->delay;
+                rxPowerDbm = link->rxPowerDbm;
+            }
+            else
+            {
+                delay = m_delay->GetDelay(senderMobility, receiverMobility);
+                rxPowerDbm = m_loss->CalcRxPower(txPowerDbm, senderMobility, receiverMobility);
+                if (useCache)
+                {
+                    m_linkCache.Add(senderMobility,
+                                    receiverMobility,
+                                    {txPowerDbm, rxPowerDbm, delay});
+                }
+            }
             NS_LOG_DEBUG("propagation: txPower="
                          << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, "
                          << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
                          << "m, delay=" << delay);
-            Ptr<NetDevice> dstNetDevice = (*i)->GetDevice();
+            Ptr<NetDevice> dstNetDevice = receiver->GetDevice();
             uint32_t dstNode;
             if (!dstNetDevice)
             {
@@ -120,16 +196,100 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
                 dstNode = dstNetDevice->GetNode()->GetId();
             }
 
+            auto rxPpdu = ppdu;
+            if (m_shared)
+            {
+                // the PHYs of another partition receive their own copy of the PPDU
+                const uint32_t partition = m_simulator->GetPartitionId(dstNode);
+                if (partition != senderPartition)
+                {
+                    auto& ppduCopy = ppduCopies[partition];
+                    if (!ppduCopy)
+                    {
+                        ppduCopy = ppdu->DeepCopy();
+                    }
+                    rxPpdu = ppduCopy;
+                }
+            }
+
             Simulator::ScheduleWithContext(dstNode,
                                            delay,
                                            &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
+                                           receiver,
+                                           rxPpdu,
                                            rxPowerDbm);
         }
     }
 }
 
+void
+YansWifiChannel::FindCandidateReceivers(Ptr<MobilityModel> senderMobility,
+                                        Ptr<const WifiPpdu> ppdu,
+                                        double txPowerDbm) const
+{
+    NS_LOG_FUNCTION(this << senderMobility << ppdu << txPowerDbm);
+    // the PPDU is dropped by the receivers if the received power is below their
+    // RX sensitivity normalized to the channel width (see Receive)
+    double thresholdDbm = std::numeric_limits<double>::infinity();
+    for (const auto& phy : m_phyList)
+    {
+        thresholdDbm = std::min(thresholdDbm, phy->GetRxSensitivity() - phy->GetRxGain());
+    }
+    thresholdDbm += RatioToDb(ppdu->GetTxChannelWidth() / 20.0);
+    const double range = m_loss->GetMaxRange(txPowerDbm, thresholdDbm);
+
+    while (m_receiverIndex.GetSize() < m_phyList.size())
+    {
+        m_receiverIndex.Add(m_phyList[m_receiverIndex.GetSize()]->GetMobility());
+    }
+    if (!m_receiverIndex.IsCellSizeSet() && std::isfinite(range) && range > 0)
+    {
+        m_receiverIndex.SetCellSize(range);
+    }
+    m_receiverIndex.GetCandidates(senderMobility->GetPosition(), range, m_candidates);
+    NS_LOG_DEBUG("Range=" << range << "m, " << m_candidates.size() << " candidate receivers");
+}
+
+Time
+YansWifiChannel::GetLookahead() const
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<uint32_t> partitions;
+    for (const auto& phy : m_phyList)
+    {
+        Ptr<NetDevice> device = phy->GetDevice();
+        partitions.push_back(
+            m_simulator->GetPartitionId(device ? device->GetNode()->GetId() : 0xffffffff));
+    }
+    m_shared = std::adjacent_find(partitions.begin(),
+                                  partitions.end(),
+                                  std::not_equal_to<uint32_t>()) != partitions.end();
+    if (!m_shared)
+    {
+        return Time::Max();
+    }
+#ifndef NS3_MTP
+    NS_ABORT_MSG("The YansWifiChannel is shared by several partitions of the "
+                 "MultithreadedSimulatorImpl, hence ns-3 must be built with NS3_MTP");
+#endif
+
+    Time lookahead = Time::Max();
+    for (std::size_t i = 0; i < m_phyList.size(); ++i)
+    {
+        for (std::size_t j = 0; j < m_phyList.size(); ++j)
+        {
+            if (partitions[i] != partitions[j])
+            {
+                lookahead = std::min(lookahead,
+                                     m_delay->GetMinDelay(m_phyList[i]->GetMobility(),
+                                                          m_phyList[j]->GetMobility()));
+            }
+        }
+    }
+    NS_LOG_DEBUG("Lookahead=" << lookahead);
+    return lookahead;
+}
+
 void
 YansWifiChannel::Receive(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, double rxPowerDbm)
 {
@@ -166,6 +326,15 @@ YansWifiChannel::Add(Ptr<YansWifiPhy> phy)
 {
     NS_LOG_FUNCTION(this << phy);
     m_phyList.push_back(phy);
+    if (m_phyList.size() == 1)
+    {
+        m_simulator = MultithreadedSimulatorImpl::GetInstance();
+        if (m_simulator)
+        {
+            m_simulator->AddLookaheadSource(
+                MakeCallback(&YansWifiChannel::GetLookahead, Ptr<YansWifiChannel>(this)));
+        }
+    }
 }
 
 int64_t
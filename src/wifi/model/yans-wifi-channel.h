@@ -21,10 +21,16 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/link-gain-cache.h"
+#include "ns3/spatial-index.h"
+
+#include <mutex>
+#include <vector>
 
 namespace ns3
 {
 
+class MultithreadedSimulatorImpl;
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
@@ -41,6 +47,12 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * If the MultithreadedSimulatorImpl is used, the channel provides the simulator with
+ * the minimum propagation delay between the nodes of different partitions (see
+ * PropagationDelayModel::GetMinDelay) as lookahead.  A channel shared by several
+ * partitions serializes the transmissions, does not use the link cache nor the
+ * receiver culling, and delivers a copy of the PPDU to the PHYs of each partition.
  */
 class YansWifiChannel : public Channel
 {
@@ -96,6 +108,9 @@ class YansWifiChannel : public Channel
      */
     int64_t AssignStreams(int64_t stream);
 
+  protected:
+    void DoDispose() override;
+
   private:
     /**
      * A vector of pointers to YansWifiPhy.
@@ -113,9 +128,39 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, double txPowerDbm);
 
+    /**
+     * Store in m_candidates the indices of the PHYs that may receive the given PPDU with
+     * a power above their RX sensitivity, i.e., all the PHYs except those that are out of
+     * the range of the sender as computed by the propagation loss model.
+     *
+     * \param senderMobility the mobility model of the sender
+     * \param ppdu the PPDU being sent
+     * \param txPowerDbm the TX power associated to the PPDU (dBm)
+     */
+    void FindCandidateReceivers(Ptr<MobilityModel> senderMobility,
+                                Ptr<const WifiPpdu> ppdu,
+                                double txPowerDbm) const;
+
+    /**
+     * Get the minimum delay between the PHYs of different partitions of the
+     * MultithreadedSimulatorImpl and check whether the channel is shared by several
+     * partitions.  This is the lookahead source of this channel.
+     *
+     * \return the minimum delay between the PHYs of different partitions
+     */
+    Time GetLookahead() const;
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+    mutable LinkGainCache m_linkCache;  //!< RX power and delay of the links between static nodes
+    bool m_receiverCulling;             //!< whether to skip the out of range receivers
+    mutable SpatialIndex m_receiverIndex; //!< spatial index over the positions of the PHYs
+    mutable std::vector<std::size_t>
+        m_candidates; //!< indices of the candidate receivers of the current transmission
+    Ptr<MultithreadedSimulatorImpl> m_simulator; //!< the multithreaded simulator, if used
+    mutable bool m_shared;      //!< whether the PHYs belong to several partitions of m_simulator
+    mutable std::mutex m_mutex; //!< mutex serializing the transmissions if m_shared
 };
 
 } // namespace ns3
@@ -1434,6 +1434,105 @@ HeSigBDurationTest::DoRun()
                           "Incorrect duration for HE-SIG-B");
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the durations memoized by WifiPhy::CalculateTxDuration are not shared by
+ * TXVECTORs that have the same signature but differ in fields the signature does not include
+ */
+class TxDurationMemoizationTest : public TestCase
+{
+  public:
+    TxDurationMemoizationTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Build a TXVECTOR for HE MU.
+     *
+     * \param channelWidth the channel width in MHz
+     * \param userInfos the HE MU specific per-user information
+     * \return the configured HE MU TXVECTOR
+     */
+    static WifiTxVector BuildTxVector(uint16_t channelWidth,
+                                      const std::list<HeMuUserInfo>& userInfos);
+
+    /**
+     * Check that the duration returned by WifiPhy::CalculateTxDuration for the given TXVECTOR
+     * is the duration computed without memoization.
+     *
+     * \param txVector the TXVECTOR
+     * \return the duration returned by WifiPhy::CalculateTxDuration
+     */
+    Time CheckTxDuration(const WifiTxVector& txVector);
+};
+
+TxDurationMemoizationTest::TxDurationMemoizationTest()
+    : TestCase("Check the memoization of the TX durations")
+{
+}
+
+WifiTxVector
+TxDurationMemoizationTest::BuildTxVector(uint16_t channelWidth,
+                                         const std::list<HeMuUserInfo>& userInfos)
+{
+    WifiTxVector txVector;
+    txVector.SetPreambleType(WIFI_PREAMBLE_HE_MU);
+    txVector.SetChannelWidth(channelWidth);
+    txVector.SetGuardInterval(800);
+    txVector.SetNess(0);
+    uint16_t staId = 1;
+    for (const auto& userInfo : userInfos)
+    {
+        txVector.SetHeMuUserInfo(staId++, userInfo);
+    }
+    txVector.SetSigBMode(VhtPhy::GetVhtMcs5());
+    return txVector;
+}
+
+Time
+TxDurationMemoizationTest::CheckTxDuration(const WifiTxVector& txVector)
+{
+    const uint32_t size = 1000;
+    const uint16_t staId = 1;
+    const auto duration =
+        WifiPhy::CalculateTxDuration(size, txVector, WIFI_PHY_BAND_5GHZ, staId);
+    const auto expected =
+        WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector) +
+        WifiPhy::GetPayloadDuration(size, txVector, WIFI_PHY_BAND_5GHZ, NORMAL_MPDU, staId);
+    NS_TEST_EXPECT_MSG_EQ(duration, expected, "Unexpected duration for TXVECTOR " << txVector);
+    return duration;
+}
+
+void
+TxDurationMemoizationTest::DoRun()
+{
+    // TXVECTORs whose users only differ in the 80 MHz segment of their RUs, hence in the
+    // RU_ALLOCATION
+    const auto samePrimary80 = BuildTxVector(160,
+                                             {{{HeRu::RU_26_TONE, 1, true}, 11, 1},
+                                              {{HeRu::RU_26_TONE, 2, true}, 11, 1}});
+    const auto differentPrimary80 = BuildTxVector(160,
+                                                  {{{HeRu::RU_26_TONE, 1, true}, 11, 1},
+                                                   {{HeRu::RU_26_TONE, 2, false}, 11, 1}});
+    NS_TEST_ASSERT_MSG_EQ(samePrimary80.GetSignature(),
+                          differentPrimary80.GetSignature(),
+                          "The RU segment is not expected to be part of the signature");
+    NS_TEST_EXPECT_MSG_EQ((samePrimary80.GetRuAllocation(0) !=
+                           differentPrimary80.GetRuAllocation(0)),
+                          true,
+                          "The RU_ALLOCATION fields should differ");
+    const auto samePrimary80Duration = CheckTxDuration(samePrimary80);
+    NS_TEST_EXPECT_MSG_NE(CheckTxDuration(differentPrimary80),
+                          samePrimary80Duration,
+                          "The RU_ALLOCATION should affect the TX duration");
+    NS_TEST_EXPECT_MSG_EQ(CheckTxDuration(samePrimary80),
+                          samePrimary80Duration,
+                          "The memoized duration should be returned");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1806,6 +1905,8 @@ TxDurationTestSuite::TxDurationTestSuite()
 
     AddTestCase(new PhyHeaderSectionsTest, TestCase::QUICK);
 
+    AddTestCase(new TxDurationMemoizationTest, TestCase::QUICK);
+
     // 20 MHz band, HeSigBDurationTest::OFDMA, even number of users per HE-SIG-B content channel
     AddTestCase(new HeSigBDurationTest(
                     {{{HeRu::RU_106_TONE, 1, true}, 11, 1}, {{HeRu::RU_106_TONE, 2, true}, 10, 4}},
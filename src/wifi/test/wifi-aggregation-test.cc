@@ -17,6 +17,7 @@
  * Author: Sébastien Deronne <sebastien.deronne@gmail.com>
  */
 
+#include "ns3/ampdu-subframe-header.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/he-configuration.h"
 #include "ns3/ht-configuration.h"
@@ -254,6 +255,30 @@ AmpduAggregationTest::DoRun()
         NS_TEST_EXPECT_MSG_EQ(psdu->GetHeader(i).GetSequenceNumber(), i, "wrong sequence number");
     }
 
+    // the A-MPDU packet is built once and rebuilt only if the MPDUs are modified
+    Ptr<const Packet> ampdu = psdu->GetPacket();
+    NS_TEST_EXPECT_MSG_EQ(ampdu->GetSize(), psdu->GetSize(), "A-MPDU packet size is not correct");
+    NS_TEST_EXPECT_MSG_EQ(psdu->GetPacket(), ampdu, "A-MPDU packet should not be built again");
+    psdu->SetDuration(MicroSeconds(100));
+    NS_TEST_EXPECT_MSG_NE(psdu->GetPacket(), ampdu, "A-MPDU packet should be built again");
+    NS_TEST_EXPECT_MSG_EQ(psdu->GetPacket()->GetSize(),
+                          psdu->GetSize(),
+                          "A-MPDU packet size is not correct");
+
+    // the MPDUs are shared with the MAC: setting the Retry flag before a retransmission
+    // modifies their headers without going through the PSDU
+    ampdu = psdu->GetPacket();
+    mpduList.front()->GetHeader().SetRetry();
+    NS_TEST_EXPECT_MSG_NE(psdu->GetPacket(), ampdu, "A-MPDU packet should be built again");
+    Ptr<Packet> ampduCopy = psdu->GetPacket()->Copy();
+    AmpduSubframeHeader subframeHdr;
+    ampduCopy->RemoveHeader(subframeHdr);
+    WifiMacHeader retryHdr;
+    ampduCopy->PeekHeader(retryHdr);
+    NS_TEST_EXPECT_MSG_EQ(retryHdr.IsRetry(), true, "Retry flag not set in the A-MPDU packet");
+    ampdu = psdu->GetPacket();
+    NS_TEST_EXPECT_MSG_EQ(psdu->GetPacket(), ampdu, "A-MPDU packet should not be built again");
+
     //-----------------------------------------------------------------------------------------------------
 
     /*
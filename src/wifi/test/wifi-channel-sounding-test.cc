@@ -0,0 +1,1454 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ap-wifi-mac.h"
+#include "ns3/boolean.h"
+#include "ns3/channel-sounding.h"
+#include "ns3/csi-buffer.h"
+#include "ns3/csi-generator.h"
+#include "ns3/ctrl-headers.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/mgt-headers.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/multi-user-scheduler.h"
+#include "ns3/packet.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/sbp-headers.h"
+#include "ns3/sensing-session-manager.h"
+#include "ns3/sensing-stats-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-csi-generator.h"
+#include "ns3/spectrum-wifi-helper.h"
+#include "ns3/ssid.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-mpdu.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-psdu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("WifiChannelSoundingTest");
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the flat storage of channel information and the reuse of buffers by the pool
+ */
+class CsiBufferTest : public TestCase
+{
+  public:
+    CsiBufferTest();
+
+  private:
+    void DoRun() override;
+};
+
+CsiBufferTest::CsiBufferTest()
+    : TestCase("Check the layout of CSI buffers and their reuse through the pool")
+{
+}
+
+void
+CsiBufferTest::DoRun()
+{
+    // 160 MHz, Ng = 4, Nr = 4, Nc = 2
+    const uint16_t ns = 500;
+    const uint8_t na = 10;
+    const uint8_t nc = 2;
+
+    CsiBuffer buffer(ns, na, nc);
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetNs(), ns, "Unexpected number of subcarriers");
+    NS_TEST_EXPECT_MSG_EQ(+buffer.GetNa(), +na, "Unexpected number of angles");
+    NS_TEST_EXPECT_MSG_EQ(+buffer.GetNc(), +nc, "Unexpected number of columns");
+
+    for (uint8_t i = 0; i < nc; i++)
+    {
+        buffer.SetStStreamSnr(i, 200 + i);
+    }
+    for (uint16_t i = 0; i < ns; i++)
+    {
+        for (uint8_t j = 0; j < na / 2; j++)
+        {
+            buffer.SetPhi(i, j, (i + j) % 512);
+            buffer.SetPsi(i, j, (i * j) % 128);
+        }
+        for (uint8_t j = 0; j < nc; j++)
+        {
+            buffer.SetDeltaSnr(i, j, (i + j) % 16);
+        }
+    }
+
+    // The fields are stored one after another in a single contiguous block
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetPhiData(),
+                          buffer.GetStStreamSnrData() + nc,
+                          "Phi angles do not follow the average SNR values");
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetPsiData(),
+                          buffer.GetPhiData() + ns * (na / 2),
+                          "Psi angles do not follow the Phi angles");
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetDeltaSnrData(),
+                          buffer.GetPsiData() + ns * (na / 2),
+                          "Delta SNR values do not follow the Psi angles");
+    NS_TEST_EXPECT_MSG_EQ(buffer.GetPhiData()[7 * (na / 2) + 3],
+                          buffer.GetPhi(7, 3),
+                          "Unexpected Phi angle in the flat storage");
+    NS_TEST_EXPECT_MSG_EQ(+buffer.GetDeltaSnr(ns - 1, nc - 1),
+                          (ns - 1 + nc - 1) % 16,
+                          "Unexpected delta SNR value");
+    NS_TEST_EXPECT_MSG_EQ(+buffer.GetStStreamSnr(1), 201, "Unexpected average SNR value");
+
+    // A released buffer is handed out again by the pool without reallocation
+    CsiBufferPool pool;
+    const uint16_t* storage = buffer.GetStStreamSnrData();
+    std::size_t capacity = buffer.GetCapacity();
+    pool.Release(std::move(buffer));
+    NS_TEST_EXPECT_MSG_EQ(pool.GetNAvailable(), 1, "The released buffer is not in the pool");
+
+    // 80 MHz, Ng = 4, Nr = 2, Nc = 2 fits in the storage of the released buffer
+    CsiBuffer reused = pool.Acquire(250, 2, 2);
+    NS_TEST_EXPECT_MSG_EQ(pool.GetNAvailable(), 0, "The pool did not hand out its buffer");
+    NS_TEST_EXPECT_MSG_EQ(reused.GetStStreamSnrData(), storage, "The storage was not reused");
+    NS_TEST_EXPECT_MSG_EQ(reused.GetCapacity(), capacity, "The storage was reallocated");
+    NS_TEST_EXPECT_MSG_EQ(reused.GetPhi(100, 0), 0, "A reused buffer is not zeroed");
+    NS_TEST_EXPECT_MSG_EQ(+reused.GetDeltaSnr(249, 1), 0, "A reused buffer is not zeroed");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the serialization and deserialization of the HE Compressed Beamforming Report and
+ * HE MU Exclusive Beamforming Report fields for a given configuration of the HE MIMO Control
+ * field. The serialized bytes are checked against a bit-by-bit reference encoding.
+ */
+class BfReportRoundTripTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param bandwidth the bandwidth (MHz)
+     * \param ng the subcarrier grouping parameter
+     * \param codebook the codebook information
+     * \param nc the number of columns of the feedback matrix
+     * \param nr the number of rows of the feedback matrix
+     * \param type the feedback type (SU or MU)
+     */
+    BfReportRoundTripTest(uint16_t bandwidth,
+                          uint8_t ng,
+                          uint8_t codebook,
+                          uint8_t nc,
+                          uint8_t nr,
+                          HeMimoControlHeader::CsType type);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Append a field to a reference bit stream, one bit at a time
+     * \param bytes the reference bit stream
+     * \param nBits the number of bits in the reference bit stream
+     * \param value the value of the field
+     * \param bits the width of the field
+     */
+    static void AppendBits(std::vector<uint8_t>& bytes,
+                           std::size_t& nBits,
+                           uint16_t value,
+                           uint8_t bits);
+
+    uint16_t m_bandwidth;               ///< the bandwidth (MHz)
+    uint8_t m_ng;                       ///< the subcarrier grouping parameter
+    uint8_t m_codebook;                 ///< the codebook information
+    uint8_t m_nc;                       ///< the number of columns of the feedback matrix
+    uint8_t m_nr;                       ///< the number of rows of the feedback matrix
+    HeMimoControlHeader::CsType m_type; ///< the feedback type
+};
+
+BfReportRoundTripTest::BfReportRoundTripTest(uint16_t bandwidth,
+                                             uint8_t ng,
+                                             uint8_t codebook,
+                                             uint8_t nc,
+                                             uint8_t nr,
+                                             HeMimoControlHeader::CsType type)
+    : TestCase("Check beamforming report round trip (BW=" + std::to_string(bandwidth) +
+               ", Ng=" + std::to_string(ng) + ", codebook=" + std::to_string(codebook) +
+               ", Nc=" + std::to_string(nc) + ", Nr=" + std::to_string(nr) +
+               (type == HeMimoControlHeader::SU ? ", SU)" : ", MU)")),
+      m_bandwidth(bandwidth),
+      m_ng(ng),
+      m_codebook(codebook),
+      m_nc(nc),
+      m_nr(nr),
+      m_type(type)
+{
+}
+
+void
+BfReportRoundTripTest::AppendBits(std::vector<uint8_t>& bytes,
+                                  std::size_t& nBits,
+                                  uint16_t value,
+                                  uint8_t bits)
+{
+    for (int b = bits - 1; b >= 0; b--)
+    {
+        if (nBits % 8 == 0)
+        {
+            bytes.push_back(0);
+        }
+        bytes.back() |= ((value >> b) & 0x01) << (7 - nBits % 8);
+        nBits++;
+    }
+}
+
+void
+BfReportRoundTripTest::DoRun()
+{
+    HeMimoControlHeader mimoControl;
+    mimoControl.SetNc(m_nc - 1);
+    mimoControl.SetNr(m_nr - 1);
+    mimoControl.SetBw(m_bandwidth);
+    mimoControl.SetGrouping(m_ng);
+    mimoControl.SetCodebookInfo(m_codebook);
+    mimoControl.SetFeedbackType(m_type);
+    mimoControl.SetRuStart(0);
+    mimoControl.SetRuEnd(m_bandwidth == 20   ? 8
+                         : m_bandwidth == 40 ? 17
+                         : m_bandwidth == 80 ? 36
+                                             : 73);
+
+    HeCompressedBfReport txReport(mimoControl);
+    const uint16_t ns = txReport.GetNs();
+    const uint8_t na = txReport.GetNa();
+    const uint8_t bits1 = txReport.GetBits1();
+    const uint8_t bits2 = txReport.GetBits2();
+
+    // Fill the channel information with values spanning the whole range of each field
+    CsiBuffer txInfo(ns, na, m_nc);
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return static_cast<uint16_t>(seed >> 16);
+    };
+    for (uint8_t i = 0; i < m_nc; i++)
+    {
+        txInfo.SetStStreamSnr(i, next() & 0xff);
+    }
+    for (uint16_t i = 0; i < ns; i++)
+    {
+        for (uint8_t j = 0; j < na / 2; j++)
+        {
+            txInfo.SetPhi(i, j, next() & ((1 << bits1) - 1));
+            txInfo.SetPsi(i, j, next() & ((1 << bits2) - 1));
+        }
+        for (uint8_t j = 0; j < m_nc; j++)
+        {
+            txInfo.SetDeltaSnr(i, j, next() & 0x0f);
+        }
+    }
+
+    Ptr<Packet> packet = Create<Packet>();
+    if (m_type == HeMimoControlHeader::MU)
+    {
+        HeMuExclusiveBfReport muReport(mimoControl);
+        muReport.SetChannelInfo(txInfo);
+        packet->AddHeader(muReport);
+    }
+    txReport.SetChannelInfo(txInfo);
+    packet->AddHeader(txReport);
+
+    NS_TEST_EXPECT_MSG_EQ(packet->GetSize(),
+                          ChannelSounding::GetBfReportLength(m_bandwidth,
+                                                             m_ng,
+                                                             m_nc,
+                                                             m_nr,
+                                                             m_codebook,
+                                                             m_type),
+                          "Unexpected size of the beamforming report");
+
+    // Build the reference encoding one bit at a time
+    std::vector<uint8_t> expected;
+    std::size_t nBits = 0;
+    for (uint8_t i = 0; i < m_nc; i++)
+    {
+        AppendBits(expected, nBits, txInfo.GetStStreamSnr(i), 8);
+    }
+    const auto order = HeCompressedBfReport::GetAngleOrder(na, m_nr);
+    for (uint16_t i = 0; i < ns; i++)
+    {
+        for (uint8_t j = 0; j < na; j++)
+        {
+            uint8_t idx = order[j] & ~HeCompressedBfReport::ANGLE_ORDER_PSI;
+            if (order[j] & HeCompressedBfReport::ANGLE_ORDER_PSI)
+            {
+                AppendBits(expected, nBits, txInfo.GetPsi(i, idx), bits2);
+            }
+            else
+            {
+                AppendBits(expected, nBits, txInfo.GetPhi(i, idx), bits1);
+            }
+        }
+    }
+    if (m_type == HeMimoControlHeader::MU)
+    {
+        nBits = 0;
+        for (uint16_t i = 0; i < ns; i++)
+        {
+            for (uint8_t j = 0; j < m_nc; j++)
+            {
+                if (nBits % 8 == 0)
+                {
+                    expected.push_back(0);
+                }
+                expected.back() |= txInfo.GetDeltaSnr(i, j) << (4 - nBits % 8);
+                nBits += 4;
+            }
+        }
+    }
+    std::vector<uint8_t> actual(packet->GetSize());
+    packet->CopyData(actual.data(), actual.size());
+    NS_TEST_ASSERT_MSG_EQ(actual.size(), expected.size(), "Unexpected size of the encoding");
+    for (std::size_t i = 0; i < actual.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(+actual[i], +expected[i], "Unexpected byte " << i);
+    }
+
+    // Decode both fields into the same buffer, as done by the beamformer
+    CsiBuffer rxInfo;
+    HeCompressedBfReport rxReport(mimoControl);
+    rxReport.SetChannelInfoBuffer(rxInfo);
+    packet->RemoveHeader(rxReport);
+    if (m_type == HeMimoControlHeader::MU)
+    {
+        HeMuExclusiveBfReport muReport(mimoControl);
+        muReport.SetChannelInfoBuffer(rxInfo);
+        packet->RemoveHeader(muReport);
+    }
+    NS_TEST_EXPECT_MSG_EQ(packet->GetSize(), 0, "The beamforming report was not fully decoded");
+
+    NS_TEST_ASSERT_MSG_EQ(rxInfo.GetNs(), ns, "Unexpected number of subcarriers");
+    for (uint8_t i = 0; i < m_nc; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(+rxInfo.GetStStreamSnr(i),
+                              +txInfo.GetStStreamSnr(i),
+                              "Unexpected average SNR");
+    }
+    for (uint16_t i = 0; i < ns; i++)
+    {
+        for (uint8_t j = 0; j < na / 2; j++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(rxInfo.GetPhi(i, j), txInfo.GetPhi(i, j), "Unexpected Phi");
+            NS_TEST_ASSERT_MSG_EQ(rxInfo.GetPsi(i, j), txInfo.GetPsi(i, j), "Unexpected Psi");
+        }
+        for (uint8_t j = 0; j < m_nc && m_type == HeMimoControlHeader::MU; j++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(+rxInfo.GetDeltaSnr(i, j),
+                                  +txInfo.GetDeltaSnr(i, j),
+                                  "Unexpected delta SNR");
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that the random CSI generator produces values in the range of each field and
+ * that the generated channel information only depends on the assigned stream.
+ */
+class RandomCsiGeneratorTest : public TestCase
+{
+  public:
+    RandomCsiGeneratorTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Generate the channel information of two reports with a generator using the given stream
+     *
+     * \param mimoControl the HE MIMO Control field of the reports
+     * \param stream the stream assigned to the generator
+     * \return the channel information of the second report
+     */
+    CsiBuffer GenerateReports(const HeMimoControlHeader& mimoControl, int64_t stream);
+};
+
+RandomCsiGeneratorTest::RandomCsiGeneratorTest()
+    : TestCase("Check the reproducibility of the random CSI generator")
+{
+}
+
+CsiBuffer
+RandomCsiGeneratorTest::GenerateReports(const HeMimoControlHeader& mimoControl, int64_t stream)
+{
+    HeCompressedBfReport report(mimoControl);
+    CsiBuffer channelInfo;
+    auto generator = CreateObject<RandomCsiGenerator>();
+    generator->AssignStreams(stream);
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        channelInfo.Reset(report.GetNs(), report.GetNa(), report.GetNc());
+        generator->Generate(mimoControl, Mac48Address("00:00:00:00:00:01"), channelInfo);
+    }
+    return channelInfo;
+}
+
+void
+RandomCsiGeneratorTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    // 160 MHz, Ng = 4, MU feedback with codebook (9,7), Nr = 4, Nc = 2
+    HeMimoControlHeader mimoControl;
+    mimoControl.SetNc(1);
+    mimoControl.SetNr(3);
+    mimoControl.SetBw(160);
+    mimoControl.SetGrouping(4);
+    mimoControl.SetCodebookInfo(1);
+    mimoControl.SetFeedbackType(HeMimoControlHeader::MU);
+    mimoControl.SetRuStart(0);
+    mimoControl.SetRuEnd(73);
+
+    CsiBuffer first = GenerateReports(mimoControl, 10);
+    CsiBuffer second = GenerateReports(mimoControl, 10);
+    CsiBuffer other = GenerateReports(mimoControl, 11);
+
+    bool identical = true;
+    bool different = false;
+    uint16_t maxPhi = 0;
+    uint16_t maxPsi = 0;
+    uint8_t maxDeltaSnr = 0;
+    for (uint16_t i = 0; i < first.GetNs(); i++)
+    {
+        for (uint8_t j = 0; j < first.GetNa() / 2; j++)
+        {
+            identical &= (first.GetPhi(i, j) == second.GetPhi(i, j)) &&
+                         (first.GetPsi(i, j) == second.GetPsi(i, j));
+            different |= (first.GetPhi(i, j) != other.GetPhi(i, j));
+            maxPhi = std::max(maxPhi, first.GetPhi(i, j));
+            maxPsi = std::max(maxPsi, first.GetPsi(i, j));
+        }
+        for (uint8_t j = 0; j < first.GetNc(); j++)
+        {
+            identical &= (first.GetDeltaSnr(i, j) == second.GetDeltaSnr(i, j));
+            maxDeltaSnr = std::max(maxDeltaSnr, first.GetDeltaSnr(i, j));
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(identical, true, "Same stream produced different channel information");
+    NS_TEST_EXPECT_MSG_EQ(different, true, "Different streams produced the same Phi angles");
+    NS_TEST_EXPECT_MSG_LT(maxPhi, 1 << 9, "Phi angle exceeds 9 bits");
+    NS_TEST_EXPECT_MSG_GT(maxPhi, 1 << 8, "Phi angles do not span 9 bits");
+    NS_TEST_EXPECT_MSG_LT(maxPsi, 1 << 7, "Psi angle exceeds 7 bits");
+    NS_TEST_EXPECT_MSG_EQ(+maxDeltaSnr, 15, "Delta SNR values do not span 4 bits");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that a beamforming matrix can be rebuilt from the Givens rotation angles computed
+ * by the spectrum CSI generator, and that the angles are quantized as specified.
+ */
+class GivensDecompositionTest : public TestCase
+{
+  public:
+    GivensDecompositionTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the decomposition of a matrix with orthonormal columns of the given size
+     *
+     * \param nr the number of rows
+     * \param nc the number of columns
+     */
+    void CheckDecomposition(uint8_t nr, uint8_t nc);
+};
+
+GivensDecompositionTest::GivensDecompositionTest()
+    : TestCase("Check the compression of beamforming matrices into Givens rotation angles")
+{
+}
+
+void
+GivensDecompositionTest::CheckDecomposition(uint8_t nr, uint8_t nc)
+{
+    using Complex = std::complex<double>;
+
+    // deterministic matrix with orthonormal columns (Gram-Schmidt)
+    std::vector<Complex> v(nr * nc);
+    for (uint8_t c = 0; c < nc; c++)
+    {
+        for (uint8_t r = 0; r < nr; r++)
+        {
+            v[r * nc + c] = Complex(std::cos(1.3 * r + 0.7 * c + 0.2), std::sin(2.1 * r * c + r));
+        }
+        for (uint8_t p = 0; p < c; p++)
+        {
+            Complex dot = 0;
+            for (uint8_t r = 0; r < nr; r++)
+            {
+                dot += std::conj(v[r * nc + p]) * v[r * nc + c];
+            }
+            for (uint8_t r = 0; r < nr; r++)
+            {
+                v[r * nc + c] -= dot * v[r * nc + p];
+            }
+        }
+        double norm = 0;
+        for (uint8_t r = 0; r < nr; r++)
+        {
+            norm += std::norm(v[r * nc + c]);
+        }
+        for (uint8_t r = 0; r < nr; r++)
+        {
+            v[r * nc + c] /= std::sqrt(norm);
+        }
+    }
+
+    std::vector<Complex> expected(v);
+    for (uint8_t c = 0; c < nc; c++)
+    {
+        const Complex rot = std::polar(1.0, -std::arg(v[(nr - 1) * nc + c]));
+        for (uint8_t r = 0; r < nr; r++)
+        {
+            expected[r * nc + c] *= rot;
+        }
+    }
+
+    std::vector<double> phi(nr * nc);
+    std::vector<double> psi(nr * nc);
+    SpectrumCsiGenerator::DecomposeBeamformingMatrix(v.data(), nr, nc, phi.data(), psi.data());
+
+    // rebuild the matrix as the product of D_i and G_li^T matrices applied to I~
+    std::vector<Complex> rebuilt(nr * nc, 0);
+    for (uint8_t c = 0; c < nc; c++)
+    {
+        rebuilt[c * nc + c] = 1;
+    }
+    const uint8_t nColumns = std::min<uint8_t>(nc, nr - 1);
+    for (int i = nColumns - 1; i >= 0; i--)
+    {
+        std::size_t offset = 0;
+        for (int j = 0; j < i; j++)
+        {
+            offset += nr - 1 - j;
+        }
+        for (int l = nr - 1; l > i; l--)
+        {
+            const double angle = psi[offset + l - i - 1];
+            for (uint8_t c = 0; c < nc; c++)
+            {
+                const Complex ri = rebuilt[i * nc + c];
+                const Complex rl = rebuilt[l * nc + c];
+                rebuilt[i * nc + c] = std::cos(angle) * ri - std::sin(angle) * rl;
+                rebuilt[l * nc + c] = std::sin(angle) * ri + std::cos(angle) * rl;
+            }
+        }
+        for (int l = i; l < nr - 1; l++)
+        {
+            for (uint8_t c = 0; c < nc; c++)
+            {
+                rebuilt[l * nc + c] *= std::polar(1.0, phi[offset + l - i]);
+            }
+        }
+    }
+
+    for (uint8_t r = 0; r < nr; r++)
+    {
+        for (uint8_t c = 0; c < nc; c++)
+        {
+            NS_TEST_EXPECT_MSG_EQ_TOL(rebuilt[r * nc + c].real(),
+                                      expected[r * nc + c].real(),
+                                      1e-9,
+                                      "Unexpected real part for Nr=" << +nr << " Nc=" << +nc);
+            NS_TEST_EXPECT_MSG_EQ_TOL(rebuilt[r * nc + c].imag(),
+                                      expected[r * nc + c].imag(),
+                                      1e-9,
+                                      "Unexpected imaginary part for Nr=" << +nr << " Nc=" << +nc);
+        }
+    }
+}
+
+void
+GivensDecompositionTest::DoRun()
+{
+    for (const auto& [nr, nc] : std::vector<std::pair<uint8_t, uint8_t>>{
+             {2, 1}, {2, 2}, {3, 1}, {3, 2}, {3, 3}, {4, 1}, {4, 2}, {4, 3}, {4, 4}, {8, 2}})
+    {
+        CheckDecomposition(nr, nc);
+    }
+
+    // V = [1; exp(j*pi/3)] / sqrt(2) yields Phi = 5*pi/3 and Psi = pi/4
+    std::vector<std::complex<double>> v{std::polar(M_SQRT1_2, 0.0),
+                                        std::polar(M_SQRT1_2, M_PI / 3)};
+    double phi;
+    double psi;
+    SpectrumCsiGenerator::DecomposeBeamformingMatrix(v.data(), 2, 1, &phi, &psi);
+    NS_TEST_EXPECT_MSG_EQ_TOL(phi, 5 * M_PI / 3, 1e-9, "Unexpected Phi angle");
+    NS_TEST_EXPECT_MSG_EQ_TOL(psi, M_PI / 4, 1e-9, "Unexpected Psi angle");
+    NS_TEST_EXPECT_MSG_EQ(SpectrumCsiGenerator::QuantizePhi(phi, 6), 53, "Unexpected Phi value");
+    NS_TEST_EXPECT_MSG_EQ(SpectrumCsiGenerator::QuantizePsi(psi, 4), 8, "Unexpected Psi value");
+    NS_TEST_EXPECT_MSG_EQ(SpectrumCsiGenerator::QuantizePhi(2 * M_PI - 1e-12, 4),
+                          15,
+                          "Phi value out of range");
+    NS_TEST_EXPECT_MSG_EQ(SpectrumCsiGenerator::QuantizePsi(M_PI / 2, 2),
+                          3,
+                          "Psi value out of range");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the streaming estimation of the sensing latency percentiles
+ */
+class StreamingQuantileTest : public TestCase
+{
+  public:
+    StreamingQuantileTest();
+
+  private:
+    void DoRun() override;
+};
+
+StreamingQuantileTest::StreamingQuantileTest()
+    : TestCase("Check the streaming estimation of latency percentiles")
+{
+}
+
+void
+StreamingQuantileTest::DoRun()
+{
+    StreamingQuantile median(0.5);
+    StreamingQuantile p99(0.99);
+    NS_TEST_EXPECT_MSG_EQ(median.Get(), 0, "Unexpected quantile without samples");
+
+    // exact quantiles while fewer than five samples have been added
+    for (double x : {4.0, 1.0, 3.0})
+    {
+        median.Add(x);
+        p99.Add(x);
+    }
+    NS_TEST_EXPECT_MSG_EQ(median.Get(), 3, "Unexpected median of three samples");
+    NS_TEST_EXPECT_MSG_EQ(p99.Get(), 4, "Unexpected 99th percentile of three samples");
+
+    // samples 1 to 10000 in a scrambled order
+    median.Reset();
+    p99.Reset();
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        const double x = 1 + (i * 7919) % 10000;
+        median.Add(x);
+        p99.Add(x);
+    }
+    NS_TEST_EXPECT_MSG_EQ(median.GetCount(), 10000, "Unexpected number of samples");
+    NS_TEST_EXPECT_MSG_EQ_TOL(median.Get(), 5000, 100, "Unexpected median");
+    NS_TEST_EXPECT_MSG_EQ_TOL(p99.Get(), 9900, 100, "Unexpected 99th percentile");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the scheduling and the merging of sensing measurement setups
+ */
+class SensingSessionManagerTest : public TestCase
+{
+  public:
+    SensingSessionManagerTest();
+
+  private:
+    void DoRun() override;
+};
+
+SensingSessionManagerTest::SensingSessionManagerTest()
+    : TestCase("Check the scheduling and the merging of sensing measurement setups")
+{
+}
+
+void
+SensingSessionManagerTest::DoRun()
+{
+    SensingSessionManager manager;
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNextDue(), Time::Max(), "Unexpected due time without setups");
+
+    const Mac48Address sta1("00:00:00:00:00:01");
+    const Mac48Address sta2("00:00:00:00:00:02");
+    const Mac48Address sta3("00:00:00:00:00:03");
+
+    SensingMeasurementSetup fast;
+    fast.interval = MilliSeconds(10);
+    fast.stations = {sta1};
+    SensingMeasurementSetup slow;
+    slow.interval = MilliSeconds(20);
+    slow.stations = {sta2};
+    SensingMeasurementSetup urgent;
+    urgent.interval = MilliSeconds(10);
+    urgent.priority = 0;
+    urgent.stations = {sta3};
+
+    uint32_t fastId = manager.AddSetup(fast, MilliSeconds(10));
+    uint32_t slowId = manager.AddSetup(slow, MilliSeconds(11));
+    uint32_t urgentId = manager.AddSetup(urgent, MilliSeconds(10));
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNSetups(), 3, "Unexpected number of setups");
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNextDue(), MilliSeconds(10), "Unexpected next due time");
+
+    // nothing is due before 10 ms
+    auto instance = manager.PopDue(MilliSeconds(5), MilliSeconds(2));
+    NS_TEST_EXPECT_MSG_EQ(instance.IsEmpty(), true, "No setup should be due");
+
+    // the fast and the slow setups are merged; the urgent one has a different priority
+    instance = manager.PopDue(MilliSeconds(10), MilliSeconds(2));
+    NS_TEST_ASSERT_MSG_EQ(instance.setupIds.size(), 2, "Two setups should be merged");
+    NS_TEST_EXPECT_MSG_EQ(instance.setupIds[0], fastId, "Unexpected first setup");
+    NS_TEST_EXPECT_MSG_EQ(instance.setupIds[1], slowId, "Unexpected second setup");
+    NS_TEST_EXPECT_MSG_EQ(instance.IsParticipant(sta1), true, "STA 1 should be sounded");
+    NS_TEST_EXPECT_MSG_EQ(instance.IsParticipant(sta2), true, "STA 2 should be sounded");
+    NS_TEST_EXPECT_MSG_EQ(instance.IsParticipant(sta3), false, "STA 3 should not be sounded");
+
+    instance = manager.PopDue(MilliSeconds(10), MilliSeconds(2));
+    NS_TEST_ASSERT_MSG_EQ(instance.setupIds.size(), 1, "Only the urgent setup should be due");
+    NS_TEST_EXPECT_MSG_EQ(instance.setupIds[0], urgentId, "Unexpected setup");
+    NS_TEST_EXPECT_MSG_EQ(instance.priority, 0, "Unexpected priority");
+
+    // the next instances are due one interval after the previous ones
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNextDue(), MilliSeconds(20), "Unexpected next due time");
+    manager.RemoveSetup(urgentId);
+    instance = manager.PopDue(MilliSeconds(20), Seconds(0));
+    NS_TEST_ASSERT_MSG_EQ(instance.setupIds.size(), 1, "Only the fast setup should be due");
+    NS_TEST_EXPECT_MSG_EQ(instance.setupIds[0], fastId, "Unexpected setup");
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNextDue(), MilliSeconds(30), "Unexpected next due time");
+
+    // a setup without stations sounds all the stations
+    SensingMeasurementSetup all;
+    all.interval = MilliSeconds(10);
+    manager.AddSetup(all, MilliSeconds(30));
+    instance = manager.PopDue(MilliSeconds(31), Seconds(0));
+    NS_TEST_ASSERT_MSG_EQ(instance.setupIds.size(), 3, "Three setups should be merged");
+    NS_TEST_EXPECT_MSG_EQ(instance.IsParticipant(sta3), true, "STA 3 should be sounded");
+    NS_TEST_EXPECT_MSG_EQ(manager.GetNextDue(), MilliSeconds(40), "Unexpected next due time");
+
+    // a setup whose interval does not exceed the merge window is launched once per instance
+    SensingSessionManager shortManager;
+    SensingMeasurementSetup frequent;
+    frequent.interval = MilliSeconds(1);
+    uint32_t frequentId = shortManager.AddSetup(frequent, MilliSeconds(10));
+    instance = shortManager.PopDue(MilliSeconds(10), MilliSeconds(2));
+    NS_TEST_ASSERT_MSG_EQ(instance.setupIds.size(), 1, "The setup should be launched once");
+    NS_TEST_EXPECT_MSG_EQ(instance.setupIds[0], frequentId, "Unexpected setup");
+    NS_TEST_EXPECT_MSG_EQ(shortManager.GetNextDue(),
+                          MilliSeconds(11),
+                          "Unexpected next due time");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the serialization of the sensing by proxy frames
+ */
+class SbpFramesTest : public TestCase
+{
+  public:
+    SbpFramesTest();
+
+  private:
+    void DoRun() override;
+};
+
+SbpFramesTest::SbpFramesTest()
+    : TestCase("Check the serialization of the sensing by proxy frames")
+{
+}
+
+void
+SbpFramesTest::DoRun()
+{
+    SensingMeasurementSetup setup;
+    setup.interval = MilliSeconds(50);
+    setup.priority = 6;
+    setup.stations = {Mac48Address("00:00:00:00:00:01"), Mac48Address("00:00:00:00:00:02")};
+    setup.channelWidth = 40;
+    setup.reportFormat = SensingReportFormat::MU;
+
+    MgtSbpRequestHeader request;
+    request.SetSetupId(3);
+    request.SetMeasurementSetup(setup);
+    WifiActionHeader actionHdr;
+    WifiActionHeader::ActionValue action;
+    action.sensingAction = WifiActionHeader::SENSING_SBP_REQUEST;
+    actionHdr.SetAction(WifiActionHeader::SENSING, action);
+    auto packet = Create<Packet>();
+    packet->AddHeader(request);
+    packet->AddHeader(actionHdr);
+    NS_TEST_EXPECT_MSG_EQ(packet->GetSize(), 2 + 10 + 12, "Unexpected SBP Request frame size");
+
+    auto [category, actionValue] = WifiActionHeader::Remove(packet);
+    NS_TEST_EXPECT_MSG_EQ(category, WifiActionHeader::SENSING, "Unexpected category");
+    NS_TEST_EXPECT_MSG_EQ(actionValue.sensingAction,
+                          WifiActionHeader::SENSING_SBP_REQUEST,
+                          "Unexpected action");
+    MgtSbpRequestHeader rxRequest;
+    packet->RemoveHeader(rxRequest);
+    NS_TEST_EXPECT_MSG_EQ(+rxRequest.GetSetupId(), 3, "Unexpected setup ID");
+    NS_TEST_EXPECT_MSG_EQ((rxRequest.GetMeasurementSetup() == setup),
+                          true,
+                          "Unexpected measurement setup");
+
+    // the forwarded report is the received one preceded by the SBP Report header
+    auto report = Create<Packet>(300);
+    MgtSbpReportHeader reportHdr;
+    reportHdr.SetSetupId(3);
+    reportHdr.SetInstanceId(12345);
+    reportHdr.SetReporter(Mac48Address("00:00:00:00:00:02"));
+    auto forwarded = report->Copy();
+    forwarded->AddHeader(reportHdr);
+    NS_TEST_EXPECT_MSG_EQ(report->GetSize(), 300, "The received report must not be modified");
+
+    MgtSbpReportHeader rxReportHdr;
+    forwarded->RemoveHeader(rxReportHdr);
+    NS_TEST_EXPECT_MSG_EQ(+rxReportHdr.GetSetupId(), 3, "Unexpected setup ID");
+    NS_TEST_EXPECT_MSG_EQ(rxReportHdr.GetInstanceId(), 12345, "Unexpected instance ID");
+    NS_TEST_EXPECT_MSG_EQ(rxReportHdr.GetReporter(),
+                          Mac48Address("00:00:00:00:00:02"),
+                          "Unexpected reporter");
+    NS_TEST_EXPECT_MSG_EQ(forwarded->GetSize(), 300, "Unexpected forwarded report size");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the threshold-based reporting of channel information and the announcement of
+ * non-TB sensing soundings
+ */
+class ThresholdReportingTest : public TestCase
+{
+  public:
+    ThresholdReportingTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Let the beamformee measure a new NDP and generate a report
+     *
+     * \param beamformee the beamformee
+     * \return the generated report
+     */
+    Ptr<WifiMpdu> MeasureAndReport(Ptr<CsBeamformee> beamformee);
+};
+
+ThresholdReportingTest::ThresholdReportingTest()
+    : TestCase("Check the threshold-based reporting of channel information")
+{
+}
+
+Ptr<WifiMpdu>
+ThresholdReportingTest::MeasureAndReport(Ptr<CsBeamformee> beamformee)
+{
+    WifiTxVector txVector;
+    txVector.SetNss(2);
+    txVector.SetChannelWidth(20);
+    beamformee->GetNdpInfo(txVector, 1);
+    beamformee->GenerateBfReport(1,
+                                 Mac48Address("00:00:00:00:00:01"),
+                                 Mac48Address("00:00:00:00:00:02"),
+                                 Mac48Address("00:00:00:00:00:01"));
+    return beamformee->GetBfReport();
+}
+
+void
+ThresholdReportingTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    // SU sounding of the station with AID 1 on a 20 MHz channel
+    CtrlNdpaHeader ndpaHeader;
+    ndpaHeader.SetSoundingDialogToken(1);
+    ndpaHeader.SetNonTbSensing(true);
+    CtrlNdpaHeader::StaInfo sta;
+    sta.m_aid11 = 1;
+    sta.m_ruStart = 0;
+    sta.m_ruEnd = 8;
+    sta.m_feedbackTypeNg = 0;
+    sta.m_disambiguation = 1;
+    sta.m_codebookSize = 0;
+    sta.m_nc = 0;
+    ndpaHeader.AddStaInfoField(sta);
+    auto packet = Create<Packet>();
+    packet->AddHeader(ndpaHeader);
+    auto ndpa = Create<WifiMpdu>(packet, WifiMacHeader(WIFI_MAC_CTL_NDPA));
+
+    CtrlNdpaHeader rxNdpaHeader;
+    packet->PeekHeader(rxNdpaHeader);
+    NS_TEST_EXPECT_MSG_EQ(rxNdpaHeader.IsNonTbSensing(), true, "Expected a non-TB NDPA");
+    NS_TEST_EXPECT_MSG_EQ(+(rxNdpaHeader.GetSoundingDialogToken() & 0x7f),
+                          1,
+                          "The non-TB indication must not alter the dialog token");
+
+    auto beamformee = CreateObject<CsBeamformee>();
+    beamformee->AssignStreams(1);
+    beamformee->SetAttribute("ReportThreshold", DoubleValue(1e6));
+    beamformee->GetNdpaInfo(ndpa, 1);
+    NS_TEST_EXPECT_MSG_EQ(beamformee->IsNonTbSounding(), true, "Expected a non-TB sounding");
+
+    auto beamformer = CreateObject<CsBeamformer>();
+    beamformer->SetBeamformerFrames(ndpa, "NDPA");
+    NS_TEST_EXPECT_MSG_EQ(beamformer->IsNonTbSounding(), true, "Expected a non-TB sounding");
+
+    // the first report is always a full report
+    auto report = MeasureAndReport(beamformee);
+    NS_TEST_EXPECT_MSG_EQ(beamformee->IsNoChangeReport(), false, "Expected a full report");
+    const CsiBuffer firstChannelInfo = beamformee->GetChannelInfo();
+    beamformer->GetBfReportInfo(report, 1);
+    NS_TEST_EXPECT_MSG_EQ(CsBeamformee::GetChannelInfoDistance(beamformer->GetChannelInfo(1),
+                                                               firstChannelInfo,
+                                                               CsBeamformee::ANGLE_DISTANCE),
+                          0,
+                          "Unexpected angles in the full report");
+
+    // with a large threshold, a new measurement is reported as no change and the beamformer
+    // uses the channel information of the last full report
+    beamformer->ClearChannelInfo();
+    report = MeasureAndReport(beamformee);
+    NS_TEST_EXPECT_MSG_EQ(beamformee->IsNoChangeReport(), true, "Expected a no change report");
+    NS_TEST_EXPECT_MSG_EQ(report->GetPacket()->GetSize(), 2, "Unexpected no change report size");
+    NS_TEST_EXPECT_MSG_GT(CsBeamformee::GetChannelInfoDistance(beamformee->GetChannelInfo(),
+                                                               firstChannelInfo,
+                                                               CsBeamformee::ANGLE_DISTANCE),
+                          0,
+                          "The new measurement should differ from the first one");
+    beamformer->GetBfReportInfo(report, 1);
+    NS_TEST_EXPECT_MSG_EQ(beamformer->CheckAllChannelInfoReceived().empty(),
+                          true,
+                          "A no change report counts as a received report");
+    NS_TEST_EXPECT_MSG_EQ(CsBeamformee::GetChannelInfoDistance(beamformer->GetChannelInfo(1),
+                                                               firstChannelInfo,
+                                                               CsBeamformee::ANGLE_DISTANCE),
+                          0,
+                          "The beamformer should reuse the last full report");
+
+    // without threshold, a full report is always sent
+    beamformee->SetAttribute("ReportThreshold", DoubleValue(0));
+    MeasureAndReport(beamformee);
+    NS_TEST_EXPECT_MSG_EQ(beamformee->IsNoChangeReport(), false, "Expected a full report");
+
+    // distance metrics
+    CsiBuffer other = firstChannelInfo;
+    other.SetPhi(0, 0, other.GetPhi(0, 0) ^ 0x08);
+    other.SetStStreamSnr(0, other.GetStStreamSnr(0) ^ 0x04);
+    const double nAngles = firstChannelInfo.GetNs() * firstChannelInfo.GetNa();
+    NS_TEST_EXPECT_MSG_EQ_TOL(CsBeamformee::GetChannelInfoDistance(firstChannelInfo,
+                                                                   other,
+                                                                   CsBeamformee::ANGLE_DISTANCE),
+                              8 / nAngles,
+                              1e-9,
+                              "Unexpected angle distance");
+    NS_TEST_EXPECT_MSG_EQ_TOL(CsBeamformee::GetChannelInfoDistance(firstChannelInfo,
+                                                                   other,
+                                                                   CsBeamformee::SNR_DISTANCE),
+                              4.0 / firstChannelInfo.GetNc(),
+                              1e-9,
+                              "Unexpected SNR distance");
+    NS_TEST_EXPECT_MSG_EQ(std::isinf(CsBeamformee::GetChannelInfoDistance(
+                              firstChannelInfo,
+                              CsiBuffer(1, 2, 1),
+                              CsBeamformee::ANGLE_DISTANCE)),
+                          true,
+                          "Channel information of different dimensions must be infinitely far");
+
+    beamformee->Dispose();
+    beamformer->Dispose();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the sequence of phases of a TB sensing measurement instance, as reported by the
+ * SensingPhase trace sources of the AP and of the participating stations
+ */
+class SensingPhaseSequenceTest : public TestCase
+{
+  public:
+    SensingPhaseSequenceTest();
+
+  private:
+    void DoRun() override;
+
+    /// a sensing phase event reported by a SensingPhase trace source
+    using PhaseEvent = std::tuple<uint32_t, SensingPhase, SensingPhaseEvent>;
+
+    /**
+     * Record a sensing phase event
+     *
+     * \param events the list of events to append the event to
+     * \param instanceId the ID of the sensing measurement instance
+     * \param phase the sensing phase
+     * \param event the event that occurred in the given phase
+     * \param time the time the event occurred
+     */
+    static void RecordPhase(std::vector<PhaseEvent>* events,
+                            uint32_t instanceId,
+                            SensingPhase phase,
+                            SensingPhaseEvent event,
+                            Time time);
+};
+
+SensingPhaseSequenceTest::SensingPhaseSequenceTest()
+    : TestCase("Check the sequence of phases of a sensing measurement instance")
+{
+}
+
+void
+SensingPhaseSequenceTest::RecordPhase(std::vector<PhaseEvent>* events,
+                                      uint32_t instanceId,
+                                      SensingPhase phase,
+                                      SensingPhaseEvent event,
+                                      Time time)
+{
+    NS_LOG_DEBUG(time << " instance " << instanceId << " " << phase << " " << event);
+    events->emplace_back(instanceId, phase, event);
+}
+
+void
+SensingPhaseSequenceTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode;
+    apNode.Create(1);
+    NodeContainer staNode;
+    staNode.Create(1);
+
+    Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel>();
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    channel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+
+    SpectrumWifiPhyHelper phy;
+    phy.SetChannel(channel);
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211bf);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs6"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+    wifi.ConfigHeOptions("MaxNc", UintegerValue(1));
+
+    Ssid ssid("sensing-phases");
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(ssid),
+                "WiFiSensingSupported",
+                BooleanValue(true),
+                "ChannelSoundingSupported",
+                BooleanValue(true),
+                "QosSupported",
+                BooleanValue(true),
+                "SensingPriority",
+                UintegerValue(AC_BE),
+                "SensingInterval",
+                TimeValue(MilliSeconds(50)));
+    // the sounding sequences of the AP are not acknowledged
+    mac.SetAckManager("ns3::WifiDefaultAckManager",
+                      "DlMuAckSequenceType",
+                      EnumValue(WifiAcknowledgment::NONE));
+    mac.SetMultiUserScheduler("ns3::RrMultiUserScheduler",
+                              "ChannelSoundingInterval",
+                              TimeValue(MilliSeconds(5)),
+                              "EnableMuMimo",
+                              BooleanValue(true),
+                              "NStations",
+                              UintegerValue(1));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    mac.SetType("ns3::StaWifiMac",
+                "Ssid",
+                SsidValue(ssid),
+                "ActiveProbing",
+                BooleanValue(false),
+                "WiFiSensingSupported",
+                BooleanValue(true),
+                "QosSupported",
+                BooleanValue(true),
+                "ManualConnection",
+                BooleanValue(true));
+    NetDeviceContainer staDevice = wifi.Install(phy, mac, staNode);
+
+    wifi.AssignStreams(apDevice, 100);
+    wifi.AssignStreams(staDevice, 100);
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(1.0, 0.0, 0.0));
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNode);
+
+    auto apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice.Get(0))->GetMac());
+    auto staMac = DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(staDevice.Get(0))->GetMac());
+    // the station connects to the AP given by the scenario
+    staMac->SetBssid(apMac->GetAddress(), 0);
+
+    std::vector<PhaseEvent> apEvents;
+    std::vector<PhaseEvent> staEvents;
+    apMac->TraceConnectWithoutContext("SensingPhase",
+                                      MakeBoundCallback(&SensingPhaseSequenceTest::RecordPhase,
+                                                        &apEvents));
+    staMac->GetFrameExchangeManager()->TraceConnectWithoutContext(
+        "SensingPhase",
+        MakeBoundCallback(&SensingPhaseSequenceTest::RecordPhase, &staEvents));
+
+    // the station asks the AP to run a measurement setup on its behalf once associated
+    SensingMeasurementSetup setup;
+    setup.interval = MilliSeconds(50);
+    setup.priority = AC_BE;
+    Simulator::Schedule(MilliSeconds(500), [staMac, setup]() {
+        staMac->RequestSensingByProxy(setup);
+    });
+
+    Simulator::Stop(MilliSeconds(700));
+    Simulator::Run();
+
+    // keep the events of the first instance only
+    auto firstInstance = [](std::vector<PhaseEvent> events) {
+        events.erase(std::remove_if(events.begin(),
+                                    events.end(),
+                                    [](const PhaseEvent& e) { return std::get<0>(e) != 1; }),
+                     events.end());
+        return events;
+    };
+
+    const std::vector<PhaseEvent> expectedAp{
+        {1, SensingPhase::POLLING, SensingPhaseEvent::START},
+        {1, SensingPhase::POLLING, SensingPhaseEvent::COMPLETE},
+        {1, SensingPhase::NDPA_SOUNDING, SensingPhaseEvent::START},
+        {1, SensingPhase::NDPA_SOUNDING, SensingPhaseEvent::COMPLETE},
+        {1, SensingPhase::NDP, SensingPhaseEvent::START},
+        {1, SensingPhase::NDP, SensingPhaseEvent::COMPLETE},
+        {1, SensingPhase::REPORT, SensingPhaseEvent::START},
+        {1, SensingPhase::REPORT, SensingPhaseEvent::COMPLETE}};
+    const std::vector<PhaseEvent> expectedSta{
+        {1, SensingPhase::NDPA_SOUNDING, SensingPhaseEvent::COMPLETE},
+        {1, SensingPhase::NDP, SensingPhaseEvent::COMPLETE},
+        {1, SensingPhase::REPORT, SensingPhaseEvent::START}};
+
+    auto ap = firstInstance(apEvents);
+    NS_TEST_ASSERT_MSG_EQ(ap.size(), expectedAp.size(), "Unexpected number of AP phase events");
+    for (std::size_t i = 0; i < ap.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ((ap[i] == expectedAp[i]), true, "Unexpected AP phase event #" << i);
+    }
+    auto sta = firstInstance(staEvents);
+    NS_TEST_ASSERT_MSG_EQ(sta.size(), expectedSta.size(), "Unexpected number of STA phase events");
+    for (std::size_t i = 0; i < sta.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ((sta[i] == expectedSta[i]),
+                              true,
+                              "Unexpected STA phase event #" << i);
+    }
+    // the station reports the instance IDs announced by the AP
+    NS_TEST_EXPECT_MSG_GT(staEvents.size(), expectedSta.size(), "Expected more than one instance");
+    NS_TEST_EXPECT_MSG_EQ(std::get<0>(staEvents.back()),
+                          apMac->GetSensingInstanceId(),
+                          "Unexpected instance ID reported by the station");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that MU sounding groups the stations by maximum Nc, so that every NDPA addresses
+ * stations with the same Nc and every instance takes one NDPA round per group
+ */
+class MixedNcSoundingTest : public TestCase
+{
+  public:
+    MixedNcSoundingTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Callback invoked when the AP starts transmitting a PSDU
+     *
+     * \param psduMap the PSDU map
+     * \param txVector the TX vector
+     * \param txPowerW the TX power in Watts
+     */
+    void Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
+
+    Ptr<ApWifiMac> m_apMac; ///< the AP MAC
+    /// the instance ID and the Nc of the STA Info fields of the NDPA frames sent by the AP
+    std::vector<std::pair<uint32_t, std::vector<uint8_t>>> m_ndpas;
+};
+
+MixedNcSoundingTest::MixedNcSoundingTest()
+    : TestCase("Check the grouping of stations with different maximum Nc in MU sounding")
+{
+}
+
+void
+MixedNcSoundingTest::Transmit(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW)
+{
+    for (const auto& [staId, psdu] : psduMap)
+    {
+        for (const auto& mpdu : *PeekPointer(psdu))
+        {
+            if (!mpdu->GetHeader().IsNdpa())
+            {
+                continue;
+            }
+            CtrlNdpaHeader ndpa;
+            mpdu->GetPacket()->PeekHeader(ndpa);
+            std::vector<uint8_t> ncs;
+            for (const auto& staInfo : ndpa)
+            {
+                ncs.push_back(staInfo.m_nc);
+            }
+            m_ndpas.emplace_back(m_apMac->GetSensingInstanceId(), ncs);
+        }
+    }
+}
+
+void
+MixedNcSoundingTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer apNode;
+    apNode.Create(1);
+    NodeContainer staNodes;
+    staNodes.Create(4);
+
+    Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel>();
+    channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+    channel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+
+    SpectrumWifiPhyHelper phy;
+    phy.SetChannel(channel);
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+    phy.Set("Antennas", UintegerValue(2));
+    phy.Set("MaxSupportedTxSpatialStreams", UintegerValue(2));
+    phy.Set("MaxSupportedRxSpatialStreams", UintegerValue(2));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211bf);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs6"),
+                                 "ControlMode",
+                                 StringValue("OfdmRate24Mbps"));
+
+    Ssid ssid("sensing-nc");
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac",
+                "Ssid",
+                SsidValue(ssid),
+                "WiFiSensingSupported",
+                BooleanValue(true),
+                "ChannelSoundingSupported",
+                BooleanValue(true),
+                "QosSupported",
+                BooleanValue(true),
+                "SensingPriority",
+                UintegerValue(AC_BE),
+                "SensingInterval",
+                TimeValue(MilliSeconds(50)));
+    mac.SetAckManager("ns3::WifiDefaultAckManager",
+                      "DlMuAckSequenceType",
+                      EnumValue(WifiAcknowledgment::NONE));
+    mac.SetMultiUserScheduler("ns3::RrMultiUserScheduler",
+                              "ChannelSoundingInterval",
+                              TimeValue(MilliSeconds(5)),
+                              "EnableMuMimo",
+                              BooleanValue(true),
+                              "SoundingType",
+                              UintegerValue(MultiUserScheduler::MU_only),
+                              "NStations",
+                              UintegerValue(4));
+    NetDeviceContainer apDevice = wifi.Install(phy, mac, apNode);
+
+    mac.SetType("ns3::StaWifiMac",
+                "Ssid",
+                SsidValue(ssid),
+                "ActiveProbing",
+                BooleanValue(false),
+                "WiFiSensingSupported",
+                BooleanValue(true),
+                "QosSupported",
+                BooleanValue(true),
+                "ManualConnection",
+                BooleanValue(true));
+    // the first two stations report one column, the other two report two columns
+    NetDeviceContainer staDevices;
+    for (uint8_t maxNc : {0, 1})
+    {
+        wifi.ConfigHeOptions("MaxNc", UintegerValue(maxNc));
+        NodeContainer nodes(staNodes.Get(2 * maxNc), staNodes.Get(2 * maxNc + 1));
+        staDevices.Add(wifi.Install(phy, mac, nodes));
+    }
+
+    wifi.AssignStreams(apDevice, 100);
+    wifi.AssignStreams(staDevices, 100);
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (uint32_t i = 0; i < staNodes.GetN(); i++)
+    {
+        positionAlloc->Add(Vector(1.0, i, 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(apNode);
+    mobility.Install(staNodes);
+
+    m_apMac = DynamicCast<ApWifiMac>(DynamicCast<WifiNetDevice>(apDevice.Get(0))->GetMac());
+    for (uint32_t i = 0; i < staDevices.GetN(); i++)
+    {
+        auto staMac =
+            DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(staDevices.Get(i))->GetMac());
+        staMac->SetBssid(m_apMac->GetAddress(), 0);
+    }
+    DynamicCast<WifiNetDevice>(apDevice.Get(0))
+        ->GetPhy()
+        ->TraceConnectWithoutContext("PhyTxPsduBegin",
+                                     MakeCallback(&MixedNcSoundingTest::Transmit, this));
+
+    SensingMeasurementSetup setup;
+    setup.interval = MilliSeconds(50);
+    setup.priority = AC_BE;
+    auto staMac =
+        DynamicCast<StaWifiMac>(DynamicCast<WifiNetDevice>(staDevices.Get(0))->GetMac());
+    Simulator::Schedule(MilliSeconds(500), [staMac, setup]() {
+        staMac->RequestSensingByProxy(setup);
+    });
+
+    Simulator::Stop(MilliSeconds(700));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_GT(m_ndpas.size(), 0, "No NDPA sent by the AP");
+    std::map<uint32_t, std::set<uint8_t>> ncsPerInstance;
+    std::map<uint32_t, std::size_t> roundsPerInstance;
+    for (const auto& [instanceId, ncs] : m_ndpas)
+    {
+        NS_TEST_ASSERT_MSG_EQ(ncs.empty(), false, "NDPA without STA Info field");
+        NS_TEST_EXPECT_MSG_EQ(static_cast<std::size_t>(
+                                  std::count(ncs.begin(), ncs.end(), ncs.front())),
+                              ncs.size(),
+                              "Stations with different Nc sounded by the same NDPA");
+        NS_TEST_EXPECT_MSG_EQ(ncs.size(), 2, "Unexpected number of stations in the group");
+        NS_TEST_EXPECT_MSG_EQ(ncsPerInstance[instanceId].insert(ncs.front()).second,
+                              true,
+                              "Group sounded twice in instance " << instanceId);
+        roundsPerInstance[instanceId]++;
+    }
+    for (const auto& [instanceId, rounds] : roundsPerInstance)
+    {
+        NS_TEST_EXPECT_MSG_EQ(rounds, 2, "Unexpected number of NDPA rounds in " << instanceId);
+    }
+
+    m_apMac = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief wifi channel sounding Test Suite
+ */
+class WifiChannelSoundingTestSuite : public TestSuite
+{
+  public:
+    WifiChannelSoundingTestSuite();
+};
+
+WifiChannelSoundingTestSuite::WifiChannelSoundingTestSuite()
+    : TestSuite("wifi-channel-sounding", UNIT)
+{
+    AddTestCase(new CsiBufferTest(), TestCase::QUICK);
+    AddTestCase(new RandomCsiGeneratorTest(), TestCase::QUICK);
+    AddTestCase(new GivensDecompositionTest(), TestCase::QUICK);
+    AddTestCase(new StreamingQuantileTest(), TestCase::QUICK);
+    AddTestCase(new SensingSessionManagerTest(), TestCase::QUICK);
+    AddTestCase(new SbpFramesTest(), TestCase::QUICK);
+    AddTestCase(new ThresholdReportingTest(), TestCase::QUICK);
+    AddTestCase(new SensingPhaseSequenceTest(), TestCase::QUICK);
+    AddTestCase(new MixedNcSoundingTest(), TestCase::QUICK);
+
+    // {Nc, Nr} pairs for which the number of angles is defined
+    const std::vector<std::pair<uint8_t, uint8_t>> dimensions{
+        {1, 2}, {2, 2}, {1, 3}, {2, 3}, {3, 3}, {1, 4}, {2, 4}, {3, 4}, {4, 4}};
+    for (auto type : {HeMimoControlHeader::SU, HeMimoControlHeader::MU})
+    {
+        for (uint16_t bandwidth : {20, 40, 80, 160})
+        {
+            for (uint8_t ng : {4, 16})
+            {
+                for (uint8_t codebook : {0, 1})
+                {
+                    if (type == HeMimoControlHeader::MU && ng == 16 && codebook == 0)
+                    {
+                        // CQI feedback, not supported
+                        continue;
+                    }
+                    for (const auto& [nc, nr] : dimensions)
+                    {
+                        AddTestCase(
+                            new BfReportRoundTripTest(bandwidth, ng, codebook, nc, nr, type),
+                            TestCase::QUICK);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static WifiChannelSoundingTestSuite g_wifiChannelSoundingTestSuite; ///< the test suite
@@ -26,6 +26,7 @@
 #endif
 
 #include "ns3/dsss-error-rate-model.h"
+#include "ns3/dsss-phy.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 #include "ns3/log.h"
@@ -1039,6 +1040,96 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Batch evaluation of the chunks test case
+ *
+ * Check that the success rate returned by ErrorRateModel::GetChunksSuccessRate for a
+ * set of chunks equals the product of the success rates of the individual chunks.
+ */
+class WifiErrorRateModelsTestCaseBatch : public TestCase
+{
+  public:
+    WifiErrorRateModelsTestCaseBatch();
+    ~WifiErrorRateModelsTestCaseBatch() override;
+
+  private:
+    void DoRun() override;
+};
+
+WifiErrorRateModelsTestCaseBatch::WifiErrorRateModelsTestCaseBatch()
+    : TestCase("WifiErrorRateModel batch evaluation of the chunks")
+{
+}
+
+WifiErrorRateModelsTestCaseBatch::~WifiErrorRateModelsTestCaseBatch()
+{
+}
+
+void
+WifiErrorRateModelsTestCaseBatch::DoRun()
+{
+    const std::vector<Ptr<ErrorRateModel>> models{CreateObject<NistErrorRateModel>(),
+                                                  CreateObject<YansErrorRateModel>(),
+                                                  CreateObject<TableBasedErrorRateModel>()};
+    const std::vector<WifiMode> modes{DsssPhy::GetDsssRate1Mbps(),
+                                      OfdmPhy::GetOfdmRate6Mbps(),
+                                      OfdmPhy::GetOfdmRate54Mbps(),
+                                      HtPhy::GetHtMcs12(),
+                                      VhtPhy::GetVhtMcs8(),
+                                      HePhy::GetHeMcs11()};
+
+    // SNRs (in dB) on and off the grid of the tables, some of them repeated, and sizes
+    // around the size threshold of the tables
+    std::vector<ErrorRateModel::Chunk> chunks;
+    for (double snrDb = -5.0; snrDb <= 40.0; snrDb += 1.237)
+    {
+        chunks.emplace_back(std::pow(10.0, snrDb / 10), 8 * (10 + chunks.size() * 37));
+        chunks.emplace_back(std::pow(10.0, std::round(snrDb) / 10), 8 * 1458);
+    }
+
+    for (const auto& model : models)
+    {
+        for (const auto& mode : modes)
+        {
+            for (const auto ldpc : {false, true})
+            {
+                WifiTxVector txVector;
+                txVector.SetMode(mode);
+                txVector.SetChannelWidth(20);
+                txVector.SetNss(1);
+                txVector.SetLdpc(ldpc);
+
+                // a chunk with a low SNR makes the whole PSR null, hence check subsets
+                for (std::size_t first = 0; first < chunks.size(); ++first)
+                {
+                    double expectedPsr = 1.0;
+                    for (std::size_t i = first; i < chunks.size(); ++i)
+                    {
+                        expectedPsr *= model->GetChunkSuccessRate(mode,
+                                                                  txVector,
+                                                                  chunks[i].first,
+                                                                  chunks[i].second);
+                    }
+                    const std::vector<ErrorRateModel::Chunk> subset(chunks.cbegin() + first,
+                                                                    chunks.cend());
+                    NS_TEST_EXPECT_MSG_EQ(model->GetChunksSuccessRate(mode, txVector, subset),
+                                          expectedPsr,
+                                          "Unexpected PSR for " << model->GetInstanceTypeId()
+                                                                << " and mode " << mode);
+                }
+            }
+        }
+        NS_TEST_EXPECT_MSG_EQ(model->GetChunksSuccessRate(OfdmPhy::GetOfdmRate6Mbps(),
+                                                          WifiTxVector(),
+                                                          {}),
+                              1.0,
+                              "The PSR of no chunk should be 1");
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1057,6 +1148,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::QUICK);
+    AddTestCase(new WifiErrorRateModelsTestCaseBatch, TestCase::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
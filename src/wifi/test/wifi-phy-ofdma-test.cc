@@ -5825,6 +5825,125 @@ TestUlOfdmaPowerControl::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief HE PPDU that counts the computations of its transmission duration
+ */
+class CountingHePpdu : public HePpdu
+{
+  public:
+    using HePpdu::HePpdu;
+
+    mutable std::size_t m_nTxDurationComputations{0}; ///< number of TX duration computations
+
+  private:
+    Time DoGetTxDuration() const override
+    {
+        // the returned value identifies the computation
+        return MicroSeconds(++m_nTxDurationComputations);
+    }
+};
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the durations derived from the TXVECTOR of an HE TB PPDU, which are computed
+ * once and shared by the receivers, are computed again when the TXVECTOR is reset and when it is
+ * updated with the information of the TRIGVECTOR.
+ */
+class TestHeTbPpduTxInfo : public TestCase
+{
+  public:
+    TestHeTbPpduTxInfo();
+
+  private:
+    void DoRun() override;
+};
+
+TestHeTbPpduTxInfo::TestHeTbPpduTxInfo()
+    : TestCase("Check the durations derived from the TXVECTOR of an HE TB PPDU")
+{
+}
+
+void
+TestHeTbPpduTxInfo::DoRun()
+{
+    const uint16_t staId = 1;
+    const HeRu::RuSpec ru(HeRu::RU_106_TONE, 1, false);
+    WifiTxVector txVector(HePhy::GetHeMcs7(),
+                          0,
+                          WIFI_PREAMBLE_HE_TB,
+                          3200,
+                          1,
+                          1,
+                          0,
+                          DEFAULT_CHANNEL_WIDTH,
+                          false,
+                          false);
+    txVector.SetRu(ru, staId);
+    txVector.SetMode(HePhy::GetHeMcs7(), staId);
+    txVector.SetNss(1, staId);
+
+    WifiMacHeader hdr;
+    hdr.SetType(WIFI_MAC_QOSDATA);
+    hdr.SetQosTid(0);
+    WifiConstPsduMap psdus{{staId, Create<WifiPsdu>(Create<Packet>(1000), hdr)}};
+
+    WifiPhyOperatingChannel channel;
+    channel.SetDefault(DEFAULT_CHANNEL_WIDTH, WIFI_STANDARD_80211ax, WIFI_PHY_BAND_5GHZ);
+    const auto ppduDuration = WifiPhy::CalculateTxDuration(psdus, txVector, WIFI_PHY_BAND_5GHZ);
+    auto ppdu = Create<CountingHePpdu>(psdus,
+                                       txVector,
+                                       channel,
+                                       ppduDuration,
+                                       0,
+                                       HePpdu::PSD_NON_HE_PORTION);
+
+    // the durations are computed once
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetTxDuration(), MicroSeconds(1), "Unexpected TX duration");
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetTxDuration(), MicroSeconds(1), "TX duration computed twice");
+    const auto preambleDuration = WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector);
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetPreambleAndHeaderDuration(),
+                          preambleDuration,
+                          "Unexpected preamble and header duration");
+
+    // the TXVECTOR is rebuilt from the PHY headers, which do not carry the guard interval of an
+    // HE TB PPDU, and then updated with the TRIGVECTOR
+    ppdu->ResetTxVector();
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetTxDuration(),
+                          MicroSeconds(2),
+                          "TX duration not computed again after resetting the TXVECTOR");
+
+    WifiTxVector trigVector(HePhy::GetHeMcs7(),
+                            0,
+                            WIFI_PREAMBLE_HE_TB,
+                            1600,
+                            1,
+                            1,
+                            0,
+                            DEFAULT_CHANNEL_WIDTH,
+                            false,
+                            false);
+    // the user info of the TRIGVECTOR uses two spatial streams, hence two HE-LTFs
+    trigVector.SetHeMuUserInfo(staId, {ru, 7, 2});
+    ppdu->UpdateTxVectorForUlMu(trigVector);
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetTxVector().GetGuardInterval(),
+                          1600,
+                          "Guard interval not taken from the TRIGVECTOR");
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetTxDuration(),
+                          MicroSeconds(3),
+                          "TX duration not computed again after updating the TXVECTOR");
+    NS_TEST_EXPECT_MSG_EQ(ppdu->GetPreambleAndHeaderDuration(),
+                          WifiPhy::CalculatePhyPreambleAndHeaderDuration(ppdu->GetTxVector()),
+                          "Unexpected preamble and header duration after updating the TXVECTOR");
+    NS_TEST_EXPECT_MSG_NE(ppdu->GetPreambleAndHeaderDuration(),
+                          preambleDuration,
+                          "Preamble and header duration not computed again");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -5847,6 +5966,7 @@ WifiPhyOfdmaTestSuite::WifiPhyOfdmaTestSuite()
     AddTestCase(new TestUlOfdmaPhyTransmission, TestCase::QUICK);
     AddTestCase(new TestPhyPaddingExclusion, TestCase::QUICK);
     AddTestCase(new TestUlOfdmaPowerControl, TestCase::QUICK);
+    AddTestCase(new TestHeTbPpduTxInfo, TestCase::QUICK);
 }
 
 static WifiPhyOfdmaTestSuite wifiPhyOfdmaTestSuite; ///< the test suite
@@ -37,12 +37,14 @@
 #include "ns3/packet-socket-helper.h"
 #include "ns3/packet-socket-server.h"
 #include "ns3/pointer.h"
+#include "ns3/propagation-delay-model.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/socket.h"
 #include "ns3/spectrum-wifi-helper.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
 #include "ns3/vht-phy.h"
 #include "ns3/waypoint-mobility-model.h"
 #include "ns3/wifi-default-ack-manager.h"
@@ -3778,6 +3780,181 @@ WifiMgtHeaderTest::DoRun()
     TestHeaderSerialization(frame);
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi channels used with the MultithreadedSimulatorImpl
+ *
+ * An AP and two stations, attached to a YansWifiChannel or to a MultiModelSpectrumChannel,
+ * exchange packets in both directions. The simulation is run with the DefaultSimulatorImpl
+ * and with the MultithreadedSimulatorImpl, whose lookahead is derived from the propagation
+ * delay model of the channel, and all the packets must be received in both cases.
+ */
+class MultithreadedChannelTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     * \param useSpectrum whether to use a MultiModelSpectrumChannel instead of a
+     *                    YansWifiChannel
+     * \param partitions the number of partitions of the MultithreadedSimulatorImpl
+     */
+    MultithreadedChannelTest(bool useSpectrum, uint32_t partitions);
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+
+    /**
+     * Run a simulation
+     * \param simulatorType the simulator implementation type
+     * \return the number of packets received by each node
+     */
+    std::vector<uint32_t> RunOne(const std::string& simulatorType);
+
+    /**
+     * Send a packet
+     * \param device the sending device
+     * \param destination the address of the destination device
+     */
+    static void SendPacket(Ptr<NetDevice> device, Address destination);
+
+    static constexpr uint32_t N_PACKETS = 5; ///< number of packets sent to each destination
+
+    bool m_useSpectrum;    ///< whether to use a MultiModelSpectrumChannel
+    uint32_t m_partitions; ///< number of partitions of the MultithreadedSimulatorImpl
+};
+
+MultithreadedChannelTest::MultithreadedChannelTest(bool useSpectrum, uint32_t partitions)
+    : TestCase(std::string("Check the ") +
+               (useSpectrum ? "MultiModelSpectrumChannel" : "YansWifiChannel") +
+               " with a MultithreadedSimulatorImpl of " + std::to_string(partitions) +
+               " partitions"),
+      m_useSpectrum(useSpectrum),
+      m_partitions(partitions)
+{
+}
+
+void
+MultithreadedChannelTest::SendPacket(Ptr<NetDevice> device, Address destination)
+{
+    device->Send(Create<Packet>(1000), destination, 0);
+}
+
+std::vector<uint32_t>
+MultithreadedChannelTest::RunOne(const std::string& simulatorType)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    YansWifiPhyHelper yansPhy;
+    SpectrumWifiPhyHelper spectrumPhy;
+    if (m_useSpectrum)
+    {
+        Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel>();
+        channel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+        channel->SetPropagationDelayModel(CreateObject<ConstantSpeedPropagationDelayModel>());
+        spectrumPhy.SetChannel(channel);
+    }
+    else
+    {
+        yansPhy.SetChannel(YansWifiChannelHelper::Default().Create());
+    }
+    const WifiPhyHelper& phy =
+        m_useSpectrum ? static_cast<const WifiPhyHelper&>(spectrumPhy) : yansPhy;
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::IdealWifiManager");
+
+    WifiMacHelper mac;
+    Ssid ssid("multithreaded");
+    mac.SetType("ns3::ApWifiMac", "Ssid", SsidValue(ssid));
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes.Get(0));
+    mac.SetType("ns3::StaWifiMac", "Ssid", SsidValue(ssid));
+    devices.Add(wifi.Install(phy, mac, NodeContainer(nodes.Get(1), nodes.Get(2))));
+    wifi.AssignStreams(devices, 100);
+
+    MobilityHelper mobility;
+    Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(5.0, 0.0, 0.0));
+    positionAlloc->Add(Vector(0.0, 5.0, 0.0));
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    // each node is only accessed by the thread of its partition
+    std::vector<uint32_t> rxCount(nodes.GetN(), 0);
+    for (uint32_t i = 0; i < devices.GetN(); i++)
+    {
+        DynamicCast<WifiNetDevice>(devices.Get(i))
+            ->GetMac()
+            ->TraceConnectWithoutContext(
+                "MacRx",
+                Callback<void, Ptr<const Packet>>([&rxCount, i](Ptr<const Packet>) {
+                    rxCount[i]++;
+                }));
+    }
+
+    // the AP and the stations send packets to each other once the stations are associated
+    for (uint32_t i = 1; i < devices.GetN(); i++)
+    {
+        for (uint32_t n = 0; n < N_PACKETS; n++)
+        {
+            Simulator::ScheduleWithContext(0,
+                                           Seconds(1) + MilliSeconds(n),
+                                           &MultithreadedChannelTest::SendPacket,
+                                           devices.Get(0),
+                                           devices.Get(i)->GetAddress());
+            Simulator::ScheduleWithContext(i,
+                                           Seconds(1) + MilliSeconds(n),
+                                           &MultithreadedChannelTest::SendPacket,
+                                           devices.Get(i),
+                                           devices.Get(0)->GetAddress());
+        }
+    }
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    Simulator::Destroy();
+    return rxCount;
+}
+
+void
+MultithreadedChannelTest::DoRun()
+{
+    auto expected = RunOne("ns3::DefaultSimulatorImpl");
+
+    Config::SetDefault("ns3::MultithreadedSimulatorImpl::Partitions",
+                       UintegerValue(m_partitions));
+    auto results = RunOne("ns3::MultithreadedSimulatorImpl");
+
+    for (uint32_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(expected[i],
+                              (i == 0 ? 2 : 1) * N_PACKETS,
+                              "Unexpected number of packets received by node " << i);
+        NS_TEST_EXPECT_MSG_EQ(results[i],
+                              expected[i],
+                              "Unexpected number of packets received by node "
+                                  << i << " with the MultithreadedSimulatorImpl");
+    }
+}
+
+void
+MultithreadedChannelTest::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+    Config::Reset();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -3811,6 +3988,13 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new IdealRateManagerMimoTest, TestCase::QUICK);
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::QUICK);
+    AddTestCase(new MultithreadedChannelTest(false, 1), TestCase::QUICK);
+    AddTestCase(new MultithreadedChannelTest(true, 1), TestCase::QUICK);
+#ifdef NS3_MTP
+    // the channels can only be shared by several partitions with the thread-safe objects
+    AddTestCase(new MultithreadedChannelTest(false, 2), TestCase::QUICK);
+    AddTestCase(new MultithreadedChannelTest(true, 2), TestCase::QUICK);
+#endif
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
@@ -306,6 +306,114 @@ WifiOfdmMaskSlopesTestCase::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that transmit PSDs are obtained by scaling the cached unit-power templates
+ * when all the parameters but the transmit power match, and that they match the PSDs
+ * built from scratch.
+ */
+class WifiTxPsdTemplateTestCase : public TestCase
+{
+  public:
+    WifiTxPsdTemplateTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that two PSDs are equal, up to a relative tolerance.
+     *
+     * \param actual the actual PSD
+     * \param expected the expected PSD
+     * \param msg the message to print if the PSDs differ
+     */
+    void CheckPsd(Ptr<const SpectrumValue> actual,
+                  Ptr<const SpectrumValue> expected,
+                  const std::string& msg);
+};
+
+WifiTxPsdTemplateTestCase::WifiTxPsdTemplateTestCase()
+    : TestCase("Check the cache of transmit PSD templates")
+{
+}
+
+void
+WifiTxPsdTemplateTestCase::CheckPsd(Ptr<const SpectrumValue> actual,
+                                    Ptr<const SpectrumValue> expected,
+                                    const std::string& msg)
+{
+    NS_TEST_ASSERT_MSG_EQ(actual->GetValuesN(), expected->GetValuesN(), msg);
+    for (uint32_t i = 0; i < actual->GetValuesN(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(actual->ValuesAt(i),
+                                  expected->ValuesAt(i),
+                                  expected->ValuesAt(i) * 1e-12,
+                                  msg << " (band " << i << ")");
+    }
+}
+
+void
+WifiTxPsdTemplateTestCase::DoRun()
+{
+    WifiSpectrumValueHelper::ClearTxPsdTemplates();
+
+    WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.1, 20);
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateMisses(), 1, "Expected a miss");
+    auto second =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.2, 20);
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateHits(), 1, "Expected a hit");
+    NS_TEST_EXPECT_MSG_EQ_TOL(Integral(*second), 0.2, 1e-6, "Wrong TX power");
+
+    // a different puncturing pattern, a different width or a different PSD type are misses
+    WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210,
+                                                                80,
+                                                                0.1,
+                                                                20,
+                                                                -20,
+                                                                -28,
+                                                                -40,
+                                                                {false, true, false, false});
+    WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 40, 0.1, 20);
+    WifiSpectrumValueHelper::CreateHtOfdmTxPowerSpectralDensity(5210, 80, 0.1, 20);
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateMisses(), 4, "Expected misses");
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateHits(), 1, "Unexpected hits");
+
+    // the PSDs obtained from the templates match those built from scratch
+    WifiSpectrumValueHelper::ClearTxPsdTemplates();
+    auto expected =
+        WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity(5210, 80, 0.2, 20);
+    CheckPsd(second, expected, "HE PSD obtained from the template");
+
+    WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(2412, 0.05, 20);
+    auto dsss = WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(2412, 0.03, 20);
+    const WifiSpectrumBandIndices ru{100, 300};
+    WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(5210, 80, 0.05, 20, ru);
+    auto heMu =
+        WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(5210, 80, 0.03, 20, ru);
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateHits(), 2, "Expected hits");
+    WifiSpectrumValueHelper::ClearTxPsdTemplates();
+    CheckPsd(dsss,
+             WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(2412, 0.03, 20),
+             "DSSS PSD obtained from the template");
+    CheckPsd(heMu,
+             WifiSpectrumValueHelper::CreateHeMuOfdmTxPowerSpectralDensity(5210, 80, 0.03, 20, ru),
+             "HE MU PSD obtained from the template");
+
+    // modifying a returned PSD does not affect the template
+    dsss = WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(2412, 0.03, 20);
+    *dsss *= 0;
+    dsss = WifiSpectrumValueHelper::CreateDsssTxPowerSpectralDensity(2412, 0.03, 20);
+    NS_TEST_EXPECT_MSG_EQ(WifiSpectrumValueHelper::GetTxPsdTemplateHits(), 2, "Expected hits");
+    NS_TEST_EXPECT_MSG_EQ_TOL(Integral(*dsss),
+                              0.03,
+                              1e-6,
+                              "The template should not have been modified");
+
+    WifiSpectrumValueHelper::ClearTxPsdTemplates();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1320,4 +1428,6 @@ WifiTransmitMaskTestSuite::WifiTransmitMaskTestSuite()
                                        prec,
                                        {false, false, false, false, false, false, true, true}),
         TestCase::QUICK);
+
+    AddTestCase(new WifiTxPsdTemplateTestCase, TestCase::QUICK);
 }
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2023
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/recording-scheduler.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GCC < 8 only ships the std::experimental::filesystem header (see system-path.cc)
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#error "No support for filesystem library"
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/** Output field width for numeric data. */
+const int g_fwidth = 14;
+
+/**
+ * Counter of the cache misses of this process, if supported by the platform
+ * and allowed by the system (Linux perf events).
+ */
+class CacheMissCounter
+{
+  public:
+    CacheMissCounter();
+    ~CacheMissCounter();
+
+    /** Reset and start counting. */
+    void Start();
+    /**
+     * Stop counting.
+     * \returns The number of cache misses since Start(), or -1 if not available.
+     */
+    int64_t Stop();
+
+  private:
+    int m_fd; //!< The perf event file descriptor, negative if not available.
+};
+
+#ifdef __linux__
+
+CacheMissCounter::CacheMissCounter()
+{
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+CacheMissCounter::~CacheMissCounter()
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+    }
+}
+
+void
+CacheMissCounter::Start()
+{
+    if (m_fd >= 0)
+    {
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+int64_t
+CacheMissCounter::Stop()
+{
+    uint64_t count;
+    if (m_fd < 0 || ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0) != 0 ||
+        read(m_fd, &count, sizeof(count)) != sizeof(count))
+    {
+        return -1;
+    }
+    return static_cast<int64_t>(count);
+}
+
+#else
+
+CacheMissCounter::CacheMissCounter()
+    : m_fd(-1)
+{
+}
+
+CacheMissCounter::~CacheMissCounter()
+{
+}
+
+void
+CacheMissCounter::Start()
+{
+}
+
+int64_t
+CacheMissCounter::Stop()
+{
+    return -1;
+}
+
+#endif
+
+/** The results of the replay of a trace on a scheduler. */
+struct ReplayResult
+{
+    uint64_t inserts{0};     //!< Number of Insert() operations.
+    uint64_t removes{0};     //!< Number of RemoveNext() and Remove() operations.
+    uint64_t mismatches{0};  //!< Number of RemoveNext() returning another event than recorded.
+    double insertTime{0};    //!< Time (s) spent in Insert().
+    double removeTime{0};    //!< Time (s) spent in RemoveNext() and Remove().
+    int64_t cacheMisses{-1}; //!< Number of cache misses, -1 if not available.
+    int64_t peakRssKiB{-1};  //!< Peak resident set size (KiB), -1 if not available.
+};
+
+/**
+ * Replay a trace on a scheduler.
+ *
+ * The consecutive operations of the same kind (insertions or removals) are
+ * timed together, to keep the overhead of reading the clock low.
+ *
+ * \param [in] factory Factory pre-configured to create the desired Scheduler.
+ * \param [in] records The records of the trace.
+ * \returns The results.
+ */
+ReplayResult
+Replay(const ObjectFactory& factory, const std::vector<RecordingScheduler::Record>& records)
+{
+    using Clock = std::chrono::steady_clock;
+
+    ReplayResult result;
+    Ptr<Scheduler> scheduler = factory.Create<Scheduler>();
+    CacheMissCounter counter;
+
+    // The schedulers never dereference the event implementation, which is only
+    // used here to check that the events are removed in the recorded order.
+    auto getImpl = [](uint32_t uid) {
+        return reinterpret_cast<EventImpl*>(static_cast<uintptr_t>(uid) + 1);
+    };
+
+    counter.Start();
+    std::size_t i = 0;
+    while (i < records.size())
+    {
+        const bool insert = (records[i].operation == RecordingScheduler::INSERT);
+        const auto start = Clock::now();
+        for (; i < records.size() && (records[i].operation == RecordingScheduler::INSERT) == insert;
+             ++i)
+        {
+            const auto& record = records[i];
+            Scheduler::Event ev{getImpl(record.uid), {record.ts, record.uid, record.context}};
+            switch (record.operation)
+            {
+            case RecordingScheduler::INSERT:
+                scheduler->Insert(ev);
+                result.inserts++;
+                break;
+            case RecordingScheduler::REMOVE_NEXT:
+                if (scheduler->RemoveNext().impl != ev.impl)
+                {
+                    result.mismatches++;
+                }
+                result.removes++;
+                break;
+            case RecordingScheduler::REMOVE:
+                scheduler->Remove(ev);
+                result.removes++;
+                break;
+            case RecordingScheduler::KIND:
+                // the definitions of the event kinds are not returned as records
+                NS_ABORT_MSG("Unexpected event kind definition");
+            }
+        }
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+        (insert ? result.insertTime : result.removeTime) += elapsed.count();
+    }
+    result.cacheMisses = counter.Stop();
+
+#ifdef __linux__
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        result.peakRssKiB = usage.ru_maxrss;
+    }
+#endif
+    return result;
+}
+
+/**
+ * Event of the hold model: reschedule itself after a random delay, until
+ * the requested number of events have been run.
+ *
+ * \param [in] delay The random delay.
+ * \param [in] remaining The number of events left to schedule.
+ */
+void
+Hold(Ptr<RandomVariableStream> delay, uint64_t* remaining)
+{
+    if (*remaining > 0)
+    {
+        (*remaining)--;
+        Simulator::Schedule(NanoSeconds(delay->GetInteger()), &Hold, delay, remaining);
+    }
+}
+
+/**
+ * Record the trace of a hold model simulation: a constant population of
+ * events, each one scheduling another one after a random delay.
+ *
+ * \param [in] filename The trace file.
+ * \param [in] population The number of pending events.
+ * \param [in] total The total number of events.
+ */
+void
+RecordHoldModel(const std::string& filename, uint64_t population, uint64_t total)
+{
+    ObjectFactory factory;
+    factory.SetTypeId(RecordingScheduler::GetTypeId());
+    factory.Set("FileName", StringValue(filename));
+    Simulator::SetScheduler(factory);
+
+    Ptr<RandomVariableStream> delay = CreateObject<UniformRandomVariable>();
+    delay->SetAttribute("Max", DoubleValue(1e6));
+    uint64_t remaining = total > population ? total - population : 0;
+    for (uint64_t i = 0; i < population; ++i)
+    {
+        Simulator::Schedule(NanoSeconds(delay->GetInteger()), &Hold, delay, &remaining);
+    }
+    Simulator::Run();
+    // the trace file is closed when the scheduler is destroyed
+    Simulator::Destroy();
+}
+
+/**
+ * Format a value which may not be available.
+ *
+ * \param [in] value The value.
+ * \returns The value, or "n/a" if negative.
+ */
+std::string
+Available(int64_t value)
+{
+    return value < 0 ? "n/a" : std::to_string(value);
+}
+
+/**
+ * Log the results of a replay.
+ *
+ * \param [in] name The name of the scheduler.
+ * \param [in] result The results.
+ */
+void
+LogResult(const std::string& name, const ReplayResult& result)
+{
+    LOG(std::left << std::setw(2 * g_fwidth) << name << std::setw(g_fwidth)
+                  << result.inserts / result.insertTime << std::setw(g_fwidth)
+                  << result.removes / result.removeTime << std::setw(g_fwidth)
+                  << result.insertTime + result.removeTime << std::setw(g_fwidth)
+                  << Available(result.cacheMisses) << std::setw(g_fwidth)
+                  << Available(result.peakRssKiB) << result.mismatches);
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string trace;
+    std::string schedulers = "ns3::CalendarScheduler,ns3::HeapScheduler,ns3::ListScheduler,"
+                             "ns3::MapScheduler,ns3::PriorityQueueScheduler,"
+                             "ns3::TimingWheelScheduler";
+    bool isolate = true;
+    uint64_t population = 10000;
+    uint64_t total = 100000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Replay a scheduler trace on several schedulers.\n"
+              "\n"
+              "The trace is recorded by running a simulation with the\n"
+              "ns3::RecordingScheduler, e.g., with the arguments\n"
+              "  --SchedulerType=ns3::RecordingScheduler\n"
+              "  --ns3::RecordingScheduler::FileName=<trace>\n"
+              "\n"
+              "Without a trace file, the trace of a hold model simulation is\n"
+              "recorded and replayed.\n"
+              "\n"
+              "The operations recorded are replayed on each scheduler, which\n"
+              "reports the insertion and removal rates, the number of cache misses\n"
+              "(if the platform allows reading the hardware counters) and the\n"
+              "peak resident set size.");
+    cmd.AddValue("trace", "the scheduler trace file", trace);
+    cmd.AddValue("pop", "event population size of the hold model", population);
+    cmd.AddValue("total", "total number of events of the hold model", total);
+    cmd.AddValue("schedulers", "comma separated list of the schedulers to replay", schedulers);
+    cmd.AddValue("isolate",
+                 "replay each scheduler in a separate process, so that the peak "
+                 "resident set size only accounts for one scheduler (Linux only)",
+                 isolate);
+    cmd.Parse(argc, argv);
+
+    // the directory of the hold model trace, removed at the end of the benchmark
+    std::string directory;
+    if (trace.empty())
+    {
+        directory = SystemPath::MakeTemporaryDirectoryName();
+        SystemPath::MakeDirectories(directory);
+        trace = SystemPath::Append(directory, "hold-model.evtrace");
+        LOG("Recording a hold model trace with " << population << " pending events and " << total
+                                                 << " events");
+        RecordHoldModel(trace, population, total);
+    }
+
+    std::vector<std::string> kinds;
+    auto records = RecordingScheduler::ReadTrace(trace, &kinds);
+    LOG("Replaying " << records.size() << " operations on events of " << kinds.size()
+                     << " kinds from " << trace);
+    LOG("");
+    LOG(std::left << std::setw(2 * g_fwidth) << "Scheduler" << std::setw(g_fwidth) << "Insert/s"
+                  << std::setw(g_fwidth) << "Remove/s" << std::setw(g_fwidth) << "Total (s)"
+                  << std::setw(g_fwidth) << "Cache misses" << std::setw(g_fwidth)
+                  << "RSS (KiB)"
+                  << "Mismatches");
+
+    std::istringstream names(schedulers);
+    std::string name;
+    while (std::getline(names, name, ','))
+    {
+        ObjectFactory factory(name);
+#ifdef __linux__
+        if (isolate)
+        {
+            std::cout.flush();
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid < 0, "Cannot fork to replay " << name);
+            if (pid == 0)
+            {
+                LogResult(name, Replay(factory, records));
+                std::cout.flush();
+                _exit(0);
+            }
+            waitpid(pid, nullptr, 0);
+            continue;
+        }
+#endif
+        LogResult(name, Replay(factory, records));
+    }
+
+    if (!directory.empty())
+    {
+        fs::remove_all(directory);
+    }
+    return 0;
+}
@@ -460,12 +460,15 @@ main(int argc, char* argv[])
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
+    bool schedWheel = false;
 
     uint64_t pop = 100000;
     uint64_t total = 1000000;
     uint64_t runs = 1;
     std::string filename = "";
     bool calRev = false;
+    uint32_t wheelBuckets = 4096;
+    Time wheelWidth = MicroSeconds(5);
 
     CommandLine cmd(__FILE__);
     cmd.Usage("Benchmark the simulator scheduler.\n"
@@ -485,6 +488,9 @@ main(int argc, char* argv[])
     cmd.AddValue("list", "use ListSheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
+    cmd.AddValue("wheel", "use TimingWheelScheduler", schedWheel);
+    cmd.AddValue("buckets", "number of buckets of the TimingWheelScheduler", wheelBuckets);
+    cmd.AddValue("width", "bucket width of the TimingWheelScheduler", wheelWidth);
     cmd.AddValue("debug", "enable debugging output", g_debug);
     cmd.AddValue("pop", "event population size", pop);
     cmd.AddValue("total", "total number of events to run", total);
@@ -505,10 +511,10 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedHeap = schedList = schedMap = schedPQ = schedWheel = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ || schedWheel))
     {
         schedMap = true;
     }
@@ -553,6 +559,13 @@ main(int argc, char* argv[])
         factory.SetTypeId("ns3::PriorityQueueScheduler");
         BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
     }
+    if (schedWheel)
+    {
+        factory.SetTypeId("ns3::TimingWheelScheduler");
+        factory.Set("Buckets", UintegerValue(wheelBuckets));
+        factory.Set("BucketWidth", TimeValue(wheelWidth));
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
 
     return 0;
 }